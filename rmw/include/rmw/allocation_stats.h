@@ -0,0 +1,212 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__ALLOCATION_STATS_H_
+#define RMW__ALLOCATION_STATS_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/visibility_control.h"
+
+/// Parts of librmw whose allocations are accounted separately.
+typedef enum RMW_PUBLIC_TYPE rmw_allocation_domain_e
+{
+  /// rmw_allocate() and rmw_free(), including handle structs when handle pools are disabled
+  RMW_ALLOCATION_DOMAIN_DEFAULT_ALLOCATOR = 0,
+  /// Message and message info sequences, see rmw/message_sequence.h
+  RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE,
+  /// Arrays of names and types, see rmw/names_and_types.h
+  RMW_ALLOCATION_DOMAIN_NAMES_AND_TYPES,
+  /// Topic endpoint info and their arrays, see rmw/topic_endpoint_info.h
+  RMW_ALLOCATION_DOMAIN_TOPIC_ENDPOINT_INFO,
+  /// Subscription content filter options, see rmw/subscription_content_filter_options.h
+  RMW_ALLOCATION_DOMAIN_CONTENT_FILTER_OPTIONS,
+  /// Allocators wrapped with rmw_counting_allocator_init()
+  RMW_ALLOCATION_DOMAIN_COUNTING_ALLOCATOR,
+  /// QoS profile intern tables, see rmw/qos_profile_intern_table.h
+  RMW_ALLOCATION_DOMAIN_QOS_PROFILE_INTERN_TABLE,
+  /// Chained, shared and pooled serialized messages, see rmw/serialized_message.h
+  RMW_ALLOCATION_DOMAIN_SERIALIZED_MESSAGE,
+  /// Number of allocation domains, this is not a valid domain
+  RMW_ALLOCATION_DOMAIN_COUNT
+} rmw_allocation_domain_t;
+
+/// Allocation statistics of an allocation domain.
+/**
+ * Only memory allocated by librmw itself is accounted, e.g. strings that rmw
+ * implementations put into an array of names and types are not, although the
+ * array is.
+ * A reallocation of existing memory counts as both a deallocation and an allocation.
+ * Nothing is accounted if librmw was built without `RMW_ENABLE_ALLOCATION_TRACKING`,
+ * see rmw/impl/config.h.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_allocation_stats_s
+{
+  /// Number of successful allocations.
+  uint64_t allocations;
+  /// Number of deallocations.
+  uint64_t deallocations;
+  /// Number of bytes requested by successful allocations.
+  uint64_t bytes;
+} rmw_allocation_stats_t;
+
+/// Get the allocation statistics of an allocation domain.
+/**
+ * Statistics are accumulated since the process started, or since
+ * rmw_reset_allocation_stats() was last called.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] domain domain to get statistics for.
+ * \param[out] stats the allocation statistics.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `domain` is not valid, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `stats` is NULL.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_get_allocation_stats(rmw_allocation_domain_t domain, rmw_allocation_stats_t * stats);
+
+/// Reset the allocation statistics of all allocation domains to zero.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ */
+RMW_PUBLIC
+void
+rmw_reset_allocation_stats(void);
+
+/// Function called on every allocation while the allocation trap is armed.
+/**
+ * \param[in] domain domain of the allocation.
+ * \param[in] size number of bytes allocated.
+ * \param[in] data the data given to rmw_allocation_trap_arm().
+ */
+typedef void (* rmw_allocation_trap_handler_t)(
+  rmw_allocation_domain_t domain, size_t size, void * data);
+
+/// Arm the allocation trap, which fires on every accounted allocation from now on.
+/**
+ * This is meant to be called once initialization is over, e.g. after all
+ * nodes, publishers and subscriptions were created, so that any allocation
+ * on the publish or take path is flagged.
+ * Allocations made through an allocator wrapped with rmw_counting_allocator_init()
+ * are flagged as well, which allows catching allocations outside librmw, e.g.
+ * in rmw implementations, by handing them such an allocator.
+ *
+ * The trap fires after the allocation succeeded, on the allocating thread.
+ * If `handler` is NULL, the default handler prints the offending domain to
+ * stderr and aborts the process.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | No
+ *
+ * \param[in] handler function to be called on allocations, or NULL to abort.
+ * \param[in] data opaque data passed to `handler`.
+ */
+RMW_PUBLIC
+void
+rmw_allocation_trap_arm(rmw_allocation_trap_handler_t handler, void * data);
+
+/// Disarm the allocation trap, calling this function when it is not armed is a no-op.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | No
+ */
+RMW_PUBLIC
+void
+rmw_allocation_trap_disarm(void);
+
+/// Check whether the allocation trap is armed.
+RMW_PUBLIC
+bool
+rmw_allocation_trap_is_armed(void);
+
+/// Allocator accounting for all the allocations it forwards to another allocator.
+/**
+ * Allocations are accounted in `RMW_ALLOCATION_DOMAIN_COUNTING_ALLOCATOR`,
+ * and fire the allocation trap when it is armed.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_counting_allocator_s
+{
+  /// Allocator serving the memory.
+  rcutils_allocator_t wrapped;
+  /// Allocator to be used in place of `wrapped`.
+  rcutils_allocator_t allocator;
+} rmw_counting_allocator_t;
+
+/// Initialize a counting allocator wrapping another allocator.
+/**
+ * `counting_allocator->allocator` refers to `counting_allocator`, which must
+ * therefore outlive any use of it.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[out] counting_allocator counting allocator to be initialized.
+ * \param[in] wrapped allocator serving the memory, it is copied.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `counting_allocator` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `wrapped` is invalid.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_counting_allocator_init(
+  rmw_counting_allocator_t * counting_allocator,
+  const rcutils_allocator_t * wrapped);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RMW__ALLOCATION_STATS_H_
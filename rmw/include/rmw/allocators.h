@@ -20,10 +20,130 @@ extern "C"
 {
 #endif
 
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
 #include "rmw/types.h"
 #include "rmw/visibility_control.h"
 
-/// Allocate memory of size in bytes using rcutils default allocator's allocate()
+/// Kinds of rmw handle structs which are allocated by the functions in this header.
+typedef enum RMW_PUBLIC_TYPE rmw_handle_type_e
+{
+  /// `rmw_node_t`, see rmw_node_allocate()
+  RMW_HANDLE_TYPE_NODE = 0,
+  /// `rmw_publisher_t`, see rmw_publisher_allocate()
+  RMW_HANDLE_TYPE_PUBLISHER,
+  /// `rmw_subscription_t`, see rmw_subscription_allocate()
+  RMW_HANDLE_TYPE_SUBSCRIPTION,
+  /// `rmw_guard_condition_t`, see rmw_guard_condition_allocate()
+  RMW_HANDLE_TYPE_GUARD_CONDITION,
+  /// `rmw_client_t`, see rmw_client_allocate()
+  RMW_HANDLE_TYPE_CLIENT,
+  /// `rmw_service_t`, see rmw_service_allocate()
+  RMW_HANDLE_TYPE_SERVICE,
+  /// `rmw_wait_set_t`, see rmw_wait_set_allocate()
+  RMW_HANDLE_TYPE_WAIT_SET,
+  /// Number of handle types, this is not a valid handle type
+  RMW_HANDLE_TYPE_COUNT
+} rmw_handle_type_t;
+
+/// Usage statistics of the handles of a given type.
+typedef struct RMW_PUBLIC_TYPE rmw_handle_statistics_s
+{
+  /// Number of handles currently allocated.
+  size_t live;
+  /// Highest number of handles allocated at the same time.
+  size_t peak;
+  /// Number of handles which fit in the slabs reserved so far, zero if pools are disabled.
+  size_t capacity;
+  /// Number of slabs reserved so far, zero if pools are disabled.
+  size_t slab_count;
+} rmw_handle_statistics_t;
+
+/// Set the allocator used by rmw_allocate() and rmw_free().
+/**
+ * Until this function is called, the rcutils default allocator is used, or
+ * rmw_get_static_allocator() if `RMW_AVOID_MEMORY_ALLOCATION` is enabled.
+ * It can only be called once, and it must be called before any memory is
+ * allocated through rmw_allocate(), i.e. before `rmw_init()`, so that all
+ * the memory is given back to the allocator it came from.
+ *
+ * This is the hook to route all rmw level allocations, including handle
+ * structs when handle pools are disabled, into e.g. a real-time arena.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] allocator allocator to be used, it is copied.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `allocator` is invalid, or
+ * \return `RMW_RET_ERROR` if the default allocator was already set.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_set_default_allocator(const rcutils_allocator_t * allocator);
+
+/// Get the allocator used by rmw_allocate() and rmw_free().
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \return the allocator set with rmw_set_default_allocator(), or
+ * \return the rcutils default allocator if none was set, or
+ * \return rmw_get_static_allocator() if none was set and `RMW_AVOID_MEMORY_ALLOCATION`
+ *   is enabled.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rcutils_allocator_t
+rmw_get_default_allocator(void);
+
+/// Get an allocator serving memory out of fixed size blocks of static storage.
+/**
+ * Requests are served from the smallest block class that fits them, either
+ * `RMW_STATIC_SMALL_BLOCK_COUNT` blocks of `RMW_STATIC_SMALL_BLOCK_SIZE` bytes
+ * or `RMW_STATIC_LARGE_BLOCK_COUNT` blocks of `RMW_STATIC_LARGE_BLOCK_SIZE`
+ * bytes, see rmw/impl/config.h.
+ * Requests larger than a large block, or made while the fitting classes are
+ * exhausted, fail as if the heap was out of memory.
+ * Deallocating or reallocating memory that was not allocated by it is a no-op
+ * and fails, respectively.
+ *
+ * Its storage is only reserved if `RMW_AVOID_MEMORY_ALLOCATION` is enabled,
+ * in which case it is the allocator used by librmw.
+ * Otherwise, it is still valid but every request fails.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | No
+ *
+ * \return the static allocator, whose functions are thread-safe but not lock-free.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rcutils_allocator_t
+rmw_get_static_allocator(void);
+
+/// Allocate memory of size in bytes using rmw_get_default_allocator()'s allocate()
 /**
  * \param[in] size The number of bytes to allocate
  * \return pointer to allocated memory
@@ -32,7 +152,7 @@ RMW_PUBLIC
 void *
 rmw_allocate(size_t size);
 
-/// Free memory using rcutils default allocator's deallocate()
+/// Free memory using rmw_get_default_allocator()'s deallocate()
 /**
  * \param[in] pointer pointer to allocated memory
  */
@@ -40,7 +160,8 @@ RMW_PUBLIC
 void
 rmw_free(void * pointer);
 
-/// Allocate memory for an `rmw_node_t` using rcutils default allocator's allocate()
+/// Allocate memory for an `rmw_node_t` using rmw default allocator's allocate(), or
+/// from its slab pool if rmw_handle_pools_init() was called
 /**
  * \return pointer to allocated memory
  */
@@ -48,7 +169,8 @@ RMW_PUBLIC
 rmw_node_t *
 rmw_node_allocate(void);
 
-/// Free memory allocated to this node pointer using rcutils default allocator's deallocate()
+/// Free memory allocated to this node pointer using rmw default allocator's deallocate(),
+/// or back into its slab pool if rmw_handle_pools_init() was called
 /**
  * \param[in] node pointer to allocated memory
  */
@@ -56,7 +178,8 @@ RMW_PUBLIC
 void
 rmw_node_free(rmw_node_t * node);
 
-/// Allocate memory for an `rmw_publisher_t` using rcutils default allocator's allocate()
+/// Allocate memory for an `rmw_publisher_t` using rmw default allocator's allocate(), or
+/// from its slab pool if rmw_handle_pools_init() was called
 /**
  * \return pointer to allocated memory
  */
@@ -64,7 +187,8 @@ RMW_PUBLIC
 rmw_publisher_t *
 rmw_publisher_allocate(void);
 
-/// Free memory using rcutils default allocator's deallocate()
+/// Free memory using rmw default allocator's deallocate(),
+/// or back into its slab pool if rmw_handle_pools_init() was called
 /**
  * \param[in] publisher pointer to allocated memory
  */
@@ -72,7 +196,8 @@ RMW_PUBLIC
 void
 rmw_publisher_free(rmw_publisher_t * publisher);
 
-/// Allocate memory for an `rmw_subscription_t` using rcutils default allocator's allocate()
+/// Allocate memory for an `rmw_subscription_t` using rmw default allocator's allocate(), or
+/// from its slab pool if rmw_handle_pools_init() was called
 /**
  * \return pointer to allocated memory
  */
@@ -80,7 +205,8 @@ RMW_PUBLIC
 rmw_subscription_t *
 rmw_subscription_allocate(void);
 
-/// Free memory using rcutils default allocator's deallocate()
+/// Free memory using rmw default allocator's deallocate(),
+/// or back into its slab pool if rmw_handle_pools_init() was called
 /**
  * \param[in] subscription pointer to allocated memory
  */
@@ -88,7 +214,8 @@ RMW_PUBLIC
 void
 rmw_subscription_free(rmw_subscription_t * subscription);
 
-/// Allocate memory for an `rmw_guard_condition_t` using rcutils default allocator's allocate()
+/// Allocate memory for an `rmw_guard_condition_t` using rmw default allocator's allocate(), or
+/// from its slab pool if rmw_handle_pools_init() was called
 /**
  * \return pointer to allocated memory
  */
@@ -96,7 +223,8 @@ RMW_PUBLIC
 rmw_guard_condition_t *
 rmw_guard_condition_allocate(void);
 
-/// Free memory using rcutils default allocator's deallocate()
+/// Free memory using rmw default allocator's deallocate(),
+/// or back into its slab pool if rmw_handle_pools_init() was called
 /**
  * \param[in] guard_condition pointer to allocated memory
  */
@@ -104,7 +232,8 @@ RMW_PUBLIC
 void
 rmw_guard_condition_free(rmw_guard_condition_t * guard_condition);
 
-/// Allocate memory for an `rmw_client_t` using rcutils default allocator's allocate()
+/// Allocate memory for an `rmw_client_t` using rmw default allocator's allocate(), or
+/// from its slab pool if rmw_handle_pools_init() was called
 /**
  * \return pointer to allocated memory
  */
@@ -112,7 +241,8 @@ RMW_PUBLIC
 rmw_client_t *
 rmw_client_allocate(void);
 
-/// Free memory using rcutils default allocator's deallocate()
+/// Free memory using rmw default allocator's deallocate(),
+/// or back into its slab pool if rmw_handle_pools_init() was called
 /**
  * \param[in] client pointer to allocated memory
  */
@@ -120,7 +250,8 @@ RMW_PUBLIC
 void
 rmw_client_free(rmw_client_t * client);
 
-/// Allocate memory for an `rmw_service_t` using rcutils default allocator's allocate()
+/// Allocate memory for an `rmw_service_t` using rmw default allocator's allocate(), or
+/// from its slab pool if rmw_handle_pools_init() was called
 /**
  * \return pointer to allocated memory
  */
@@ -128,7 +259,8 @@ RMW_PUBLIC
 rmw_service_t *
 rmw_service_allocate(void);
 
-/// Free memory using rcutils default allocator's deallocate()
+/// Free memory using rmw default allocator's deallocate(),
+/// or back into its slab pool if rmw_handle_pools_init() was called
 /**
  * \param[in] service pointer to allocated memory
  */
@@ -136,7 +268,8 @@ RMW_PUBLIC
 void
 rmw_service_free(rmw_service_t * service);
 
-/// Allocate memory for an `rmw_wait_set_t` using rcutils default allocator's allocate()
+/// Allocate memory for an `rmw_wait_set_t` using rmw default allocator's allocate(), or
+/// from its slab pool if rmw_handle_pools_init() was called
 /**
  * \return pointer to allocated memory
  */
@@ -144,7 +277,8 @@ RMW_PUBLIC
 rmw_wait_set_t *
 rmw_wait_set_allocate(void);
 
-/// Free memory using rcutils default allocator's deallocate()
+/// Free memory using rmw default allocator's deallocate(),
+/// or back into its slab pool if rmw_handle_pools_init() was called
 /**
  * \param[in] wait_set pointer to allocated memory
  */
@@ -152,6 +286,96 @@ RMW_PUBLIC
 void
 rmw_wait_set_free(rmw_wait_set_t * wait_set);
 
+/// Serve rmw handle structs from per type slab pools instead of the heap.
+/**
+ * Once enabled, each of the `rmw_*_allocate()` functions in this header hands
+ * out zero initialized structs from a pool dedicated to its handle type, and
+ * the matching `rmw_*_free()` function gives them back to the pool.
+ * Both operations are O(1) and only reach `allocator` when a pool runs dry,
+ * in which case a slab of `handles_per_slab` structs is reserved at once.
+ * Slabs are held until rmw_handle_pools_fini() is called.
+ *
+ * Pools can only be enabled while no handle is live, e.g. before `rmw_init()`,
+ * so that every handle is freed the same way it was allocated.
+ * For the same reason, handles must be released with the `rmw_*_free()`
+ * function that matches the `rmw_*_allocate()` function they come from.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] handles_per_slab number of handles reserved at once when a pool runs dry.
+ * \param[in] allocator allocator used to reserve slabs, it is copied.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `handles_per_slab` is zero, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `allocator` is invalid, or
+ * \return `RMW_RET_ERROR` if pools are already enabled, or
+ * \return `RMW_RET_ERROR` if any handle is live, or
+ * \return `RMW_RET_UNSUPPORTED` if `RMW_AVOID_MEMORY_ALLOCATION` is enabled, as
+ *   handles are then always served from static pools.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_handle_pools_init(size_t handles_per_slab, const rcutils_allocator_t * allocator);
+
+/// Stop serving rmw handle structs from slab pools, releasing all the slabs.
+/**
+ * Calling this function when pools are not enabled is a no-op.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_ERROR` if any handle is live, or
+ * \return `RMW_RET_UNSUPPORTED` if `RMW_AVOID_MEMORY_ALLOCATION` is enabled.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_handle_pools_fini(void);
+
+/// Check whether rmw handle structs are served from slab pools.
+/**
+ * This is always the case if `RMW_AVOID_MEMORY_ALLOCATION` is enabled.
+ */
+RMW_PUBLIC
+bool
+rmw_handle_pools_are_enabled(void);
+
+/// Get usage statistics of the handles of a given type.
+/**
+ * Statistics are kept whether pools are enabled or not, with the exception
+ * of slab related ones.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | No
+ *
+ * \param[in] type handle type to get statistics for.
+ * \param[out] statistics the usage statistics.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `type` is not a valid handle type, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `statistics` is NULL.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_get_handle_statistics(rmw_handle_type_t type, rmw_handle_statistics_t * statistics);
+
 #ifdef __cplusplus
 }
 #endif
@@ -15,10 +15,97 @@
 #ifndef RMW__IMPL__CONFIG_H_
 #define RMW__IMPL__CONFIG_H_
 
+/// Whether librmw must not use the heap, defaults to off.
+/**
+ * When enabled, e.g. by configuring rmw with `-DRMW_AVOID_MEMORY_ALLOCATION=ON`:
+ *
+ * - handles returned by rmw_node_allocate() and friends are served out of
+ *   static pools, sized by the RMW_STATIC_MAX_* limits below;
+ * - rmw_allocate() and rmw_free() use rmw_get_static_allocator(), unless
+ *   another allocator was set with rmw_set_default_allocator();
+ * - message sequences are capped at `RMW_STATIC_MAX_SEQUENCE_LENGTH`.
+ *
+ * Utilities taking an allocator, e.g. message sequences, names and types or
+ * topic endpoint info, always use the allocator they are given, since callers
+ * may free their memory with it: they must be given rmw_get_static_allocator()
+ * to stay off the heap.
+ *
+ * Exhausting any of these pools is reported the same way as a failed
+ * allocation, so the worst case memory usage is known at compile time.
+ */
 #ifndef RMW_AVOID_MEMORY_ALLOCATION
-// Default to off.
-// TODO(wjwwood): document these configuration flags.
 #define RMW_AVOID_MEMORY_ALLOCATION 0
 #endif
 
+/// Maximum number of live nodes, if RMW_AVOID_MEMORY_ALLOCATION is enabled.
+#ifndef RMW_STATIC_MAX_NODES
+#define RMW_STATIC_MAX_NODES 16
+#endif
+
+/// Maximum number of live publishers, if RMW_AVOID_MEMORY_ALLOCATION is enabled.
+#ifndef RMW_STATIC_MAX_PUBLISHERS
+#define RMW_STATIC_MAX_PUBLISHERS 64
+#endif
+
+/// Maximum number of live subscriptions, if RMW_AVOID_MEMORY_ALLOCATION is enabled.
+#ifndef RMW_STATIC_MAX_SUBSCRIPTIONS
+#define RMW_STATIC_MAX_SUBSCRIPTIONS 64
+#endif
+
+/// Maximum number of live guard conditions, if RMW_AVOID_MEMORY_ALLOCATION is enabled.
+#ifndef RMW_STATIC_MAX_GUARD_CONDITIONS
+#define RMW_STATIC_MAX_GUARD_CONDITIONS 64
+#endif
+
+/// Maximum number of live clients, if RMW_AVOID_MEMORY_ALLOCATION is enabled.
+#ifndef RMW_STATIC_MAX_CLIENTS
+#define RMW_STATIC_MAX_CLIENTS 32
+#endif
+
+/// Maximum number of live services, if RMW_AVOID_MEMORY_ALLOCATION is enabled.
+#ifndef RMW_STATIC_MAX_SERVICES
+#define RMW_STATIC_MAX_SERVICES 32
+#endif
+
+/// Maximum number of live wait sets, if RMW_AVOID_MEMORY_ALLOCATION is enabled.
+#ifndef RMW_STATIC_MAX_WAIT_SETS
+#define RMW_STATIC_MAX_WAIT_SETS 16
+#endif
+
+/// Maximum capacity of message (info) sequences, if RMW_AVOID_MEMORY_ALLOCATION is enabled.
+#ifndef RMW_STATIC_MAX_SEQUENCE_LENGTH
+#define RMW_STATIC_MAX_SEQUENCE_LENGTH 64
+#endif
+
+/// Size in bytes of the small blocks of rmw_get_static_allocator(), enough for any name.
+#ifndef RMW_STATIC_SMALL_BLOCK_SIZE
+#define RMW_STATIC_SMALL_BLOCK_SIZE 256
+#endif
+
+/// Number of small blocks of rmw_get_static_allocator().
+#ifndef RMW_STATIC_SMALL_BLOCK_COUNT
+#define RMW_STATIC_SMALL_BLOCK_COUNT 512
+#endif
+
+/// Size in bytes of the large blocks of rmw_get_static_allocator(), used for arrays.
+#ifndef RMW_STATIC_LARGE_BLOCK_SIZE
+#define RMW_STATIC_LARGE_BLOCK_SIZE 8192
+#endif
+
+/// Number of large blocks of rmw_get_static_allocator().
+#ifndef RMW_STATIC_LARGE_BLOCK_COUNT
+#define RMW_STATIC_LARGE_BLOCK_COUNT 32
+#endif
+
+/// Whether librmw accounts its allocations, see rmw/allocation_stats.h, defaults to on.
+/**
+ * Accounting costs a few atomic increments on every allocation and deallocation,
+ * e.g. in rmw_allocate() and rmw_free().
+ * When disabled, e.g. by configuring rmw with `-DRMW_ENABLE_ALLOCATION_TRACKING=OFF`,
+ * allocation statistics stay at zero and the allocation trap never fires.
+ */
+#ifndef RMW_ENABLE_ALLOCATION_TRACKING
+#define RMW_ENABLE_ALLOCATION_TRACKING 1
+#endif
+
 #endif  // RMW__IMPL__CONFIG_H_
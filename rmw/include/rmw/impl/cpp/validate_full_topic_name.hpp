@@ -0,0 +1,128 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__IMPL__CPP__VALIDATE_FULL_TOPIC_NAME_HPP_
+#define RMW__IMPL__CPP__VALIDATE_FULL_TOPIC_NAME_HPP_
+
+#include <cstddef>
+
+#include "rmw/validate_full_topic_name.h"
+
+namespace rmw
+{
+namespace impl
+{
+namespace cpp
+{
+
+/// Result of the validation of a fully qualified topic name.
+struct full_topic_name_validation
+{
+  /// One of the `RMW_TOPIC_*` validation results of rmw_validate_full_topic_name().
+  int validation_result;
+  /// Index of the error in the topic name if it is invalid, zero otherwise.
+  std::size_t invalid_index;
+
+  /// Return true if the topic name is valid.
+  constexpr bool
+  is_valid() const
+  {
+    return RMW_TOPIC_VALID == validation_result;
+  }
+};
+
+/// Determine if a given fully qualified topic name is valid, at compile time if possible.
+/**
+ * This applies the exact same rules, in the same order, as
+ * rmw_validate_full_topic_name_with_size(), and yields the same validation
+ * result and invalid index, so that topic names known at compile time need
+ * not be validated again at runtime.
+ *
+ * \param[in] topic_name topic name to be validated, not necessarily null-terminated.
+ * \param[in] topic_name_length length of `topic_name`.
+ * \return the validation result.
+ */
+constexpr full_topic_name_validation
+validate_full_topic_name(const char * topic_name, std::size_t topic_name_length)
+{
+  if (topic_name_length == 0) {
+    return {RMW_TOPIC_INVALID_IS_EMPTY_STRING, 0};
+  }
+  if (topic_name[0] != '/') {
+    return {RMW_TOPIC_INVALID_NOT_ABSOLUTE, 0};
+  }
+  // note topic_name_length is >= 1 at this point
+  if (topic_name[topic_name_length - 1] == '/') {
+    // catches both "/foo/" and "/"
+    return {RMW_TOPIC_INVALID_ENDS_WITH_FORWARD_SLASH, topic_name_length - 1};
+  }
+  // check for unallowed characters, without depending on the locale
+  for (std::size_t i = 0; i < topic_name_length; ++i) {
+    const char c = topic_name[i];
+    if (
+      !(c >= 'a' && c <= 'z') && !(c >= 'A' && c <= 'Z') && !(c >= '0' && c <= '9') &&
+      c != '_' && c != '/')
+    {
+      return {RMW_TOPIC_INVALID_CONTAINS_UNALLOWED_CHARACTERS, i};
+    }
+  }
+  // check for double '/' and tokens that start with a number
+  for (std::size_t i = 0; i + 1 < topic_name_length; ++i) {
+    if (topic_name[i] == '/') {
+      if (topic_name[i + 1] == '/') {
+        return {RMW_TOPIC_INVALID_CONTAINS_REPEATED_FORWARD_SLASH, i + 1};
+      }
+      if (topic_name[i + 1] >= '0' && topic_name[i + 1] <= '9') {
+        return {RMW_TOPIC_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER, i + 1};
+      }
+    }
+  }
+  // check if the topic name is too long last, since it might be a soft invalidation
+  if (topic_name_length > (RMW_TOPIC_MAX_NAME_LENGTH)) {
+    return {RMW_TOPIC_INVALID_TOO_LONG, (RMW_TOPIC_MAX_NAME_LENGTH) - 1};
+  }
+  return {RMW_TOPIC_VALID, 0};
+}
+
+/// Determine if a given fully qualified topic name is valid, at compile time if possible.
+/**
+ * The topic name ends at the first null character of the array, so that
+ * both string literals and larger buffers holding a shorter name can be
+ * validated, or at the end of the array if it holds none.
+ *
+ * \param[in] topic_name topic name to be validated.
+ * \return the validation result.
+ */
+template<std::size_t N>
+constexpr full_topic_name_validation
+validate_full_topic_name(const char (& topic_name)[N])
+{
+  std::size_t topic_name_length = 0;
+  while (topic_name_length < N && topic_name[topic_name_length] != '\0') {
+    ++topic_name_length;
+  }
+  return validate_full_topic_name(topic_name, topic_name_length);
+}
+
+}  // namespace cpp
+}  // namespace impl
+}  // namespace rmw
+
+/// Fail to compile unless the given string literal is a valid fully qualified topic name.
+#define RMW_STATIC_ASSERT_VALID_FULL_TOPIC_NAME(topic_name) \
+  static_assert( \
+    rmw::impl::cpp::validate_full_topic_name(topic_name).is_valid(), \
+    "invalid fully qualified topic name: " topic_name)
+
+#endif  // RMW__IMPL__CPP__VALIDATE_FULL_TOPIC_NAME_HPP_
@@ -0,0 +1,154 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__MAPPED_SERIALIZED_MESSAGE_H_
+#define RMW__MAPPED_SERIALIZED_MESSAGE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/serialized_message.h"
+#include "rmw/visibility_control.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Serialized message whose buffer lies in a memory mapped file or anonymous memory file.
+/**
+ * Large payloads (e.g. maps or lidar sweeps) can then be published straight
+ * from a file with rmw_publish_serialized_message(), or taken into a shared
+ * memory region with rmw_take_serialized_message(), without being copied to
+ * or from the heap.
+ *
+ * `serialized_message` can be passed wherever a serialized message is
+ * expected.
+ * Its allocator never allocates memory: resizing it succeeds as long as the
+ * new size fits in the mapping and the mapping is writable, and fails with
+ * `RMW_RET_BAD_ALLOC` otherwise.
+ * Finalizing it leaves the mapping alone, only
+ * rmw_mapped_serialized_message_fini() unmaps it.
+ *
+ * Memory mapping is only supported on POSIX systems, and anonymous memory
+ * files on Linux; functions return `RMW_RET_UNSUPPORTED` elsewhere.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_mapped_serialized_message_s
+{
+  /// Serialized message whose buffer lies in the mapping.
+  rmw_serialized_message_t serialized_message;
+  /// Start of the mapping, which precedes the buffer if it was mapped at an unaligned offset.
+  void * mapping;
+  /// Length of the mapping, in bytes.
+  size_t mapping_length;
+  /// Whether the mapping can be written to.
+  bool is_writable;
+  /// File descriptor owned by the message and closed on fini, or -1 if it owns none.
+  int file_descriptor;
+} rmw_mapped_serialized_message_t;
+
+/// Return a zero initialized mapped serialized message.
+RMW_PUBLIC
+rmw_mapped_serialized_message_t
+rmw_get_zero_initialized_mapped_serialized_message(void);
+
+/// Map a whole file, read only, as a serialized message.
+/**
+ * The file is not kept open, the mapping keeps its contents alive.
+ * The serialized message length and capacity are the file size.
+ *
+ * \param[inout] message zero initialized mapped serialized message.
+ * \param[in] file_path path of the file to map.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is NULL, or
+ * \return `RMW_RET_ERROR` if the file could not be opened or mapped, or
+ * \return `RMW_RET_UNSUPPORTED` if memory mapping is not supported.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_mapped_serialized_message_map_file(
+  rmw_mapped_serialized_message_t * message,
+  const char * file_path);
+
+/// Map part of a file descriptor as a serialized message.
+/**
+ * The file descriptor is borrowed: it is not closed on fini, and may be
+ * closed by the caller as soon as this function returns.
+ * Writable mappings are shared, i.e. what is written to the serialized message
+ * is written to the file.
+ * The serialized message length and capacity are `length`.
+ *
+ * \param[inout] message zero initialized mapped serialized message.
+ * \param[in] file_descriptor file descriptor of a file, or of an anonymous memory file.
+ * \param[in] offset offset in the file of the first byte of the serialized message,
+ *   which need not be aligned.
+ * \param[in] length number of bytes to map, must not be zero.
+ * \param[in] writable whether the mapping can be written to.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is invalid, or
+ * \return `RMW_RET_ERROR` if the file descriptor could not be mapped, or
+ * \return `RMW_RET_UNSUPPORTED` if memory mapping is not supported.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_mapped_serialized_message_map_file_descriptor(
+  rmw_mapped_serialized_message_t * message,
+  int file_descriptor,
+  size_t offset,
+  size_t length,
+  bool writable);
+
+/// Create a writable anonymous memory file and map it as an empty serialized message.
+/**
+ * The message owns the file descriptor of the memory file, which can be shared
+ * with another process to map the same memory.
+ *
+ * \param[inout] message zero initialized mapped serialized message.
+ * \param[in] capacity size of the memory file, must not be zero.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if the memory file could not be created or sized, or
+ * \return `RMW_RET_ERROR` if the memory file could not be mapped, or
+ * \return `RMW_RET_UNSUPPORTED` if anonymous memory files are not supported.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_mapped_serialized_message_create(
+  rmw_mapped_serialized_message_t * message,
+  size_t capacity);
+
+/// Unmap a mapped serialized message, closing its file descriptor if it owns one.
+/**
+ * Finalizing a zero initialized mapped serialized message is a no-op.
+ *
+ * \param[inout] message mapped serialized message to be finalized.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `message` is NULL, or
+ * \return `RMW_RET_ERROR` if the mapping could not be unmapped.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_mapped_serialized_message_fini(rmw_mapped_serialized_message_t * message);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RMW__MAPPED_SERIALIZED_MESSAGE_H_
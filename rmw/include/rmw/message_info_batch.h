@@ -0,0 +1,210 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__MESSAGE_INFO_BATCH_H_
+#define RMW__MESSAGE_INFO_BATCH_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/macros.h"
+#include "rmw/message_sequence.h"
+#include "rmw/ret_types.h"
+#include "rmw/time.h"
+#include "rmw/types.h"
+#include "rmw/visibility_control.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Structure of arrays holding the members of a batch of message infos.
+/**
+ * Each member of rmw_message_info_t is stored in its own array, all arrays sharing a single
+ * allocation, so that scanning one member across a batch, e.g. the timestamps when measuring
+ * latencies, only touches the memory of that member.
+ * The message info at index `i` of the batch is made of the `i`-th element of every array.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_message_info_batch_s
+{
+  /// Array of source timestamps, see rmw_message_info_t::source_timestamp.
+  rmw_time_point_value_t * source_timestamps;
+  /// Array of received timestamps, see rmw_message_info_t::received_timestamp.
+  rmw_time_point_value_t * received_timestamps;
+  /// Array of publication sequence numbers, see rmw_message_info_t::publication_sequence_number.
+  uint64_t * publication_sequence_numbers;
+  /// Array of reception sequence numbers, see rmw_message_info_t::reception_sequence_number.
+  uint64_t * reception_sequence_numbers;
+  /// Array of publisher GIDs, see rmw_message_info_t::publisher_gid.
+  rmw_gid_t * publisher_gids;
+  /// Array of intra-process flags, see rmw_message_info_t::from_intra_process.
+  bool * from_intra_process;
+  /// The number of valid entries in each array.
+  size_t size;
+  /// The total allocated capacity of each array.
+  size_t capacity;
+  /// The allocator used to allocate the arrays.
+  rcutils_allocator_t * allocator;
+} rmw_message_info_batch_t;
+
+/// Latency statistics of a batch of message infos, in nanoseconds.
+typedef struct RMW_PUBLIC_TYPE rmw_message_info_batch_latency_statistics_s
+{
+  /// Number of message infos with both timestamps set, over which statistics are computed.
+  size_t count;
+  /// Smallest latency, or zero if `count` is zero.
+  rmw_duration_t min;
+  /// Largest latency, or zero if `count` is zero.
+  rmw_duration_t max;
+  /// Mean latency, rounded towards zero, or zero if `count` is zero.
+  rmw_duration_t mean;
+} rmw_message_info_batch_latency_statistics_t;
+
+/// Gaps found in the sequence numbers of a batch of message infos.
+typedef struct RMW_PUBLIC_TYPE rmw_message_info_batch_sequence_gaps_s
+{
+  /// Number of places where messages of a publisher are missing from the batch.
+  size_t publication_gap_count;
+  /// Total number of messages of a publisher missing from the batch.
+  uint64_t publication_missing_count;
+  /// Number of places where messages received by the subscription are missing from the batch.
+  size_t reception_gap_count;
+  /// Total number of messages received by the subscription missing from the batch.
+  uint64_t reception_missing_count;
+} rmw_message_info_batch_sequence_gaps_t;
+
+/// Return an rmw_message_info_batch_t struct with members initialized to `NULL`
+RMW_PUBLIC
+rmw_message_info_batch_t
+rmw_get_zero_initialized_message_info_batch(void);
+
+/// Initialize an rmw_message_info_batch_t object.
+/**
+ * If `RMW_AVOID_MEMORY_ALLOCATION` is enabled, `capacity` must not exceed
+ * `RMW_STATIC_MAX_SEQUENCE_LENGTH`, and `allocator` must be rmw_get_static_allocator()
+ * for the batch to stay off the heap.
+ *
+ * \param[inout] batch batch object to be initialized.
+ * \param[in] capacity capacity of the batch to be allocated.
+ * \param[in] allocator the allocator used to allocate memory.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `batch` is NULL or `allocator` is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_info_batch_init(
+  rmw_message_info_batch_t * batch,
+  size_t capacity,
+  rcutils_allocator_t * allocator);
+
+/// Finalize an rmw_message_info_batch_t object.
+/**
+ * \param[inout] batch batch object to be finalized.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `batch` is NULL.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_info_batch_fini(rmw_message_info_batch_t * batch);
+
+/// Copy the message infos of a sequence into a batch, replacing its contents.
+/**
+ * \param[inout] batch initialized batch object to copy the message infos into.
+ * \param[in] sequence sequence of message infos to be copied.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if the capacity of `batch` is less than the size of
+ *   `sequence`.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_info_batch_from_sequence(
+  rmw_message_info_batch_t * batch,
+  const rmw_message_info_sequence_t * sequence);
+
+/// Copy the message infos of a batch into a sequence, replacing its contents.
+/**
+ * \param[in] batch batch of message infos to be copied.
+ * \param[inout] sequence initialized sequence object to copy the message infos into.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if the capacity of `sequence` is less than the size of
+ *   `batch`.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_info_batch_to_sequence(
+  const rmw_message_info_batch_t * batch,
+  rmw_message_info_sequence_t * sequence);
+
+/// Compute the latency statistics of a batch of message infos.
+/**
+ * The latency of a message is its received timestamp minus its source timestamp.
+ * Message infos with either timestamp set to zero, i.e. not provided by the rmw
+ * implementation, are ignored.
+ *
+ * Only the two timestamp arrays are read, in a single sequential pass.
+ *
+ * \param[in] batch batch of message infos.
+ * \param[out] statistics latency statistics of the batch.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is NULL.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_info_batch_get_latency_statistics(
+  const rmw_message_info_batch_t * batch,
+  rmw_message_info_batch_latency_statistics_t * statistics);
+
+/// Find gaps in the sequence numbers of a batch of message infos, in order of reception.
+/**
+ * A reception gap is found wherever the reception sequence number of a message info is more
+ * than the one of the previous message info plus one, i.e. messages received by the subscription
+ * were not taken into the batch, e.g. because they were dropped by its history.
+ *
+ * A publication gap is found wherever the publication sequence number of a message info is
+ * more than the one of the previous message info plus one, and both come from the same
+ * publisher, i.e. messages sent by that publisher did not make it into the batch.
+ * Messages of different publishers are not compared, so gaps in the messages of a publisher
+ * are only found between its consecutive message infos in the batch.
+ *
+ * Sequence numbers set to `RMW_MESSAGE_INFO_SEQUENCE_NUMBER_UNSUPPORTED` are ignored.
+ *
+ * \param[in] batch batch of message infos.
+ * \param[out] gaps gaps found in the batch.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is NULL.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_info_batch_find_sequence_gaps(
+  const rmw_message_info_batch_t * batch,
+  rmw_message_info_batch_sequence_gaps_t * gaps);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RMW__MESSAGE_INFO_BATCH_H_
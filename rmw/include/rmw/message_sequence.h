@@ -52,6 +52,33 @@ typedef struct RMW_PUBLIC_TYPE rmw_message_info_sequence_s
   rcutils_allocator_t * allocator;
 } rmw_message_info_sequence_t;
 
+/// A ROS message along with its message info.
+typedef struct RMW_PUBLIC_TYPE rmw_message_and_info_s
+{
+  /// Pointer to the ROS message.
+  void * message;
+  /// Info of the ROS message.
+  rmw_message_info_t message_info;
+} rmw_message_and_info_t;
+
+/// Structure to hold a sequence of ROS messages along with their message infos.
+/**
+ * Unlike an rmw_message_sequence_t and rmw_message_info_sequence_t pair, each message is
+ * stored next to its info, in a single array, so walking the messages of a batch along with
+ * their infos touches contiguous memory only.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_message_and_info_sequence_s
+{
+  /// Array of messages along with their infos.
+  rmw_message_and_info_t * data;
+  /// The number of valid entries in `data`.
+  size_t size;
+  /// The total allocated capacity of the data array.
+  size_t capacity;
+  /// The allocator used to allocate the data array.
+  rcutils_allocator_t * allocator;
+} rmw_message_and_info_sequence_t;
+
 /// Return an rmw_message_sequence_t struct with members initialized to `NULL`
 RMW_PUBLIC
 rmw_message_sequence_t
@@ -59,6 +86,10 @@ rmw_get_zero_initialized_message_sequence(void);
 
 /// Initialize an rmw_message_sequence_t object.
 /**
+ * If `RMW_AVOID_MEMORY_ALLOCATION` is enabled, `size` must not exceed
+ * `RMW_STATIC_MAX_SEQUENCE_LENGTH`, and `allocator` must be rmw_get_static_allocator()
+ * for the sequence to stay off the heap.
+ *
  * \param[inout] sequence sequence object to be initialized.
  * \param[in] size capacity of the sequence to be allocated.
  * \param[in] allocator the allcator used to allocate memory.
@@ -85,6 +116,47 @@ RMW_PUBLIC
 rmw_ret_t
 rmw_message_sequence_fini(rmw_message_sequence_t * sequence);
 
+/// Ensure an rmw_message_sequence_t object can hold at least `capacity` messages.
+/**
+ * The data array is grown with the `reallocate` function of the allocator of the sequence,
+ * keeping the `size` messages it holds.
+ * Capacity grows geometrically: the sequence at least doubles its capacity whenever it grows,
+ * so that growing it one message at a time takes amortized constant time.
+ * The capacity of the sequence is never reduced.
+ *
+ * If `RMW_AVOID_MEMORY_ALLOCATION` is enabled, `capacity` must not exceed
+ * `RMW_STATIC_MAX_SEQUENCE_LENGTH`, and growth stops at that limit.
+ *
+ * \param[inout] sequence initialized sequence object to be grown.
+ * \param[in] capacity minimum capacity of the sequence.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `sequence` is NULL or not initialized, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, in which case the sequence is
+ *   left unchanged.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_sequence_reserve(rmw_message_sequence_t * sequence, size_t capacity);
+
+/// Set the number of valid entries of an rmw_message_sequence_t object.
+/**
+ * The sequence is first grown as by rmw_message_sequence_reserve(), if needed.
+ * Entries beyond the previous size are set to `NULL`, while entries beyond the new size are
+ * left as they are: resizing never allocates nor deallocates messages.
+ *
+ * \param[inout] sequence initialized sequence object to be resized.
+ * \param[in] size new number of valid entries in the sequence.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `sequence` is NULL or not initialized, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, in which case the sequence is
+ *   left unchanged.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_sequence_resize(rmw_message_sequence_t * sequence, size_t size);
+
 /// Return an rmw_message_info_sequence_t struct with members initialized to `NULL`
 RMW_PUBLIC
 rmw_message_info_sequence_t
@@ -92,6 +164,10 @@ rmw_get_zero_initialized_message_info_sequence(void);
 
 /// Initialize an rmw_message_info_sequence_t object.
 /**
+ * If `RMW_AVOID_MEMORY_ALLOCATION` is enabled, `size` must not exceed
+ * `RMW_STATIC_MAX_SEQUENCE_LENGTH`, and `allocator` must be rmw_get_static_allocator()
+ * for the sequence to stay off the heap.
+ *
  * \param[inout] sequence sequence object to be initialized.
  * \param[in] size capacity of the sequence to be allocated.
  * \param[in] allocator the allcator used to allocate memory.
@@ -116,6 +192,138 @@ RMW_PUBLIC
 rmw_ret_t
 rmw_message_info_sequence_fini(rmw_message_info_sequence_t * sequence);
 
+/// Ensure an rmw_message_info_sequence_t object can hold at least `capacity` message infos.
+/**
+ * Growth follows the same rules as rmw_message_sequence_reserve().
+ *
+ * \param[inout] sequence initialized sequence object to be grown.
+ * \param[in] capacity minimum capacity of the sequence.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `sequence` is NULL or not initialized, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, in which case the sequence is
+ *   left unchanged.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_info_sequence_reserve(rmw_message_info_sequence_t * sequence, size_t capacity);
+
+/// Set the number of valid entries of an rmw_message_info_sequence_t object.
+/**
+ * The sequence is first grown as by rmw_message_info_sequence_reserve(), if needed.
+ * Entries beyond the previous size are zero initialized, see
+ * rmw_get_zero_initialized_message_info().
+ *
+ * \param[inout] sequence initialized sequence object to be resized.
+ * \param[in] size new number of valid entries in the sequence.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `sequence` is NULL or not initialized, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, in which case the sequence is
+ *   left unchanged.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_info_sequence_resize(rmw_message_info_sequence_t * sequence, size_t size);
+
+/// Return an rmw_message_and_info_sequence_t struct with members initialized to `NULL`
+RMW_PUBLIC
+rmw_message_and_info_sequence_t
+rmw_get_zero_initialized_message_and_info_sequence(void);
+
+/// Initialize an rmw_message_and_info_sequence_t object.
+/**
+ * Messages and their infos are stored in a single allocation.
+ *
+ * If `RMW_AVOID_MEMORY_ALLOCATION` is enabled, `size` must not exceed
+ * `RMW_STATIC_MAX_SEQUENCE_LENGTH`, and `allocator` must be rmw_get_static_allocator()
+ * for the sequence to stay off the heap.
+ *
+ * \param[inout] sequence sequence object to be initialized.
+ * \param[in] size capacity of the sequence to be allocated.
+ * \param[in] allocator the allocator used to allocate memory.
+ */
+RMW_PUBLIC
+rmw_ret_t
+rmw_message_and_info_sequence_init(
+  rmw_message_and_info_sequence_t * sequence,
+  size_t size,
+  rcutils_allocator_t * allocator);
+
+/// Finalize an rmw_message_and_info_sequence_t object.
+/**
+ * This function reclaims any allocated resources within the object and zeroes out all other
+ * members.
+ *
+ * Note: This will not call `fini` or deallocate the underlying message structures.
+ *
+ * \param[inout] sequence sequence object to be finalized.
+ */
+RMW_PUBLIC
+rmw_ret_t
+rmw_message_and_info_sequence_fini(rmw_message_and_info_sequence_t * sequence);
+
+/// Ensure an rmw_message_and_info_sequence_t object can hold at least `capacity` entries.
+/**
+ * Growth follows the same rules as rmw_message_sequence_reserve().
+ *
+ * \param[inout] sequence initialized sequence object to be grown.
+ * \param[in] capacity minimum capacity of the sequence.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `sequence` is NULL or not initialized, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, in which case the sequence is
+ *   left unchanged.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_and_info_sequence_reserve(
+  rmw_message_and_info_sequence_t * sequence,
+  size_t capacity);
+
+/// Set the number of valid entries of an rmw_message_and_info_sequence_t object.
+/**
+ * The sequence is first grown as by rmw_message_and_info_sequence_reserve(), if needed.
+ * Entries beyond the previous size get a `NULL` message and a zero initialized message info.
+ *
+ * \param[inout] sequence initialized sequence object to be resized.
+ * \param[in] size new number of valid entries in the sequence.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `sequence` is NULL or not initialized, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, in which case the sequence is
+ *   left unchanged.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_and_info_sequence_resize(rmw_message_and_info_sequence_t * sequence, size_t size);
+
+/// Get the message at a given index of an rmw_message_and_info_sequence_t object.
+/**
+ * \param[in] sequence sequence object to get the message from.
+ * \param[in] index index of the message, which must be less than the size of the sequence.
+ * \return the message, or
+ * \return `NULL` if `sequence` is NULL or `index` is out of range.
+ */
+RMW_PUBLIC
+void *
+rmw_message_and_info_sequence_get_message(
+  const rmw_message_and_info_sequence_t * sequence,
+  size_t index);
+
+/// Get the message info at a given index of an rmw_message_and_info_sequence_t object.
+/**
+ * \param[in] sequence sequence object to get the message info from.
+ * \param[in] index index of the message info, which must be less than the size of the sequence.
+ * \return the message info, owned by the sequence, or
+ * \return `NULL` if `sequence` is NULL or `index` is out of range.
+ */
+RMW_PUBLIC
+rmw_message_info_t *
+rmw_message_and_info_sequence_get_message_info(
+  const rmw_message_and_info_sequence_t * sequence,
+  size_t index);
+
 #if __cplusplus
 }
 #endif
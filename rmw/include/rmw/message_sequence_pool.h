@@ -0,0 +1,164 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__MESSAGE_SEQUENCE_POOL_H_
+#define RMW__MESSAGE_SEQUENCE_POOL_H_
+
+#include <stddef.h>
+
+#include <stdbool.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/macros.h"
+#include "rmw/message_sequence.h"
+#include "rmw/ret_types.h"
+#include "rmw/visibility_control.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Message sequence and message info sequence of the same capacity, as taken together.
+/**
+ * See rmw_take_sequence().
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_message_sequence_pair_s
+{
+  /// Sequence of messages.
+  rmw_message_sequence_t message_sequence;
+  /// Sequence of message infos, one per message in `message_sequence`.
+  rmw_message_info_sequence_t message_info_sequence;
+} rmw_message_sequence_pair_t;
+
+/// Pool of pre-sized message sequence pairs, recycled instead of being finalized.
+/**
+ * All pairs are initialized up front, so acquiring a pair from the pool and
+ * releasing it back never touches the allocator.
+ * Released pairs are reset, keeping the capacity of their sequences, even if
+ * it was grown with rmw_message_sequence_reserve() while the pair was in use.
+ * Taking sequences in a loop out of a pool is thus allocation free once the
+ * sequences have grown to the largest batch.
+ *
+ * A pool is not thread-safe: it must be guarded by the caller if it is shared.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_message_sequence_pool_s
+{
+  /// Pairs owned by the pool.
+  rmw_message_sequence_pair_t * pairs;
+  /// Number of pairs owned by the pool.
+  size_t size;
+  /// Stack of the pairs that are not handed out.
+  rmw_message_sequence_pair_t ** free_pairs;
+  /// Number of pairs in `free_pairs`.
+  size_t free_count;
+  /// Whether each of `pairs` is handed out, to catch pairs released twice.
+  bool * pairs_in_use;
+  /// The allocator used to allocate the pool and its sequences.
+  rcutils_allocator_t * allocator;
+} rmw_message_sequence_pool_t;
+
+/// Return an rmw_message_sequence_pool_t struct with members initialized to `NULL`
+RMW_PUBLIC
+rmw_message_sequence_pool_t
+rmw_get_zero_initialized_message_sequence_pool(void);
+
+/// Initialize an rmw_message_sequence_pool_t object.
+/**
+ * The sequences of the pool keep a pointer to `allocator`, which must thus outlive the pool.
+ * If `RMW_AVOID_MEMORY_ALLOCATION` is enabled, `capacity` must not exceed
+ * `RMW_STATIC_MAX_SEQUENCE_LENGTH`, and `allocator` must be rmw_get_static_allocator()
+ * for the pool to stay off the heap.
+ *
+ * \param[inout] pool zero initialized pool object to be initialized.
+ * \param[in] size number of pairs in the pool.
+ * \param[in] capacity capacity of each sequence of each pair.
+ * \param[in] allocator the allocator used to allocate memory.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `pool` is NULL or `allocator` is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_sequence_pool_init(
+  rmw_message_sequence_pool_t * pool,
+  size_t size,
+  size_t capacity,
+  rcutils_allocator_t * allocator);
+
+/// Finalize an rmw_message_sequence_pool_t object, and all its sequences.
+/**
+ * Note: This will not call `fini` or deallocate the messages of the sequences.
+ *
+ * \param[inout] pool pool object to be finalized.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `pool` is NULL, or
+ * \return `RMW_RET_ERROR` if pairs acquired from the pool have not been released.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_sequence_pool_fini(rmw_message_sequence_pool_t * pool);
+
+/// Acquire an empty message sequence pair from the pool.
+/**
+ * \param[inout] pool pool object to acquire the pair from.
+ * \param[out] pair the acquired pair, owned by the pool.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is NULL, or
+ * \return `RMW_RET_ERROR` if all the pairs of the pool are in use.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_sequence_pool_acquire(
+  rmw_message_sequence_pool_t * pool,
+  rmw_message_sequence_pair_t ** pair);
+
+/// Release a message sequence pair back to the pool it was acquired from, resetting it.
+/**
+ * \param[inout] pool pool object the pair was acquired from.
+ * \param[in] pair the pair to be released, it must not be used afterwards.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `pair` does not belong to `pool`, or
+ * \return `RMW_RET_ERROR` if `pair` is not in use, e.g. it was already released.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_sequence_pool_release(
+  rmw_message_sequence_pool_t * pool,
+  rmw_message_sequence_pair_t * pair);
+
+/// Empty both sequences of a pair, keeping their capacity.
+/**
+ * Note: This will not call `fini` or deallocate the messages of the sequences.
+ *
+ * \param[inout] pair the pair to be reset.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `pair` is NULL.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_message_sequence_pair_reset(rmw_message_sequence_pair_t * pair);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RMW__MESSAGE_SEQUENCE_POOL_H_
@@ -74,6 +74,9 @@ rmw_names_and_types_check_zero(rmw_names_and_types_t * names_and_types);
  * it does not initialize the string array for each setup of types.
  * However, the string arrays for each set of types is zero initialized.
  *
+ * If `RMW_AVOID_MEMORY_ALLOCATION` is enabled, `allocator` must be
+ * rmw_get_static_allocator() for the array to stay off the heap.
+ *
  * <hr>
  * Attribute          | Adherence
  * ------------------ | -------------
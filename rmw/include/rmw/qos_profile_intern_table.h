@@ -0,0 +1,186 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__QOS_PROFILE_INTERN_TABLE_H_
+#define RMW__QOS_PROFILE_INTERN_TABLE_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/types.h"
+#include "rmw/visibility_control.h"
+
+/// Handle of a QoS profile interned in a rmw_qos_profile_intern_table_t.
+/**
+ * Handles are dense: the n-th distinct profile interned in a table gets the
+ * handle n, starting at zero.
+ * Within a table, two profiles are equal if and only if their handles are.
+ */
+typedef uint32_t rmw_qos_profile_id_t;
+
+/// Table deduplicating QoS profiles into small handles.
+/**
+ * Records that would otherwise embed a full rmw_qos_profile_t copy, e.g. the
+ * topic endpoint info of a graph cache, can store the handle of their profile
+ * instead, and compare profiles by comparing handles.
+ *
+ * Profiles are stored by handle in a growing array, and indexed by an open
+ * addressing hash table keyed by rmw_qos_profile_hash(), so that interning a
+ * profile is O(1) on average and getting the profile of a handle is O(1).
+ * Profiles are never removed, the table is meant to hold the few distinct
+ * profiles in use in a system.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_qos_profile_intern_table_s
+{
+  /// Distinct interned profiles, indexed by handle.
+  rmw_qos_profile_t * profiles;
+  /// Number of distinct interned profiles.
+  size_t size;
+  /// Number of profiles that fit in `profiles`.
+  size_t capacity;
+  /// Hash table slots, holding the handle of a profile plus one, or zero if empty.
+  rmw_qos_profile_id_t * slots;
+  /// Number of hash table slots, a power of two twice as large as `capacity`.
+  size_t slot_count;
+  /// Allocator used for `profiles` and `slots`.
+  rcutils_allocator_t allocator;
+} rmw_qos_profile_intern_table_t;
+
+/// Return a zero initialized QoS profile intern table.
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_qos_profile_intern_table_t
+rmw_get_zero_initialized_qos_profile_intern_table(void);
+
+/// Initialize an empty QoS profile intern table.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] table: Zero initialized table to be initialized.
+ * \param[in] capacity: Number of distinct profiles to reserve storage for, the table
+ *   grows past it as needed, and may be zero.
+ * \param[in] allocator: Allocator used to store the profiles, it is copied.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `table` is `NULL`, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `allocator` is invalid, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `capacity` is too large, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_qos_profile_intern_table_init(
+  rmw_qos_profile_intern_table_t * table,
+  size_t capacity,
+  const rcutils_allocator_t * allocator);
+
+/// Finalize a QoS profile intern table, invalidating all its handles.
+/**
+ * Finalizing a zero initialized table is a no-op.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] table: Table to be finalized, it is zero initialized afterwards.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `table` is `NULL`.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_qos_profile_intern_table_fini(rmw_qos_profile_intern_table_t * table);
+
+/// Get the handle of a QoS profile, adding the profile to the table if it is not there yet.
+/**
+ * Adding a profile may grow the table, which invalidates the pointers
+ * previously returned by rmw_qos_profile_intern_table_get(), but never any
+ * handle.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] table: Table to intern the profile in.
+ * \param[in] profile: QoS profile to be interned, it is copied.
+ * \param[out] id: Handle of the profile.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is `NULL`, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `table` is not initialized, or
+ * \return `RMW_RET_BAD_ALLOC` if the table had to grow and memory allocation failed, or
+ * \return `RMW_RET_ERROR` if the table is full and cannot grow any further.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_qos_profile_intern(
+  rmw_qos_profile_intern_table_t * table,
+  const rmw_qos_profile_t * profile,
+  rmw_qos_profile_id_t * id);
+
+/// Get the QoS profile of a handle.
+/**
+ * The returned profile is owned by the table, and is only valid until the
+ * table grows or is finalized.
+ * This function may be called concurrently with itself, but not with
+ * rmw_qos_profile_intern().
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] table: Table the handle was obtained from.
+ * \param[in] id: Handle of the profile.
+ * \return the interned profile, or
+ * \return `NULL` if `table` is `NULL`, or
+ * \return `NULL` if `id` is not a handle of `table`.
+ */
+RMW_PUBLIC
+const rmw_qos_profile_t *
+rmw_qos_profile_intern_table_get(
+  const rmw_qos_profile_intern_table_t * table,
+  rmw_qos_profile_id_t id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RMW__QOS_PROFILE_INTERN_TABLE_H_
@@ -206,6 +206,89 @@ rmw_qos_profile_check_compatible(
   char * reason,
   size_t reason_size);
 
+/// Check if a QoS profile of a publisher is compatible with those of several subscriptions.
+/**
+ * This is equivalent to calling rmw_qos_profile_check_compatible() for each
+ * subscription profile, without a reason, but the publisher profile is only
+ * inspected once, which makes it cheaper to match an endpoint against all the
+ * endpoints discovered on a topic.
+ * The reason of a given incompatibility can then be obtained by calling
+ * rmw_qos_profile_check_compatible() for that pair of profiles.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] publisher_profile: The QoS profile used for a publisher.
+ * \param[in] subscription_profiles: Array of `count` QoS profiles used for subscriptions.
+ * \param[in] count: Number of subscription profiles.
+ * \param[out] compatibilities: Array of `count` compatibilities, in which the compatibility
+ *   of the publisher with each subscription is stored, see rmw_qos_profile_check_compatible().
+ * \return `RMW_RET_OK` if the check was successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `publisher_profile` is `NULL`, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `subscription_profiles` or `compatibilities` is
+ *   `NULL` and `count` is not zero.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_qos_profile_check_compatible_with_subscriptions(
+  const rmw_qos_profile_t * publisher_profile,
+  const rmw_qos_profile_t * subscription_profiles,
+  size_t count,
+  rmw_qos_compatibility_type_t * compatibilities);
+
+/// Compute a hash of a QoS profile, consistent with rmw_qos_profile_are_equal().
+/**
+ * Profiles that compare equal have equal hashes, which makes this function
+ * suitable to key hash tables of profiles, e.g. see rmw_qos_profile_intern().
+ * Hashes are only stable within a process, they must not be persisted.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] profile: The QoS profile to be hashed.
+ * \return hash of `profile`, or
+ * \return `0` if `profile` is `NULL`.
+ */
+RMW_PUBLIC
+size_t
+rmw_qos_profile_hash(const rmw_qos_profile_t * profile);
+
+/// Check whether two QoS profiles are equal, policy by policy.
+/**
+ * All policies must be the same, durations included, for the profiles to be
+ * equal.
+ * Durations are compared as given, e.g. 1 second and 1000000000 nanoseconds
+ * are not equal.
+ * Unlike a `memcmp()` of the structs, padding bytes are not compared.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] lhs: First QoS profile to be compared.
+ * \param[in] rhs: Second QoS profile to be compared.
+ * \return `true` if both profiles are equal, or both are `NULL`, or
+ * \return `false` otherwise.
+ */
+RMW_PUBLIC
+bool
+rmw_qos_profile_are_equal(const rmw_qos_profile_t * lhs, const rmw_qos_profile_t * rhs);
+
 #ifdef __cplusplus
 }
 #endif
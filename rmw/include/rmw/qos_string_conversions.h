@@ -15,6 +15,10 @@
 #ifndef RMW__QOS_STRING_CONVERSIONS_H_
 #define RMW__QOS_STRING_CONVERSIONS_H_
 
+#include <stddef.h>
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
 #include "rmw/types.h"
 #include "rmw/visibility_control.h"
 
@@ -170,6 +174,85 @@ RMW_PUBLIC
 rmw_qos_reliability_policy_t
 rmw_qos_reliability_policy_from_str(const char * str);
 
+/// Size of a buffer large enough for any profile stringified by rmw_qos_profile_to_str().
+#define RMW_QOS_PROFILE_STR_MAX_SIZE 276
+
+/// Write a string representing a whole qos profile into the given buffer.
+/**
+ * The profile is stringified as a comma separated list of `key=value` pairs,
+ * one per policy and always in the same order, e.g.:
+ *
+ *     history=keep_last,depth=10,reliability=reliable,durability=volatile,
+ *     deadline=0.100000000,lifespan=infinite,liveliness=automatic,
+ *     liveliness_lease_duration=0.000000000,avoid_ros_namespace_conventions=false
+ *
+ * without the line breaks.
+ * Keys are the stringified policy kinds, see rmw_qos_policy_kind_to_str(),
+ * and policy values are stringified as per rmw_qos_durability_policy_to_str().
+ * Durations are stringified as seconds, with a nanoseconds fraction of 9
+ * digits, e.g. `1.500000000`, or as `infinite` if they are equal to
+ * `RMW_DURATION_INFINITE`.
+ * Booleans are stringified as `true` or `false`.
+ *
+ * No memory is allocated, a buffer of `RMW_QOS_PROFILE_STR_MAX_SIZE` bytes is
+ * always large enough.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] qos_profile qos profile to be stringified.
+ * \param[out] buffer buffer the null terminated string is written to.
+ * \param[in] buffer_size size of `buffer`, in bytes.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `qos_profile` or `buffer` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any policy of `qos_profile` has an unknown value, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `buffer_size` is too small, in which case the
+ *   contents of `buffer` are unspecified.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_qos_profile_to_str(
+  const rmw_qos_profile_t * qos_profile,
+  char * buffer,
+  size_t buffer_size);
+
+/// Parse a string representing a whole or partial qos profile.
+/**
+ * The string is expected in the format written by rmw_qos_profile_to_str(),
+ * but pairs may come in any order and any of them may be omitted, in which
+ * case the matching policy of `qos_profile` is left as is.
+ * This allows applying a string of overrides onto a base profile.
+ * Durations may omit their fraction, or have a shorter one, e.g. `1` or `0.25`.
+ * No whitespace is allowed.
+ *
+ * The string is parsed in a single pass, without allocating memory.
+ * If it is invalid, `qos_profile` is left untouched.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] str null terminated string to be parsed.
+ * \param[inout] qos_profile qos profile the parsed policies are written to.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `str` or `qos_profile` is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `str` is not a valid qos profile string.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_qos_profile_from_str(const char * str, rmw_qos_profile_t * qos_profile);
+
 #ifdef __cplusplus
 }
 #endif
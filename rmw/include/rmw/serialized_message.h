@@ -20,8 +20,17 @@ extern "C"
 {
 #endif
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rcutils/allocator.h"
 #include "rcutils/types/uint8_array.h"
 
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/visibility_control.h"
+
 /**
  * \brief Serialized message as a string of bytes.
  *
@@ -95,6 +104,266 @@ typedef rcutils_uint8_array_t rmw_serialized_message_t;
 #define rmw_serialized_message_resize(serialized_message, new_size) \
   rcutils_uint8_array_resize(serialized_message, new_size)
 
+/// Contiguous piece of a chained serialized message, borrowed from its producer.
+typedef struct RMW_PUBLIC_TYPE rmw_serialized_message_segment_s
+{
+  /// The bytes of the segment, not owned by the chained serialized message.
+  const uint8_t * buffer;
+  /// The number of bytes of the segment.
+  size_t buffer_length;
+} rmw_serialized_message_segment_t;
+
+/// Serialized message made of a chain of segments, in the spirit of `struct iovec` arrays.
+/**
+ * Producers can assemble a message out of buffers they already have, e.g. a
+ * framing header prepended to a large payload, without copying any of them.
+ * Segments are borrowed: their buffers must outlive the chained serialized
+ * message, or at least until it is reset or finalized.
+ *
+ * A contiguous copy of the message is only made when asked for with
+ * rmw_chained_serialized_message_linearize(), and kept until the chain is modified.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_chained_serialized_message_s
+{
+  /// The segments of the message, in order.
+  rmw_serialized_message_segment_t * segments;
+  /// The number of segments in `segments`.
+  size_t segment_count;
+  /// The number of segments `segments` can hold without being reallocated.
+  size_t segment_capacity;
+  /// The total number of bytes of all segments.
+  size_t buffer_length;
+  /// Contiguous copy of all segments, only valid if `is_linearized` is true.
+  rmw_serialized_message_t linearized;
+  /// Whether `linearized` holds a copy of the current segments.
+  bool is_linearized;
+  /// The allocator used for the segment array and for `linearized`.
+  rcutils_allocator_t allocator;
+} rmw_chained_serialized_message_t;
+
+/// Return a zero initialized chained serialized message struct.
+RMW_PUBLIC
+rmw_chained_serialized_message_t
+rmw_get_zero_initialized_chained_serialized_message(void);
+
+/// Initialize a chained serialized message, with no segments.
+/**
+ * Given chained serialized message must have been zero initialized.
+ *
+ * \param[inout] message a pointer to the chained serialized message to initialize
+ * \param[in] segment_capacity the number of segments to allocate room for
+ * \param[in] allocator the allocator to use for memory allocations, it is copied
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any arguments are invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if no memory could be allocated correctly
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_chained_serialized_message_init(
+  rmw_chained_serialized_message_t * message,
+  size_t segment_capacity,
+  const rcutils_allocator_t * allocator);
+
+/// Finalize a chained serialized message.
+/**
+ * The buffers of the segments are borrowed, and thus left untouched.
+ *
+ * \param[inout] message a pointer to the chained serialized message to finalize
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `message` is NULL or its allocator is invalid
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_chained_serialized_message_fini(rmw_chained_serialized_message_t * message);
+
+/// Add a segment at the end of a chained serialized message, without copying it.
+/**
+ * Empty segments are not stored.
+ *
+ * \param[inout] message a pointer to an initialized chained serialized message
+ * \param[in] buffer the bytes of the segment, which must outlive `message`
+ * \param[in] buffer_length the number of bytes of the segment
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `message` is NULL or not initialized, or
+ *   `buffer` is NULL while `buffer_length` is not zero, or the total length overflows, or
+ * \return `RMW_RET_BAD_ALLOC` if the segment array could not be grown
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_chained_serialized_message_append(
+  rmw_chained_serialized_message_t * message,
+  const uint8_t * buffer,
+  size_t buffer_length);
+
+/// Add a segment at the beginning of a chained serialized message, without copying it.
+/**
+ * This is meant for framing headers, only segment descriptors are moved.
+ * Empty segments are not stored.
+ *
+ * \param[inout] message a pointer to an initialized chained serialized message
+ * \param[in] buffer the bytes of the segment, which must outlive `message`
+ * \param[in] buffer_length the number of bytes of the segment
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `message` is NULL or not initialized, or
+ *   `buffer` is NULL while `buffer_length` is not zero, or the total length overflows, or
+ * \return `RMW_RET_BAD_ALLOC` if the segment array could not be grown
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_chained_serialized_message_prepend(
+  rmw_chained_serialized_message_t * message,
+  const uint8_t * buffer,
+  size_t buffer_length);
+
+/// Remove all segments of a chained serialized message, keeping its allocated memory.
+/**
+ * \param[inout] message a pointer to the chained serialized message to reset
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `message` is NULL
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_chained_serialized_message_reset(rmw_chained_serialized_message_t * message);
+
+/// Return the total number of bytes of a chained serialized message.
+/**
+ * \param[in] message a pointer to the chained serialized message
+ * \return the sum of the lengths of all segments, or `0` if `message` is NULL
+ */
+RMW_PUBLIC
+size_t
+rmw_chained_serialized_message_get_length(const rmw_chained_serialized_message_t * message);
+
+/// Get a contiguous view of a chained serialized message.
+/**
+ * No copy is made if the message has at most one segment; otherwise all
+ * segments are copied once into memory owned by `message`, and that copy is
+ * reused until a segment is added or the message is reset.
+ *
+ * The view can be passed wherever a read only serialized message is expected,
+ * e.g. to rmw_publish_serialized_message().
+ * It is valid until `message` is modified or finalized, and must not be
+ * written to, resized, nor finalized; its allocator is zero initialized to
+ * catch the latter.
+ *
+ * \param[inout] message a pointer to an initialized chained serialized message
+ * \param[out] serialized_message the view of the message
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any arguments are NULL or `message` is not initialized, or
+ * \return `RMW_RET_BAD_ALLOC` if the contiguous copy could not be allocated
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_chained_serialized_message_linearize(
+  rmw_chained_serialized_message_t * message,
+  rmw_serialized_message_t * serialized_message);
+
+/// Function called to dispose of the contents of a shared serialized message.
+/**
+ * \param[inout] serialized_message the serialized message that was shared.
+ * \param[in] data the data given along with the callback.
+ */
+typedef void (* rmw_shared_serialized_message_release_callback_t)(
+  rmw_serialized_message_t * serialized_message,
+  void * data);
+
+/// Reference counted, read only serialized message, shared without copies.
+/**
+ * A single serialized message can be handed to many local consumers (e.g. a
+ * recorder and a bridge), each of them holding a reference to it.
+ * The contents are disposed of when the last reference is released.
+ *
+ * Retaining and releasing references is thread-safe, the contents must not be
+ * modified once shared.
+ */
+typedef struct rmw_shared_serialized_message_s rmw_shared_serialized_message_t;
+
+/// Share a serialized message, taking ownership of its contents.
+/**
+ * The returned shared serialized message holds a single reference.
+ * On success, `serialized_message` is zero initialized, its contents now
+ * being owned by `shared_serialized_message`.
+ *
+ * When the last reference is released, `release_callback` is called with the
+ * contents, e.g. to give the buffer back to a pool; if it is `NULL`, the
+ * contents are finalized with rmw_serialized_message_fini() instead.
+ *
+ * \param[inout] serialized_message the serialized message to be shared
+ * \param[in] release_callback the function disposing of the contents, or `NULL`
+ * \param[in] release_callback_data the data passed to `release_callback`
+ * \param[in] allocator the allocator used for the shared serialized message itself, it is copied
+ * \param[out] shared_serialized_message the shared serialized message
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any arguments are invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if no memory could be allocated correctly
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_shared_serialized_message_create(
+  rmw_serialized_message_t * serialized_message,
+  rmw_shared_serialized_message_release_callback_t release_callback,
+  void * release_callback_data,
+  const rcutils_allocator_t * allocator,
+  rmw_shared_serialized_message_t ** shared_serialized_message);
+
+/// Add a reference to a shared serialized message.
+/**
+ * Each reference must eventually be given back with
+ * rmw_shared_serialized_message_release().
+ *
+ * \param[inout] shared_serialized_message the shared serialized message
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `shared_serialized_message` is NULL
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_shared_serialized_message_retain(rmw_shared_serialized_message_t * shared_serialized_message);
+
+/// Release a reference to a shared serialized message, disposing of it if it was the last one.
+/**
+ * \param[inout] shared_serialized_message the shared serialized message, which must not be
+ *   used afterwards by the caller
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `shared_serialized_message` is NULL, or
+ * \return `RMW_RET_ERROR` if the contents could not be finalized, the shared
+ *   serialized message is deallocated nonetheless
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_shared_serialized_message_release(rmw_shared_serialized_message_t * shared_serialized_message);
+
+/// Return the read only contents of a shared serialized message.
+/**
+ * \param[in] shared_serialized_message the shared serialized message
+ * \return the serialized message, valid as long as the caller holds a reference, or
+ * \return `NULL` if `shared_serialized_message` is NULL
+ */
+RMW_PUBLIC
+const rmw_serialized_message_t *
+rmw_shared_serialized_message_get_serialized_message(
+  const rmw_shared_serialized_message_t * shared_serialized_message);
+
+/// Return the number of references to a shared serialized message.
+/**
+ * The result is only a snapshot if other threads hold references too.
+ *
+ * \param[in] shared_serialized_message the shared serialized message
+ * \return the number of references, or `0` if `shared_serialized_message` is NULL
+ */
+RMW_PUBLIC
+size_t
+rmw_shared_serialized_message_get_reference_count(
+  const rmw_shared_serialized_message_t * shared_serialized_message);
+
 #if __cplusplus
 }
 #endif
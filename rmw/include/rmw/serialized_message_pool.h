@@ -0,0 +1,208 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__SERIALIZED_MESSAGE_POOL_H_
+#define RMW__SERIALIZED_MESSAGE_POOL_H_
+
+#include <stddef.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/serialized_message.h"
+#include "rmw/visibility_control.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Default size of the smallest buffers of a serialized message pool.
+#define RMW_SERIALIZED_MESSAGE_POOL_DEFAULT_MIN_BUFFER_SIZE 256u
+
+/// Default size of the largest buffers of a serialized message pool.
+#define RMW_SERIALIZED_MESSAGE_POOL_DEFAULT_MAX_BUFFER_SIZE (64u * 1024u * 1024u)
+
+/// Maximum number of size classes of a serialized message pool.
+#define RMW_SERIALIZED_MESSAGE_POOL_MAX_CLASS_COUNT 32u
+
+/// Buffers of a single size class of a serialized message pool, and their statistics.
+typedef struct RMW_PUBLIC_TYPE rmw_serialized_message_pool_class_s
+{
+  /// Size of the buffers of this class.
+  size_t buffer_size;
+  /// Free buffers of this class, linked through their headers.
+  void * free_buffers;
+  /// Number of buffers in `free_buffers`.
+  size_t free_count;
+  /// Number of buffers of this class currently handed out.
+  size_t in_use;
+  /// Highest number of buffers of this class handed out at the same time.
+  size_t high_water_mark;
+  /// Number of buffers of this class allocated with the pool allocator.
+  size_t allocation_count;
+} rmw_serialized_message_pool_class_t;
+
+/// Pool of serialized message buffers, sorted in power of two size classes.
+/**
+ * Serialized messages acquired from the pool use an allocator backed by the
+ * pool: growing them with rmw_serialized_message_resize() moves them to a
+ * larger class, and finalizing them gives their buffer back to the pool.
+ * Once every class in use holds enough free buffers, e.g. after a warm up or
+ * rmw_serialized_message_pool_reserve(), taking serialized messages in a loop
+ * does not allocate memory anymore.
+ *
+ * Buffers larger than the largest class are allocated and deallocated
+ * directly with the pool allocator.
+ * Free buffers are only deallocated when the pool is finalized.
+ *
+ * A pool is not thread-safe: it must be guarded by the caller if it is shared,
+ * and so must be the serialized messages acquired from it.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_serialized_message_pool_s
+{
+  /// Size classes of the pool, in increasing buffer size.
+  rmw_serialized_message_pool_class_t classes[RMW_SERIALIZED_MESSAGE_POOL_MAX_CLASS_COUNT];
+  /// Number of size classes in `classes`.
+  size_t class_count;
+  /// Number of buffers larger than the largest class currently handed out.
+  size_t oversized_in_use;
+  /// Allocator used to allocate the buffers.
+  rcutils_allocator_t allocator;
+} rmw_serialized_message_pool_t;
+
+/// Return a zero initialized serialized message pool.
+RMW_PUBLIC
+rmw_serialized_message_pool_t
+rmw_get_zero_initialized_serialized_message_pool(void);
+
+/// Initialize a serialized message pool, without allocating any buffer yet.
+/**
+ * \param[inout] pool zero initialized pool to be initialized.
+ * \param[in] min_buffer_size size of the buffers of the smallest class, a power of two
+ *   of at least 64 bytes.
+ * \param[in] max_buffer_size size of the buffers of the largest class, a power of two
+ *   no smaller than `min_buffer_size`.
+ * \param[in] allocator allocator used to allocate the buffers, it is copied.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is invalid, or if there
+ *   would be more than `RMW_SERIALIZED_MESSAGE_POOL_MAX_CLASS_COUNT` classes.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialized_message_pool_init(
+  rmw_serialized_message_pool_t * pool,
+  size_t min_buffer_size,
+  size_t max_buffer_size,
+  const rcutils_allocator_t * allocator);
+
+/// Finalize a serialized message pool, deallocating all its free buffers.
+/**
+ * \param[inout] pool pool to be finalized.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `pool` is NULL, or
+ * \return `RMW_RET_ERROR` if serialized messages acquired from the pool have not been released.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialized_message_pool_fini(rmw_serialized_message_pool_t * pool);
+
+/// Allocate free buffers ahead of time.
+/**
+ * \param[inout] pool pool to add free buffers to.
+ * \param[in] buffer_size size the buffers must be able to hold, which selects their class.
+ * \param[in] count number of free buffers to allocate.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `pool` is NULL, or `buffer_size` is zero
+ *   or larger than the largest class, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails, buffers allocated
+ *   until then are kept.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialized_message_pool_reserve(
+  rmw_serialized_message_pool_t * pool,
+  size_t buffer_size,
+  size_t count);
+
+/// Return the allocator serving buffers out of the pool.
+/**
+ * It can be used wherever a serialized message is initialized, which is
+ * equivalent to rmw_serialized_message_pool_acquire().
+ * The pool must outlive any memory allocated with it.
+ *
+ * \param[in] pool pool serving the allocations.
+ * \return the allocator, or
+ * \return a zero initialized allocator if `pool` is NULL.
+ */
+RMW_PUBLIC
+rcutils_allocator_t
+rmw_serialized_message_pool_get_allocator(rmw_serialized_message_pool_t * pool);
+
+/// Initialize a serialized message with a buffer out of the pool.
+/**
+ * \param[inout] pool pool to acquire the buffer from.
+ * \param[in] capacity capacity the serialized message must have, at least.
+ * \param[inout] serialized_message zero initialized serialized message to be initialized.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is NULL, or
+ * \return `RMW_RET_BAD_ALLOC` if memory allocation fails.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialized_message_pool_acquire(
+  rmw_serialized_message_pool_t * pool,
+  size_t capacity,
+  rmw_serialized_message_t * serialized_message);
+
+/// Give the buffer of a serialized message back to the pool, finalizing the message.
+/**
+ * This is equivalent to rmw_serialized_message_fini().
+ *
+ * \param[inout] pool pool the serialized message was acquired from.
+ * \param[inout] serialized_message serialized message to be released.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is NULL, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `serialized_message` does not use the pool allocator.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_serialized_message_pool_release(
+  rmw_serialized_message_pool_t * pool,
+  rmw_serialized_message_t * serialized_message);
+
+/// Return the size class serving buffers of a given size.
+/**
+ * \param[in] pool pool to look the class up in.
+ * \param[in] buffer_size size of the buffers.
+ * \return the class, whose statistics can be inspected, or
+ * \return `NULL` if `pool` is NULL or `buffer_size` is larger than the largest class.
+ */
+RMW_PUBLIC
+const rmw_serialized_message_pool_class_t *
+rmw_serialized_message_pool_get_class(
+  const rmw_serialized_message_pool_t * pool,
+  size_t buffer_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RMW__SERIALIZED_MESSAGE_POOL_H_
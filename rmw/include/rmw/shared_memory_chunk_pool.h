@@ -0,0 +1,275 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW__SHARED_MEMORY_CHUNK_POOL_H_
+#define RMW__SHARED_MEMORY_CHUNK_POOL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rmw/macros.h"
+#include "rmw/ret_types.h"
+#include "rmw/visibility_control.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Maximum length of the name of a shared memory chunk pool, terminating null included.
+#define RMW_SHARED_MEMORY_CHUNK_POOL_MAX_NAME_LENGTH 256u
+
+/// Alignment of the chunks of a shared memory chunk pool, in bytes.
+#define RMW_SHARED_MEMORY_CHUNK_POOL_CHUNK_ALIGNMENT 64u
+
+/// Pool of fixed size chunks in shared memory, to build message loans on.
+/**
+ * rmw implementations can serve rmw_borrow_loaned_message() out of such a
+ * pool, and hand the same chunk to local subscriptions, so that messages are
+ * passed between processes of a single host without copies.
+ *
+ * The pool lives in a shared memory segment, either an anonymous memory file
+ * whose file descriptor is passed around, or a named POSIX shared memory
+ * object; any number of processes can attach to it.
+ * Chunks are acquired from and released to a lock-free free list.
+ * Each chunk has a reference count, so that it goes back to the free list
+ * once its publisher and all its subscriptions are done with it, and an owner,
+ * so that chunks held by a process that died can be reclaimed.
+ *
+ * All functions operating on chunks are thread-safe and process-safe.
+ * Shared memory chunk pools are only supported on Linux; functions return
+ * `RMW_RET_UNSUPPORTED` elsewhere.
+ */
+typedef struct RMW_PUBLIC_TYPE rmw_shared_memory_chunk_pool_s
+{
+  /// Start of the shared memory segment, as mapped in this process.
+  void * segment;
+  /// Size of the shared memory segment, in bytes.
+  size_t segment_size;
+  /// Usable size of each chunk, in bytes.
+  size_t chunk_size;
+  /// Number of chunks in the pool.
+  size_t chunk_count;
+  /// File descriptor of the shared memory segment, owned by the pool.
+  int file_descriptor;
+  /// Whether this process created the segment, and unlinks its name on fini.
+  bool is_creator;
+  /// Name of the POSIX shared memory object, or an empty string if it is anonymous.
+  char name[RMW_SHARED_MEMORY_CHUNK_POOL_MAX_NAME_LENGTH];
+} rmw_shared_memory_chunk_pool_t;
+
+/// Return a zero initialized shared memory chunk pool.
+RMW_PUBLIC
+rmw_shared_memory_chunk_pool_t
+rmw_get_zero_initialized_shared_memory_chunk_pool(void);
+
+/// Create a shared memory segment and initialize a chunk pool in it.
+/**
+ * \param[inout] pool zero initialized pool.
+ * \param[in] name name of the POSIX shared memory object to create, starting with a slash,
+ *   or `NULL` for an anonymous memory file.
+ * \param[in] chunk_size usable size of each chunk, rounded up to
+ *   `RMW_SHARED_MEMORY_CHUNK_POOL_CHUNK_ALIGNMENT`, must not be zero.
+ * \param[in] chunk_count number of chunks, between 1 and `UINT32_MAX - 1`.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is invalid, or
+ * \return `RMW_RET_BAD_ALLOC` if the shared memory segment could not be created, or
+ * \return `RMW_RET_ERROR` if the shared memory segment could not be mapped, or
+ * \return `RMW_RET_UNSUPPORTED` if shared memory chunk pools are not supported.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_shared_memory_chunk_pool_create(
+  rmw_shared_memory_chunk_pool_t * pool,
+  const char * name,
+  size_t chunk_size,
+  size_t chunk_count);
+
+/// Attach to the chunk pool of an existing named shared memory segment.
+/**
+ * \param[inout] pool zero initialized pool.
+ * \param[in] name name of the POSIX shared memory object.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is invalid, or
+ * \return `RMW_RET_ERROR` if the segment could not be opened or mapped, or does not
+ *   hold an initialized chunk pool, or
+ * \return `RMW_RET_UNSUPPORTED` if shared memory chunk pools are not supported.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_shared_memory_chunk_pool_attach(
+  rmw_shared_memory_chunk_pool_t * pool,
+  const char * name);
+
+/// Attach to the chunk pool of the shared memory segment behind a file descriptor.
+/**
+ * The file descriptor is duplicated, the caller keeps ownership of `file_descriptor`.
+ *
+ * \param[inout] pool zero initialized pool.
+ * \param[in] file_descriptor file descriptor of the segment, e.g. received from its creator.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is invalid, or
+ * \return `RMW_RET_ERROR` if the segment could not be mapped, or does not hold an
+ *   initialized chunk pool, or
+ * \return `RMW_RET_UNSUPPORTED` if shared memory chunk pools are not supported.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_shared_memory_chunk_pool_attach_file_descriptor(
+  rmw_shared_memory_chunk_pool_t * pool,
+  int file_descriptor);
+
+/// Detach from a chunk pool, unlinking its name if this process created it.
+/**
+ * Chunks still acquired are left alone, processes still attached keep using
+ * the segment, which is destroyed once the last of them detaches.
+ * Finalizing a zero initialized pool is a no-op.
+ *
+ * \param[inout] pool pool to be finalized.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `pool` is NULL, or
+ * \return `RMW_RET_ERROR` if the segment could not be unmapped.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_shared_memory_chunk_pool_fini(rmw_shared_memory_chunk_pool_t * pool);
+
+/// Acquire a free chunk, holding a single reference to it.
+/**
+ * \param[inout] pool pool to acquire the chunk from.
+ * \param[in] owner identifier of the owner of the chunk, e.g. a process id, must not be zero.
+ * \param[out] chunk_index index of the acquired chunk, the same in all processes.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is invalid, or
+ * \return `RMW_RET_ERROR` if all chunks are in use.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_shared_memory_chunk_pool_acquire(
+  rmw_shared_memory_chunk_pool_t * pool,
+  uint32_t owner,
+  size_t * chunk_index);
+
+/// Add a reference to an acquired chunk, e.g. for each subscription it is handed to.
+/**
+ * \param[inout] pool pool the chunk belongs to.
+ * \param[in] chunk_index index of the chunk.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `pool` is NULL or `chunk_index` out of range, or
+ * \return `RMW_RET_ERROR` if the chunk is free.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_shared_memory_chunk_pool_retain(
+  rmw_shared_memory_chunk_pool_t * pool,
+  size_t chunk_index);
+
+/// Release a reference to a chunk, giving it back to the free list if it was the last one.
+/**
+ * \param[inout] pool pool the chunk belongs to.
+ * \param[in] chunk_index index of the chunk.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `pool` is NULL or `chunk_index` out of range, or
+ * \return `RMW_RET_ERROR` if the chunk is free.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_shared_memory_chunk_pool_release(
+  rmw_shared_memory_chunk_pool_t * pool,
+  size_t chunk_index);
+
+/// Give all the chunks of an owner back to the free list, whatever their reference count.
+/**
+ * This is only meant for chunks whose owner is known to be gone, e.g. a
+ * process that died while holding loans: references to them held by others
+ * are invalidated.
+ *
+ * \param[inout] pool pool the chunks belong to.
+ * \param[in] owner identifier of the owner, must not be zero.
+ * \param[out] reclaimed_count number of chunks given back, may be NULL.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `pool` is NULL or `owner` is zero.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_shared_memory_chunk_pool_reclaim(
+  rmw_shared_memory_chunk_pool_t * pool,
+  uint32_t owner,
+  size_t * reclaimed_count);
+
+/// Return the address of a chunk in this process.
+/**
+ * \param[in] pool pool the chunk belongs to.
+ * \param[in] chunk_index index of the chunk.
+ * \return the address of the chunk, or
+ * \return `NULL` if `pool` is NULL or not initialized, or `chunk_index` is out of range.
+ */
+RMW_PUBLIC
+void *
+rmw_shared_memory_chunk_pool_get_chunk(
+  const rmw_shared_memory_chunk_pool_t * pool,
+  size_t chunk_index);
+
+/// Find the index of the chunk at a given address in this process, e.g. of a loaned message.
+/**
+ * \param[in] pool pool the chunk belongs to.
+ * \param[in] chunk address of the chunk, as returned by rmw_shared_memory_chunk_pool_get_chunk().
+ * \param[out] chunk_index index of the chunk.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is NULL, or `chunk` is not the
+ *   address of a chunk of `pool`.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_shared_memory_chunk_pool_get_chunk_index(
+  const rmw_shared_memory_chunk_pool_t * pool,
+  const void * chunk,
+  size_t * chunk_index);
+
+/// Get the reference count and owner of a chunk.
+/**
+ * The result is only a snapshot if other threads or processes use the chunk.
+ *
+ * \param[in] pool pool the chunk belongs to.
+ * \param[in] chunk_index index of the chunk.
+ * \param[out] reference_count number of references to the chunk, zero if it is free.
+ * \param[out] owner owner of the chunk, zero if it is free; may be NULL.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `pool` or `reference_count` is NULL,
+ *   or `chunk_index` is out of range.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_shared_memory_chunk_pool_get_chunk_state(
+  const rmw_shared_memory_chunk_pool_t * pool,
+  size_t chunk_index,
+  uint32_t * reference_count,
+  uint32_t * owner);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RMW__SHARED_MEMORY_CHUNK_POOL_H_
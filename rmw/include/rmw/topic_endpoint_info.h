@@ -28,6 +28,10 @@ extern "C"
 /// A data structure that encapsulates the node name, node namespace,
 /// topic_type, gid, and qos_profile of publishers and subscriptions
 /// for a topic.
+/**
+ * If `RMW_AVOID_MEMORY_ALLOCATION` is enabled, the functions populating and finalizing
+ * it must be given rmw_get_static_allocator() for it to stay off the heap.
+ */
 typedef struct RMW_PUBLIC_TYPE rmw_topic_endpoint_info_s
 {
   /// Name of the node
@@ -25,6 +25,10 @@ extern "C"
 #include "rmw/visibility_control.h"
 
 /// Array of topic endpoint information
+/**
+ * If `RMW_AVOID_MEMORY_ALLOCATION` is enabled, the functions initializing and finalizing
+ * it must be given rmw_get_static_allocator() for the array to stay off the heap.
+ */
 typedef struct RMW_PUBLIC_TYPE rmw_topic_endpoint_info_array_s
 {
   /// Size of the array.
@@ -106,6 +106,50 @@ rmw_validate_node_name_with_size(
   int * validation_result,
   size_t * invalid_index);
 
+/// Determine if each of a batch of node names is valid.
+/**
+ * This is equivalent to calling rmw_validate_node_name_with_size() on each element, without
+ * the per call overhead of checking arguments.
+ * Elements are independent from each other, so a very large batch can be
+ * split into sub-batches validated concurrently from several threads, as
+ * long as they write to disjoint parts of `validation_results` and
+ * `invalid_indices`.
+ *
+ * \sa rmw_validate_node_name_with_size(const char *, size_t, int *, size_t *)
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] node_names array of `count` node names to be validated.
+ * \param[in] node_name_lengths array of `count` lengths of `node_names`, or NULL
+ *   if they are all null-terminated.
+ * \param[in] count number of node names to be validated.
+ * \param[out] validation_results array of `count` ints in which the result of each
+ *   check is stored.
+ * \param[out] invalid_indices array of `count` size_t in which the index of the error
+ *   in each invalid name is stored, or NULL.
+ *   Entries of valid names are left untouched.
+ * \returns `RMW_RET_OK` on successfully running all the checks, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if `node_names` or `validation_results` is NULL
+ *   while `count` is not zero, or
+ * \returns `RMW_RET_INVALID_ARGUMENT` if any of `node_names` is NULL, in which case only
+ *   the elements before it are validated.
+ */
+RMW_PUBLIC
+RMW_WARN_UNUSED
+rmw_ret_t
+rmw_validate_node_names(
+  const char * const * node_names,
+  const size_t * node_name_lengths,
+  size_t count,
+  int * validation_results,
+  size_t * invalid_indices);
+
 /// Return a validation result description, or NULL if RMW_NODE_NAME_VALID.
 /**
  * \param[in] validation_result the result of validation
@@ -0,0 +1,200 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/allocation_stats.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "rcutils/stdatomic_helper.h"
+
+#include "rmw/error_handling.h"
+
+#include "./allocation_tracking.h"
+#include "./spinlock.h"
+
+static atomic_uint_least64_t g_allocations[RMW_ALLOCATION_DOMAIN_COUNT];
+static atomic_uint_least64_t g_deallocations[RMW_ALLOCATION_DOMAIN_COUNT];
+static atomic_uint_least64_t g_bytes[RMW_ALLOCATION_DOMAIN_COUNT];
+
+static atomic_bool g_trap_armed;
+static rmw_spinlock_t g_trap_lock;
+static rmw_allocation_trap_handler_t g_trap_handler;
+static void * g_trap_data;
+
+static const char * const g_domain_names[RMW_ALLOCATION_DOMAIN_COUNT] = {
+  [RMW_ALLOCATION_DOMAIN_DEFAULT_ALLOCATOR] = "default allocator",
+  [RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE] = "message sequence",
+  [RMW_ALLOCATION_DOMAIN_NAMES_AND_TYPES] = "names and types",
+  [RMW_ALLOCATION_DOMAIN_TOPIC_ENDPOINT_INFO] = "topic endpoint info",
+  [RMW_ALLOCATION_DOMAIN_CONTENT_FILTER_OPTIONS] = "content filter options",
+  [RMW_ALLOCATION_DOMAIN_COUNTING_ALLOCATOR] = "counting allocator",
+  [RMW_ALLOCATION_DOMAIN_QOS_PROFILE_INTERN_TABLE] = "qos profile intern table",
+  [RMW_ALLOCATION_DOMAIN_SERIALIZED_MESSAGE] = "serialized message",
+};
+
+static void
+_rmw_default_allocation_trap_handler(rmw_allocation_domain_t domain, size_t size, void * data)
+{
+  (void)data;
+  fprintf(
+    stderr, "[rmw] allocation of %zu bytes in %s after the allocation trap was armed\n",
+    size, g_domain_names[domain]);
+  abort();
+}
+
+#if RMW_ENABLE_ALLOCATION_TRACKING
+// Statistics order no other memory, so relaxed increments are enough.
+void
+rmw_track_allocation(rmw_allocation_domain_t domain, size_t size)
+{
+  atomic_fetch_add_explicit(&g_allocations[domain], 1u, memory_order_relaxed);
+  atomic_fetch_add_explicit(&g_bytes[domain], size, memory_order_relaxed);
+  // The handler is read under the trap lock, which orders it after arming.
+  if (!atomic_load_explicit(&g_trap_armed, memory_order_relaxed)) {
+    return;
+  }
+  rmw_spinlock_lock(&g_trap_lock);
+  rmw_allocation_trap_handler_t handler = g_trap_handler;
+  void * data = g_trap_data;
+  rmw_spinlock_unlock(&g_trap_lock);
+  // The trap may have been disarmed in the meantime.
+  if (NULL != handler) {
+    handler(domain, size, data);
+  }
+}
+
+void
+rmw_track_deallocation(rmw_allocation_domain_t domain)
+{
+  atomic_fetch_add_explicit(&g_deallocations[domain], 1u, memory_order_relaxed);
+}
+#endif
+
+rmw_ret_t
+rmw_get_allocation_stats(rmw_allocation_domain_t domain, rmw_allocation_stats_t * stats)
+{
+  if ((int)domain < 0 || domain >= RMW_ALLOCATION_DOMAIN_COUNT) {
+    RMW_SET_ERROR_MSG("invalid allocation domain");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  RMW_CHECK_ARGUMENT_FOR_NULL(stats, RMW_RET_INVALID_ARGUMENT);
+  stats->allocations = rcutils_atomic_load_uint64_t(&g_allocations[domain]);
+  stats->deallocations = rcutils_atomic_load_uint64_t(&g_deallocations[domain]);
+  stats->bytes = rcutils_atomic_load_uint64_t(&g_bytes[domain]);
+  return RMW_RET_OK;
+}
+
+void
+rmw_reset_allocation_stats(void)
+{
+  for (size_t i = 0u; i < RMW_ALLOCATION_DOMAIN_COUNT; ++i) {
+    rcutils_atomic_store(&g_allocations[i], 0u);
+    rcutils_atomic_store(&g_deallocations[i], 0u);
+    rcutils_atomic_store(&g_bytes[i], 0u);
+  }
+}
+
+void
+rmw_allocation_trap_arm(rmw_allocation_trap_handler_t handler, void * data)
+{
+  rmw_spinlock_lock(&g_trap_lock);
+  g_trap_handler = NULL != handler ? handler : _rmw_default_allocation_trap_handler;
+  g_trap_data = data;
+  rmw_spinlock_unlock(&g_trap_lock);
+  rcutils_atomic_store(&g_trap_armed, true);
+}
+
+void
+rmw_allocation_trap_disarm(void)
+{
+  rcutils_atomic_store(&g_trap_armed, false);
+  rmw_spinlock_lock(&g_trap_lock);
+  g_trap_handler = NULL;
+  g_trap_data = NULL;
+  rmw_spinlock_unlock(&g_trap_lock);
+}
+
+bool
+rmw_allocation_trap_is_armed(void)
+{
+  return rcutils_atomic_load_bool(&g_trap_armed);
+}
+
+static void *
+_rmw_counting_allocate(size_t size, void * state)
+{
+  rmw_counting_allocator_t * counting_allocator = state;
+  void * pointer =
+    counting_allocator->wrapped.allocate(size, counting_allocator->wrapped.state);
+  if (NULL != pointer) {
+    rmw_track_allocation(RMW_ALLOCATION_DOMAIN_COUNTING_ALLOCATOR, size);
+  }
+  return pointer;
+}
+
+static void
+_rmw_counting_deallocate(void * pointer, void * state)
+{
+  rmw_counting_allocator_t * counting_allocator = state;
+  if (NULL != pointer) {
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_COUNTING_ALLOCATOR);
+  }
+  counting_allocator->wrapped.deallocate(pointer, counting_allocator->wrapped.state);
+}
+
+static void *
+_rmw_counting_reallocate(void * pointer, size_t size, void * state)
+{
+  rmw_counting_allocator_t * counting_allocator = state;
+  void * new_pointer =
+    counting_allocator->wrapped.reallocate(pointer, size, counting_allocator->wrapped.state);
+  if (NULL != new_pointer) {
+    if (NULL != pointer) {
+      rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_COUNTING_ALLOCATOR);
+    }
+    rmw_track_allocation(RMW_ALLOCATION_DOMAIN_COUNTING_ALLOCATOR, size);
+  }
+  return new_pointer;
+}
+
+static void *
+_rmw_counting_zero_allocate(size_t number_of_elements, size_t size_of_element, void * state)
+{
+  rmw_counting_allocator_t * counting_allocator = state;
+  void * pointer = counting_allocator->wrapped.zero_allocate(
+    number_of_elements, size_of_element, counting_allocator->wrapped.state);
+  if (NULL != pointer) {
+    rmw_track_allocation(
+      RMW_ALLOCATION_DOMAIN_COUNTING_ALLOCATOR, number_of_elements * size_of_element);
+  }
+  return pointer;
+}
+
+rmw_ret_t
+rmw_counting_allocator_init(
+  rmw_counting_allocator_t * counting_allocator,
+  const rcutils_allocator_t * wrapped)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(counting_allocator, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    wrapped, "wrapped allocator is invalid", return RMW_RET_INVALID_ARGUMENT);
+  counting_allocator->wrapped = *wrapped;
+  counting_allocator->allocator.allocate = _rmw_counting_allocate;
+  counting_allocator->allocator.deallocate = _rmw_counting_deallocate;
+  counting_allocator->allocator.reallocate = _rmw_counting_reallocate;
+  counting_allocator->allocator.zero_allocate = _rmw_counting_zero_allocate;
+  counting_allocator->allocator.state = counting_allocator;
+  return RMW_RET_OK;
+}
@@ -0,0 +1,53 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ALLOCATION_TRACKING_H_
+#define ALLOCATION_TRACKING_H_
+
+#include <stddef.h>
+
+#include "rmw/allocation_stats.h"
+#include "rmw/impl/config.h"
+#include "rmw/visibility_control.h"
+
+#if RMW_ENABLE_ALLOCATION_TRACKING
+
+/// Account a successful allocation, firing the allocation trap if it is armed.
+RMW_LOCAL
+void
+rmw_track_allocation(rmw_allocation_domain_t domain, size_t size);
+
+/// Account a deallocation of non NULL memory.
+RMW_LOCAL
+void
+rmw_track_deallocation(rmw_allocation_domain_t domain);
+
+#else
+
+static inline void
+rmw_track_allocation(rmw_allocation_domain_t domain, size_t size)
+{
+  (void)domain;
+  (void)size;
+}
+
+static inline void
+rmw_track_deallocation(rmw_allocation_domain_t domain)
+{
+  (void)domain;
+}
+
+#endif
+
+#endif  // ALLOCATION_TRACKING_H_
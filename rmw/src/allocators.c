@@ -19,16 +19,132 @@
 
 #include <rcutils/allocator.h>
 
+#include "rmw/error_handling.h"
+#include "rmw/impl/config.h"
 #include "rmw/types.h"
 
+#include "./allocation_tracking.h"
+#include "./slab_pool.h"
+#include "./spinlock.h"
+
+typedef struct rmw_handle_storage_s
+{
+  /// Size of the handle struct.
+  const size_t handle_size;
+  /// Pool the handles are served from, if pools are enabled.
+  rmw_slab_pool_t pool;
+  /// Number of handles currently allocated from the heap.
+  size_t live;
+  /// Highest number of handles allocated at the same time.
+  size_t peak;
+  /// Lock guarding the heap statistics.
+  rmw_spinlock_t lock;
+} rmw_handle_storage_t;
+
+#if RMW_AVOID_MEMORY_ALLOCATION
+// Handles are served from pools carved out of static storage, which are always enabled.
+# define RMW_HANDLE_STORAGE(type, max_count, storage) \
+  { \
+    .handle_size = sizeof(type), \
+    .pool = RMW_SLAB_POOL_STATIC_INITIALIZER(sizeof(type), max_count, storage), \
+  }
+# define RMW_DECLARE_HANDLE_STORAGE(type, max_count, storage) \
+  static rmw_slab_pool_max_align_t storage[RMW_SLAB_POOL_STORAGE_LENGTH(sizeof(type), max_count)]
+
+RMW_DECLARE_HANDLE_STORAGE(rmw_node_t, RMW_STATIC_MAX_NODES, g_node_storage);
+RMW_DECLARE_HANDLE_STORAGE(rmw_publisher_t, RMW_STATIC_MAX_PUBLISHERS, g_publisher_storage);
+RMW_DECLARE_HANDLE_STORAGE(
+  rmw_subscription_t, RMW_STATIC_MAX_SUBSCRIPTIONS, g_subscription_storage);
+RMW_DECLARE_HANDLE_STORAGE(
+  rmw_guard_condition_t, RMW_STATIC_MAX_GUARD_CONDITIONS, g_guard_condition_storage);
+RMW_DECLARE_HANDLE_STORAGE(rmw_client_t, RMW_STATIC_MAX_CLIENTS, g_client_storage);
+RMW_DECLARE_HANDLE_STORAGE(rmw_service_t, RMW_STATIC_MAX_SERVICES, g_service_storage);
+RMW_DECLARE_HANDLE_STORAGE(rmw_wait_set_t, RMW_STATIC_MAX_WAIT_SETS, g_wait_set_storage);
+#else
+// Handles are served from the heap, or from pools once rmw_handle_pools_init() is called.
+# define RMW_HANDLE_STORAGE(type, max_count, storage) {.handle_size = sizeof(type)}
+#endif
+
+static rmw_handle_storage_t g_handle_storage[RMW_HANDLE_TYPE_COUNT] = {
+  [RMW_HANDLE_TYPE_NODE] =
+    RMW_HANDLE_STORAGE(rmw_node_t, RMW_STATIC_MAX_NODES, g_node_storage),
+  [RMW_HANDLE_TYPE_PUBLISHER] =
+    RMW_HANDLE_STORAGE(rmw_publisher_t, RMW_STATIC_MAX_PUBLISHERS, g_publisher_storage),
+  [RMW_HANDLE_TYPE_SUBSCRIPTION] =
+    RMW_HANDLE_STORAGE(rmw_subscription_t, RMW_STATIC_MAX_SUBSCRIPTIONS, g_subscription_storage),
+  [RMW_HANDLE_TYPE_GUARD_CONDITION] = RMW_HANDLE_STORAGE(
+    rmw_guard_condition_t, RMW_STATIC_MAX_GUARD_CONDITIONS, g_guard_condition_storage),
+  [RMW_HANDLE_TYPE_CLIENT] =
+    RMW_HANDLE_STORAGE(rmw_client_t, RMW_STATIC_MAX_CLIENTS, g_client_storage),
+  [RMW_HANDLE_TYPE_SERVICE] =
+    RMW_HANDLE_STORAGE(rmw_service_t, RMW_STATIC_MAX_SERVICES, g_service_storage),
+  [RMW_HANDLE_TYPE_WAIT_SET] =
+    RMW_HANDLE_STORAGE(rmw_wait_set_t, RMW_STATIC_MAX_WAIT_SETS, g_wait_set_storage),
+};
+
+#if !RMW_AVOID_MEMORY_ALLOCATION
+static atomic_bool g_handle_pools_enabled;
+#endif
+
+static bool
+_rmw_handle_pools_are_enabled(void)
+{
+#if RMW_AVOID_MEMORY_ALLOCATION
+  return true;
+#else
+  return rcutils_atomic_load_bool(&g_handle_pools_enabled);
+#endif
+}
+
+// Lifecycle of the allocator behind rmw_allocate() and rmw_free(), which can only be set once.
+enum
+{
+  RMW_DEFAULT_ALLOCATOR_UNSET = 0,
+  RMW_DEFAULT_ALLOCATOR_BEING_SET,
+  RMW_DEFAULT_ALLOCATOR_SET
+};
+
+static rcutils_allocator_t g_default_allocator;
+static atomic_uint_least64_t g_default_allocator_state;
+
+rmw_ret_t
+rmw_set_default_allocator(const rcutils_allocator_t * allocator)
+{
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    allocator, "allocator is invalid", return RMW_RET_INVALID_ARGUMENT);
+  uint64_t expected_state = RMW_DEFAULT_ALLOCATOR_UNSET;
+  if (!rcutils_atomic_compare_exchange_strong_uint_least64_t(
+      &g_default_allocator_state, &expected_state, RMW_DEFAULT_ALLOCATOR_BEING_SET))
+  {
+    RMW_SET_ERROR_MSG("default allocator can only be set once");
+    return RMW_RET_ERROR;
+  }
+  g_default_allocator = *allocator;
+  rcutils_atomic_store(&g_default_allocator_state, RMW_DEFAULT_ALLOCATOR_SET);
+  return RMW_RET_OK;
+}
+
+rcutils_allocator_t
+rmw_get_default_allocator(void)
+{
+  if (RMW_DEFAULT_ALLOCATOR_SET == rcutils_atomic_load_uint64_t(&g_default_allocator_state)) {
+    return g_default_allocator;
+  }
+#if RMW_AVOID_MEMORY_ALLOCATION
+  return rmw_get_static_allocator();
+#else
+  return rcutils_get_default_allocator();
+#endif
+}
+
 void *
 rmw_allocate(size_t size)
 {
-  // Could be overridden with a general purpose allocator
-  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rcutils_allocator_t allocator = rmw_get_default_allocator();
   void * ptr = allocator.allocate(size, allocator.state);
   if (ptr) {
     memset(ptr, 0, size);
+    rmw_track_allocation(RMW_ALLOCATION_DOMAIN_DEFAULT_ALLOCATOR, size);
   }
   return ptr;
 }
@@ -36,106 +152,244 @@ rmw_allocate(size_t size)
 void
 rmw_free(void * pointer)
 {
-  // Should have a corresponding override with rmw_allocate
-  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  if (pointer) {
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_DEFAULT_ALLOCATOR);
+  }
+  rcutils_allocator_t allocator = rmw_get_default_allocator();
   allocator.deallocate(pointer, allocator.state);
 }
 
+static void *
+_rmw_handle_allocate(rmw_handle_type_t type)
+{
+  rmw_handle_storage_t * storage = &g_handle_storage[type];
+  if (_rmw_handle_pools_are_enabled()) {
+    return rmw_slab_pool_acquire(&storage->pool);
+  }
+  void * handle = rmw_allocate(storage->handle_size);
+  if (NULL != handle) {
+    rmw_spinlock_lock(&storage->lock);
+    if (++storage->live > storage->peak) {
+      storage->peak = storage->live;
+    }
+    rmw_spinlock_unlock(&storage->lock);
+  }
+  return handle;
+}
+
+static void
+_rmw_handle_free(rmw_handle_type_t type, void * handle)
+{
+  if (NULL == handle) {
+    return;
+  }
+  rmw_handle_storage_t * storage = &g_handle_storage[type];
+  if (_rmw_handle_pools_are_enabled()) {
+    rmw_slab_pool_release(&storage->pool, handle);
+    return;
+  }
+  rmw_free(handle);
+  rmw_spinlock_lock(&storage->lock);
+  if (storage->live > 0u) {
+    --storage->live;
+  }
+  rmw_spinlock_unlock(&storage->lock);
+}
+
+#if !RMW_AVOID_MEMORY_ALLOCATION
+// Whether any handle is live, either from the heap or from a pool.
+static bool
+_rmw_handles_are_live(void)
+{
+  for (size_t i = 0u; i < RMW_HANDLE_TYPE_COUNT; ++i) {
+    rmw_handle_statistics_t statistics;
+    if (RMW_RET_OK != rmw_get_handle_statistics((rmw_handle_type_t)i, &statistics)) {
+      return true;
+    }
+    if (0u != statistics.live) {
+      return true;
+    }
+  }
+  return false;
+}
+#endif
+
+rmw_ret_t
+rmw_handle_pools_init(size_t handles_per_slab, const rcutils_allocator_t * allocator)
+{
+  if (0u == handles_per_slab) {
+    RMW_SET_ERROR_MSG("handles_per_slab must be greater than zero");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    allocator, "allocator is invalid", return RMW_RET_INVALID_ARGUMENT);
+#if RMW_AVOID_MEMORY_ALLOCATION
+  RMW_SET_ERROR_MSG("handle pools are static when avoiding memory allocation");
+  return RMW_RET_UNSUPPORTED;
+#else
+  if (rcutils_atomic_load_bool(&g_handle_pools_enabled)) {
+    RMW_SET_ERROR_MSG("handle pools are already enabled");
+    return RMW_RET_ERROR;
+  }
+  if (_rmw_handles_are_live()) {
+    RMW_SET_ERROR_MSG("handle pools cannot be enabled while handles are live");
+    return RMW_RET_ERROR;
+  }
+  for (size_t i = 0u; i < RMW_HANDLE_TYPE_COUNT; ++i) {
+    rmw_handle_storage_t * storage = &g_handle_storage[i];
+    rmw_ret_t ret = rmw_slab_pool_init(
+      &storage->pool, storage->handle_size, handles_per_slab, allocator);
+    if (RMW_RET_OK != ret) {
+      // Nothing was reserved yet, so finalizing pools initialized so far cannot fail.
+      for (size_t j = 0u; j < i; ++j) {
+        (void)rmw_slab_pool_fini(&g_handle_storage[j].pool);
+      }
+      return ret;
+    }
+  }
+  rcutils_atomic_store(&g_handle_pools_enabled, true);
+  return RMW_RET_OK;
+#endif
+}
+
+rmw_ret_t
+rmw_handle_pools_fini(void)
+{
+#if RMW_AVOID_MEMORY_ALLOCATION
+  RMW_SET_ERROR_MSG("handle pools are static when avoiding memory allocation");
+  return RMW_RET_UNSUPPORTED;
+#else
+  if (!rcutils_atomic_load_bool(&g_handle_pools_enabled)) {
+    return RMW_RET_OK;
+  }
+  if (_rmw_handles_are_live()) {
+    RMW_SET_ERROR_MSG("handle pools cannot be disabled while handles are live");
+    return RMW_RET_ERROR;
+  }
+  rcutils_atomic_store(&g_handle_pools_enabled, false);
+  for (size_t i = 0u; i < RMW_HANDLE_TYPE_COUNT; ++i) {
+    rmw_ret_t ret = rmw_slab_pool_fini(&g_handle_storage[i].pool);
+    if (RMW_RET_OK != ret) {
+      return ret;
+    }
+  }
+  return RMW_RET_OK;
+#endif
+}
+
+bool
+rmw_handle_pools_are_enabled(void)
+{
+  return _rmw_handle_pools_are_enabled();
+}
+
+rmw_ret_t
+rmw_get_handle_statistics(rmw_handle_type_t type, rmw_handle_statistics_t * statistics)
+{
+  if ((int)type < 0 || type >= RMW_HANDLE_TYPE_COUNT) {
+    RMW_SET_ERROR_MSG("invalid handle type");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  RMW_CHECK_ARGUMENT_FOR_NULL(statistics, RMW_RET_INVALID_ARGUMENT);
+  rmw_handle_storage_t * storage = &g_handle_storage[type];
+  if (_rmw_handle_pools_are_enabled()) {
+    rmw_slab_pool_statistics_t pool_statistics;
+    rmw_slab_pool_get_statistics(&storage->pool, &pool_statistics);
+    statistics->live = pool_statistics.live;
+    statistics->peak = pool_statistics.peak;
+    statistics->capacity = pool_statistics.capacity;
+    statistics->slab_count = pool_statistics.slab_count;
+    return RMW_RET_OK;
+  }
+  rmw_spinlock_lock(&storage->lock);
+  statistics->live = storage->live;
+  statistics->peak = storage->peak;
+  rmw_spinlock_unlock(&storage->lock);
+  statistics->capacity = 0u;
+  statistics->slab_count = 0u;
+  return RMW_RET_OK;
+}
+
 rmw_node_t *
 rmw_node_allocate()
 {
-  // Could be overridden with custom (maybe static) node struct allocator
-  return (rmw_node_t *)rmw_allocate(sizeof(rmw_node_t));
+  return (rmw_node_t *)_rmw_handle_allocate(RMW_HANDLE_TYPE_NODE);
 }
 
 void
 rmw_node_free(rmw_node_t * node)
 {
-  // Should have matching overide with rmw_node_allocate
-  rmw_free(node);
+  _rmw_handle_free(RMW_HANDLE_TYPE_NODE, node);
 }
 
 rmw_publisher_t *
 rmw_publisher_allocate()
 {
-  // Could be overridden with custom (maybe static) publisher struct allocator
-  return (rmw_publisher_t *)rmw_allocate(sizeof(rmw_publisher_t));
+  return (rmw_publisher_t *)_rmw_handle_allocate(RMW_HANDLE_TYPE_PUBLISHER);
 }
 
 void
 rmw_publisher_free(rmw_publisher_t * publisher)
 {
-  // Should have matching overide with rmw_publisher_allocate
-  rmw_free(publisher);
+  _rmw_handle_free(RMW_HANDLE_TYPE_PUBLISHER, publisher);
 }
 
 rmw_subscription_t *
 rmw_subscription_allocate()
 {
-  // Could be overridden with custom (maybe static) subscription struct allocator
-  return (rmw_subscription_t *)rmw_allocate(sizeof(rmw_subscription_t));
+  return (rmw_subscription_t *)_rmw_handle_allocate(RMW_HANDLE_TYPE_SUBSCRIPTION);
 }
 
 void
 rmw_subscription_free(rmw_subscription_t * subscription)
 {
-  // Should have matching overide with rmw_subscription_allocate
-  rmw_free(subscription);
+  _rmw_handle_free(RMW_HANDLE_TYPE_SUBSCRIPTION, subscription);
 }
 
 rmw_guard_condition_t *
 rmw_guard_condition_allocate()
 {
-  // Could be overridden with custom (maybe static) guard_condition
-  // struct allocator
-  return (rmw_guard_condition_t *)rmw_allocate(sizeof(rmw_guard_condition_t));
+  return (rmw_guard_condition_t *)_rmw_handle_allocate(RMW_HANDLE_TYPE_GUARD_CONDITION);
 }
 
 void
 rmw_guard_condition_free(rmw_guard_condition_t * guard_condition)
 {
-  // Should have matching overide with rmw_guard_condition_allocate
-  rmw_free(guard_condition);
+  _rmw_handle_free(RMW_HANDLE_TYPE_GUARD_CONDITION, guard_condition);
 }
 
 rmw_client_t *
 rmw_client_allocate()
 {
-  // Could be overridden with custom (maybe static) client struct allocator
-  return (rmw_client_t *)rmw_allocate(sizeof(rmw_client_t));
+  return (rmw_client_t *)_rmw_handle_allocate(RMW_HANDLE_TYPE_CLIENT);
 }
 
 void
 rmw_client_free(rmw_client_t * client)
 {
-  // Should have matching overide with rmw_client_allocate
-  rmw_free(client);
+  _rmw_handle_free(RMW_HANDLE_TYPE_CLIENT, client);
 }
 
 rmw_service_t *
 rmw_service_allocate()
 {
-  // Could be overridden with custom (maybe static) client struct allocator
-  return (rmw_service_t *)rmw_allocate(sizeof(rmw_service_t));
+  return (rmw_service_t *)_rmw_handle_allocate(RMW_HANDLE_TYPE_SERVICE);
 }
 
 void
 rmw_service_free(rmw_service_t * service)
 {
-  // Should have matching overide with rmw_service_allocate
-  rmw_free(service);
+  _rmw_handle_free(RMW_HANDLE_TYPE_SERVICE, service);
 }
 
 rmw_wait_set_t *
 rmw_wait_set_allocate()
 {
-  // Could be overridden with custom (maybe static) client struct allocator
-  return (rmw_wait_set_t *)rmw_allocate(sizeof(rmw_wait_set_t));
+  return (rmw_wait_set_t *)_rmw_handle_allocate(RMW_HANDLE_TYPE_WAIT_SET);
 }
 
 void
 rmw_wait_set_free(rmw_wait_set_t * wait_set)
 {
-  // Should have matching overide with rmw_wait_set_allocate
-  rmw_free(wait_set);
+  _rmw_handle_free(RMW_HANDLE_TYPE_WAIT_SET, wait_set);
 }
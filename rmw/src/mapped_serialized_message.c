@@ -0,0 +1,256 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef __linux__
+// Required for memfd_create().
+# ifndef _GNU_SOURCE
+#  define _GNU_SOURCE
+# endif
+#endif
+
+#include "rmw/mapped_serialized_message.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#ifndef _WIN32
+# include <errno.h>
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+#include "rcutils/allocator.h"
+
+#include "rmw/error_handling.h"
+
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+# define RMW_MAPPED_SERIALIZED_MESSAGE_HAS_MEMFD 1
+#else
+# define RMW_MAPPED_SERIALIZED_MESSAGE_HAS_MEMFD 0
+#endif
+
+// The allocator of a mapped serialized message carries the number of bytes available
+// to it in its state rather than a pointer, so that the message can be freely copied.
+static void *
+_rmw_mapped_serialized_message_allocate(size_t size, void * state)
+{
+  (void)size;
+  (void)state;
+  return NULL;
+}
+
+static void
+_rmw_mapped_serialized_message_deallocate(void * pointer, void * state)
+{
+  // The mapping is only unmapped by rmw_mapped_serialized_message_fini().
+  (void)pointer;
+  (void)state;
+}
+
+static void *
+_rmw_mapped_serialized_message_reallocate(void * pointer, size_t size, void * state)
+{
+  const size_t available = (size_t)(uintptr_t)state;
+  return size <= available ? pointer : NULL;
+}
+
+static void *
+_rmw_mapped_serialized_message_zero_allocate(
+  size_t number_of_elements, size_t size_of_element, void * state)
+{
+  (void)number_of_elements;
+  (void)size_of_element;
+  (void)state;
+  return NULL;
+}
+
+rmw_mapped_serialized_message_t
+rmw_get_zero_initialized_mapped_serialized_message(void)
+{
+  rmw_mapped_serialized_message_t zero;
+  memset(&zero, 0, sizeof(zero));
+  zero.serialized_message = rmw_get_zero_initialized_serialized_message();
+  zero.file_descriptor = -1;
+  return zero;
+}
+
+#ifndef _WIN32
+// Map length bytes of a file descriptor from offset, and point the serialized message at them.
+static rmw_ret_t
+_rmw_mapped_serialized_message_map(
+  rmw_mapped_serialized_message_t * message,
+  int file_descriptor,
+  size_t offset,
+  size_t length,
+  bool writable)
+{
+  const long page_size = sysconf(_SC_PAGESIZE);
+  const size_t alignment = page_size > 0 ? (size_t)page_size : 4096u;
+  const size_t padding = offset % alignment;
+  if (length > SIZE_MAX - padding || (uintmax_t)(offset - padding) > (uintmax_t)INT64_MAX) {
+    RMW_SET_ERROR_MSG("offset and length are out of range");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  const int protection = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+  const int flags = writable ? MAP_SHARED : MAP_PRIVATE;
+  void * mapping = mmap(
+    NULL, padding + length, protection, flags, file_descriptor, (off_t)(offset - padding));
+  if (MAP_FAILED == mapping) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING("failed to map file descriptor, errno %d", errno);
+    return RMW_RET_ERROR;
+  }
+
+  message->mapping = mapping;
+  message->mapping_length = padding + length;
+  message->is_writable = writable;
+  rcutils_allocator_t * allocator = &message->serialized_message.allocator;
+  *allocator = rcutils_get_zero_initialized_allocator();
+  allocator->allocate = _rmw_mapped_serialized_message_allocate;
+  allocator->deallocate = _rmw_mapped_serialized_message_deallocate;
+  allocator->reallocate = _rmw_mapped_serialized_message_reallocate;
+  allocator->zero_allocate = _rmw_mapped_serialized_message_zero_allocate;
+  // Read only mappings must not be taken into, so they cannot be resized at all.
+  allocator->state = (void *)(uintptr_t)(writable ? length : 0u);
+  message->serialized_message.buffer = (uint8_t *)mapping + padding;
+  message->serialized_message.buffer_length = length;
+  message->serialized_message.buffer_capacity = length;
+  return RMW_RET_OK;
+}
+#endif
+
+rmw_ret_t
+rmw_mapped_serialized_message_map_file(
+  rmw_mapped_serialized_message_t * message,
+  const char * file_path)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(message, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(file_path, RMW_RET_INVALID_ARGUMENT);
+#ifdef _WIN32
+  RMW_SET_ERROR_MSG("memory mapped serialized messages are not supported on this platform");
+  return RMW_RET_UNSUPPORTED;
+#else
+  *message = rmw_get_zero_initialized_mapped_serialized_message();
+  const int file_descriptor = open(file_path, O_RDONLY | O_CLOEXEC);
+  if (-1 == file_descriptor) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+      "failed to open '%s', errno %d", file_path, errno);
+    return RMW_RET_ERROR;
+  }
+  rmw_ret_t ret = RMW_RET_OK;
+  struct stat file_status;
+  if (0 != fstat(file_descriptor, &file_status)) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+      "failed to get the size of '%s', errno %d", file_path, errno);
+    ret = RMW_RET_ERROR;
+  } else if ((uintmax_t)file_status.st_size > (uintmax_t)SIZE_MAX) {
+    RMW_SET_ERROR_MSG("file is too large to be mapped");
+    ret = RMW_RET_ERROR;
+  } else if (file_status.st_size > 0) {
+    // Empty files cannot be mapped, they are empty serialized messages instead.
+    ret = _rmw_mapped_serialized_message_map(
+      message, file_descriptor, 0u, (size_t)file_status.st_size, false);
+  }
+  // The mapping keeps the file contents alive on its own.
+  (void)close(file_descriptor);
+  return ret;
+#endif
+}
+
+rmw_ret_t
+rmw_mapped_serialized_message_map_file_descriptor(
+  rmw_mapped_serialized_message_t * message,
+  int file_descriptor,
+  size_t offset,
+  size_t length,
+  bool writable)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(message, RMW_RET_INVALID_ARGUMENT);
+  if (file_descriptor < 0) {
+    RMW_SET_ERROR_MSG("file descriptor is invalid");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (0u == length) {
+    RMW_SET_ERROR_MSG("length must not be zero");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+#ifdef _WIN32
+  (void)offset;
+  (void)writable;
+  RMW_SET_ERROR_MSG("memory mapped serialized messages are not supported on this platform");
+  return RMW_RET_UNSUPPORTED;
+#else
+  *message = rmw_get_zero_initialized_mapped_serialized_message();
+  return _rmw_mapped_serialized_message_map(message, file_descriptor, offset, length, writable);
+#endif
+}
+
+rmw_ret_t
+rmw_mapped_serialized_message_create(
+  rmw_mapped_serialized_message_t * message,
+  size_t capacity)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(message, RMW_RET_INVALID_ARGUMENT);
+  if (0u == capacity) {
+    RMW_SET_ERROR_MSG("capacity must not be zero");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+#if RMW_MAPPED_SERIALIZED_MESSAGE_HAS_MEMFD
+  if ((uintmax_t)capacity > (uintmax_t)INT64_MAX) {
+    RMW_SET_ERROR_MSG("capacity is too large");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  *message = rmw_get_zero_initialized_mapped_serialized_message();
+  const int file_descriptor = memfd_create("rmw_serialized_message", MFD_CLOEXEC);
+  if (-1 == file_descriptor) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING("failed to create memory file, errno %d", errno);
+    return RMW_RET_BAD_ALLOC;
+  }
+  if (0 != ftruncate(file_descriptor, (off_t)capacity)) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING("failed to size memory file, errno %d", errno);
+    (void)close(file_descriptor);
+    return RMW_RET_BAD_ALLOC;
+  }
+  rmw_ret_t ret =
+    _rmw_mapped_serialized_message_map(message, file_descriptor, 0u, capacity, true);
+  if (RMW_RET_OK != ret) {
+    (void)close(file_descriptor);
+    return ret;
+  }
+  message->file_descriptor = file_descriptor;
+  message->serialized_message.buffer_length = 0u;
+  return RMW_RET_OK;
+#else
+  RMW_SET_ERROR_MSG("anonymous memory files are not supported on this platform");
+  return RMW_RET_UNSUPPORTED;
+#endif
+}
+
+rmw_ret_t
+rmw_mapped_serialized_message_fini(rmw_mapped_serialized_message_t * message)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(message, RMW_RET_INVALID_ARGUMENT);
+#ifndef _WIN32
+  if (NULL != message->mapping && 0 != munmap(message->mapping, message->mapping_length)) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING("failed to unmap serialized message, errno %d", errno);
+    return RMW_RET_ERROR;
+  }
+  if (-1 != message->file_descriptor) {
+    (void)close(message->file_descriptor);
+  }
+#endif
+  *message = rmw_get_zero_initialized_mapped_serialized_message();
+  return RMW_RET_OK;
+}
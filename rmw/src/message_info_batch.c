@@ -0,0 +1,241 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/message_info_batch.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "rmw/error_handling.h"
+#include "rmw/impl/config.h"
+
+#include "./allocation_tracking.h"
+
+// Size of all the members of a message info, once split into arrays.
+#define RMW_MESSAGE_INFO_BATCH_ENTRY_SIZE \
+  (2u * sizeof(rmw_time_point_value_t) + 2u * sizeof(uint64_t) + sizeof(rmw_gid_t) + \
+  sizeof(bool))
+
+// Number of latencies summed as integers before being accumulated as a double,
+// small enough for the integer sum not to overflow with any sensible latency.
+#define RMW_MESSAGE_INFO_BATCH_LATENCY_CHUNK_SIZE 1024u
+
+#if RMW_AVOID_MEMORY_ALLOCATION
+_Static_assert(
+  RMW_STATIC_MAX_SEQUENCE_LENGTH * RMW_MESSAGE_INFO_BATCH_ENTRY_SIZE <=
+  RMW_STATIC_LARGE_BLOCK_SIZE,
+  "batches of RMW_STATIC_MAX_SEQUENCE_LENGTH must fit in RMW_STATIC_LARGE_BLOCK_SIZE");
+#endif
+
+rmw_message_info_batch_t
+rmw_get_zero_initialized_message_info_batch(void)
+{
+  rmw_message_info_batch_t zero;
+  memset(&zero, 0, sizeof(zero));
+  return zero;
+}
+
+rmw_ret_t
+rmw_message_info_batch_init(
+  rmw_message_info_batch_t * batch,
+  size_t capacity,
+  rcutils_allocator_t * allocator)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(batch, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR(allocator, return RMW_RET_INVALID_ARGUMENT);
+#if RMW_AVOID_MEMORY_ALLOCATION
+  if (capacity > RMW_STATIC_MAX_SEQUENCE_LENGTH) {
+    RMW_SET_ERROR_MSG("capacity exceeds RMW_STATIC_MAX_SEQUENCE_LENGTH");
+    return RMW_RET_BAD_ALLOC;
+  }
+#endif
+  if (capacity > SIZE_MAX / RMW_MESSAGE_INFO_BATCH_ENTRY_SIZE) {
+    RMW_SET_ERROR_MSG("capacity is too large");
+    return RMW_RET_BAD_ALLOC;
+  }
+  *batch = rmw_get_zero_initialized_message_info_batch();
+  if (capacity > 0u) {
+    // Arrays are laid out by decreasing alignment, so that each of them is suitably aligned.
+    uint8_t * data =
+      allocator->allocate(RMW_MESSAGE_INFO_BATCH_ENTRY_SIZE * capacity, allocator->state);
+    if (NULL == data) {
+      RMW_SET_ERROR_MSG("failed to allocate memory for the batch");
+      return RMW_RET_BAD_ALLOC;
+    }
+    rmw_track_allocation(
+      RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE, RMW_MESSAGE_INFO_BATCH_ENTRY_SIZE * capacity);
+    batch->source_timestamps = (rmw_time_point_value_t *)data;
+    batch->received_timestamps = batch->source_timestamps + capacity;
+    batch->publication_sequence_numbers = (uint64_t *)(batch->received_timestamps + capacity);
+    batch->reception_sequence_numbers = batch->publication_sequence_numbers + capacity;
+    batch->publisher_gids = (rmw_gid_t *)(batch->reception_sequence_numbers + capacity);
+    batch->from_intra_process = (bool *)(batch->publisher_gids + capacity);
+  }
+  batch->capacity = capacity;
+  batch->allocator = allocator;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_info_batch_fini(rmw_message_info_batch_t * batch)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(batch, RMW_RET_INVALID_ARGUMENT);
+  if (NULL != batch->source_timestamps) {
+    RCUTILS_CHECK_ALLOCATOR(batch->allocator, return RMW_RET_INVALID_ARGUMENT);
+    batch->allocator->deallocate(batch->source_timestamps, batch->allocator->state);
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE);
+  }
+  *batch = rmw_get_zero_initialized_message_info_batch();
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_info_batch_from_sequence(
+  rmw_message_info_batch_t * batch,
+  const rmw_message_info_sequence_t * sequence)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(batch, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(sequence, RMW_RET_INVALID_ARGUMENT);
+  if (sequence->size > batch->capacity) {
+    RMW_SET_ERROR_MSG("batch capacity is less than sequence size");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  for (size_t i = 0u; i < sequence->size; ++i) {
+    const rmw_message_info_t * message_info = &sequence->data[i];
+    batch->source_timestamps[i] = message_info->source_timestamp;
+    batch->received_timestamps[i] = message_info->received_timestamp;
+    batch->publication_sequence_numbers[i] = message_info->publication_sequence_number;
+    batch->reception_sequence_numbers[i] = message_info->reception_sequence_number;
+    batch->publisher_gids[i] = message_info->publisher_gid;
+    batch->from_intra_process[i] = message_info->from_intra_process;
+  }
+  batch->size = sequence->size;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_info_batch_to_sequence(
+  const rmw_message_info_batch_t * batch,
+  rmw_message_info_sequence_t * sequence)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(batch, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(sequence, RMW_RET_INVALID_ARGUMENT);
+  if (batch->size > sequence->capacity) {
+    RMW_SET_ERROR_MSG("sequence capacity is less than batch size");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  for (size_t i = 0u; i < batch->size; ++i) {
+    rmw_message_info_t * message_info = &sequence->data[i];
+    *message_info = rmw_get_zero_initialized_message_info();
+    message_info->source_timestamp = batch->source_timestamps[i];
+    message_info->received_timestamp = batch->received_timestamps[i];
+    message_info->publication_sequence_number = batch->publication_sequence_numbers[i];
+    message_info->reception_sequence_number = batch->reception_sequence_numbers[i];
+    message_info->publisher_gid = batch->publisher_gids[i];
+    message_info->from_intra_process = batch->from_intra_process[i];
+  }
+  sequence->size = batch->size;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_info_batch_get_latency_statistics(
+  const rmw_message_info_batch_t * batch,
+  rmw_message_info_batch_latency_statistics_t * statistics)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(batch, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(statistics, RMW_RET_INVALID_ARGUMENT);
+  const rmw_time_point_value_t * source_timestamps = batch->source_timestamps;
+  const rmw_time_point_value_t * received_timestamps = batch->received_timestamps;
+  int64_t min = INT64_MAX;
+  int64_t max = INT64_MIN;
+  size_t count = 0u;
+  double total = 0.0;
+  for (size_t begin = 0u; begin < batch->size;
+    begin += RMW_MESSAGE_INFO_BATCH_LATENCY_CHUNK_SIZE)
+  {
+    size_t end = batch->size - begin < RMW_MESSAGE_INFO_BATCH_LATENCY_CHUNK_SIZE ?
+      batch->size : begin + RMW_MESSAGE_INFO_BATCH_LATENCY_CHUNK_SIZE;
+    int64_t sum = 0;
+    for (size_t i = begin; i < end; ++i) {
+      const int64_t source = source_timestamps[i];
+      const int64_t received = received_timestamps[i];
+      if (0 == source || 0 == received) {
+        continue;
+      }
+      const int64_t latency = (int64_t)((uint64_t)received - (uint64_t)source);
+      ++count;
+      sum += latency;
+      min = latency < min ? latency : min;
+      max = latency > max ? latency : max;
+    }
+    total += (double)sum;
+  }
+  statistics->count = count;
+  if (0u == count) {
+    statistics->min = 0;
+    statistics->max = 0;
+    statistics->mean = 0;
+  } else {
+    statistics->min = min;
+    statistics->max = max;
+    statistics->mean = (rmw_duration_t)(total / (double)count);
+  }
+  return RMW_RET_OK;
+}
+
+// All message infos of a batch come from the same rmw implementation, only GID data matters.
+static inline bool
+_rmw_gid_data_are_equal(const rmw_gid_t * lhs, const rmw_gid_t * rhs)
+{
+  return 0 == memcmp(lhs->data, rhs->data, sizeof(lhs->data));
+}
+
+rmw_ret_t
+rmw_message_info_batch_find_sequence_gaps(
+  const rmw_message_info_batch_t * batch,
+  rmw_message_info_batch_sequence_gaps_t * gaps)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(batch, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(gaps, RMW_RET_INVALID_ARGUMENT);
+  memset(gaps, 0, sizeof(*gaps));
+
+  const uint64_t * reception_sequence_numbers = batch->reception_sequence_numbers;
+  const uint64_t * publication_sequence_numbers = batch->publication_sequence_numbers;
+  for (size_t i = 1u; i < batch->size; ++i) {
+    const uint64_t previous = reception_sequence_numbers[i - 1u];
+    const uint64_t current = reception_sequence_numbers[i];
+    // Unsupported sequence numbers are the largest ones, and never leave a gap behind them.
+    if (current > previous + 1u && RMW_MESSAGE_INFO_SEQUENCE_NUMBER_UNSUPPORTED != previous &&
+      RMW_MESSAGE_INFO_SEQUENCE_NUMBER_UNSUPPORTED != current)
+    {
+      ++gaps->reception_gap_count;
+      gaps->reception_missing_count += current - previous - 1u;
+    }
+  }
+  for (size_t i = 1u; i < batch->size; ++i) {
+    const uint64_t previous = publication_sequence_numbers[i - 1u];
+    const uint64_t current = publication_sequence_numbers[i];
+    // Only look at the publishers, which is costlier, when sequence numbers leave a gap.
+    if (current > previous + 1u && RMW_MESSAGE_INFO_SEQUENCE_NUMBER_UNSUPPORTED != previous &&
+      RMW_MESSAGE_INFO_SEQUENCE_NUMBER_UNSUPPORTED != current &&
+      _rmw_gid_data_are_equal(&batch->publisher_gids[i - 1u], &batch->publisher_gids[i]))
+    {
+      ++gaps->publication_gap_count;
+      gaps->publication_missing_count += current - previous - 1u;
+    }
+  }
+  return RMW_RET_OK;
+}
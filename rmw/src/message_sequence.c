@@ -13,8 +13,76 @@
 // limitations under the License.
 
 #include "rmw/message_sequence.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rmw/error_handling.h"
+#include "rmw/impl/config.h"
 #include "rmw/types.h"
 
+#include "./allocation_tracking.h"
+
+#if RMW_AVOID_MEMORY_ALLOCATION
+_Static_assert(
+  RMW_STATIC_MAX_SEQUENCE_LENGTH * sizeof(rmw_message_and_info_t) <= RMW_STATIC_LARGE_BLOCK_SIZE,
+  "sequences of RMW_STATIC_MAX_SEQUENCE_LENGTH must fit in RMW_STATIC_LARGE_BLOCK_SIZE");
+#endif
+
+// Reject capacities the static pools are not sized for.
+static bool
+_rmw_sequence_capacity_is_supported(size_t size)
+{
+#if RMW_AVOID_MEMORY_ALLOCATION
+  return size <= RMW_STATIC_MAX_SEQUENCE_LENGTH;
+#else
+  (void)size;
+  return true;
+#endif
+}
+
+// Grow the data array of a sequence to hold at least min_capacity elements, at least doubling
+// its capacity so that repeated growth takes amortized constant time.
+static rmw_ret_t
+_rmw_sequence_grow(
+  void * data,
+  size_t capacity,
+  size_t element_size,
+  rcutils_allocator_t * allocator,
+  size_t min_capacity,
+  void ** new_data,
+  size_t * new_capacity)
+{
+  if (!_rmw_sequence_capacity_is_supported(min_capacity)) {
+    RMW_SET_ERROR_MSG("capacity exceeds RMW_STATIC_MAX_SEQUENCE_LENGTH");
+    return RMW_RET_BAD_ALLOC;
+  }
+  size_t grown_capacity = min_capacity;
+  if (capacity <= SIZE_MAX / 2u && 2u * capacity > grown_capacity) {
+    grown_capacity = 2u * capacity;
+    if (!_rmw_sequence_capacity_is_supported(grown_capacity)) {
+      grown_capacity = min_capacity;
+    }
+  }
+  if (grown_capacity > SIZE_MAX / element_size) {
+    RMW_SET_ERROR_MSG("capacity is too large");
+    return RMW_RET_BAD_ALLOC;
+  }
+  void * grown_data =
+    allocator->reallocate(data, grown_capacity * element_size, allocator->state);
+  if (NULL == grown_data) {
+    RMW_SET_ERROR_MSG("failed to reallocate memory for the sequence");
+    return RMW_RET_BAD_ALLOC;
+  }
+  if (NULL != data) {
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE);
+  }
+  rmw_track_allocation(RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE, grown_capacity * element_size);
+  *new_data = grown_data;
+  *new_capacity = grown_capacity;
+  return RMW_RET_OK;
+}
+
 rmw_message_sequence_t
 rmw_get_zero_initialized_message_sequence(void)
 {
@@ -36,13 +104,17 @@ rmw_message_sequence_init(
 {
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(sequence, RMW_RET_INVALID_ARGUMENT);
   RCUTILS_CHECK_ALLOCATOR(allocator, return RMW_RET_INVALID_ARGUMENT);
-
+  if (!_rmw_sequence_capacity_is_supported(size)) {
+    RMW_SET_ERROR_MSG("size exceeds RMW_STATIC_MAX_SEQUENCE_LENGTH");
+    return RMW_RET_BAD_ALLOC;
+  }
   void * data = NULL;
   if (size > 0u) {
     data = allocator->allocate(sizeof(void *) * size, allocator->state);
     if (NULL == data) {
       return RMW_RET_BAD_ALLOC;
     }
+    rmw_track_allocation(RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE, sizeof(void *) * size);
   }
 
   sequence->data = data;
@@ -62,6 +134,7 @@ rmw_message_sequence_fini(rmw_message_sequence_t * sequence)
     assert(sequence->capacity > 0u);
     RCUTILS_CHECK_ALLOCATOR(sequence->allocator, return RMW_RET_INVALID_ARGUMENT);
     sequence->allocator->deallocate(sequence->data, sequence->allocator->state);
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE);
   }
 
   sequence->data = NULL;
@@ -72,6 +145,42 @@ rmw_message_sequence_fini(rmw_message_sequence_t * sequence)
   return RMW_RET_OK;
 }
 
+rmw_ret_t
+rmw_message_sequence_reserve(rmw_message_sequence_t * sequence, size_t capacity)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(sequence, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    sequence->allocator, "sequence is not initialized", return RMW_RET_INVALID_ARGUMENT);
+  if (capacity <= sequence->capacity) {
+    return RMW_RET_OK;
+  }
+  void * data = NULL;
+  size_t new_capacity = 0u;
+  rmw_ret_t ret = _rmw_sequence_grow(
+    sequence->data, sequence->capacity, sizeof(void *), sequence->allocator, capacity,
+    &data, &new_capacity);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  sequence->data = data;
+  sequence->capacity = new_capacity;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_sequence_resize(rmw_message_sequence_t * sequence, size_t size)
+{
+  rmw_ret_t ret = rmw_message_sequence_reserve(sequence, size);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  for (size_t i = sequence->size; i < size; ++i) {
+    sequence->data[i] = NULL;
+  }
+  sequence->size = size;
+  return RMW_RET_OK;
+}
+
 rmw_message_info_sequence_t
 rmw_get_zero_initialized_message_info_sequence(void)
 {
@@ -93,13 +202,18 @@ rmw_message_info_sequence_init(
 {
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(sequence, RMW_RET_INVALID_ARGUMENT);
   RCUTILS_CHECK_ALLOCATOR(allocator, return RMW_RET_INVALID_ARGUMENT);
-
+  if (!_rmw_sequence_capacity_is_supported(size)) {
+    RMW_SET_ERROR_MSG("size exceeds RMW_STATIC_MAX_SEQUENCE_LENGTH");
+    return RMW_RET_BAD_ALLOC;
+  }
   rmw_message_info_t * data = NULL;
   if (size > 0u) {
     data = allocator->allocate(sizeof(rmw_message_info_t) * size, allocator->state);
     if (NULL == data) {
       return RMW_RET_BAD_ALLOC;
     }
+    rmw_track_allocation(
+      RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE, sizeof(rmw_message_info_t) * size);
   }
   sequence->data = data;
   sequence->size = 0u;
@@ -118,6 +232,109 @@ rmw_message_info_sequence_fini(rmw_message_info_sequence_t * sequence)
     assert(sequence->capacity > 0u);
     RCUTILS_CHECK_ALLOCATOR(sequence->allocator, return RMW_RET_INVALID_ARGUMENT);
     sequence->allocator->deallocate(sequence->data, sequence->allocator->state);
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE);
+  }
+
+  sequence->data = NULL;
+  sequence->size = 0u;
+  sequence->capacity = 0u;
+  sequence->allocator = NULL;
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_info_sequence_reserve(rmw_message_info_sequence_t * sequence, size_t capacity)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(sequence, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    sequence->allocator, "sequence is not initialized", return RMW_RET_INVALID_ARGUMENT);
+  if (capacity <= sequence->capacity) {
+    return RMW_RET_OK;
+  }
+  void * data = NULL;
+  size_t new_capacity = 0u;
+  rmw_ret_t ret = _rmw_sequence_grow(
+    sequence->data, sequence->capacity, sizeof(rmw_message_info_t), sequence->allocator,
+    capacity, &data, &new_capacity);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  sequence->data = data;
+  sequence->capacity = new_capacity;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_info_sequence_resize(rmw_message_info_sequence_t * sequence, size_t size)
+{
+  rmw_ret_t ret = rmw_message_info_sequence_reserve(sequence, size);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  for (size_t i = sequence->size; i < size; ++i) {
+    sequence->data[i] = rmw_get_zero_initialized_message_info();
+  }
+  sequence->size = size;
+  return RMW_RET_OK;
+}
+
+rmw_message_and_info_sequence_t
+rmw_get_zero_initialized_message_and_info_sequence(void)
+{
+  static rmw_message_and_info_sequence_t message_and_info_sequence = {
+    .data = NULL,
+    .size = 0u,
+    .capacity = 0u,
+    .allocator = NULL
+  };
+
+  return message_and_info_sequence;
+}
+
+rmw_ret_t
+rmw_message_and_info_sequence_init(
+  rmw_message_and_info_sequence_t * sequence,
+  size_t size,
+  rcutils_allocator_t * allocator)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(sequence, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR(allocator, return RMW_RET_INVALID_ARGUMENT);
+  if (!_rmw_sequence_capacity_is_supported(size)) {
+    RMW_SET_ERROR_MSG("size exceeds RMW_STATIC_MAX_SEQUENCE_LENGTH");
+    return RMW_RET_BAD_ALLOC;
+  }
+  if (size > SIZE_MAX / sizeof(rmw_message_and_info_t)) {
+    RMW_SET_ERROR_MSG("size is too large");
+    return RMW_RET_BAD_ALLOC;
+  }
+  rmw_message_and_info_t * data = NULL;
+  if (size > 0u) {
+    data = allocator->allocate(sizeof(rmw_message_and_info_t) * size, allocator->state);
+    if (NULL == data) {
+      return RMW_RET_BAD_ALLOC;
+    }
+    rmw_track_allocation(
+      RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE, sizeof(rmw_message_and_info_t) * size);
+  }
+  sequence->data = data;
+  sequence->size = 0u;
+  sequence->capacity = size;
+  sequence->allocator = allocator;
+
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_and_info_sequence_fini(rmw_message_and_info_sequence_t * sequence)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(sequence, RMW_RET_INVALID_ARGUMENT);
+
+  if (NULL != sequence->data) {
+    assert(sequence->capacity > 0u);
+    RCUTILS_CHECK_ALLOCATOR(sequence->allocator, return RMW_RET_INVALID_ARGUMENT);
+    sequence->allocator->deallocate(sequence->data, sequence->allocator->state);
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE);
   }
 
   sequence->data = NULL;
@@ -127,3 +344,64 @@ rmw_message_info_sequence_fini(rmw_message_info_sequence_t * sequence)
 
   return RMW_RET_OK;
 }
+
+rmw_ret_t
+rmw_message_and_info_sequence_reserve(
+  rmw_message_and_info_sequence_t * sequence,
+  size_t capacity)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(sequence, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    sequence->allocator, "sequence is not initialized", return RMW_RET_INVALID_ARGUMENT);
+  if (capacity <= sequence->capacity) {
+    return RMW_RET_OK;
+  }
+  void * data = NULL;
+  size_t new_capacity = 0u;
+  rmw_ret_t ret = _rmw_sequence_grow(
+    sequence->data, sequence->capacity, sizeof(rmw_message_and_info_t), sequence->allocator,
+    capacity, &data, &new_capacity);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  sequence->data = data;
+  sequence->capacity = new_capacity;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_and_info_sequence_resize(rmw_message_and_info_sequence_t * sequence, size_t size)
+{
+  rmw_ret_t ret = rmw_message_and_info_sequence_reserve(sequence, size);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  for (size_t i = sequence->size; i < size; ++i) {
+    sequence->data[i].message = NULL;
+    sequence->data[i].message_info = rmw_get_zero_initialized_message_info();
+  }
+  sequence->size = size;
+  return RMW_RET_OK;
+}
+
+void *
+rmw_message_and_info_sequence_get_message(
+  const rmw_message_and_info_sequence_t * sequence,
+  size_t index)
+{
+  if (NULL == sequence || index >= sequence->size) {
+    return NULL;
+  }
+  return sequence->data[index].message;
+}
+
+rmw_message_info_t *
+rmw_message_and_info_sequence_get_message_info(
+  const rmw_message_and_info_sequence_t * sequence,
+  size_t index)
+{
+  if (NULL == sequence || index >= sequence->size) {
+    return NULL;
+  }
+  return &sequence->data[index].message_info;
+}
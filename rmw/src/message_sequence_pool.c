@@ -0,0 +1,190 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/message_sequence_pool.h"
+
+#include <stdint.h>
+
+#include "rmw/error_handling.h"
+#include "rmw/message_sequence.h"
+
+#include "./allocation_tracking.h"
+
+rmw_message_sequence_pool_t
+rmw_get_zero_initialized_message_sequence_pool(void)
+{
+  static rmw_message_sequence_pool_t message_sequence_pool = {
+    .pairs = NULL,
+    .size = 0u,
+    .free_pairs = NULL,
+    .free_count = 0u,
+    .pairs_in_use = NULL,
+    .allocator = NULL
+  };
+
+  return message_sequence_pool;
+}
+
+// Finalize the first count pairs, and deallocate the pool arrays.
+static void
+_rmw_message_sequence_pool_destroy(rmw_message_sequence_pool_t * pool, size_t count)
+{
+  for (size_t i = 0u; i < count; ++i) {
+    // Sequences initialized by the pool always have a valid allocator.
+    (void)rmw_message_sequence_fini(&pool->pairs[i].message_sequence);
+    (void)rmw_message_info_sequence_fini(&pool->pairs[i].message_info_sequence);
+  }
+  if (NULL != pool->pairs) {
+    pool->allocator->deallocate(pool->pairs, pool->allocator->state);
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE);
+  }
+  if (NULL != pool->free_pairs) {
+    pool->allocator->deallocate(pool->free_pairs, pool->allocator->state);
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE);
+  }
+  if (NULL != pool->pairs_in_use) {
+    pool->allocator->deallocate(pool->pairs_in_use, pool->allocator->state);
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE);
+  }
+  *pool = rmw_get_zero_initialized_message_sequence_pool();
+}
+
+rmw_ret_t
+rmw_message_sequence_pool_init(
+  rmw_message_sequence_pool_t * pool,
+  size_t size,
+  size_t capacity,
+  rcutils_allocator_t * allocator)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR(allocator, return RMW_RET_INVALID_ARGUMENT);
+  if (size > SIZE_MAX / sizeof(rmw_message_sequence_pair_t)) {
+    RMW_SET_ERROR_MSG("size is too large");
+    return RMW_RET_BAD_ALLOC;
+  }
+  *pool = rmw_get_zero_initialized_message_sequence_pool();
+  pool->allocator = allocator;
+  if (0u == size) {
+    return RMW_RET_OK;
+  }
+
+  pool->pairs = pool->allocator->allocate(
+    sizeof(rmw_message_sequence_pair_t) * size, pool->allocator->state);
+  if (NULL == pool->pairs) {
+    RMW_SET_ERROR_MSG("failed to allocate memory for the pool pairs");
+    _rmw_message_sequence_pool_destroy(pool, 0u);
+    return RMW_RET_BAD_ALLOC;
+  }
+  rmw_track_allocation(
+    RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE, sizeof(rmw_message_sequence_pair_t) * size);
+  pool->free_pairs = pool->allocator->allocate(
+    sizeof(rmw_message_sequence_pair_t *) * size, pool->allocator->state);
+  if (NULL == pool->free_pairs) {
+    RMW_SET_ERROR_MSG("failed to allocate memory for the pool free list");
+    _rmw_message_sequence_pool_destroy(pool, 0u);
+    return RMW_RET_BAD_ALLOC;
+  }
+  rmw_track_allocation(
+    RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE, sizeof(rmw_message_sequence_pair_t *) * size);
+  pool->pairs_in_use = pool->allocator->allocate(sizeof(bool) * size, pool->allocator->state);
+  if (NULL == pool->pairs_in_use) {
+    RMW_SET_ERROR_MSG("failed to allocate memory for the pool in use flags");
+    _rmw_message_sequence_pool_destroy(pool, 0u);
+    return RMW_RET_BAD_ALLOC;
+  }
+  rmw_track_allocation(RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE, sizeof(bool) * size);
+
+  for (size_t i = 0u; i < size; ++i) {
+    rmw_message_sequence_pair_t * pair = &pool->pairs[i];
+    pair->message_sequence = rmw_get_zero_initialized_message_sequence();
+    pair->message_info_sequence = rmw_get_zero_initialized_message_info_sequence();
+    rmw_ret_t ret = rmw_message_sequence_init(&pair->message_sequence, capacity, allocator);
+    if (RMW_RET_OK == ret) {
+      ret = rmw_message_info_sequence_init(&pair->message_info_sequence, capacity, allocator);
+      if (RMW_RET_OK != ret) {
+        (void)rmw_message_sequence_fini(&pair->message_sequence);
+      }
+    }
+    if (RMW_RET_OK != ret) {
+      _rmw_message_sequence_pool_destroy(pool, i);
+      return ret;
+    }
+    pool->pairs_in_use[i] = false;
+    // Stack pairs in reverse, so that they are handed out in order.
+    pool->free_pairs[size - 1u - i] = pair;
+  }
+  pool->size = size;
+  pool->free_count = size;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_sequence_pool_fini(rmw_message_sequence_pool_t * pool)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+  if (pool->free_count != pool->size) {
+    RMW_SET_ERROR_MSG("pairs acquired from the pool have not been released");
+    return RMW_RET_ERROR;
+  }
+  _rmw_message_sequence_pool_destroy(pool, pool->size);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_sequence_pool_acquire(
+  rmw_message_sequence_pool_t * pool,
+  rmw_message_sequence_pair_t ** pair)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(pair, RMW_RET_INVALID_ARGUMENT);
+  if (0u == pool->free_count) {
+    RMW_SET_ERROR_MSG("all the pairs of the pool are in use");
+    return RMW_RET_ERROR;
+  }
+  *pair = pool->free_pairs[--pool->free_count];
+  pool->pairs_in_use[*pair - pool->pairs] = true;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_sequence_pool_release(
+  rmw_message_sequence_pool_t * pool,
+  rmw_message_sequence_pair_t * pair)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(pair, RMW_RET_INVALID_ARGUMENT);
+  if (pair < pool->pairs || pair >= pool->pairs + pool->size) {
+    RMW_SET_ERROR_MSG("pair does not belong to the pool");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  const size_t index = (size_t)(pair - pool->pairs);
+  if (!pool->pairs_in_use[index]) {
+    RMW_SET_ERROR_MSG("pair is not in use, it may have been released already");
+    return RMW_RET_ERROR;
+  }
+  pool->pairs_in_use[index] = false;
+  pair->message_sequence.size = 0u;
+  pair->message_info_sequence.size = 0u;
+  pool->free_pairs[pool->free_count++] = pair;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_message_sequence_pair_reset(rmw_message_sequence_pair_t * pair)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(pair, RMW_RET_INVALID_ARGUMENT);
+  pair->message_sequence.size = 0u;
+  pair->message_info_sequence.size = 0u;
+  return RMW_RET_OK;
+}
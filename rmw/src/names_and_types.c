@@ -21,6 +21,8 @@
 #include "rmw/convert_rcutils_ret_to_rmw_ret.h"
 #include "rmw/types.h"
 
+#include "./allocation_tracking.h"
+
 rmw_names_and_types_t
 rmw_get_zero_initialized_names_and_types(void)
 {
@@ -74,9 +76,19 @@ rmw_names_and_types_init(
     RMW_SET_ERROR_MSG(rcutils_get_error_string().str);
     return rmw_convert_rcutils_ret_to_rmw_ret(rcutils_ret);
   }
+  if (names_and_types->names.data) {
+    rmw_track_allocation(RMW_ALLOCATION_DOMAIN_NAMES_AND_TYPES, size * sizeof(char *));
+  }
   names_and_types->types =
     allocator->zero_allocate(size, sizeof(rcutils_string_array_t), allocator->state);
+  if (names_and_types->types) {
+    rmw_track_allocation(
+      RMW_ALLOCATION_DOMAIN_NAMES_AND_TYPES, size * sizeof(rcutils_string_array_t));
+  }
   if (!names_and_types->types && size != 0) {
+    if (names_and_types->names.data) {
+      rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_NAMES_AND_TYPES);
+    }
     rcutils_ret = rcutils_string_array_fini(&names_and_types->names);
     if (rcutils_ret != RCUTILS_RET_OK) {
       RCUTILS_LOG_ERROR("error while reporting error: %s", rcutils_get_error_string().str);
@@ -116,12 +128,17 @@ rmw_names_and_types_fini(rmw_names_and_types_t * names_and_types)
     names_and_types->names.allocator.deallocate(
       names_and_types->types, names_and_types->names.allocator.state);
     names_and_types->types = NULL;
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_NAMES_AND_TYPES);
   }
   // Cleanup names string array
+  const bool names_allocated = NULL != names_and_types->names.data;
   rcutils_ret = rcutils_string_array_fini(&names_and_types->names);
   if (rcutils_ret != RCUTILS_RET_OK) {
     RMW_SET_ERROR_MSG(rcutils_get_error_string().str);
     return rmw_convert_rcutils_ret_to_rmw_ret(rcutils_ret);
   }
+  if (names_allocated) {
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_NAMES_AND_TYPES);
+  }
   return RMW_RET_OK;
 }
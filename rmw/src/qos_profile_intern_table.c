@@ -0,0 +1,206 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/qos_profile_intern_table.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/qos_profiles.h"
+
+#include "./allocation_tracking.h"
+
+// Capacity reserved on first use when the table was initialized without any.
+#define RMW_QOS_PROFILE_INTERN_TABLE_MIN_CAPACITY 8u
+// Largest capacity whose handles fit in the slots, and whose storage size does not overflow.
+#define RMW_QOS_PROFILE_INTERN_TABLE_MAX_CAPACITY \
+  (SIZE_MAX / 2u / sizeof(rmw_qos_profile_t) < UINT32_MAX ? \
+  SIZE_MAX / 2u / sizeof(rmw_qos_profile_t) : (size_t)UINT32_MAX)
+
+rmw_qos_profile_intern_table_t
+rmw_get_zero_initialized_qos_profile_intern_table(void)
+{
+  rmw_qos_profile_intern_table_t zero;
+  memset(&zero, 0, sizeof(zero));
+  return zero;
+}
+
+// Find the slot of a profile, or the empty slot where it belongs, slot_count must not be zero.
+static size_t
+_rmw_qos_profile_intern_table_find_slot(
+  const rmw_qos_profile_intern_table_t * table,
+  const rmw_qos_profile_t * profile,
+  size_t hash)
+{
+  const size_t mask = table->slot_count - 1u;
+  size_t slot = hash & mask;
+  // Slots are never more than half full, so probing always ends on an empty one.
+  while (0u != table->slots[slot]) {
+    const rmw_qos_profile_id_t id = table->slots[slot] - 1u;
+    if (rmw_qos_profile_are_equal(&table->profiles[id], profile)) {
+      break;
+    }
+    slot = (slot + 1u) & mask;
+  }
+  return slot;
+}
+
+// Reserve storage for capacity profiles, rehashing those already in the table.
+static rmw_ret_t
+_rmw_qos_profile_intern_table_reserve(rmw_qos_profile_intern_table_t * table, size_t capacity)
+{
+  size_t slot_count = 1u;
+  while (slot_count < 2u * capacity) {
+    slot_count <<= 1u;
+  }
+  rcutils_allocator_t * allocator = &table->allocator;
+  rmw_qos_profile_id_t * slots =
+    allocator->zero_allocate(slot_count, sizeof(rmw_qos_profile_id_t), allocator->state);
+  if (!slots) {
+    RMW_SET_ERROR_MSG("failed to allocate memory for the intern table slots");
+    return RMW_RET_BAD_ALLOC;
+  }
+  rmw_track_allocation(
+    RMW_ALLOCATION_DOMAIN_QOS_PROFILE_INTERN_TABLE, slot_count * sizeof(rmw_qos_profile_id_t));
+  rmw_qos_profile_t * profiles =
+    allocator->reallocate(table->profiles, capacity * sizeof(rmw_qos_profile_t), allocator->state);
+  if (!profiles) {
+    allocator->deallocate(slots, allocator->state);
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_QOS_PROFILE_INTERN_TABLE);
+    RMW_SET_ERROR_MSG("failed to allocate memory for the intern table profiles");
+    return RMW_RET_BAD_ALLOC;
+  }
+  if (table->profiles) {
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_QOS_PROFILE_INTERN_TABLE);
+  }
+  rmw_track_allocation(
+    RMW_ALLOCATION_DOMAIN_QOS_PROFILE_INTERN_TABLE, capacity * sizeof(rmw_qos_profile_t));
+  if (table->slots) {
+    allocator->deallocate(table->slots, allocator->state);
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_QOS_PROFILE_INTERN_TABLE);
+  }
+  table->profiles = profiles;
+  table->capacity = capacity;
+  table->slots = slots;
+  table->slot_count = slot_count;
+  for (size_t i = 0u; i < table->size; ++i) {
+    const size_t slot = _rmw_qos_profile_intern_table_find_slot(
+      table, &profiles[i], rmw_qos_profile_hash(&profiles[i]));
+    slots[slot] = (rmw_qos_profile_id_t)(i + 1u);
+  }
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_qos_profile_intern_table_init(
+  rmw_qos_profile_intern_table_t * table,
+  size_t capacity,
+  const rcutils_allocator_t * allocator)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(table, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    allocator, "allocator is invalid", return RMW_RET_INVALID_ARGUMENT);
+  if (capacity > RMW_QOS_PROFILE_INTERN_TABLE_MAX_CAPACITY) {
+    RMW_SET_ERROR_MSG("capacity is too large");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  *table = rmw_get_zero_initialized_qos_profile_intern_table();
+  table->allocator = *allocator;
+  if (0u == capacity) {
+    return RMW_RET_OK;
+  }
+  rmw_ret_t ret = _rmw_qos_profile_intern_table_reserve(table, capacity);
+  if (RMW_RET_OK != ret) {
+    *table = rmw_get_zero_initialized_qos_profile_intern_table();
+  }
+  return ret;
+}
+
+rmw_ret_t
+rmw_qos_profile_intern_table_fini(rmw_qos_profile_intern_table_t * table)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(table, RMW_RET_INVALID_ARGUMENT);
+  rcutils_allocator_t * allocator = &table->allocator;
+  if (table->profiles) {
+    allocator->deallocate(table->profiles, allocator->state);
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_QOS_PROFILE_INTERN_TABLE);
+  }
+  if (table->slots) {
+    allocator->deallocate(table->slots, allocator->state);
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_QOS_PROFILE_INTERN_TABLE);
+  }
+  *table = rmw_get_zero_initialized_qos_profile_intern_table();
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_qos_profile_intern(
+  rmw_qos_profile_intern_table_t * table,
+  const rmw_qos_profile_t * profile,
+  rmw_qos_profile_id_t * id)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(table, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(profile, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(id, RMW_RET_INVALID_ARGUMENT);
+  if (!rcutils_allocator_is_valid(&table->allocator)) {
+    RMW_SET_ERROR_MSG("table is not initialized");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  const size_t hash = rmw_qos_profile_hash(profile);
+  size_t slot = 0u;
+  if (0u != table->slot_count) {
+    slot = _rmw_qos_profile_intern_table_find_slot(table, profile, hash);
+    if (0u != table->slots[slot]) {
+      *id = table->slots[slot] - 1u;
+      return RMW_RET_OK;
+    }
+  }
+
+  if (table->size == table->capacity) {
+    if (table->size >= RMW_QOS_PROFILE_INTERN_TABLE_MAX_CAPACITY) {
+      RMW_SET_ERROR_MSG("intern table is full");
+      return RMW_RET_ERROR;
+    }
+    size_t capacity = RMW_QOS_PROFILE_INTERN_TABLE_MIN_CAPACITY;
+    if (table->capacity >= RMW_QOS_PROFILE_INTERN_TABLE_MAX_CAPACITY / 2u) {
+      capacity = RMW_QOS_PROFILE_INTERN_TABLE_MAX_CAPACITY;
+    } else if (table->capacity >= capacity / 2u) {
+      capacity = 2u * table->capacity;
+    }
+    rmw_ret_t ret = _rmw_qos_profile_intern_table_reserve(table, capacity);
+    if (RMW_RET_OK != ret) {
+      return ret;
+    }
+    slot = _rmw_qos_profile_intern_table_find_slot(table, profile, hash);
+  }
+  table->profiles[table->size] = *profile;
+  table->slots[slot] = (rmw_qos_profile_id_t)(table->size + 1u);
+  *id = (rmw_qos_profile_id_t)table->size;
+  ++table->size;
+  return RMW_RET_OK;
+}
+
+const rmw_qos_profile_t *
+rmw_qos_profile_intern_table_get(
+  const rmw_qos_profile_intern_table_t * table,
+  rmw_qos_profile_id_t id)
+{
+  if (!table || id >= table->size) {
+    return NULL;
+  }
+  return &table->profiles[id];
+}
@@ -0,0 +1,368 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/qos_profiles.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rcutils/snprintf.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/qos_string_conversions.h"
+#include "rmw/time.h"
+
+#define RMW_QOS_RELIABILITY_COUNT (RMW_QOS_POLICY_RELIABILITY_BEST_AVAILABLE + 1)
+#define RMW_QOS_DURABILITY_COUNT (RMW_QOS_POLICY_DURABILITY_BEST_AVAILABLE + 1)
+#define RMW_QOS_LIVELINESS_COUNT (RMW_QOS_POLICY_LIVELINESS_BEST_AVAILABLE + 1)
+
+#define OK RMW_QOS_COMPATIBILITY_OK
+#define WARN RMW_QOS_COMPATIBILITY_WARNING
+#define ERR RMW_QOS_COMPATIBILITY_ERROR
+
+// Compatibility of the reliability of a publisher (rows) with that of a subscription (columns),
+// both in enum order: system_default, reliable, best_effort, unknown, best_available.
+// A best effort publisher cannot match a reliable subscription, and compatibility cannot be
+// determined when the policy of one side is "system default" or "unknown" and the other side
+// does not settle it.
+static const rmw_qos_compatibility_type_t
+  g_reliability_compatibility[RMW_QOS_RELIABILITY_COUNT][RMW_QOS_RELIABILITY_COUNT] =
+{
+  {WARN, WARN, OK, WARN, OK},
+  {OK, OK, OK, OK, OK},
+  {WARN, ERR, OK, WARN, OK},
+  {WARN, WARN, OK, WARN, OK},
+  {OK, OK, OK, OK, OK},
+};
+
+// Compatibility of the durability of a publisher (rows) with that of a subscription (columns),
+// both in enum order: system_default, transient_local, volatile, unknown, best_available.
+// A volatile publisher cannot match a transient local subscription.
+static const rmw_qos_compatibility_type_t
+  g_durability_compatibility[RMW_QOS_DURABILITY_COUNT][RMW_QOS_DURABILITY_COUNT] =
+{
+  {WARN, WARN, OK, WARN, OK},
+  {OK, OK, OK, OK, OK},
+  {WARN, ERR, OK, WARN, OK},
+  {WARN, WARN, OK, WARN, OK},
+  {OK, OK, OK, OK, OK},
+};
+
+// Compatibility of the liveliness of a publisher (rows) with that of a subscription (columns),
+// both in enum order: system_default, automatic, manual_by_node, manual_by_topic, unknown,
+// best_available.
+// A publisher with automatic liveliness cannot match a subscription with manual by topic one.
+static const rmw_qos_compatibility_type_t
+  g_liveliness_compatibility[RMW_QOS_LIVELINESS_COUNT][RMW_QOS_LIVELINESS_COUNT] =
+{
+  {WARN, OK, OK, WARN, WARN, OK},
+  {WARN, OK, OK, ERR, WARN, OK},
+  {OK, OK, OK, OK, OK, OK},
+  {OK, OK, OK, OK, OK, OK},
+  {WARN, OK, OK, WARN, WARN, OK},
+  {OK, OK, OK, OK, OK, OK},
+};
+
+#undef OK
+#undef WARN
+#undef ERR
+
+// Policies of a publisher, looked up once for all the subscriptions it is checked against.
+typedef struct rmw_qos_publisher_policies_s
+{
+  const rmw_qos_compatibility_type_t * reliability;
+  const rmw_qos_compatibility_type_t * durability;
+  const rmw_qos_compatibility_type_t * liveliness;
+  bool has_deadline;
+  rmw_duration_t deadline;
+  bool has_liveliness_lease_duration;
+  rmw_duration_t liveliness_lease_duration;
+} rmw_qos_publisher_policies_t;
+
+// Reason buffer, appended to until it is full.
+typedef struct rmw_qos_reason_s
+{
+  char * buffer;
+  size_t size;
+  size_t length;
+} rmw_qos_reason_t;
+
+// Account for what rcutils_snprintf() wrote, stopping at the terminator on truncation.
+static void
+_rmw_qos_reason_advance(rmw_qos_reason_t * reason, int ret)
+{
+  if (ret > 0) {
+    const size_t written = (size_t)ret;
+    reason->length = written < reason->size - reason->length ?
+      reason->length + written : reason->size - 1u;
+  }
+}
+
+static void
+_rmw_qos_append_reason(rmw_qos_reason_t * reason, const char * message)
+{
+  if (!reason || reason->length + 1u >= reason->size) {
+    return;
+  }
+  _rmw_qos_reason_advance(
+    reason, rcutils_snprintf(
+      reason->buffer + reason->length, reason->size - reason->length, "%s", message));
+}
+
+static void
+_rmw_qos_append_warning(
+  rmw_qos_reason_t * reason,
+  rmw_qos_policy_kind_t kind,
+  const char * publisher_value,
+  const char * subscription_value)
+{
+  if (!reason || reason->length + 1u >= reason->size) {
+    return;
+  }
+  const char * policy = rmw_qos_policy_kind_to_str(kind);
+  _rmw_qos_reason_advance(
+    reason, rcutils_snprintf(
+      reason->buffer + reason->length, reason->size - reason->length,
+      "WARNING: Publisher %s is %s and subscription %s is %s;",
+      policy, publisher_value ? publisher_value : "unknown",
+      policy, subscription_value ? subscription_value : "unknown"));
+}
+
+// Index of a policy value in the tables above, values out of range are unknown.
+#define RMW_QOS_POLICY_INDEX(value, unknown, best_available) \
+  ((unsigned int)(value) <= (unsigned int)(best_available) ? (unsigned int)(value) : \
+  (unsigned int)(unknown))
+
+static rmw_qos_publisher_policies_t
+_rmw_qos_get_publisher_policies(const rmw_qos_profile_t * publisher_profile)
+{
+  const rmw_time_t deadline_default = RMW_QOS_DEADLINE_DEFAULT;
+  const rmw_time_t lease_default = RMW_QOS_LIVELINESS_LEASE_DURATION_DEFAULT;
+  rmw_qos_publisher_policies_t policies;
+  policies.reliability = g_reliability_compatibility[RMW_QOS_POLICY_INDEX(
+      publisher_profile->reliability, RMW_QOS_POLICY_RELIABILITY_UNKNOWN,
+      RMW_QOS_POLICY_RELIABILITY_BEST_AVAILABLE)];
+  policies.durability = g_durability_compatibility[RMW_QOS_POLICY_INDEX(
+      publisher_profile->durability, RMW_QOS_POLICY_DURABILITY_UNKNOWN,
+      RMW_QOS_POLICY_DURABILITY_BEST_AVAILABLE)];
+  policies.liveliness = g_liveliness_compatibility[RMW_QOS_POLICY_INDEX(
+      publisher_profile->liveliness, RMW_QOS_POLICY_LIVELINESS_UNKNOWN,
+      RMW_QOS_POLICY_LIVELINESS_BEST_AVAILABLE)];
+  policies.has_deadline = !rmw_time_equal(publisher_profile->deadline, deadline_default);
+  policies.deadline = rmw_time_total_nsec(publisher_profile->deadline);
+  policies.has_liveliness_lease_duration =
+    !rmw_time_equal(publisher_profile->liveliness_lease_duration, lease_default);
+  policies.liveliness_lease_duration =
+    rmw_time_total_nsec(publisher_profile->liveliness_lease_duration);
+  return policies;
+}
+
+// Check a publisher against a subscription, appending to the reason if there is one.
+static rmw_qos_compatibility_type_t
+_rmw_qos_check_compatible(
+  const rmw_qos_publisher_policies_t * publisher,
+  const rmw_qos_profile_t * publisher_profile,
+  const rmw_qos_profile_t * subscription_profile,
+  rmw_qos_reason_t * reason)
+{
+  const rmw_qos_compatibility_type_t reliability = publisher->reliability[RMW_QOS_POLICY_INDEX(
+      subscription_profile->reliability, RMW_QOS_POLICY_RELIABILITY_UNKNOWN,
+      RMW_QOS_POLICY_RELIABILITY_BEST_AVAILABLE)];
+  const rmw_qos_compatibility_type_t durability = publisher->durability[RMW_QOS_POLICY_INDEX(
+      subscription_profile->durability, RMW_QOS_POLICY_DURABILITY_UNKNOWN,
+      RMW_QOS_POLICY_DURABILITY_BEST_AVAILABLE)];
+  const rmw_qos_compatibility_type_t liveliness = publisher->liveliness[RMW_QOS_POLICY_INDEX(
+      subscription_profile->liveliness, RMW_QOS_POLICY_LIVELINESS_UNKNOWN,
+      RMW_QOS_POLICY_LIVELINESS_BEST_AVAILABLE)];
+
+  const rmw_time_t deadline_default = RMW_QOS_DEADLINE_DEFAULT;
+  const rmw_time_t lease_default = RMW_QOS_LIVELINESS_LEASE_DURATION_DEFAULT;
+  const bool subscription_has_deadline =
+    !rmw_time_equal(subscription_profile->deadline, deadline_default);
+  const bool subscription_has_liveliness_lease_duration =
+    !rmw_time_equal(subscription_profile->liveliness_lease_duration, lease_default);
+
+  rmw_qos_compatibility_type_t compatibility = RMW_QOS_COMPATIBILITY_OK;
+  if (RMW_QOS_COMPATIBILITY_ERROR == reliability) {
+    compatibility = RMW_QOS_COMPATIBILITY_ERROR;
+    _rmw_qos_append_reason(reason, "ERROR: Best effort publisher and reliable subscription;");
+  }
+  if (RMW_QOS_COMPATIBILITY_ERROR == durability) {
+    compatibility = RMW_QOS_COMPATIBILITY_ERROR;
+    _rmw_qos_append_reason(
+      reason, "ERROR: Volatile publisher and transient local subscription;");
+  }
+  if (subscription_has_deadline) {
+    if (!publisher->has_deadline) {
+      compatibility = RMW_QOS_COMPATIBILITY_ERROR;
+      _rmw_qos_append_reason(reason, "ERROR: Subscription has a deadline, but publisher does not;");
+    } else if (rmw_time_total_nsec(subscription_profile->deadline) < publisher->deadline) {
+      compatibility = RMW_QOS_COMPATIBILITY_ERROR;
+      _rmw_qos_append_reason(
+        reason, "ERROR: Subscription deadline is less than publisher deadline;");
+    }
+  }
+  if (RMW_QOS_COMPATIBILITY_ERROR == liveliness) {
+    compatibility = RMW_QOS_COMPATIBILITY_ERROR;
+    _rmw_qos_append_reason(
+      reason,
+      "ERROR: Publisher's liveliness is automatic and subscription's is manual by topic;");
+  }
+  if (subscription_has_liveliness_lease_duration) {
+    if (!publisher->has_liveliness_lease_duration) {
+      compatibility = RMW_QOS_COMPATIBILITY_ERROR;
+      _rmw_qos_append_reason(
+        reason, "ERROR: Subscription has a liveliness lease duration, but publisher does not;");
+    } else if (  // NOLINT
+      rmw_time_total_nsec(subscription_profile->liveliness_lease_duration) <
+      publisher->liveliness_lease_duration)
+    {
+      compatibility = RMW_QOS_COMPATIBILITY_ERROR;
+      _rmw_qos_append_reason(
+        reason, "ERROR: Subscription liveliness lease duration is less than publisher;");
+    }
+  }
+  // Only report warnings if there are no errors.
+  if (RMW_QOS_COMPATIBILITY_ERROR == compatibility) {
+    return compatibility;
+  }
+  if (RMW_QOS_COMPATIBILITY_WARNING == reliability) {
+    compatibility = RMW_QOS_COMPATIBILITY_WARNING;
+    _rmw_qos_append_warning(
+      reason, RMW_QOS_POLICY_RELIABILITY,
+      rmw_qos_reliability_policy_to_str(publisher_profile->reliability),
+      rmw_qos_reliability_policy_to_str(subscription_profile->reliability));
+  }
+  if (RMW_QOS_COMPATIBILITY_WARNING == durability) {
+    compatibility = RMW_QOS_COMPATIBILITY_WARNING;
+    _rmw_qos_append_warning(
+      reason, RMW_QOS_POLICY_DURABILITY,
+      rmw_qos_durability_policy_to_str(publisher_profile->durability),
+      rmw_qos_durability_policy_to_str(subscription_profile->durability));
+  }
+  if (RMW_QOS_COMPATIBILITY_WARNING == liveliness) {
+    compatibility = RMW_QOS_COMPATIBILITY_WARNING;
+    _rmw_qos_append_warning(
+      reason, RMW_QOS_POLICY_LIVELINESS,
+      rmw_qos_liveliness_policy_to_str(publisher_profile->liveliness),
+      rmw_qos_liveliness_policy_to_str(subscription_profile->liveliness));
+  }
+  return compatibility;
+}
+
+rmw_ret_t
+rmw_qos_profile_check_compatible(
+  const rmw_qos_profile_t publisher_profile,
+  const rmw_qos_profile_t subscription_profile,
+  rmw_qos_compatibility_type_t * compatibility,
+  char * reason,
+  size_t reason_size)
+{
+  if (!compatibility) {
+    RMW_SET_ERROR_MSG("compatibility parameter is null");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (!reason && reason_size != 0u) {
+    RMW_SET_ERROR_MSG("reason parameter is null, but reason_size parameter is not zero");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  rmw_qos_reason_t reason_buffer = {reason, reason_size, 0u};
+  if (reason && reason_size != 0u) {
+    reason[0] = '\0';
+  }
+  const rmw_qos_publisher_policies_t publisher =
+    _rmw_qos_get_publisher_policies(&publisher_profile);
+  *compatibility = _rmw_qos_check_compatible(
+    &publisher, &publisher_profile, &subscription_profile, reason ? &reason_buffer : NULL);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_qos_profile_check_compatible_with_subscriptions(
+  const rmw_qos_profile_t * publisher_profile,
+  const rmw_qos_profile_t * subscription_profiles,
+  size_t count,
+  rmw_qos_compatibility_type_t * compatibilities)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(publisher_profile, RMW_RET_INVALID_ARGUMENT);
+  if (count == 0u) {
+    return RMW_RET_OK;
+  }
+  RMW_CHECK_ARGUMENT_FOR_NULL(subscription_profiles, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(compatibilities, RMW_RET_INVALID_ARGUMENT);
+  const rmw_qos_publisher_policies_t publisher =
+    _rmw_qos_get_publisher_policies(publisher_profile);
+  for (size_t i = 0u; i < count; ++i) {
+    compatibilities[i] = _rmw_qos_check_compatible(
+      &publisher, publisher_profile, &subscription_profiles[i], NULL);
+  }
+  return RMW_RET_OK;
+}
+
+// 64-bit FNV-1a step over a whole policy value rather than over its bytes.
+static inline uint64_t
+_rmw_qos_hash_combine(uint64_t hash, uint64_t value)
+{
+  return (hash ^ value) * 1099511628211ULL;
+}
+
+size_t
+rmw_qos_profile_hash(const rmw_qos_profile_t * profile)
+{
+  if (!profile) {
+    return 0u;
+  }
+  uint64_t hash = 14695981039346656037ULL;
+  hash = _rmw_qos_hash_combine(hash, (uint64_t)profile->history);
+  hash = _rmw_qos_hash_combine(hash, (uint64_t)profile->depth);
+  hash = _rmw_qos_hash_combine(hash, (uint64_t)profile->reliability);
+  hash = _rmw_qos_hash_combine(hash, (uint64_t)profile->durability);
+  hash = _rmw_qos_hash_combine(hash, profile->deadline.sec);
+  hash = _rmw_qos_hash_combine(hash, profile->deadline.nsec);
+  hash = _rmw_qos_hash_combine(hash, profile->lifespan.sec);
+  hash = _rmw_qos_hash_combine(hash, profile->lifespan.nsec);
+  hash = _rmw_qos_hash_combine(hash, (uint64_t)profile->liveliness);
+  hash = _rmw_qos_hash_combine(hash, profile->liveliness_lease_duration.sec);
+  hash = _rmw_qos_hash_combine(hash, profile->liveliness_lease_duration.nsec);
+  hash = _rmw_qos_hash_combine(hash, (uint64_t)profile->avoid_ros_namespace_conventions);
+  // Fold the high bits in, they are the best mixed ones and would be lost on 32-bit platforms.
+  return (size_t)(hash ^ (hash >> 32));
+}
+
+static inline bool
+_rmw_qos_time_are_equal(rmw_time_t lhs, rmw_time_t rhs)
+{
+  return lhs.sec == rhs.sec && lhs.nsec == rhs.nsec;
+}
+
+bool
+rmw_qos_profile_are_equal(const rmw_qos_profile_t * lhs, const rmw_qos_profile_t * rhs)
+{
+  if (lhs == rhs) {
+    return true;
+  }
+  if (!lhs || !rhs) {
+    return false;
+  }
+  return
+    lhs->history == rhs->history &&
+    lhs->depth == rhs->depth &&
+    lhs->reliability == rhs->reliability &&
+    lhs->durability == rhs->durability &&
+    _rmw_qos_time_are_equal(lhs->deadline, rhs->deadline) &&
+    _rmw_qos_time_are_equal(lhs->lifespan, rhs->lifespan) &&
+    lhs->liveliness == rhs->liveliness &&
+    _rmw_qos_time_are_equal(lhs->liveliness_lease_duration, rhs->liveliness_lease_duration) &&
+    lhs->avoid_ros_namespace_conventions == rhs->avoid_ros_namespace_conventions;
+}
@@ -12,8 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
 #include "rmw/error_handling.h"
 #include "rmw/qos_string_conversions.h"
+#include "rmw/time.h"
 
 const char *
 rmw_qos_policy_kind_to_str(rmw_qos_policy_kind_t kind)
@@ -113,112 +118,472 @@ rmw_qos_reliability_policy_to_str(enum rmw_qos_reliability_policy_e value)
   }
 }
 
-#define RMW_QOS_STREQ_WITH_LITERAL(string_literal, string) \
-  (0 == strncmp(string_literal, str, sizeof(string_literal)))
+// Longest string any of the functions below parses, longer strings never match.
+#define RMW_QOS_MAX_STR_LENGTH (sizeof("avoid_ros_namespace_conventions") - 1)
 
-rmw_qos_policy_kind_t
-rmw_qos_policy_kind_from_str(const char * str)
+// Length of a string literal, usable in case labels.
+#define RMW_QOS_LITERAL_LENGTH(string_literal) (sizeof(string_literal) - 1)
+
+// Whether a string of the same length as the literal is equal to it.
+#define RMW_QOS_STREQ_WITH_LITERAL(string_literal, str) \
+  (0 == memcmp(string_literal, str, RMW_QOS_LITERAL_LENGTH(string_literal)))
+
+// Length of the string, or RMW_QOS_MAX_STR_LENGTH + 1 if it is longer than that.
+static size_t
+_rmw_qos_str_length(const char * str)
 {
-  RMW_CHECK_ARGUMENT_FOR_NULL(str, RMW_QOS_POLICY_INVALID);
-  if (RMW_QOS_STREQ_WITH_LITERAL("durability", str)) {
-    return RMW_QOS_POLICY_DURABILITY;
+  size_t length = 0;
+  while (length <= RMW_QOS_MAX_STR_LENGTH && str[length] != '\0') {
+    ++length;
   }
-  if (RMW_QOS_STREQ_WITH_LITERAL("deadline", str)) {
-    return RMW_QOS_POLICY_DEADLINE;
-  }
-  if (RMW_QOS_STREQ_WITH_LITERAL("liveliness", str)) {
-    return RMW_QOS_POLICY_LIVELINESS;
-  }
-  if (RMW_QOS_STREQ_WITH_LITERAL("reliability", str)) {
-    return RMW_QOS_POLICY_RELIABILITY;
-  }
-  if (RMW_QOS_STREQ_WITH_LITERAL("history", str)) {
-    return RMW_QOS_POLICY_HISTORY;
+  return length;
+}
+
+// Strings of the given length are parsed by switching on that length, then on their first
+// character when several strings share a length, so that at most one full comparison is made.
+// They need not be null terminated.
+
+static rmw_qos_policy_kind_t
+_rmw_qos_policy_kind_from_str_with_length(const char * str, size_t length)
+{
+  switch (length) {
+    case RMW_QOS_LITERAL_LENGTH("depth"):
+      if (RMW_QOS_STREQ_WITH_LITERAL("depth", str)) {
+        return RMW_QOS_POLICY_DEPTH;
+      }
+      break;
+    case RMW_QOS_LITERAL_LENGTH("history"):
+      if (RMW_QOS_STREQ_WITH_LITERAL("history", str)) {
+        return RMW_QOS_POLICY_HISTORY;
+      }
+      break;
+    case RMW_QOS_LITERAL_LENGTH("deadline"):  // or "lifespan"
+      if (str[0] == 'd' && RMW_QOS_STREQ_WITH_LITERAL("deadline", str)) {
+        return RMW_QOS_POLICY_DEADLINE;
+      }
+      if (str[0] == 'l' && RMW_QOS_STREQ_WITH_LITERAL("lifespan", str)) {
+        return RMW_QOS_POLICY_LIFESPAN;
+      }
+      break;
+    case RMW_QOS_LITERAL_LENGTH("durability"):  // or "liveliness"
+      if (str[0] == 'd' && RMW_QOS_STREQ_WITH_LITERAL("durability", str)) {
+        return RMW_QOS_POLICY_DURABILITY;
+      }
+      if (str[0] == 'l' && RMW_QOS_STREQ_WITH_LITERAL("liveliness", str)) {
+        return RMW_QOS_POLICY_LIVELINESS;
+      }
+      break;
+    case RMW_QOS_LITERAL_LENGTH("reliability"):
+      if (RMW_QOS_STREQ_WITH_LITERAL("reliability", str)) {
+        return RMW_QOS_POLICY_RELIABILITY;
+      }
+      break;
+    case RMW_QOS_LITERAL_LENGTH("liveliness_lease_duration"):
+      if (RMW_QOS_STREQ_WITH_LITERAL("liveliness_lease_duration", str)) {
+        return RMW_QOS_POLICY_LIVELINESS_LEASE_DURATION;
+      }
+      break;
+    case RMW_QOS_LITERAL_LENGTH("avoid_ros_namespace_conventions"):
+      if (RMW_QOS_STREQ_WITH_LITERAL("avoid_ros_namespace_conventions", str)) {
+        return RMW_QOS_POLICY_AVOID_ROS_NAMESPACE_CONVENTIONS;
+      }
+      break;
+    default:
+      break;
   }
-  if (RMW_QOS_STREQ_WITH_LITERAL("lifespan", str)) {
-    return RMW_QOS_POLICY_LIFESPAN;
+  return RMW_QOS_POLICY_INVALID;
+}
+
+static enum rmw_qos_durability_policy_e
+_rmw_qos_durability_policy_from_str_with_length(const char * str, size_t length)
+{
+  switch (length) {
+    case RMW_QOS_LITERAL_LENGTH("volatile"):
+      if (RMW_QOS_STREQ_WITH_LITERAL("volatile", str)) {
+        return RMW_QOS_POLICY_DURABILITY_VOLATILE;
+      }
+      break;
+    case RMW_QOS_LITERAL_LENGTH("system_default"):  // or "best_available"
+      if (str[0] == 's' && RMW_QOS_STREQ_WITH_LITERAL("system_default", str)) {
+        return RMW_QOS_POLICY_DURABILITY_SYSTEM_DEFAULT;
+      }
+      if (str[0] == 'b' && RMW_QOS_STREQ_WITH_LITERAL("best_available", str)) {
+        return RMW_QOS_POLICY_DURABILITY_BEST_AVAILABLE;
+      }
+      break;
+    case RMW_QOS_LITERAL_LENGTH("transient_local"):
+      if (RMW_QOS_STREQ_WITH_LITERAL("transient_local", str)) {
+        return RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL;
+      }
+      break;
+    default:
+      break;
   }
-  if (RMW_QOS_STREQ_WITH_LITERAL("depth", str)) {
-    return RMW_QOS_POLICY_DEPTH;
+  return RMW_QOS_POLICY_DURABILITY_UNKNOWN;
+}
+
+static enum rmw_qos_history_policy_e
+_rmw_qos_history_policy_from_str_with_length(const char * str, size_t length)
+{
+  switch (length) {
+    case RMW_QOS_LITERAL_LENGTH("keep_all"):
+      if (RMW_QOS_STREQ_WITH_LITERAL("keep_all", str)) {
+        return RMW_QOS_POLICY_HISTORY_KEEP_ALL;
+      }
+      break;
+    case RMW_QOS_LITERAL_LENGTH("keep_last"):
+      if (RMW_QOS_STREQ_WITH_LITERAL("keep_last", str)) {
+        return RMW_QOS_POLICY_HISTORY_KEEP_LAST;
+      }
+      break;
+    case RMW_QOS_LITERAL_LENGTH("system_default"):
+      if (RMW_QOS_STREQ_WITH_LITERAL("system_default", str)) {
+        return RMW_QOS_POLICY_HISTORY_SYSTEM_DEFAULT;
+      }
+      break;
+    default:
+      break;
   }
-  if (RMW_QOS_STREQ_WITH_LITERAL("liveliness_lease_duration", str)) {
-    return RMW_QOS_POLICY_LIVELINESS_LEASE_DURATION;
+  return RMW_QOS_POLICY_HISTORY_UNKNOWN;
+}
+
+static enum rmw_qos_liveliness_policy_e
+_rmw_qos_liveliness_policy_from_str_with_length(const char * str, size_t length)
+{
+  switch (length) {
+    case RMW_QOS_LITERAL_LENGTH("automatic"):
+      if (RMW_QOS_STREQ_WITH_LITERAL("automatic", str)) {
+        return RMW_QOS_POLICY_LIVELINESS_AUTOMATIC;
+      }
+      break;
+    case RMW_QOS_LITERAL_LENGTH("system_default"):  // or "best_available"
+      if (str[0] == 's' && RMW_QOS_STREQ_WITH_LITERAL("system_default", str)) {
+        return RMW_QOS_POLICY_LIVELINESS_SYSTEM_DEFAULT;
+      }
+      if (str[0] == 'b' && RMW_QOS_STREQ_WITH_LITERAL("best_available", str)) {
+        return RMW_QOS_POLICY_LIVELINESS_BEST_AVAILABLE;
+      }
+      break;
+    case RMW_QOS_LITERAL_LENGTH("manual_by_topic"):
+      if (RMW_QOS_STREQ_WITH_LITERAL("manual_by_topic", str)) {
+        return RMW_QOS_POLICY_LIVELINESS_MANUAL_BY_TOPIC;
+      }
+      break;
+    default:
+      break;
   }
-  if (RMW_QOS_STREQ_WITH_LITERAL("avoid_ros_namespace_conventions", str)) {
-    return RMW_QOS_POLICY_AVOID_ROS_NAMESPACE_CONVENTIONS;
+  return RMW_QOS_POLICY_LIVELINESS_UNKNOWN;
+}
+
+static enum rmw_qos_reliability_policy_e
+_rmw_qos_reliability_policy_from_str_with_length(const char * str, size_t length)
+{
+  switch (length) {
+    case RMW_QOS_LITERAL_LENGTH("reliable"):
+      if (RMW_QOS_STREQ_WITH_LITERAL("reliable", str)) {
+        return RMW_QOS_POLICY_RELIABILITY_RELIABLE;
+      }
+      break;
+    case RMW_QOS_LITERAL_LENGTH("best_effort"):
+      if (RMW_QOS_STREQ_WITH_LITERAL("best_effort", str)) {
+        return RMW_QOS_POLICY_RELIABILITY_BEST_EFFORT;
+      }
+      break;
+    case RMW_QOS_LITERAL_LENGTH("system_default"):  // or "best_available"
+      if (str[0] == 's' && RMW_QOS_STREQ_WITH_LITERAL("system_default", str)) {
+        return RMW_QOS_POLICY_RELIABILITY_SYSTEM_DEFAULT;
+      }
+      if (str[0] == 'b' && RMW_QOS_STREQ_WITH_LITERAL("best_available", str)) {
+        return RMW_QOS_POLICY_RELIABILITY_BEST_AVAILABLE;
+      }
+      break;
+    default:
+      break;
   }
-  return RMW_QOS_POLICY_INVALID;
+  return RMW_QOS_POLICY_RELIABILITY_UNKNOWN;
+}
+
+rmw_qos_policy_kind_t
+rmw_qos_policy_kind_from_str(const char * str)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(str, RMW_QOS_POLICY_INVALID);
+  return _rmw_qos_policy_kind_from_str_with_length(str, _rmw_qos_str_length(str));
 }
 
 enum rmw_qos_durability_policy_e
 rmw_qos_durability_policy_from_str(const char * str)
 {
   RMW_CHECK_ARGUMENT_FOR_NULL(str, RMW_QOS_POLICY_DURABILITY_UNKNOWN);
-  if (RMW_QOS_STREQ_WITH_LITERAL("system_default", str)) {
-    return RMW_QOS_POLICY_DURABILITY_SYSTEM_DEFAULT;
-  }
-  if (RMW_QOS_STREQ_WITH_LITERAL("transient_local", str)) {
-    return RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL;
-  }
-  if (RMW_QOS_STREQ_WITH_LITERAL("volatile", str)) {
-    return RMW_QOS_POLICY_DURABILITY_VOLATILE;
-  }
-  if (RMW_QOS_STREQ_WITH_LITERAL("best_available", str)) {
-    return RMW_QOS_POLICY_DURABILITY_BEST_AVAILABLE;
-  }
-  return RMW_QOS_POLICY_DURABILITY_UNKNOWN;
+  return _rmw_qos_durability_policy_from_str_with_length(str, _rmw_qos_str_length(str));
 }
 
 enum rmw_qos_history_policy_e
 rmw_qos_history_policy_from_str(const char * str)
 {
   RMW_CHECK_ARGUMENT_FOR_NULL(str, RMW_QOS_POLICY_HISTORY_UNKNOWN);
-  if (RMW_QOS_STREQ_WITH_LITERAL("system_default", str)) {
-    return RMW_QOS_POLICY_HISTORY_SYSTEM_DEFAULT;
-  }
-  if (RMW_QOS_STREQ_WITH_LITERAL("keep_last", str)) {
-    return RMW_QOS_POLICY_HISTORY_KEEP_LAST;
-  }
-  if (RMW_QOS_STREQ_WITH_LITERAL("keep_all", str)) {
-    return RMW_QOS_POLICY_HISTORY_KEEP_ALL;
-  }
-  return RMW_QOS_POLICY_HISTORY_UNKNOWN;
+  return _rmw_qos_history_policy_from_str_with_length(str, _rmw_qos_str_length(str));
 }
 
 enum rmw_qos_liveliness_policy_e
 rmw_qos_liveliness_policy_from_str(const char * str)
 {
   RMW_CHECK_ARGUMENT_FOR_NULL(str, RMW_QOS_POLICY_LIVELINESS_UNKNOWN);
-  if (RMW_QOS_STREQ_WITH_LITERAL("system_default", str)) {
-    return RMW_QOS_POLICY_LIVELINESS_SYSTEM_DEFAULT;
+  return _rmw_qos_liveliness_policy_from_str_with_length(str, _rmw_qos_str_length(str));
+}
+
+enum rmw_qos_reliability_policy_e
+rmw_qos_reliability_policy_from_str(const char * str)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(str, RMW_QOS_POLICY_RELIABILITY_UNKNOWN);
+  return _rmw_qos_reliability_policy_from_str_with_length(str, _rmw_qos_str_length(str));
+}
+
+// Buffer a string is written to piece by piece, remembering whether it ran out of space.
+typedef struct rmw_qos_str_writer_s
+{
+  char * buffer;
+  size_t size;
+  size_t length;
+  bool overflow;
+} rmw_qos_str_writer_t;
+
+static void
+_rmw_qos_str_write(rmw_qos_str_writer_t * writer, const char * str, size_t length)
+{
+  // Keep room for the null terminator.
+  if (writer->overflow || length >= writer->size - writer->length) {
+    writer->overflow = true;
+    return;
+  }
+  memcpy(writer->buffer + writer->length, str, length);
+  writer->length += length;
+}
+
+#define RMW_QOS_STR_WRITE_LITERAL(writer, string_literal) \
+  _rmw_qos_str_write(writer, string_literal, RMW_QOS_LITERAL_LENGTH(string_literal))
+
+static void
+_rmw_qos_str_write_str(rmw_qos_str_writer_t * writer, const char * str)
+{
+  _rmw_qos_str_write(writer, str, strlen(str));
+}
+
+// Write an unsigned integer in decimal, padded with leading zeros up to min_digits.
+static void
+_rmw_qos_str_write_uint64(rmw_qos_str_writer_t * writer, uint64_t value, size_t min_digits)
+{
+  char digits[20];
+  size_t count = 0;
+  do {
+    digits[sizeof(digits) - ++count] = (char)('0' + value % 10u);
+    value /= 10u;
+  } while (value != 0u || count < min_digits);
+  _rmw_qos_str_write(writer, digits + sizeof(digits) - count, count);
+}
+
+static void
+_rmw_qos_str_write_time(rmw_qos_str_writer_t * writer, rmw_time_t time)
+{
+  const rmw_time_t infinite = RMW_DURATION_INFINITE;
+  if (rmw_time_equal(time, infinite)) {
+    RMW_QOS_STR_WRITE_LITERAL(writer, "infinite");
+    return;
   }
-  if (RMW_QOS_STREQ_WITH_LITERAL("automatic", str)) {
-    return RMW_QOS_POLICY_LIVELINESS_AUTOMATIC;
+  time = rmw_time_normalize(time);
+  _rmw_qos_str_write_uint64(writer, time.sec, 1u);
+  RMW_QOS_STR_WRITE_LITERAL(writer, ".");
+  _rmw_qos_str_write_uint64(writer, time.nsec, 9u);
+}
+
+rmw_ret_t
+rmw_qos_profile_to_str(
+  const rmw_qos_profile_t * qos_profile,
+  char * buffer,
+  size_t buffer_size)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(qos_profile, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(buffer, RMW_RET_INVALID_ARGUMENT);
+  const char * history = rmw_qos_history_policy_to_str(qos_profile->history);
+  const char * reliability = rmw_qos_reliability_policy_to_str(qos_profile->reliability);
+  const char * durability = rmw_qos_durability_policy_to_str(qos_profile->durability);
+  const char * liveliness = rmw_qos_liveliness_policy_to_str(qos_profile->liveliness);
+  if (!history || !reliability || !durability || !liveliness) {
+    RMW_SET_ERROR_MSG("qos profile has an unknown policy value");
+    return RMW_RET_INVALID_ARGUMENT;
   }
-  if (RMW_QOS_STREQ_WITH_LITERAL("manual_by_topic", str)) {
-    return RMW_QOS_POLICY_LIVELINESS_MANUAL_BY_TOPIC;
+
+  rmw_qos_str_writer_t writer = {buffer, buffer_size, 0u, 0u == buffer_size};
+  RMW_QOS_STR_WRITE_LITERAL(&writer, "history=");
+  _rmw_qos_str_write_str(&writer, history);
+  RMW_QOS_STR_WRITE_LITERAL(&writer, ",depth=");
+  _rmw_qos_str_write_uint64(&writer, qos_profile->depth, 1u);
+  RMW_QOS_STR_WRITE_LITERAL(&writer, ",reliability=");
+  _rmw_qos_str_write_str(&writer, reliability);
+  RMW_QOS_STR_WRITE_LITERAL(&writer, ",durability=");
+  _rmw_qos_str_write_str(&writer, durability);
+  RMW_QOS_STR_WRITE_LITERAL(&writer, ",deadline=");
+  _rmw_qos_str_write_time(&writer, qos_profile->deadline);
+  RMW_QOS_STR_WRITE_LITERAL(&writer, ",lifespan=");
+  _rmw_qos_str_write_time(&writer, qos_profile->lifespan);
+  RMW_QOS_STR_WRITE_LITERAL(&writer, ",liveliness=");
+  _rmw_qos_str_write_str(&writer, liveliness);
+  RMW_QOS_STR_WRITE_LITERAL(&writer, ",liveliness_lease_duration=");
+  _rmw_qos_str_write_time(&writer, qos_profile->liveliness_lease_duration);
+  if (qos_profile->avoid_ros_namespace_conventions) {
+    RMW_QOS_STR_WRITE_LITERAL(&writer, ",avoid_ros_namespace_conventions=true");
+  } else {
+    RMW_QOS_STR_WRITE_LITERAL(&writer, ",avoid_ros_namespace_conventions=false");
   }
-  if (RMW_QOS_STREQ_WITH_LITERAL("best_available", str)) {
-    return RMW_QOS_POLICY_LIVELINESS_BEST_AVAILABLE;
+  if (writer.overflow) {
+    RMW_SET_ERROR_MSG("buffer is too small for the stringified qos profile");
+    return RMW_RET_INVALID_ARGUMENT;
   }
-  return RMW_QOS_POLICY_LIVELINESS_UNKNOWN;
+  buffer[writer.length] = '\0';
+  return RMW_RET_OK;
 }
 
-enum rmw_qos_reliability_policy_e
-rmw_qos_reliability_policy_from_str(const char * str)
+// Parse an unsigned decimal integer of the given length, made of digits only.
+static bool
+_rmw_qos_str_parse_uint64(const char * str, size_t length, uint64_t * value)
 {
-  RMW_CHECK_ARGUMENT_FOR_NULL(str, RMW_QOS_POLICY_RELIABILITY_UNKNOWN);
-  if (RMW_QOS_STREQ_WITH_LITERAL("system_default", str)) {
-    return RMW_QOS_POLICY_RELIABILITY_SYSTEM_DEFAULT;
+  if (length == 0u) {
+    return false;
   }
-  if (RMW_QOS_STREQ_WITH_LITERAL("reliable", str)) {
-    return RMW_QOS_POLICY_RELIABILITY_RELIABLE;
+  uint64_t result = 0u;
+  for (size_t i = 0; i < length; ++i) {
+    if (str[i] < '0' || str[i] > '9') {
+      return false;
+    }
+    const uint64_t digit = (uint64_t)(str[i] - '0');
+    if (result > (UINT64_MAX - digit) / 10u) {
+      return false;
+    }
+    result = result * 10u + digit;
   }
-  if (RMW_QOS_STREQ_WITH_LITERAL("best_effort", str)) {
-    return RMW_QOS_POLICY_RELIABILITY_BEST_EFFORT;
+  *value = result;
+  return true;
+}
+
+// Parse a duration as written by _rmw_qos_str_write_time(), or with a shorter fraction.
+static bool
+_rmw_qos_str_parse_time(const char * str, size_t length, rmw_time_t * time)
+{
+  if (
+    length == RMW_QOS_LITERAL_LENGTH("infinite") &&
+    RMW_QOS_STREQ_WITH_LITERAL("infinite", str))
+  {
+    const rmw_time_t infinite = RMW_DURATION_INFINITE;
+    *time = infinite;
+    return true;
   }
-  if (RMW_QOS_STREQ_WITH_LITERAL("best_available", str)) {
-    return RMW_QOS_POLICY_RELIABILITY_BEST_AVAILABLE;
+  const char * dot = memchr(str, '.', length);
+  const size_t sec_length = dot ? (size_t)(dot - str) : length;
+  rmw_time_t result = {0u, 0u};
+  if (!_rmw_qos_str_parse_uint64(str, sec_length, &result.sec)) {
+    return false;
   }
-  return RMW_QOS_POLICY_RELIABILITY_UNKNOWN;
+  if (dot) {
+    const size_t fraction_length = length - sec_length - 1u;
+    if (
+      fraction_length > 9u ||
+      !_rmw_qos_str_parse_uint64(dot + 1, fraction_length, &result.nsec))
+    {
+      return false;
+    }
+    for (size_t i = fraction_length; i < 9u; ++i) {
+      result.nsec *= 10u;
+    }
+  }
+  *time = result;
+  return true;
+}
+
+rmw_ret_t
+rmw_qos_profile_from_str(const char * str, rmw_qos_profile_t * qos_profile)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(str, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(qos_profile, RMW_RET_INVALID_ARGUMENT);
+  // Parse into a copy, so that the profile is left untouched on failure.
+  rmw_qos_profile_t result = *qos_profile;
+  const char * pair = str;
+  while (*pair != '\0') {
+    // Find the end of the key and of the value in one go.
+    const char * equal = NULL;
+    const char * end = pair;
+    while (*end != '\0' && *end != ',') {
+      if (!equal && *end == '=') {
+        equal = end;
+      }
+      ++end;
+    }
+    if (!equal) {
+      RMW_SET_ERROR_MSG("qos profile string has a policy without a value");
+      return RMW_RET_INVALID_ARGUMENT;
+    }
+    const char * value = equal + 1;
+    const size_t value_length = (size_t)(end - value);
+
+    bool valid = false;
+    uint64_t depth = 0u;
+    switch (_rmw_qos_policy_kind_from_str_with_length(pair, (size_t)(equal - pair))) {
+      case RMW_QOS_POLICY_HISTORY:
+        result.history = _rmw_qos_history_policy_from_str_with_length(value, value_length);
+        valid = result.history != RMW_QOS_POLICY_HISTORY_UNKNOWN;
+        break;
+      case RMW_QOS_POLICY_DEPTH:
+        valid = _rmw_qos_str_parse_uint64(value, value_length, &depth) &&
+          (uint64_t)(size_t)depth == depth;
+        result.depth = (size_t)depth;
+        break;
+      case RMW_QOS_POLICY_RELIABILITY:
+        result.reliability =
+          _rmw_qos_reliability_policy_from_str_with_length(value, value_length);
+        valid = result.reliability != RMW_QOS_POLICY_RELIABILITY_UNKNOWN;
+        break;
+      case RMW_QOS_POLICY_DURABILITY:
+        result.durability = _rmw_qos_durability_policy_from_str_with_length(value, value_length);
+        valid = result.durability != RMW_QOS_POLICY_DURABILITY_UNKNOWN;
+        break;
+      case RMW_QOS_POLICY_DEADLINE:
+        valid = _rmw_qos_str_parse_time(value, value_length, &result.deadline);
+        break;
+      case RMW_QOS_POLICY_LIFESPAN:
+        valid = _rmw_qos_str_parse_time(value, value_length, &result.lifespan);
+        break;
+      case RMW_QOS_POLICY_LIVELINESS:
+        result.liveliness = _rmw_qos_liveliness_policy_from_str_with_length(value, value_length);
+        valid = result.liveliness != RMW_QOS_POLICY_LIVELINESS_UNKNOWN;
+        break;
+      case RMW_QOS_POLICY_LIVELINESS_LEASE_DURATION:
+        valid = _rmw_qos_str_parse_time(value, value_length, &result.liveliness_lease_duration);
+        break;
+      case RMW_QOS_POLICY_AVOID_ROS_NAMESPACE_CONVENTIONS:
+        result.avoid_ros_namespace_conventions =
+          value_length == RMW_QOS_LITERAL_LENGTH("true") &&
+          RMW_QOS_STREQ_WITH_LITERAL("true", value);
+        valid = result.avoid_ros_namespace_conventions || (
+          value_length == RMW_QOS_LITERAL_LENGTH("false") &&
+          RMW_QOS_STREQ_WITH_LITERAL("false", value));
+        break;
+      case RMW_QOS_POLICY_INVALID:  // fallthrough
+      default:
+        RMW_SET_ERROR_MSG("qos profile string has an unknown policy");
+        return RMW_RET_INVALID_ARGUMENT;
+    }
+    if (!valid) {
+      RMW_SET_ERROR_MSG("qos profile string has an invalid policy value");
+      return RMW_RET_INVALID_ARGUMENT;
+    }
+
+    if (*end == '\0') {
+      break;
+    }
+    pair = end + 1;
+    if (*pair == '\0') {
+      RMW_SET_ERROR_MSG("qos profile string has a trailing ','");
+      return RMW_RET_INVALID_ARGUMENT;
+    }
+  }
+  *qos_profile = result;
+  return RMW_RET_OK;
 }
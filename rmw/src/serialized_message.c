@@ -0,0 +1,363 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/serialized_message.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "rcutils/macros.h"
+#include "rcutils/stdatomic_helper.h"
+
+#include "rmw/convert_rcutils_ret_to_rmw_ret.h"
+#include "rmw/error_handling.h"
+
+#include "./allocation_tracking.h"
+
+rmw_chained_serialized_message_t
+rmw_get_zero_initialized_chained_serialized_message(void)
+{
+  rmw_chained_serialized_message_t zero;
+  memset(&zero, 0, sizeof(zero));
+  zero.linearized = rmw_get_zero_initialized_serialized_message();
+  zero.allocator = rcutils_get_zero_initialized_allocator();
+  return zero;
+}
+
+rmw_ret_t
+rmw_chained_serialized_message_init(
+  rmw_chained_serialized_message_t * message,
+  size_t segment_capacity,
+  const rcutils_allocator_t * allocator)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(message, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    allocator, "allocator is invalid", return RMW_RET_INVALID_ARGUMENT);
+  if (segment_capacity > SIZE_MAX / sizeof(rmw_serialized_message_segment_t)) {
+    RMW_SET_ERROR_MSG("segment capacity is too large");
+    return RMW_RET_BAD_ALLOC;
+  }
+
+  *message = rmw_get_zero_initialized_chained_serialized_message();
+  if (segment_capacity > 0u) {
+    const size_t size = segment_capacity * sizeof(rmw_serialized_message_segment_t);
+    message->segments = allocator->allocate(size, allocator->state);
+    if (NULL == message->segments) {
+      RMW_SET_ERROR_MSG("failed to allocate memory for the segments");
+      return RMW_RET_BAD_ALLOC;
+    }
+    rmw_track_allocation(RMW_ALLOCATION_DOMAIN_SERIALIZED_MESSAGE, size);
+  }
+  message->segment_capacity = segment_capacity;
+  message->allocator = *allocator;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_chained_serialized_message_fini(rmw_chained_serialized_message_t * message)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(message, RMW_RET_INVALID_ARGUMENT);
+  if (NULL == message->segments && NULL == message->linearized.buffer) {
+    *message = rmw_get_zero_initialized_chained_serialized_message();
+    return RMW_RET_OK;
+  }
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    &message->allocator, "allocator is invalid", return RMW_RET_INVALID_ARGUMENT);
+
+  if (NULL != message->segments) {
+    message->allocator.deallocate(message->segments, message->allocator.state);
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_SERIALIZED_MESSAGE);
+  }
+  if (NULL != message->linearized.buffer) {
+    rmw_ret_t ret = rmw_convert_rcutils_ret_to_rmw_ret(
+      rmw_serialized_message_fini(&message->linearized));
+    if (RMW_RET_OK != ret) {
+      return ret;
+    }
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_SERIALIZED_MESSAGE);
+  }
+  *message = rmw_get_zero_initialized_chained_serialized_message();
+  return RMW_RET_OK;
+}
+
+// Validate a segment about to be added, and make room for it in the segment array.
+static rmw_ret_t
+_rmw_chained_serialized_message_prepare_segment(
+  rmw_chained_serialized_message_t * message,
+  const uint8_t * buffer,
+  size_t buffer_length)
+{
+  if (!rcutils_allocator_is_valid(&message->allocator)) {
+    RMW_SET_ERROR_MSG("chained serialized message is not initialized");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (NULL == buffer && 0u != buffer_length) {
+    RMW_SET_ERROR_MSG("buffer is null while its length is not zero");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (buffer_length > SIZE_MAX - message->buffer_length) {
+    RMW_SET_ERROR_MSG("total length of the segments overflows");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (message->segment_count < message->segment_capacity) {
+    return RMW_RET_OK;
+  }
+
+  // Double the segment array, so that repeated growth takes amortized constant time.
+  size_t capacity = 0u == message->segment_capacity ? 4u : 2u * message->segment_capacity;
+  if (capacity <= message->segment_capacity ||
+    capacity > SIZE_MAX / sizeof(rmw_serialized_message_segment_t))
+  {
+    RMW_SET_ERROR_MSG("segment capacity is too large");
+    return RMW_RET_BAD_ALLOC;
+  }
+  const size_t size = capacity * sizeof(rmw_serialized_message_segment_t);
+  rmw_serialized_message_segment_t * segments =
+    message->allocator.reallocate(message->segments, size, message->allocator.state);
+  if (NULL == segments) {
+    RMW_SET_ERROR_MSG("failed to reallocate memory for the segments");
+    return RMW_RET_BAD_ALLOC;
+  }
+  if (NULL != message->segments) {
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_SERIALIZED_MESSAGE);
+  }
+  rmw_track_allocation(RMW_ALLOCATION_DOMAIN_SERIALIZED_MESSAGE, size);
+  message->segments = segments;
+  message->segment_capacity = capacity;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_chained_serialized_message_append(
+  rmw_chained_serialized_message_t * message,
+  const uint8_t * buffer,
+  size_t buffer_length)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(message, RMW_RET_INVALID_ARGUMENT);
+  rmw_ret_t ret =
+    _rmw_chained_serialized_message_prepare_segment(message, buffer, buffer_length);
+  if (RMW_RET_OK != ret || 0u == buffer_length) {
+    return ret;
+  }
+  rmw_serialized_message_segment_t * segment = &message->segments[message->segment_count++];
+  segment->buffer = buffer;
+  segment->buffer_length = buffer_length;
+  message->buffer_length += buffer_length;
+  message->is_linearized = false;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_chained_serialized_message_prepend(
+  rmw_chained_serialized_message_t * message,
+  const uint8_t * buffer,
+  size_t buffer_length)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(message, RMW_RET_INVALID_ARGUMENT);
+  rmw_ret_t ret =
+    _rmw_chained_serialized_message_prepare_segment(message, buffer, buffer_length);
+  if (RMW_RET_OK != ret || 0u == buffer_length) {
+    return ret;
+  }
+  if (message->segment_count > 0u) {
+    memmove(
+      &message->segments[1], &message->segments[0],
+      message->segment_count * sizeof(rmw_serialized_message_segment_t));
+  }
+  message->segments[0].buffer = buffer;
+  message->segments[0].buffer_length = buffer_length;
+  ++message->segment_count;
+  message->buffer_length += buffer_length;
+  message->is_linearized = false;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_chained_serialized_message_reset(rmw_chained_serialized_message_t * message)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(message, RMW_RET_INVALID_ARGUMENT);
+  message->segment_count = 0u;
+  message->buffer_length = 0u;
+  message->is_linearized = false;
+  return RMW_RET_OK;
+}
+
+size_t
+rmw_chained_serialized_message_get_length(const rmw_chained_serialized_message_t * message)
+{
+  if (NULL == message) {
+    return 0u;
+  }
+  return message->buffer_length;
+}
+
+rmw_ret_t
+rmw_chained_serialized_message_linearize(
+  rmw_chained_serialized_message_t * message,
+  rmw_serialized_message_t * serialized_message)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(message, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(serialized_message, RMW_RET_INVALID_ARGUMENT);
+  if (!rcutils_allocator_is_valid(&message->allocator)) {
+    RMW_SET_ERROR_MSG("chained serialized message is not initialized");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  *serialized_message = rmw_get_zero_initialized_serialized_message();
+  serialized_message->allocator = rcutils_get_zero_initialized_allocator();
+  if (0u == message->segment_count) {
+    return RMW_RET_OK;
+  }
+  if (1u == message->segment_count) {
+    // The view is read only, casting constness away is safe.
+    serialized_message->buffer = (uint8_t *)message->segments[0].buffer;
+    serialized_message->buffer_length = message->segments[0].buffer_length;
+    serialized_message->buffer_capacity = message->segments[0].buffer_length;
+    return RMW_RET_OK;
+  }
+
+  if (!message->is_linearized) {
+    rmw_serialized_message_t * linearized = &message->linearized;
+    if (linearized->buffer_capacity < message->buffer_length) {
+      rcutils_ret_t rcutils_ret = RCUTILS_RET_OK;
+      if (NULL == linearized->buffer) {
+        rcutils_ret = rmw_serialized_message_init(
+          linearized, message->buffer_length, &message->allocator);
+      } else {
+        rcutils_ret = rmw_serialized_message_resize(linearized, message->buffer_length);
+        if (RCUTILS_RET_OK == rcutils_ret) {
+          rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_SERIALIZED_MESSAGE);
+        }
+      }
+      if (RCUTILS_RET_OK != rcutils_ret) {
+        return rmw_convert_rcutils_ret_to_rmw_ret(rcutils_ret);
+      }
+      rmw_track_allocation(RMW_ALLOCATION_DOMAIN_SERIALIZED_MESSAGE, message->buffer_length);
+    }
+    uint8_t * destination = linearized->buffer;
+    for (size_t i = 0u; i < message->segment_count; ++i) {
+      memcpy(destination, message->segments[i].buffer, message->segments[i].buffer_length);
+      destination += message->segments[i].buffer_length;
+    }
+    linearized->buffer_length = message->buffer_length;
+    message->is_linearized = true;
+  }
+  serialized_message->buffer = message->linearized.buffer;
+  serialized_message->buffer_length = message->linearized.buffer_length;
+  serialized_message->buffer_capacity = message->linearized.buffer_capacity;
+  return RMW_RET_OK;
+}
+
+struct rmw_shared_serialized_message_s
+{
+  rmw_serialized_message_t serialized_message;
+  atomic_uint_least64_t reference_count;
+  rmw_shared_serialized_message_release_callback_t release_callback;
+  void * release_callback_data;
+  rcutils_allocator_t allocator;
+};
+
+rmw_ret_t
+rmw_shared_serialized_message_create(
+  rmw_serialized_message_t * serialized_message,
+  rmw_shared_serialized_message_release_callback_t release_callback,
+  void * release_callback_data,
+  const rcutils_allocator_t * allocator,
+  rmw_shared_serialized_message_t ** shared_serialized_message)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(serialized_message, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    allocator, "allocator is invalid", return RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(shared_serialized_message, RMW_RET_INVALID_ARGUMENT);
+
+  rmw_shared_serialized_message_t * shared =
+    allocator->allocate(sizeof(rmw_shared_serialized_message_t), allocator->state);
+  if (NULL == shared) {
+    RMW_SET_ERROR_MSG("failed to allocate memory for the shared serialized message");
+    return RMW_RET_BAD_ALLOC;
+  }
+  rmw_track_allocation(
+    RMW_ALLOCATION_DOMAIN_SERIALIZED_MESSAGE, sizeof(rmw_shared_serialized_message_t));
+  shared->serialized_message = *serialized_message;
+  rcutils_atomic_store(&shared->reference_count, 1u);
+  shared->release_callback = release_callback;
+  shared->release_callback_data = release_callback_data;
+  shared->allocator = *allocator;
+
+  *serialized_message = rmw_get_zero_initialized_serialized_message();
+  *shared_serialized_message = shared;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_shared_serialized_message_retain(rmw_shared_serialized_message_t * shared_serialized_message)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(shared_serialized_message, RMW_RET_INVALID_ARGUMENT);
+  rcutils_atomic_fetch_add_uint64_t(&shared_serialized_message->reference_count, 1u);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_shared_serialized_message_release(rmw_shared_serialized_message_t * shared_serialized_message)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(shared_serialized_message, RMW_RET_INVALID_ARGUMENT);
+  // Adding UINT64_MAX decrements the count, modulo 2^64.
+  const uint64_t previous_count = rcutils_atomic_fetch_add_uint64_t(
+    &shared_serialized_message->reference_count, UINT64_MAX);
+  assert(previous_count > 0u);
+  if (1u != previous_count) {
+    return RMW_RET_OK;
+  }
+
+  rmw_ret_t ret = RMW_RET_OK;
+  if (NULL != shared_serialized_message->release_callback) {
+    shared_serialized_message->release_callback(
+      &shared_serialized_message->serialized_message,
+      shared_serialized_message->release_callback_data);
+  } else if (NULL != shared_serialized_message->serialized_message.buffer) {
+    if (RCUTILS_RET_OK !=
+      rmw_serialized_message_fini(&shared_serialized_message->serialized_message))
+    {
+      RMW_SET_ERROR_MSG("failed to finalize the shared serialized message");
+      ret = RMW_RET_ERROR;
+    }
+  }
+  rcutils_allocator_t allocator = shared_serialized_message->allocator;
+  allocator.deallocate(shared_serialized_message, allocator.state);
+  rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_SERIALIZED_MESSAGE);
+  return ret;
+}
+
+const rmw_serialized_message_t *
+rmw_shared_serialized_message_get_serialized_message(
+  const rmw_shared_serialized_message_t * shared_serialized_message)
+{
+  if (NULL == shared_serialized_message) {
+    return NULL;
+  }
+  return &shared_serialized_message->serialized_message;
+}
+
+size_t
+rmw_shared_serialized_message_get_reference_count(
+  const rmw_shared_serialized_message_t * shared_serialized_message)
+{
+  if (NULL == shared_serialized_message) {
+    return 0u;
+  }
+  // Atomic loads do not modify the count, casting constness away is safe.
+  return (size_t)rcutils_atomic_load_uint64_t(
+    (atomic_uint_least64_t *)&shared_serialized_message->reference_count);
+}
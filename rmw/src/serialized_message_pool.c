@@ -0,0 +1,333 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/serialized_message_pool.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "rmw/convert_rcutils_ret_to_rmw_ret.h"
+#include "rmw/error_handling.h"
+
+#include "./allocation_tracking.h"
+#include "./slab_pool.h"
+
+// Class index of buffers larger than the largest class.
+#define RMW_SERIALIZED_MESSAGE_POOL_OVERSIZED SIZE_MAX
+
+// Header in front of every buffer, padded to keep buffers suitably aligned.
+typedef union rmw_serialized_message_pool_header_u
+{
+  struct
+  {
+    // Next free buffer of the same class, only meaningful while the buffer is free.
+    union rmw_serialized_message_pool_header_u * next;
+    // Index of the class of the buffer, or RMW_SERIALIZED_MESSAGE_POOL_OVERSIZED.
+    size_t class_index;
+    // Usable size of the buffer.
+    size_t buffer_size;
+  } fields;
+  rmw_slab_pool_max_align_t alignment[2];
+} rmw_serialized_message_pool_header_t;
+
+_Static_assert(
+  sizeof(rmw_serialized_message_pool_header_t) % sizeof(rmw_slab_pool_max_align_t) == 0,
+  "buffers must follow their header suitably aligned");
+
+rmw_serialized_message_pool_t
+rmw_get_zero_initialized_serialized_message_pool(void)
+{
+  rmw_serialized_message_pool_t zero;
+  memset(&zero, 0, sizeof(zero));
+  zero.allocator = rcutils_get_zero_initialized_allocator();
+  return zero;
+}
+
+// Index of the smallest class holding size bytes, or class_count if there is none.
+static size_t
+_rmw_serialized_message_pool_class_index(const rmw_serialized_message_pool_t * pool, size_t size)
+{
+  size_t index = 0u;
+  while (index < pool->class_count && pool->classes[index].buffer_size < size) {
+    ++index;
+  }
+  return index;
+}
+
+// Allocate a buffer and its header with the pool allocator.
+static rmw_serialized_message_pool_header_t *
+_rmw_serialized_message_pool_allocate_buffer(
+  rmw_serialized_message_pool_t * pool,
+  size_t class_index,
+  size_t buffer_size)
+{
+  if (buffer_size > SIZE_MAX - sizeof(rmw_serialized_message_pool_header_t)) {
+    return NULL;
+  }
+  const size_t size = sizeof(rmw_serialized_message_pool_header_t) + buffer_size;
+  rmw_serialized_message_pool_header_t * header =
+    pool->allocator.allocate(size, pool->allocator.state);
+  if (NULL == header) {
+    return NULL;
+  }
+  rmw_track_allocation(RMW_ALLOCATION_DOMAIN_SERIALIZED_MESSAGE, size);
+  header->fields.next = NULL;
+  header->fields.class_index = class_index;
+  header->fields.buffer_size = buffer_size;
+  return header;
+}
+
+static void *
+_rmw_serialized_message_pool_allocate(size_t size, void * state)
+{
+  rmw_serialized_message_pool_t * pool = state;
+  const size_t class_index = _rmw_serialized_message_pool_class_index(pool, size);
+  if (class_index == pool->class_count) {
+    rmw_serialized_message_pool_header_t * header = _rmw_serialized_message_pool_allocate_buffer(
+      pool, RMW_SERIALIZED_MESSAGE_POOL_OVERSIZED, size);
+    if (NULL == header) {
+      return NULL;
+    }
+    ++pool->oversized_in_use;
+    return header + 1;
+  }
+
+  rmw_serialized_message_pool_class_t * size_class = &pool->classes[class_index];
+  rmw_serialized_message_pool_header_t * header = size_class->free_buffers;
+  if (NULL != header) {
+    size_class->free_buffers = header->fields.next;
+    --size_class->free_count;
+  } else {
+    header = _rmw_serialized_message_pool_allocate_buffer(
+      pool, class_index, size_class->buffer_size);
+    if (NULL == header) {
+      return NULL;
+    }
+    ++size_class->allocation_count;
+  }
+  if (++size_class->in_use > size_class->high_water_mark) {
+    size_class->high_water_mark = size_class->in_use;
+  }
+  return header + 1;
+}
+
+static void
+_rmw_serialized_message_pool_deallocate(void * pointer, void * state)
+{
+  if (NULL == pointer) {
+    return;
+  }
+  rmw_serialized_message_pool_t * pool = state;
+  rmw_serialized_message_pool_header_t * header =
+    (rmw_serialized_message_pool_header_t *)pointer - 1;
+  if (RMW_SERIALIZED_MESSAGE_POOL_OVERSIZED == header->fields.class_index) {
+    pool->allocator.deallocate(header, pool->allocator.state);
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_SERIALIZED_MESSAGE);
+    --pool->oversized_in_use;
+    return;
+  }
+  rmw_serialized_message_pool_class_t * size_class = &pool->classes[header->fields.class_index];
+  header->fields.next = size_class->free_buffers;
+  size_class->free_buffers = header;
+  ++size_class->free_count;
+  --size_class->in_use;
+}
+
+static void *
+_rmw_serialized_message_pool_reallocate(void * pointer, size_t size, void * state)
+{
+  if (NULL == pointer) {
+    return _rmw_serialized_message_pool_allocate(size, state);
+  }
+  const rmw_serialized_message_pool_header_t * header =
+    (const rmw_serialized_message_pool_header_t *)pointer - 1;
+  const size_t buffer_size = header->fields.buffer_size;
+  // Buffers are never shrunk, they would only move to a smaller class.
+  if (size <= buffer_size) {
+    return pointer;
+  }
+  void * grown_pointer = _rmw_serialized_message_pool_allocate(size, state);
+  if (NULL == grown_pointer) {
+    return NULL;
+  }
+  memcpy(grown_pointer, pointer, buffer_size);
+  _rmw_serialized_message_pool_deallocate(pointer, state);
+  return grown_pointer;
+}
+
+static void *
+_rmw_serialized_message_pool_zero_allocate(
+  size_t number_of_elements, size_t size_of_element, void * state)
+{
+  if (0u != size_of_element && number_of_elements > SIZE_MAX / size_of_element) {
+    return NULL;
+  }
+  const size_t size = number_of_elements * size_of_element;
+  void * pointer = _rmw_serialized_message_pool_allocate(size, state);
+  if (NULL != pointer) {
+    memset(pointer, 0, size);
+  }
+  return pointer;
+}
+
+rmw_ret_t
+rmw_serialized_message_pool_init(
+  rmw_serialized_message_pool_t * pool,
+  size_t min_buffer_size,
+  size_t max_buffer_size,
+  const rcutils_allocator_t * allocator)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    allocator, "allocator is invalid", return RMW_RET_INVALID_ARGUMENT);
+  if (min_buffer_size < 64u || 0u != (min_buffer_size & (min_buffer_size - 1u))) {
+    RMW_SET_ERROR_MSG("min buffer size must be a power of two of at least 64 bytes");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (max_buffer_size < min_buffer_size || 0u != (max_buffer_size & (max_buffer_size - 1u))) {
+    RMW_SET_ERROR_MSG("max buffer size must be a power of two no smaller than min buffer size");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  size_t class_count = 1u;
+  for (size_t size = min_buffer_size; size < max_buffer_size; size *= 2u) {
+    ++class_count;
+  }
+  if (class_count > RMW_SERIALIZED_MESSAGE_POOL_MAX_CLASS_COUNT) {
+    RMW_SET_ERROR_MSG("too many size classes between min and max buffer sizes");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  *pool = rmw_get_zero_initialized_serialized_message_pool();
+  for (size_t i = 0u; i < class_count; ++i) {
+    pool->classes[i].buffer_size = min_buffer_size << i;
+  }
+  pool->class_count = class_count;
+  pool->allocator = *allocator;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_serialized_message_pool_fini(rmw_serialized_message_pool_t * pool)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+  if (0u != pool->oversized_in_use) {
+    RMW_SET_ERROR_MSG("serialized messages acquired from the pool are still in use");
+    return RMW_RET_ERROR;
+  }
+  for (size_t i = 0u; i < pool->class_count; ++i) {
+    if (0u != pool->classes[i].in_use) {
+      RMW_SET_ERROR_MSG("serialized messages acquired from the pool are still in use");
+      return RMW_RET_ERROR;
+    }
+  }
+  for (size_t i = 0u; i < pool->class_count; ++i) {
+    rmw_serialized_message_pool_header_t * header = pool->classes[i].free_buffers;
+    while (NULL != header) {
+      rmw_serialized_message_pool_header_t * next = header->fields.next;
+      pool->allocator.deallocate(header, pool->allocator.state);
+      rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_SERIALIZED_MESSAGE);
+      header = next;
+    }
+  }
+  *pool = rmw_get_zero_initialized_serialized_message_pool();
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_serialized_message_pool_reserve(
+  rmw_serialized_message_pool_t * pool,
+  size_t buffer_size,
+  size_t count)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+  const size_t class_index = _rmw_serialized_message_pool_class_index(pool, buffer_size);
+  if (0u == buffer_size || class_index == pool->class_count) {
+    RMW_SET_ERROR_MSG("buffer size must be within the size classes of the pool");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  rmw_serialized_message_pool_class_t * size_class = &pool->classes[class_index];
+  for (size_t i = 0u; i < count; ++i) {
+    rmw_serialized_message_pool_header_t * header = _rmw_serialized_message_pool_allocate_buffer(
+      pool, class_index, size_class->buffer_size);
+    if (NULL == header) {
+      RMW_SET_ERROR_MSG("failed to allocate memory for the pool buffers");
+      return RMW_RET_BAD_ALLOC;
+    }
+    ++size_class->allocation_count;
+    header->fields.next = size_class->free_buffers;
+    size_class->free_buffers = header;
+    ++size_class->free_count;
+  }
+  return RMW_RET_OK;
+}
+
+rcutils_allocator_t
+rmw_serialized_message_pool_get_allocator(rmw_serialized_message_pool_t * pool)
+{
+  rcutils_allocator_t allocator = rcutils_get_zero_initialized_allocator();
+  if (NULL == pool) {
+    return allocator;
+  }
+  allocator.allocate = _rmw_serialized_message_pool_allocate;
+  allocator.deallocate = _rmw_serialized_message_pool_deallocate;
+  allocator.reallocate = _rmw_serialized_message_pool_reallocate;
+  allocator.zero_allocate = _rmw_serialized_message_pool_zero_allocate;
+  allocator.state = pool;
+  return allocator;
+}
+
+rmw_ret_t
+rmw_serialized_message_pool_acquire(
+  rmw_serialized_message_pool_t * pool,
+  size_t capacity,
+  rmw_serialized_message_t * serialized_message)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(serialized_message, RMW_RET_INVALID_ARGUMENT);
+  rcutils_allocator_t allocator = rmw_serialized_message_pool_get_allocator(pool);
+  return rmw_convert_rcutils_ret_to_rmw_ret(
+    rmw_serialized_message_init(serialized_message, capacity, &allocator));
+}
+
+rmw_ret_t
+rmw_serialized_message_pool_release(
+  rmw_serialized_message_pool_t * pool,
+  rmw_serialized_message_t * serialized_message)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(serialized_message, RMW_RET_INVALID_ARGUMENT);
+  if (
+    serialized_message->allocator.allocate != _rmw_serialized_message_pool_allocate ||
+    serialized_message->allocator.state != pool)
+  {
+    RMW_SET_ERROR_MSG("serialized message was not acquired from this pool");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  return rmw_convert_rcutils_ret_to_rmw_ret(rmw_serialized_message_fini(serialized_message));
+}
+
+const rmw_serialized_message_pool_class_t *
+rmw_serialized_message_pool_get_class(
+  const rmw_serialized_message_pool_t * pool,
+  size_t buffer_size)
+{
+  if (NULL == pool) {
+    return NULL;
+  }
+  const size_t class_index = _rmw_serialized_message_pool_class_index(pool, buffer_size);
+  if (class_index == pool->class_count) {
+    return NULL;
+  }
+  return &pool->classes[class_index];
+}
@@ -0,0 +1,585 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef __linux__
+// Required for memfd_create().
+# ifndef _GNU_SOURCE
+#  define _GNU_SOURCE
+# endif
+#endif
+
+#include "rmw/shared_memory_chunk_pool.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __linux__
+# include <errno.h>
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+#include "rcutils/stdatomic_helper.h"
+
+#include "rmw/error_handling.h"
+
+// Chunk states are shared between processes, so their atomics must not hide a lock.
+#if defined(__linux__) && defined(MFD_CLOEXEC) && ATOMIC_LLONG_LOCK_FREE == 2
+# define RMW_SHARED_MEMORY_CHUNK_POOL_IS_SUPPORTED 1
+#else
+# define RMW_SHARED_MEMORY_CHUNK_POOL_IS_SUPPORTED 0
+#endif
+
+// "rmwchunk", marks a segment whose chunk pool is fully initialized.
+#define RMW_SHARED_MEMORY_CHUNK_POOL_MAGIC UINT64_C(0x726d776368756e6b)
+// Bumped whenever the layout of the segment changes.
+#define RMW_SHARED_MEMORY_CHUNK_POOL_VERSION UINT64_C(1)
+// Index terminating the free list.
+#define RMW_SHARED_MEMORY_CHUNK_POOL_NO_CHUNK UINT32_MAX
+
+// Header at the start of the segment.
+typedef struct rmw_shared_memory_chunk_pool_segment_s
+{
+  atomic_uint_least64_t magic;
+  uint64_t version;
+  uint64_t segment_size;
+  uint64_t chunk_size;
+  uint64_t chunk_count;
+  // Index of the first free chunk in the low half, and a tag in the high half which is
+  // bumped on every change so that a stale head never compares equal (ABA problem).
+  _Alignas(RMW_SHARED_MEMORY_CHUNK_POOL_CHUNK_ALIGNMENT) atomic_uint_least64_t free_list_head;
+} rmw_shared_memory_chunk_pool_segment_t;
+
+// Header of a chunk, all chunk headers follow the segment header.
+typedef union rmw_shared_memory_chunk_pool_chunk_header_u
+{
+  struct
+  {
+    // Index of the next free chunk, only meaningful while the chunk is free.
+    atomic_uint_least64_t next;
+    // Owner in the high half and reference count in the low half, zero if the chunk is free.
+    atomic_uint_least64_t state;
+  } fields;
+  // Keep each header on its own cache line.
+  uint8_t padding[RMW_SHARED_MEMORY_CHUNK_POOL_CHUNK_ALIGNMENT];
+} rmw_shared_memory_chunk_pool_chunk_header_t;
+
+_Static_assert(
+  sizeof(rmw_shared_memory_chunk_pool_segment_t) %
+  RMW_SHARED_MEMORY_CHUNK_POOL_CHUNK_ALIGNMENT == 0,
+  "chunk headers must follow the segment header aligned");
+_Static_assert(
+  sizeof(rmw_shared_memory_chunk_pool_chunk_header_t) ==
+  RMW_SHARED_MEMORY_CHUNK_POOL_CHUNK_ALIGNMENT,
+  "chunk headers must keep chunks aligned");
+
+#define RMW_SHARED_MEMORY_CHUNK_POOL_STATE(owner, reference_count) \
+  (((uint64_t)(owner) << 32) | (uint64_t)(reference_count))
+#define RMW_SHARED_MEMORY_CHUNK_POOL_STATE_OWNER(state) ((uint32_t)((state) >> 32))
+#define RMW_SHARED_MEMORY_CHUNK_POOL_STATE_REFERENCE_COUNT(state) ((uint32_t)(state))
+
+rmw_shared_memory_chunk_pool_t
+rmw_get_zero_initialized_shared_memory_chunk_pool(void)
+{
+  rmw_shared_memory_chunk_pool_t zero;
+  memset(&zero, 0, sizeof(zero));
+  zero.file_descriptor = -1;
+  return zero;
+}
+
+static inline rmw_shared_memory_chunk_pool_segment_t *
+_rmw_shared_memory_chunk_pool_get_segment(const rmw_shared_memory_chunk_pool_t * pool)
+{
+  return pool->segment;
+}
+
+static inline rmw_shared_memory_chunk_pool_chunk_header_t *
+_rmw_shared_memory_chunk_pool_get_chunk_header(
+  const rmw_shared_memory_chunk_pool_t * pool,
+  size_t chunk_index)
+{
+  rmw_shared_memory_chunk_pool_chunk_header_t * chunk_headers =
+    (rmw_shared_memory_chunk_pool_chunk_header_t *)(
+    _rmw_shared_memory_chunk_pool_get_segment(pool) + 1);
+  return &chunk_headers[chunk_index];
+}
+
+static inline uint8_t *
+_rmw_shared_memory_chunk_pool_get_chunks(const rmw_shared_memory_chunk_pool_t * pool)
+{
+  return (uint8_t *)_rmw_shared_memory_chunk_pool_get_chunk_header(pool, pool->chunk_count);
+}
+
+// Push a chunk whose state was just cleared onto the free list.
+static void
+_rmw_shared_memory_chunk_pool_push(rmw_shared_memory_chunk_pool_t * pool, size_t chunk_index)
+{
+  rmw_shared_memory_chunk_pool_segment_t * segment =
+    _rmw_shared_memory_chunk_pool_get_segment(pool);
+  rmw_shared_memory_chunk_pool_chunk_header_t * chunk_header =
+    _rmw_shared_memory_chunk_pool_get_chunk_header(pool, chunk_index);
+  uint64_t head = rcutils_atomic_load_uint64_t(&segment->free_list_head);
+  uint64_t new_head = 0u;
+  do {
+    rcutils_atomic_store(&chunk_header->fields.next, head & UINT32_MAX);
+    new_head = (((head >> 32) + 1u) << 32) | (uint64_t)chunk_index;
+  } while (!rcutils_atomic_compare_exchange_strong_uint_least64_t(
+    &segment->free_list_head, &head, new_head));
+}
+
+// Pop a chunk off the free list, or return RMW_SHARED_MEMORY_CHUNK_POOL_NO_CHUNK.
+static uint32_t
+_rmw_shared_memory_chunk_pool_pop(rmw_shared_memory_chunk_pool_t * pool)
+{
+  rmw_shared_memory_chunk_pool_segment_t * segment =
+    _rmw_shared_memory_chunk_pool_get_segment(pool);
+  uint64_t head = rcutils_atomic_load_uint64_t(&segment->free_list_head);
+  uint64_t new_head = 0u;
+  uint32_t chunk_index = RMW_SHARED_MEMORY_CHUNK_POOL_NO_CHUNK;
+  do {
+    chunk_index = (uint32_t)head;
+    if (RMW_SHARED_MEMORY_CHUNK_POOL_NO_CHUNK == chunk_index) {
+      return chunk_index;
+    }
+    // If the chunk was popped meanwhile, next may be stale but the tag makes the exchange fail.
+    const uint64_t next = rcutils_atomic_load_uint64_t(
+      &_rmw_shared_memory_chunk_pool_get_chunk_header(pool, chunk_index)->fields.next);
+    new_head = (((head >> 32) + 1u) << 32) | next;
+  } while (!rcutils_atomic_compare_exchange_strong_uint_least64_t(
+    &segment->free_list_head, &head, new_head));
+  return chunk_index;
+}
+
+#if RMW_SHARED_MEMORY_CHUNK_POOL_IS_SUPPORTED
+// Size of a segment holding chunk_count chunks of chunk_size bytes, or 0 if it overflows.
+static size_t
+_rmw_shared_memory_chunk_pool_get_segment_size(size_t chunk_size, size_t chunk_count)
+{
+  const size_t chunk_stride =
+    chunk_size + sizeof(rmw_shared_memory_chunk_pool_chunk_header_t);
+  if (
+    chunk_stride < chunk_size ||
+    chunk_count > (SIZE_MAX - sizeof(rmw_shared_memory_chunk_pool_segment_t)) / chunk_stride)
+  {
+    return 0u;
+  }
+  const size_t segment_size =
+    sizeof(rmw_shared_memory_chunk_pool_segment_t) + chunk_count * chunk_stride;
+  return (uintmax_t)segment_size <= (uintmax_t)INT64_MAX ? segment_size : 0u;
+}
+
+// Map a segment holding an initialized chunk pool, taking ownership of its file descriptor.
+static rmw_ret_t
+_rmw_shared_memory_chunk_pool_map(rmw_shared_memory_chunk_pool_t * pool, int file_descriptor)
+{
+  struct stat segment_status;
+  if (0 != fstat(file_descriptor, &segment_status)) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING("failed to get the segment size, errno %d", errno);
+    (void)close(file_descriptor);
+    return RMW_RET_ERROR;
+  }
+  if (
+    segment_status.st_size < (off_t)sizeof(rmw_shared_memory_chunk_pool_segment_t) ||
+    (uintmax_t)segment_status.st_size > (uintmax_t)SIZE_MAX)
+  {
+    RMW_SET_ERROR_MSG("segment does not hold a chunk pool");
+    (void)close(file_descriptor);
+    return RMW_RET_ERROR;
+  }
+  const size_t segment_size = (size_t)segment_status.st_size;
+  void * segment =
+    mmap(NULL, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0);
+  if (MAP_FAILED == segment) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING("failed to map the segment, errno %d", errno);
+    (void)close(file_descriptor);
+    return RMW_RET_ERROR;
+  }
+
+  rmw_shared_memory_chunk_pool_segment_t * header = segment;
+  if (
+    RMW_SHARED_MEMORY_CHUNK_POOL_MAGIC != rcutils_atomic_load_uint64_t(&header->magic) ||
+    RMW_SHARED_MEMORY_CHUNK_POOL_VERSION != header->version ||
+    segment_size != header->segment_size ||
+    segment_size != _rmw_shared_memory_chunk_pool_get_segment_size(
+      (size_t)header->chunk_size, (size_t)header->chunk_count))
+  {
+    RMW_SET_ERROR_MSG("segment does not hold an initialized chunk pool of this version");
+    (void)munmap(segment, segment_size);
+    (void)close(file_descriptor);
+    return RMW_RET_ERROR;
+  }
+  pool->segment = segment;
+  pool->segment_size = segment_size;
+  pool->chunk_size = (size_t)header->chunk_size;
+  pool->chunk_count = (size_t)header->chunk_count;
+  pool->file_descriptor = file_descriptor;
+  return RMW_RET_OK;
+}
+
+// Names are handed to shm_open(), which requires a single leading slash.
+static bool
+_rmw_shared_memory_chunk_pool_name_is_valid(const char * name)
+{
+  const size_t length = strlen(name);
+  return length > 1u && length < RMW_SHARED_MEMORY_CHUNK_POOL_MAX_NAME_LENGTH &&
+         '/' == name[0] && NULL == strchr(name + 1, '/');
+}
+#endif
+
+rmw_ret_t
+rmw_shared_memory_chunk_pool_create(
+  rmw_shared_memory_chunk_pool_t * pool,
+  const char * name,
+  size_t chunk_size,
+  size_t chunk_count)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+  if (0u == chunk_size) {
+    RMW_SET_ERROR_MSG("chunk size must not be zero");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (0u == chunk_count || chunk_count >= RMW_SHARED_MEMORY_CHUNK_POOL_NO_CHUNK) {
+    RMW_SET_ERROR_MSG("chunk count must be between 1 and UINT32_MAX - 1");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+#if RMW_SHARED_MEMORY_CHUNK_POOL_IS_SUPPORTED
+  if (NULL != name && !_rmw_shared_memory_chunk_pool_name_is_valid(name)) {
+    RMW_SET_ERROR_MSG("name must be a single slash followed by a short name without slashes");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (chunk_size > SIZE_MAX - RMW_SHARED_MEMORY_CHUNK_POOL_CHUNK_ALIGNMENT) {
+    RMW_SET_ERROR_MSG("chunk size is too large");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  chunk_size = (chunk_size + RMW_SHARED_MEMORY_CHUNK_POOL_CHUNK_ALIGNMENT - 1u) /
+    RMW_SHARED_MEMORY_CHUNK_POOL_CHUNK_ALIGNMENT * RMW_SHARED_MEMORY_CHUNK_POOL_CHUNK_ALIGNMENT;
+  const size_t segment_size = _rmw_shared_memory_chunk_pool_get_segment_size(
+    chunk_size, chunk_count);
+  if (0u == segment_size) {
+    RMW_SET_ERROR_MSG("chunk pool is too large");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  *pool = rmw_get_zero_initialized_shared_memory_chunk_pool();
+  const int file_descriptor = NULL != name ?
+    shm_open(name, O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, S_IRUSR | S_IWUSR) :
+    memfd_create("rmw_shared_memory_chunk_pool", MFD_CLOEXEC);
+  if (-1 == file_descriptor) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING("failed to create the segment, errno %d", errno);
+    return RMW_RET_BAD_ALLOC;
+  }
+  if (0 != ftruncate(file_descriptor, (off_t)segment_size)) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING("failed to size the segment, errno %d", errno);
+    (void)close(file_descriptor);
+    if (NULL != name) {
+      (void)shm_unlink(name);
+    }
+    return RMW_RET_BAD_ALLOC;
+  }
+  void * segment =
+    mmap(NULL, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0);
+  if (MAP_FAILED == segment) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING("failed to map the segment, errno %d", errno);
+    (void)close(file_descriptor);
+    if (NULL != name) {
+      (void)shm_unlink(name);
+    }
+    return RMW_RET_ERROR;
+  }
+
+  pool->segment = segment;
+  pool->segment_size = segment_size;
+  pool->chunk_size = chunk_size;
+  pool->chunk_count = chunk_count;
+  pool->file_descriptor = file_descriptor;
+  pool->is_creator = true;
+  if (NULL != name) {
+    memcpy(pool->name, name, strlen(name) + 1u);
+  }
+
+  rmw_shared_memory_chunk_pool_segment_t * header = segment;
+  header->version = RMW_SHARED_MEMORY_CHUNK_POOL_VERSION;
+  header->segment_size = segment_size;
+  header->chunk_size = chunk_size;
+  header->chunk_count = chunk_count;
+  for (size_t i = 0u; i < chunk_count; ++i) {
+    rmw_shared_memory_chunk_pool_chunk_header_t * chunk_header =
+      _rmw_shared_memory_chunk_pool_get_chunk_header(pool, i);
+    const uint64_t next = i + 1u < chunk_count ? i + 1u : RMW_SHARED_MEMORY_CHUNK_POOL_NO_CHUNK;
+    rcutils_atomic_store(&chunk_header->fields.next, next);
+    rcutils_atomic_store(&chunk_header->fields.state, 0u);
+  }
+  rcutils_atomic_store(&header->free_list_head, 0u);
+  // Publish the pool last, processes attaching before that reject the segment.
+  rcutils_atomic_store(&header->magic, RMW_SHARED_MEMORY_CHUNK_POOL_MAGIC);
+  return RMW_RET_OK;
+#else
+  (void)name;
+  RMW_SET_ERROR_MSG("shared memory chunk pools are not supported on this platform");
+  return RMW_RET_UNSUPPORTED;
+#endif
+}
+
+rmw_ret_t
+rmw_shared_memory_chunk_pool_attach(
+  rmw_shared_memory_chunk_pool_t * pool,
+  const char * name)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(name, RMW_RET_INVALID_ARGUMENT);
+#if RMW_SHARED_MEMORY_CHUNK_POOL_IS_SUPPORTED
+  if (!_rmw_shared_memory_chunk_pool_name_is_valid(name)) {
+    RMW_SET_ERROR_MSG("name must be a single slash followed by a short name without slashes");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  *pool = rmw_get_zero_initialized_shared_memory_chunk_pool();
+  const int file_descriptor = shm_open(name, O_RDWR | O_CLOEXEC, 0);
+  if (-1 == file_descriptor) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING("failed to open '%s', errno %d", name, errno);
+    return RMW_RET_ERROR;
+  }
+  rmw_ret_t ret = _rmw_shared_memory_chunk_pool_map(pool, file_descriptor);
+  if (RMW_RET_OK == ret) {
+    memcpy(pool->name, name, strlen(name) + 1u);
+  }
+  return ret;
+#else
+  RMW_SET_ERROR_MSG("shared memory chunk pools are not supported on this platform");
+  return RMW_RET_UNSUPPORTED;
+#endif
+}
+
+rmw_ret_t
+rmw_shared_memory_chunk_pool_attach_file_descriptor(
+  rmw_shared_memory_chunk_pool_t * pool,
+  int file_descriptor)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+  if (file_descriptor < 0) {
+    RMW_SET_ERROR_MSG("file descriptor is invalid");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+#if RMW_SHARED_MEMORY_CHUNK_POOL_IS_SUPPORTED
+  *pool = rmw_get_zero_initialized_shared_memory_chunk_pool();
+  const int duplicate = fcntl(file_descriptor, F_DUPFD_CLOEXEC, 0);
+  if (-1 == duplicate) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING("failed to duplicate file descriptor, errno %d", errno);
+    return RMW_RET_ERROR;
+  }
+  return _rmw_shared_memory_chunk_pool_map(pool, duplicate);
+#else
+  RMW_SET_ERROR_MSG("shared memory chunk pools are not supported on this platform");
+  return RMW_RET_UNSUPPORTED;
+#endif
+}
+
+rmw_ret_t
+rmw_shared_memory_chunk_pool_fini(rmw_shared_memory_chunk_pool_t * pool)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+#if RMW_SHARED_MEMORY_CHUNK_POOL_IS_SUPPORTED
+  if (NULL != pool->segment && 0 != munmap(pool->segment, pool->segment_size)) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING("failed to unmap the segment, errno %d", errno);
+    return RMW_RET_ERROR;
+  }
+  if (-1 != pool->file_descriptor) {
+    (void)close(pool->file_descriptor);
+  }
+  if (pool->is_creator && '\0' != pool->name[0]) {
+    (void)shm_unlink(pool->name);
+  }
+#endif
+  *pool = rmw_get_zero_initialized_shared_memory_chunk_pool();
+  return RMW_RET_OK;
+}
+
+// Check that a chunk index refers to a chunk of an initialized pool.
+#define RMW_SHARED_MEMORY_CHUNK_POOL_CHECK_CHUNK_INDEX(pool, chunk_index) \
+  do { \
+    RCUTILS_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT); \
+    if (NULL == (pool)->segment) { \
+      RMW_SET_ERROR_MSG("chunk pool is not initialized"); \
+      return RMW_RET_INVALID_ARGUMENT; \
+    } \
+    if ((chunk_index) >= (pool)->chunk_count) { \
+      RMW_SET_ERROR_MSG("chunk index is out of range"); \
+      return RMW_RET_INVALID_ARGUMENT; \
+    } \
+  } while (0)
+
+rmw_ret_t
+rmw_shared_memory_chunk_pool_acquire(
+  rmw_shared_memory_chunk_pool_t * pool,
+  uint32_t owner,
+  size_t * chunk_index)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(chunk_index, RMW_RET_INVALID_ARGUMENT);
+  if (NULL == pool->segment) {
+    RMW_SET_ERROR_MSG("chunk pool is not initialized");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (0u == owner) {
+    RMW_SET_ERROR_MSG("owner must not be zero");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  const uint32_t index = _rmw_shared_memory_chunk_pool_pop(pool);
+  if (RMW_SHARED_MEMORY_CHUNK_POOL_NO_CHUNK == index) {
+    RMW_SET_ERROR_MSG("all chunks of the pool are in use");
+    return RMW_RET_ERROR;
+  }
+  rcutils_atomic_store(
+    &_rmw_shared_memory_chunk_pool_get_chunk_header(pool, index)->fields.state,
+    RMW_SHARED_MEMORY_CHUNK_POOL_STATE(owner, 1u));
+  *chunk_index = index;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_shared_memory_chunk_pool_retain(
+  rmw_shared_memory_chunk_pool_t * pool,
+  size_t chunk_index)
+{
+  RMW_SHARED_MEMORY_CHUNK_POOL_CHECK_CHUNK_INDEX(pool, chunk_index);
+  atomic_uint_least64_t * state =
+    &_rmw_shared_memory_chunk_pool_get_chunk_header(pool, chunk_index)->fields.state;
+  uint64_t current = rcutils_atomic_load_uint64_t(state);
+  do {
+    if (0u == RMW_SHARED_MEMORY_CHUNK_POOL_STATE_REFERENCE_COUNT(current)) {
+      RMW_SET_ERROR_MSG("chunk is free");
+      return RMW_RET_ERROR;
+    }
+    if (UINT32_MAX == RMW_SHARED_MEMORY_CHUNK_POOL_STATE_REFERENCE_COUNT(current)) {
+      RMW_SET_ERROR_MSG("chunk reference count overflows");
+      return RMW_RET_ERROR;
+    }
+  } while (!rcutils_atomic_compare_exchange_strong_uint_least64_t(state, &current, current + 1u));
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_shared_memory_chunk_pool_release(
+  rmw_shared_memory_chunk_pool_t * pool,
+  size_t chunk_index)
+{
+  RMW_SHARED_MEMORY_CHUNK_POOL_CHECK_CHUNK_INDEX(pool, chunk_index);
+  atomic_uint_least64_t * state =
+    &_rmw_shared_memory_chunk_pool_get_chunk_header(pool, chunk_index)->fields.state;
+  uint64_t current = rcutils_atomic_load_uint64_t(state);
+  uint64_t released = 0u;
+  do {
+    const uint32_t reference_count = RMW_SHARED_MEMORY_CHUNK_POOL_STATE_REFERENCE_COUNT(current);
+    if (0u == reference_count) {
+      RMW_SET_ERROR_MSG("chunk is free");
+      return RMW_RET_ERROR;
+    }
+    // The owner is cleared along with the last reference.
+    released = 1u == reference_count ? 0u : current - 1u;
+  } while (!rcutils_atomic_compare_exchange_strong_uint_least64_t(state, &current, released));
+  if (0u == released) {
+    _rmw_shared_memory_chunk_pool_push(pool, chunk_index);
+  }
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_shared_memory_chunk_pool_reclaim(
+  rmw_shared_memory_chunk_pool_t * pool,
+  uint32_t owner,
+  size_t * reclaimed_count)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+  if (0u == owner) {
+    RMW_SET_ERROR_MSG("owner must not be zero");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  size_t count = 0u;
+  for (size_t i = 0u; NULL != pool->segment && i < pool->chunk_count; ++i) {
+    atomic_uint_least64_t * state =
+      &_rmw_shared_memory_chunk_pool_get_chunk_header(pool, i)->fields.state;
+    uint64_t current = rcutils_atomic_load_uint64_t(state);
+    // Exchanging the whole state only succeeds if the chunk still belongs to the owner,
+    // and makes concurrent releases fail rather than push the chunk twice.
+    while (
+      0u != current && owner == RMW_SHARED_MEMORY_CHUNK_POOL_STATE_OWNER(current) &&
+      !rcutils_atomic_compare_exchange_strong_uint_least64_t(state, &current, 0u))
+    {
+    }
+    if (0u != current && owner == RMW_SHARED_MEMORY_CHUNK_POOL_STATE_OWNER(current)) {
+      _rmw_shared_memory_chunk_pool_push(pool, i);
+      ++count;
+    }
+  }
+  if (NULL != reclaimed_count) {
+    *reclaimed_count = count;
+  }
+  return RMW_RET_OK;
+}
+
+void *
+rmw_shared_memory_chunk_pool_get_chunk(
+  const rmw_shared_memory_chunk_pool_t * pool,
+  size_t chunk_index)
+{
+  if (NULL == pool || NULL == pool->segment || chunk_index >= pool->chunk_count) {
+    return NULL;
+  }
+  return _rmw_shared_memory_chunk_pool_get_chunks(pool) + chunk_index * pool->chunk_size;
+}
+
+rmw_ret_t
+rmw_shared_memory_chunk_pool_get_chunk_index(
+  const rmw_shared_memory_chunk_pool_t * pool,
+  const void * chunk,
+  size_t * chunk_index)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(chunk, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(chunk_index, RMW_RET_INVALID_ARGUMENT);
+  if (NULL == pool->segment) {
+    RMW_SET_ERROR_MSG("chunk pool is not initialized");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  const uintptr_t chunks = (uintptr_t)_rmw_shared_memory_chunk_pool_get_chunks(pool);
+  const uintptr_t address = (uintptr_t)chunk;
+  if (
+    address < chunks || (address - chunks) % pool->chunk_size != 0u ||
+    (address - chunks) / pool->chunk_size >= pool->chunk_count)
+  {
+    RMW_SET_ERROR_MSG("address is not the one of a chunk of the pool");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  *chunk_index = (address - chunks) / pool->chunk_size;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_shared_memory_chunk_pool_get_chunk_state(
+  const rmw_shared_memory_chunk_pool_t * pool,
+  size_t chunk_index,
+  uint32_t * reference_count,
+  uint32_t * owner)
+{
+  RMW_SHARED_MEMORY_CHUNK_POOL_CHECK_CHUNK_INDEX(pool, chunk_index);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(reference_count, RMW_RET_INVALID_ARGUMENT);
+  const uint64_t state = rcutils_atomic_load_uint64_t(
+    &_rmw_shared_memory_chunk_pool_get_chunk_header(pool, chunk_index)->fields.state);
+  *reference_count = RMW_SHARED_MEMORY_CHUNK_POOL_STATE_REFERENCE_COUNT(state);
+  if (NULL != owner) {
+    *owner = RMW_SHARED_MEMORY_CHUNK_POOL_STATE_OWNER(state);
+  }
+  return RMW_RET_OK;
+}
@@ -0,0 +1,185 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./slab_pool.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "rmw/error_handling.h"
+
+// Each slab starts with a pointer to the next slab, padded to keep slots aligned.
+#define RMW_SLAB_POOL_SLAB_HEADER_SIZE RMW_SLAB_POOL_ALIGN_UP(sizeof(void *))
+
+rmw_slab_pool_t
+rmw_get_zero_initialized_slab_pool(void)
+{
+  rmw_slab_pool_t zero;
+  memset(&zero, 0, sizeof(zero));
+  return zero;
+}
+
+rmw_ret_t
+rmw_slab_pool_init(
+  rmw_slab_pool_t * pool,
+  size_t object_size,
+  size_t objects_per_slab,
+  const rcutils_allocator_t * allocator)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    allocator, "allocator is invalid", return RMW_RET_INVALID_ARGUMENT);
+  if (0u == object_size || 0u == objects_per_slab) {
+    RMW_SET_ERROR_MSG("object size and objects per slab must be greater than zero");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  // Free slots hold the free list link in their first bytes.
+  if (object_size < sizeof(void *)) {
+    object_size = sizeof(void *);
+  }
+  if (object_size > SIZE_MAX - sizeof(rmw_slab_pool_max_align_t)) {
+    RMW_SET_ERROR_MSG("object size is too large");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  const size_t slot_size = RMW_SLAB_POOL_ALIGN_UP(object_size);
+  if (objects_per_slab > (SIZE_MAX - RMW_SLAB_POOL_SLAB_HEADER_SIZE) / slot_size) {
+    RMW_SET_ERROR_MSG("slab size overflows");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  *pool = rmw_get_zero_initialized_slab_pool();
+  pool->slot_size = slot_size;
+  pool->slots_per_slab = objects_per_slab;
+  pool->allocator = *allocator;
+  rmw_spinlock_init(&pool->lock);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_slab_pool_fini(rmw_slab_pool_t * pool)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(pool, RMW_RET_INVALID_ARGUMENT);
+  if (0u != pool->live) {
+    RMW_SET_ERROR_MSG("objects acquired from the slab pool are still live");
+    return RMW_RET_ERROR;
+  }
+  if (NULL != pool->storage) {
+    pool->free_list = NULL;
+    pool->peak = 0u;
+    pool->capacity = 0u;
+    pool->slab_count = 0u;
+    return RMW_RET_OK;
+  }
+  void * slab = pool->slabs;
+  while (NULL != slab) {
+    void * next = *(void **)slab;
+    pool->allocator.deallocate(slab, pool->allocator.state);
+    slab = next;
+  }
+  *pool = rmw_get_zero_initialized_slab_pool();
+  return RMW_RET_OK;
+}
+
+// Reserve a new slab and thread its slots onto the free list, lock must be held.
+static bool
+_rmw_slab_pool_grow(rmw_slab_pool_t * pool)
+{
+  uint8_t * slots = NULL;
+  if (NULL != pool->storage) {
+    // Fixed storage is threaded once, on first use.
+    if (0u != pool->slab_count) {
+      return false;
+    }
+    slots = pool->storage;
+  } else {
+    if (NULL == pool->allocator.allocate) {
+      return false;
+    }
+    const size_t slab_size =
+      RMW_SLAB_POOL_SLAB_HEADER_SIZE + pool->slot_size * pool->slots_per_slab;
+    uint8_t * slab = pool->allocator.allocate(slab_size, pool->allocator.state);
+    if (NULL == slab) {
+      return false;
+    }
+    *(void **)slab = pool->slabs;
+    pool->slabs = slab;
+    slots = slab + RMW_SLAB_POOL_SLAB_HEADER_SIZE;
+  }
+  // Push slots in reverse so they are handed out in address order.
+  for (size_t i = pool->slots_per_slab; i > 0u; --i) {
+    void * slot = slots + (i - 1u) * pool->slot_size;
+    *(void **)slot = pool->free_list;
+    pool->free_list = slot;
+  }
+  pool->capacity += pool->slots_per_slab;
+  ++pool->slab_count;
+  return true;
+}
+
+void *
+rmw_slab_pool_acquire(rmw_slab_pool_t * pool)
+{
+  if (NULL == pool) {
+    return NULL;
+  }
+  rmw_spinlock_lock(&pool->lock);
+  if (NULL == pool->free_list && !_rmw_slab_pool_grow(pool)) {
+    rmw_spinlock_unlock(&pool->lock);
+    return NULL;
+  }
+  void * object = pool->free_list;
+  pool->free_list = *(void **)object;
+  if (++pool->live > pool->peak) {
+    pool->peak = pool->live;
+  }
+  rmw_spinlock_unlock(&pool->lock);
+
+  memset(object, 0, pool->slot_size);
+  return object;
+}
+
+void
+rmw_slab_pool_release(rmw_slab_pool_t * pool, void * object)
+{
+  if (NULL == pool || NULL == object) {
+    return;
+  }
+  rmw_spinlock_lock(&pool->lock);
+  *(void **)object = pool->free_list;
+  pool->free_list = object;
+  --pool->live;
+  rmw_spinlock_unlock(&pool->lock);
+}
+
+bool
+rmw_slab_pool_storage_contains(const rmw_slab_pool_t * pool, const void * object)
+{
+  if (NULL == pool->storage) {
+    return false;
+  }
+  const uint8_t * begin = pool->storage;
+  const uint8_t * end = begin + pool->slot_size * pool->slots_per_slab;
+  return (const uint8_t *)object >= begin && (const uint8_t *)object < end;
+}
+
+void
+rmw_slab_pool_get_statistics(rmw_slab_pool_t * pool, rmw_slab_pool_statistics_t * statistics)
+{
+  rmw_spinlock_lock(&pool->lock);
+  statistics->live = pool->live;
+  statistics->peak = pool->peak;
+  statistics->capacity = pool->capacity;
+  statistics->slab_count = pool->slab_count;
+  rmw_spinlock_unlock(&pool->lock);
+}
@@ -0,0 +1,172 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SLAB_POOL_H_
+#define SLAB_POOL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/ret_types.h"
+
+#include "./spinlock.h"
+
+/// Union of the types with the strictest alignment requirements.
+/**
+ * Every object slot is a multiple of its size, which keeps objects suitably
+ * aligned for any rmw struct.
+ * Storage handed to a pool must be an array of it.
+ */
+typedef union rmw_slab_pool_max_align_u
+{
+  long double long_double_value;
+  long long long_long_value;
+  void * pointer_value;
+  void (* function_pointer_value)(void);
+} rmw_slab_pool_max_align_t;
+
+#define RMW_SLAB_POOL_ALIGN_UP(size) \
+  (((size) + sizeof(rmw_slab_pool_max_align_t) - 1) / sizeof(rmw_slab_pool_max_align_t) * \
+  sizeof(rmw_slab_pool_max_align_t))
+
+/// Size of the slot holding an object of the given size, free list link included.
+#define RMW_SLAB_POOL_SLOT_SIZE(object_size) \
+  RMW_SLAB_POOL_ALIGN_UP((object_size) < sizeof(void *) ? sizeof(void *) : (object_size))
+
+/// Length of the rmw_slab_pool_max_align_t array holding the given number of objects.
+#define RMW_SLAB_POOL_STORAGE_LENGTH(object_size, object_count) \
+  (RMW_SLAB_POOL_SLOT_SIZE(object_size) / sizeof(rmw_slab_pool_max_align_t) * (object_count))
+
+/// Static initializer for a pool serving objects out of fixed storage only.
+/**
+ * Such a pool never touches an allocator: once all `object_count` slots of
+ * `storage` are handed out, acquiring returns `NULL`.
+ * `storage` must be an array of at least
+ * `RMW_SLAB_POOL_STORAGE_LENGTH(object_size, object_count)` elements.
+ */
+#define RMW_SLAB_POOL_STATIC_INITIALIZER(object_size, object_count, storage_) \
+  { \
+    .slot_size = RMW_SLAB_POOL_SLOT_SIZE(object_size), \
+    .slots_per_slab = (object_count), \
+    .storage = (storage_), \
+  }
+
+/// Fixed size object pool, carving objects out of slabs reserved on demand.
+/**
+ * Free objects are kept in an intrusive singly linked list, so that acquiring
+ * and releasing an object are O(1) and only touch the allocator when a new
+ * slab has to be reserved.
+ * Slabs are only given back to the allocator when the pool is finalized.
+ * Alternatively, a pool can be served out of fixed storage, see
+ * RMW_SLAB_POOL_STATIC_INITIALIZER.
+ *
+ * All functions are thread-safe, except for init and fini.
+ */
+typedef struct rmw_slab_pool_s
+{
+  /// Size of each object slot, including padding to keep objects aligned.
+  size_t slot_size;
+  /// Number of object slots reserved at once when the pool runs dry.
+  size_t slots_per_slab;
+  /// Allocator used to reserve slabs.
+  rcutils_allocator_t allocator;
+  /// Head of the free object list.
+  void * free_list;
+  /// Head of the list of reserved slabs.
+  void * slabs;
+  /// Fixed storage used as the one and only slab instead of the allocator, if not NULL.
+  void * storage;
+  /// Number of objects currently handed out.
+  size_t live;
+  /// Highest number of objects handed out at the same time.
+  size_t peak;
+  /// Number of object slots in all reserved slabs.
+  size_t capacity;
+  /// Number of reserved slabs.
+  size_t slab_count;
+  /// Lock guarding all the members above, once initialized.
+  rmw_spinlock_t lock;
+} rmw_slab_pool_t;
+
+/// Snapshot of the usage of a slab pool.
+typedef struct rmw_slab_pool_statistics_s
+{
+  size_t live;
+  size_t peak;
+  size_t capacity;
+  size_t slab_count;
+} rmw_slab_pool_statistics_t;
+
+/// Return a zero initialized slab pool.
+rmw_slab_pool_t
+rmw_get_zero_initialized_slab_pool(void);
+
+/// Initialize a slab pool, without reserving any slab yet.
+/**
+ * \param[inout] pool zero initialized pool to be initialized.
+ * \param[in] object_size size in bytes of the objects handed out by the pool.
+ * \param[in] objects_per_slab number of objects reserved at once when the pool runs dry.
+ * \param[in] allocator allocator used to reserve slabs, copied into the pool.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if any argument is invalid.
+ */
+rmw_ret_t
+rmw_slab_pool_init(
+  rmw_slab_pool_t * pool,
+  size_t object_size,
+  size_t objects_per_slab,
+  const rcutils_allocator_t * allocator);
+
+/// Finalize a slab pool, giving all reserved slabs back to its allocator.
+/**
+ * A pool served out of fixed storage is reset instead, and can be used again.
+ *
+ * \param[inout] pool pool to be finalized.
+ * \return `RMW_RET_OK` if successful, or
+ * \return `RMW_RET_INVALID_ARGUMENT` if `pool` is NULL, or
+ * \return `RMW_RET_ERROR` if objects acquired from the pool are still live.
+ */
+rmw_ret_t
+rmw_slab_pool_fini(rmw_slab_pool_t * pool);
+
+/// Acquire a zero initialized object from the pool.
+/**
+ * \return pointer to the object, or
+ * \return `NULL` if the pool is exhausted and a new slab could not be reserved.
+ */
+void *
+rmw_slab_pool_acquire(rmw_slab_pool_t * pool);
+
+/// Release an object back to the pool it was acquired from.
+/**
+ * Passing `NULL` is a no-op.
+ */
+void
+rmw_slab_pool_release(rmw_slab_pool_t * pool, void * object);
+
+/// Check whether an object lies within the fixed storage of a pool.
+/**
+ * \return `true` if `object` was carved out of the storage of `pool`, or
+ * \return `false` otherwise, including when the pool has no fixed storage.
+ */
+bool
+rmw_slab_pool_storage_contains(const rmw_slab_pool_t * pool, const void * object);
+
+/// Get a consistent snapshot of the pool usage.
+void
+rmw_slab_pool_get_statistics(rmw_slab_pool_t * pool, rmw_slab_pool_statistics_t * statistics);
+
+#endif  // SLAB_POOL_H_
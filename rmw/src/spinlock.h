@@ -0,0 +1,57 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SPINLOCK_H_
+#define SPINLOCK_H_
+
+#include <stdbool.h>
+
+#include "rcutils/stdatomic_helper.h"
+
+/// Test-and-set lock for the short, non-blocking critical sections inside librmw.
+/**
+ * librmw is a C library without a threading dependency, so this is the only
+ * synchronization primitive available to it.
+ * Critical sections guarded by it must never block nor call back into user code.
+ *
+ * A zero initialized lock (e.g. a static one) is unlocked.
+ */
+typedef atomic_bool rmw_spinlock_t;
+
+/// Initialize a lock in the unlocked state.
+static inline void
+rmw_spinlock_init(rmw_spinlock_t * lock)
+{
+  rcutils_atomic_store(lock, false);
+}
+
+/// Acquire the lock, spinning until it is available.
+static inline void
+rmw_spinlock_lock(rmw_spinlock_t * lock)
+{
+  while (rcutils_atomic_exchange_bool(lock, true)) {
+    // Spin on a plain load to avoid hammering the cache line with writes.
+    while (rcutils_atomic_load_bool(lock)) {
+    }
+  }
+}
+
+/// Release a lock previously acquired with rmw_spinlock_lock().
+static inline void
+rmw_spinlock_unlock(rmw_spinlock_t * lock)
+{
+  rcutils_atomic_store(lock, false);
+}
+
+#endif  // SPINLOCK_H_
@@ -0,0 +1,135 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/allocators.h"
+#include "rmw/impl/config.h"
+
+#include "./slab_pool.h"
+
+#if RMW_STATIC_SMALL_BLOCK_SIZE > RMW_STATIC_LARGE_BLOCK_SIZE
+# error "RMW_STATIC_SMALL_BLOCK_SIZE must not be larger than RMW_STATIC_LARGE_BLOCK_SIZE"
+#endif
+
+#if RMW_AVOID_MEMORY_ALLOCATION
+static rmw_slab_pool_max_align_t g_small_block_storage[
+  RMW_SLAB_POOL_STORAGE_LENGTH(RMW_STATIC_SMALL_BLOCK_SIZE, RMW_STATIC_SMALL_BLOCK_COUNT)];
+static rmw_slab_pool_max_align_t g_large_block_storage[
+  RMW_SLAB_POOL_STORAGE_LENGTH(RMW_STATIC_LARGE_BLOCK_SIZE, RMW_STATIC_LARGE_BLOCK_COUNT)];
+
+static rmw_slab_pool_t g_small_blocks = RMW_SLAB_POOL_STATIC_INITIALIZER(
+  RMW_STATIC_SMALL_BLOCK_SIZE, RMW_STATIC_SMALL_BLOCK_COUNT, g_small_block_storage);
+static rmw_slab_pool_t g_large_blocks = RMW_SLAB_POOL_STATIC_INITIALIZER(
+  RMW_STATIC_LARGE_BLOCK_SIZE, RMW_STATIC_LARGE_BLOCK_COUNT, g_large_block_storage);
+#endif
+
+// Pool owning the given block, or NULL if the block does not come from the static allocator.
+static rmw_slab_pool_t *
+_rmw_static_block_owner(const void * block)
+{
+#if RMW_AVOID_MEMORY_ALLOCATION
+  if (rmw_slab_pool_storage_contains(&g_small_blocks, block)) {
+    return &g_small_blocks;
+  }
+  if (rmw_slab_pool_storage_contains(&g_large_blocks, block)) {
+    return &g_large_blocks;
+  }
+#else
+  (void)block;
+#endif
+  return NULL;
+}
+
+static void *
+_rmw_static_allocate(size_t size, void * state)
+{
+  (void)state;
+#if RMW_AVOID_MEMORY_ALLOCATION
+  if (size <= RMW_STATIC_SMALL_BLOCK_SIZE) {
+    void * block = rmw_slab_pool_acquire(&g_small_blocks);
+    if (NULL != block) {
+      return block;
+    }
+    // Fall back on large blocks when small ones are exhausted.
+  }
+  if (size <= RMW_STATIC_LARGE_BLOCK_SIZE) {
+    return rmw_slab_pool_acquire(&g_large_blocks);
+  }
+#else
+  // Static storage is only reserved when avoiding memory allocation.
+  (void)size;
+#endif
+  return NULL;
+}
+
+static void
+_rmw_static_deallocate(void * pointer, void * state)
+{
+  (void)state;
+  rmw_slab_pool_t * owner = _rmw_static_block_owner(pointer);
+  if (NULL != owner) {
+    rmw_slab_pool_release(owner, pointer);
+  }
+}
+
+static void *
+_rmw_static_reallocate(void * pointer, size_t size, void * state)
+{
+  if (NULL == pointer) {
+    return _rmw_static_allocate(size, state);
+  }
+  rmw_slab_pool_t * owner = _rmw_static_block_owner(pointer);
+  if (NULL == owner) {
+    return NULL;
+  }
+  // Blocks never shrink, they only move to a larger class when needed.
+  if (size <= owner->slot_size) {
+    return pointer;
+  }
+  void * block = _rmw_static_allocate(size, state);
+  if (NULL == block) {
+    return NULL;
+  }
+  memcpy(block, pointer, owner->slot_size);
+  rmw_slab_pool_release(owner, pointer);
+  return block;
+}
+
+static void *
+_rmw_static_zero_allocate(size_t number_of_elements, size_t size_of_element, void * state)
+{
+  if (0u != size_of_element && number_of_elements > SIZE_MAX / size_of_element) {
+    return NULL;
+  }
+  // Slab pools hand out zero initialized blocks already.
+  return _rmw_static_allocate(number_of_elements * size_of_element, state);
+}
+
+static rcutils_allocator_t g_static_allocator = {
+  .allocate = _rmw_static_allocate,
+  .deallocate = _rmw_static_deallocate,
+  .reallocate = _rmw_static_reallocate,
+  .zero_allocate = _rmw_static_zero_allocate,
+  .state = NULL,
+};
+
+rcutils_allocator_t
+rmw_get_static_allocator(void)
+{
+  return g_static_allocator;
+}
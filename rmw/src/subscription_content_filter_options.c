@@ -13,12 +13,30 @@
 // limitations under the License.
 
 #include <stddef.h>
+#include <string.h>
 
 #include "rcutils/strdup.h"
 
 #include "rmw/error_handling.h"
 #include "rmw/subscription_content_filter_options.h"
 
+#include "./allocation_tracking.h"
+
+// Account the deallocation of a string array about to be finalized, strings included.
+static void
+_rmw_track_string_array_deallocation(const rcutils_string_array_t * string_array)
+{
+  if (NULL == string_array->data) {
+    return;
+  }
+  for (size_t i = 0; i < string_array->size; ++i) {
+    if (NULL != string_array->data[i]) {
+      rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_CONTENT_FILTER_OPTIONS);
+    }
+  }
+  rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_CONTENT_FILTER_OPTIONS);
+}
+
 rmw_subscription_content_filter_options_t
 rmw_get_zero_initialized_content_filter_options()
 {
@@ -54,6 +72,8 @@ rmw_subscription_content_filter_options_init(
     ret = RMW_RET_BAD_ALLOC;
     goto failed;
   }
+  rmw_track_allocation(
+    RMW_ALLOCATION_DOMAIN_CONTENT_FILTER_OPTIONS, strlen(filter_expression) + 1u);
 
   if (expression_parameters_argc > 0) {
     rcutils_ret_t rcutils_ret = rcutils_string_array_init(
@@ -63,6 +83,8 @@ rmw_subscription_content_filter_options_init(
       ret = RMW_RET_BAD_ALLOC;
       goto failed;
     }
+    rmw_track_allocation(
+      RMW_ALLOCATION_DOMAIN_CONTENT_FILTER_OPTIONS, expression_parameters_argc * sizeof(char *));
 
     for (i = 0; i < expression_parameters_argc; i++) {
       options->expression_parameters.data[i] =
@@ -72,6 +94,8 @@ rmw_subscription_content_filter_options_init(
         ret = RMW_RET_BAD_ALLOC;
         goto clear_expression_parameters;
       }
+      rmw_track_allocation(
+        RMW_ALLOCATION_DOMAIN_CONTENT_FILTER_OPTIONS, strlen(expression_parameter_argv[i]) + 1u);
     }
   }
 
@@ -80,12 +104,16 @@ rmw_subscription_content_filter_options_init(
   return RMW_RET_OK;
 
 clear_expression_parameters:
+  _rmw_track_string_array_deallocation(&options->expression_parameters);
   rcutils_ret = rcutils_string_array_fini(&options->expression_parameters);
   if (RCUTILS_RET_OK != rcutils_ret) {
     RCUTILS_SAFE_FWRITE_TO_STDERR("Failed to fini string array.\n");
   }
 
 failed:
+  if (new_filter_expression) {
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_CONTENT_FILTER_OPTIONS);
+  }
   allocator->deallocate(new_filter_expression, allocator->state);
 
   return ret;
@@ -143,8 +171,10 @@ rmw_subscription_content_filter_options_fini(
   if (options->filter_expression) {
     allocator->deallocate(options->filter_expression, allocator->state);
     options->filter_expression = NULL;
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_CONTENT_FILTER_OPTIONS);
   }
 
+  _rmw_track_string_array_deallocation(&options->expression_parameters);
   rcutils_ret_t ret = rcutils_string_array_fini(&options->expression_parameters);
   if (RCUTILS_RET_OK != ret) {
     RCUTILS_SAFE_FWRITE_TO_STDERR("Failed to fini string array.\n");
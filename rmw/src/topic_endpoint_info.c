@@ -14,11 +14,15 @@
 
 #include "rmw/topic_endpoint_info.h"
 
+#include <string.h>
+
 #include "rcutils/macros.h"
 #include "rcutils/strdup.h"
 #include "rmw/error_handling.h"
 #include "rmw/types.h"
 
+#include "./allocation_tracking.h"
+
 rmw_topic_endpoint_info_t
 rmw_get_zero_initialized_topic_endpoint_info(void)
 {
@@ -38,6 +42,9 @@ _rmw_topic_endpoint_info_fini_str(
   const char ** topic_endpoint_info_str,
   rcutils_allocator_t * allocator)
 {
+  if (*topic_endpoint_info_str) {
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_TOPIC_ENDPOINT_INFO);
+  }
   allocator->deallocate((char *) *topic_endpoint_info_str, allocator->state);
   *topic_endpoint_info_str = NULL;
   return RMW_RET_OK;
@@ -130,6 +137,7 @@ _rmw_topic_endpoint_info_copy_str(
   if (NULL == *topic_endpoint_info_str) {
     return RMW_RET_BAD_ALLOC;
   }
+  rmw_track_allocation(RMW_ALLOCATION_DOMAIN_TOPIC_ENDPOINT_INFO, strlen(str) + 1u);
 
   return RMW_RET_OK;
 }
@@ -16,6 +16,8 @@
 #include "rmw/error_handling.h"
 #include "rmw/types.h"
 
+#include "./allocation_tracking.h"
+
 rmw_topic_endpoint_info_array_t
 rmw_get_zero_initialized_topic_endpoint_info_array(void)
 {
@@ -65,6 +67,9 @@ rmw_topic_endpoint_info_array_init_with_size(
     RMW_SET_ERROR_MSG("failed to allocate memory for info_array");
     return RMW_RET_BAD_ALLOC;
   }
+  rmw_track_allocation(
+    RMW_ALLOCATION_DOMAIN_TOPIC_ENDPOINT_INFO,
+    sizeof(*topic_endpoint_info_array->info_array) * size);
   topic_endpoint_info_array->size = size;
   for (size_t i = 0; i < size; i++) {
     topic_endpoint_info_array->info_array[i] = rmw_get_zero_initialized_topic_endpoint_info();
@@ -96,6 +101,9 @@ rmw_topic_endpoint_info_array_fini(
     }
   }
 
+  if (topic_endpoint_info_array->info_array) {
+    rmw_track_deallocation(RMW_ALLOCATION_DOMAIN_TOPIC_ENDPOINT_INFO);
+  }
   allocator->deallocate(topic_endpoint_info_array->info_array, allocator->state);
   topic_endpoint_info_array->info_array = NULL;
   topic_endpoint_info_array->size = 0;
@@ -14,10 +14,47 @@
 
 #include <rmw/validate_full_topic_name.h>
 
-#include <ctype.h>
 #include <string.h>
 
-#include "rcutils/isalnum_no_locale.h"
+#include "./validate_name_core.h"
+
+// Validation results for each error of the name validation core.
+static const int g_topic_validation_results[RMW_NAME_ERROR_COUNT] = {
+  [RMW_NAME_VALID] = RMW_TOPIC_VALID,
+  [RMW_NAME_INVALID_IS_EMPTY_STRING] = RMW_TOPIC_INVALID_IS_EMPTY_STRING,
+  [RMW_NAME_INVALID_NOT_ABSOLUTE] = RMW_TOPIC_INVALID_NOT_ABSOLUTE,
+  [RMW_NAME_INVALID_ENDS_WITH_FORWARD_SLASH] = RMW_TOPIC_INVALID_ENDS_WITH_FORWARD_SLASH,
+  [RMW_NAME_INVALID_CONTAINS_UNALLOWED_CHARACTERS] =
+    RMW_TOPIC_INVALID_CONTAINS_UNALLOWED_CHARACTERS,
+  [RMW_NAME_INVALID_CONTAINS_REPEATED_FORWARD_SLASH] =
+    RMW_TOPIC_INVALID_CONTAINS_REPEATED_FORWARD_SLASH,
+  [RMW_NAME_INVALID_TOKEN_STARTS_WITH_NUMBER] = RMW_TOPIC_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER,
+};
+
+// Check a full topic name whose arguments were already checked, returning the validation result.
+static int
+_rmw_validate_full_topic_name(
+  const char * topic_name,
+  size_t topic_name_length,
+  size_t * invalid_index)
+{
+  // check for emptiness, leading and trailing '/', unallowed characters, repeated '/' and
+  // tokens that start with a number, all at once
+  rmw_name_error_t error = rmw_validate_name_core(
+    topic_name, topic_name_length, RMW_NAME_KIND_FULLY_QUALIFIED, invalid_index);
+  if (error != RMW_NAME_VALID) {
+    return g_topic_validation_results[error];
+  }
+  // check if the topic name is too long last, since it might be a soft invalidation
+  if (topic_name_length > RMW_TOPIC_MAX_NAME_LENGTH) {
+    if (invalid_index) {
+      *invalid_index = RMW_TOPIC_MAX_NAME_LENGTH - 1;
+    }
+    return RMW_TOPIC_INVALID_TOO_LONG;
+  }
+  // everything was ok, avoid setting invalid_index and return valid topic
+  return RMW_TOPIC_VALID;
+}
 
 rmw_ret_t
 rmw_validate_full_topic_name(
@@ -45,84 +82,36 @@ rmw_validate_full_topic_name_with_size(
   if (!validation_result) {
     return RMW_RET_INVALID_ARGUMENT;
   }
-  if (topic_name_length == 0) {
-    *validation_result = RMW_TOPIC_INVALID_IS_EMPTY_STRING;
-    if (invalid_index) {
-      *invalid_index = 0;
-    }
-    return RMW_RET_OK;
-  }
-  if (topic_name[0] != '/') {
-    *validation_result = RMW_TOPIC_INVALID_NOT_ABSOLUTE;
-    if (invalid_index) {
-      *invalid_index = 0;
-    }
-    return RMW_RET_OK;
-  }
-  // note topic_name_length is >= 1 at this point
-  if (topic_name[topic_name_length - 1] == '/') {
-    // catches both "/foo/" and "/"
-    *validation_result = RMW_TOPIC_INVALID_ENDS_WITH_FORWARD_SLASH;
-    if (invalid_index) {
-      *invalid_index = topic_name_length - 1;
-    }
+  *validation_result = _rmw_validate_full_topic_name(topic_name, topic_name_length, invalid_index);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_validate_full_topic_names(
+  const char * const * topic_names,
+  const size_t * topic_name_lengths,
+  size_t count,
+  int * validation_results,
+  size_t * invalid_indices)
+{
+  if (count == 0) {
     return RMW_RET_OK;
   }
-  // check for unallowed characters
-  for (size_t i = 0; i < topic_name_length; ++i) {
-    if (rcutils_isalnum_no_locale(topic_name[i])) {
-      // if it is an alpha numeric character, i.e. [0-9|A-Z|a-z], continue
-      continue;
-    } else if (topic_name[i] == '_') {
-      // if it is an underscore, continue
-      continue;
-    } else if (topic_name[i] == '/') {
-      // if it is a forward slash, continue
-      continue;
-    } else {
-      // if it is none of these, then it is an unallowed character in a FQN topic name
-      *validation_result = RMW_TOPIC_INVALID_CONTAINS_UNALLOWED_CHARACTERS;
-      if (invalid_index) {
-        *invalid_index = i;
-      }
-      return RMW_RET_OK;
-    }
+  if (!topic_names) {
+    return RMW_RET_INVALID_ARGUMENT;
   }
-  // check for double '/' and tokens that start with a number
-  for (size_t i = 0; i < topic_name_length; ++i) {
-    if (i == topic_name_length - 1) {
-      // if this is the last character, then nothing to check
-      continue;
-    }
-    // past this point, assuming i+1 is a valid index
-    if (topic_name[i] == '/') {
-      if (topic_name[i + 1] == '/') {
-        *validation_result = RMW_TOPIC_INVALID_CONTAINS_REPEATED_FORWARD_SLASH;
-        if (invalid_index) {
-          *invalid_index = i + 1;
-        }
-        return RMW_RET_OK;
-      }
-      if (isdigit(topic_name[i + 1]) != 0) {
-        // this is the case where a '/' if followed by a number, i.e. [0-9]
-        *validation_result = RMW_TOPIC_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER;
-        if (invalid_index) {
-          *invalid_index = i + 1;
-        }
-        return RMW_RET_OK;
-      }
-    }
+  if (!validation_results) {
+    return RMW_RET_INVALID_ARGUMENT;
   }
-  // check if the topic name is too long last, since it might be a soft invalidation
-  if (topic_name_length > RMW_TOPIC_MAX_NAME_LENGTH) {
-    *validation_result = RMW_TOPIC_INVALID_TOO_LONG;
-    if (invalid_index) {
-      *invalid_index = RMW_TOPIC_MAX_NAME_LENGTH - 1;
+  for (size_t i = 0; i < count; ++i) {
+    const char * topic_name = topic_names[i];
+    if (!topic_name) {
+      return RMW_RET_INVALID_ARGUMENT;
     }
-    return RMW_RET_OK;
+    size_t topic_name_length = topic_name_lengths ? topic_name_lengths[i] : strlen(topic_name);
+    validation_results[i] = _rmw_validate_full_topic_name(
+      topic_name, topic_name_length, invalid_indices ? &invalid_indices[i] : NULL);
   }
-  // everything was ok, set result to valid topic, avoid setting invalid_index, and return
-  *validation_result = RMW_TOPIC_VALID;
   return RMW_RET_OK;
 }
 
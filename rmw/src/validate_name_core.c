@@ -0,0 +1,162 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./validate_name_core.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rcutils/isalnum_no_locale.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define RMW_VALIDATE_NAME_USE_SSE2 1
+# include <emmintrin.h>
+# ifdef _MSC_VER
+#  include <intrin.h>
+# endif
+#else
+# define RMW_VALIDATE_NAME_USE_SSE2 0
+#endif
+
+static inline bool
+_rmw_is_digit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+#if RMW_VALIDATE_NAME_USE_SSE2
+// Index of the lowest set bit of a non zero mask.
+static inline unsigned int
+_rmw_lowest_set_bit(unsigned int mask)
+{
+# ifdef _MSC_VER
+  unsigned long index;
+  _BitScanForward(&index, mask);
+  return (unsigned int)index;
+# else
+  return (unsigned int)__builtin_ctz(mask);
+# endif
+}
+
+// Mask of the bytes of v which lie within [low, high], bytes above 0x7F never do.
+static inline __m128i
+_rmw_bytes_in_range(__m128i v, char low, char high)
+{
+  return _mm_and_si128(
+    _mm_cmpgt_epi8(v, _mm_set1_epi8((char)(low - 1))),
+    _mm_cmplt_epi8(v, _mm_set1_epi8((char)(high + 1))));
+}
+#endif
+
+// Scan a name once, for unallowed characters and, in fully qualified names, for the
+// first repeated '/' or token starting with a number.
+// Unallowed characters take precedence, wherever they are, so the scan only stops
+// early on them.
+static rmw_name_error_t
+_rmw_scan_name(
+  const char * name,
+  size_t name_length,
+  bool allow_slash,
+  size_t * error_index)
+{
+  rmw_name_error_t error = RMW_NAME_VALID;
+  size_t i = 0;
+#if RMW_VALIDATE_NAME_USE_SSE2
+  // Process 16 bytes at a time, as long as the byte following them can be looked at too.
+  const __m128i slash = _mm_set1_epi8('/');
+  const __m128i slash_allowed = allow_slash ? _mm_set1_epi8(-1) : _mm_setzero_si128();
+  for (; i + 16 < name_length; i += 16) {
+    const __m128i v = _mm_loadu_si128((const __m128i *)(name + i));
+    const __m128i is_slash = _mm_and_si128(_mm_cmpeq_epi8(v, slash), slash_allowed);
+    __m128i allowed = _mm_or_si128(_rmw_bytes_in_range(v, '0', '9'), is_slash);
+    allowed = _mm_or_si128(allowed, _mm_cmpeq_epi8(v, _mm_set1_epi8('_')));
+    // Setting the 0x20 bit maps upper case letters onto lower case ones.
+    allowed = _mm_or_si128(
+      allowed, _rmw_bytes_in_range(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z'));
+    const unsigned int unallowed = (unsigned int)_mm_movemask_epi8(allowed) ^ 0xFFFFu;
+    if (unallowed != 0u) {
+      *error_index = i + _rmw_lowest_set_bit(unallowed);
+      return RMW_NAME_INVALID_CONTAINS_UNALLOWED_CHARACTERS;
+    }
+    if (error != RMW_NAME_VALID || !allow_slash) {
+      continue;
+    }
+    const __m128i next = _mm_loadu_si128((const __m128i *)(name + i + 1));
+    const unsigned int next_is_slash =
+      (unsigned int)_mm_movemask_epi8(_mm_and_si128(is_slash, _mm_cmpeq_epi8(next, slash)));
+    const unsigned int next_is_digit = (unsigned int)_mm_movemask_epi8(
+      _mm_and_si128(is_slash, _rmw_bytes_in_range(next, '0', '9')));
+    if ((next_is_slash | next_is_digit) != 0u) {
+      const unsigned int bit = _rmw_lowest_set_bit(next_is_slash | next_is_digit);
+      error = (next_is_slash & (1u << bit)) ?
+        RMW_NAME_INVALID_CONTAINS_REPEATED_FORWARD_SLASH :
+        RMW_NAME_INVALID_TOKEN_STARTS_WITH_NUMBER;
+      *error_index = i + bit + 1;
+    }
+  }
+#endif
+  for (; i < name_length; ++i) {
+    const char c = name[i];
+    if (c == '/' && allow_slash) {
+      if (error != RMW_NAME_VALID || i + 1 == name_length) {
+        continue;
+      }
+      // past this point, i+1 is a valid index
+      if (name[i + 1] == '/') {
+        error = RMW_NAME_INVALID_CONTAINS_REPEATED_FORWARD_SLASH;
+        *error_index = i + 1;
+      } else if (_rmw_is_digit(name[i + 1])) {
+        // this is the case where a '/' if followed by a number, i.e. [0-9]
+        error = RMW_NAME_INVALID_TOKEN_STARTS_WITH_NUMBER;
+        *error_index = i + 1;
+      }
+    } else if (!rcutils_isalnum_no_locale(c) && c != '_') {
+      // if it is none of [0-9|A-Z|a-z|_], then it is an unallowed character
+      *error_index = i;
+      return RMW_NAME_INVALID_CONTAINS_UNALLOWED_CHARACTERS;
+    }
+  }
+  return error;
+}
+
+rmw_name_error_t
+rmw_validate_name_core(
+  const char * name,
+  size_t name_length,
+  rmw_name_kind_t kind,
+  size_t * invalid_index)
+{
+  rmw_name_error_t error = RMW_NAME_VALID;
+  size_t error_index = 0;
+  const bool fully_qualified = kind == RMW_NAME_KIND_FULLY_QUALIFIED;
+  if (name_length == 0) {
+    error = RMW_NAME_INVALID_IS_EMPTY_STRING;
+  } else if (fully_qualified && name[0] != '/') {
+    error = RMW_NAME_INVALID_NOT_ABSOLUTE;
+  } else if (fully_qualified && name[name_length - 1] == '/') {
+    // catches both "/foo/" and "/"
+    error = RMW_NAME_INVALID_ENDS_WITH_FORWARD_SLASH;
+    error_index = name_length - 1;
+  } else {
+    error = _rmw_scan_name(name, name_length, fully_qualified, &error_index);
+    if (error == RMW_NAME_VALID && !fully_qualified && _rmw_is_digit(name[0])) {
+      // this is the case where the name starts with a number, i.e. [0-9]
+      error = RMW_NAME_INVALID_TOKEN_STARTS_WITH_NUMBER;
+    }
+  }
+  if (error != RMW_NAME_VALID && invalid_index) {
+    *invalid_index = error_index;
+  }
+  return error;
+}
@@ -0,0 +1,67 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef VALIDATE_NAME_CORE_H_
+#define VALIDATE_NAME_CORE_H_
+
+#include <stddef.h>
+
+/// Kinds of names validated by rmw_validate_name_core().
+typedef enum rmw_name_kind_e
+{
+  /// Absolute, '/' separated names, i.e. full topic names and namespaces.
+  RMW_NAME_KIND_FULLY_QUALIFIED,
+  /// Single token names, i.e. node names.
+  RMW_NAME_KIND_TOKEN
+} rmw_name_kind_t;
+
+/// Errors found by rmw_validate_name_core(), by order of precedence.
+typedef enum rmw_name_error_e
+{
+  RMW_NAME_VALID = 0,
+  RMW_NAME_INVALID_IS_EMPTY_STRING,
+  /// Only for fully qualified names.
+  RMW_NAME_INVALID_NOT_ABSOLUTE,
+  /// Only for fully qualified names.
+  RMW_NAME_INVALID_ENDS_WITH_FORWARD_SLASH,
+  RMW_NAME_INVALID_CONTAINS_UNALLOWED_CHARACTERS,
+  /// Only for fully qualified names.
+  RMW_NAME_INVALID_CONTAINS_REPEATED_FORWARD_SLASH,
+  /// For token names, only the first character is a token start.
+  RMW_NAME_INVALID_TOKEN_STARTS_WITH_NUMBER,
+  RMW_NAME_ERROR_COUNT
+} rmw_name_error_t;
+
+/// Validate the characters and structure of a name in a single pass.
+/**
+ * Allowed characters are alphanumerics and '_', plus '/' for fully qualified names.
+ * Exactly `name_length` bytes of `name` are looked at, so it needs not be null terminated.
+ * Length limits are left to callers, as they differ for each kind of name and are
+ * checked last.
+ *
+ * \param[in] name name to be validated, must not be NULL.
+ * \param[in] name_length length of `name`.
+ * \param[in] kind kind of name to validate `name` as.
+ * \param[out] invalid_index index of the first offending character, set only
+ *   if the name is not valid, may be NULL.
+ * \return the first error found, by order of precedence, or `RMW_NAME_VALID`.
+ */
+rmw_name_error_t
+rmw_validate_name_core(
+  const char * name,
+  size_t name_length,
+  rmw_name_kind_t kind,
+  size_t * invalid_index);
+
+#endif  // VALIDATE_NAME_CORE_H_
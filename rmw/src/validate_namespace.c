@@ -14,14 +14,55 @@
 
 #include "rmw/validate_namespace.h"
 
-#include <ctype.h>
-#include <stdio.h>
 #include <string.h>
 
-#include <rcutils/snprintf.h>
+#include "./validate_name_core.h"
 
-#include "rmw/error_handling.h"
-#include "rmw/validate_full_topic_name.h"
+// Validation results for each error of the name validation core.
+static const int g_namespace_validation_results[RMW_NAME_ERROR_COUNT] = {
+  [RMW_NAME_VALID] = RMW_NAMESPACE_VALID,
+  [RMW_NAME_INVALID_IS_EMPTY_STRING] = RMW_NAMESPACE_INVALID_IS_EMPTY_STRING,
+  [RMW_NAME_INVALID_NOT_ABSOLUTE] = RMW_NAMESPACE_INVALID_NOT_ABSOLUTE,
+  [RMW_NAME_INVALID_ENDS_WITH_FORWARD_SLASH] = RMW_NAMESPACE_INVALID_ENDS_WITH_FORWARD_SLASH,
+  [RMW_NAME_INVALID_CONTAINS_UNALLOWED_CHARACTERS] =
+    RMW_NAMESPACE_INVALID_CONTAINS_UNALLOWED_CHARACTERS,
+  [RMW_NAME_INVALID_CONTAINS_REPEATED_FORWARD_SLASH] =
+    RMW_NAMESPACE_INVALID_CONTAINS_REPEATED_FORWARD_SLASH,
+  [RMW_NAME_INVALID_TOKEN_STARTS_WITH_NUMBER] =
+    RMW_NAMESPACE_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER,
+};
+
+// Check a namespace whose arguments were already checked, returning the validation result.
+static int
+_rmw_validate_namespace(
+  const char * namespace_,
+  size_t namespace_length,
+  size_t * invalid_index)
+{
+  // Special case for root namepsace
+  if (namespace_length == 1 && namespace_[0] == '/') {
+    // Ok to return here, it is valid and will not exceed RMW_NAMESPACE_MAX_LENGTH.
+    return RMW_NAMESPACE_VALID;
+  }
+
+  // All other cases follow the same rules as full topic names.
+  rmw_name_error_t error = rmw_validate_name_core(
+    namespace_, namespace_length, RMW_NAME_KIND_FULLY_QUALIFIED, invalid_index);
+  if (error != RMW_NAME_VALID) {
+    return g_namespace_validation_results[error];
+  }
+
+  // check if the namespace is too long last, since it might be a soft invalidation
+  if (namespace_length > RMW_NAMESPACE_MAX_LENGTH) {
+    if (invalid_index) {
+      *invalid_index = RMW_NAMESPACE_MAX_LENGTH - 1;
+    }
+    return RMW_NAMESPACE_INVALID_TOO_LONG;
+  }
+
+  // everything was ok, avoid setting invalid_index and return valid namespace
+  return RMW_NAMESPACE_VALID;
+}
 
 rmw_ret_t
 rmw_validate_namespace(
@@ -49,76 +90,36 @@ rmw_validate_namespace_with_size(
   if (!validation_result) {
     return RMW_RET_INVALID_ARGUMENT;
   }
+  *validation_result = _rmw_validate_namespace(namespace_, namespace_length, invalid_index);
+  return RMW_RET_OK;
+}
 
-  // Special case for root namepsace
-  if (namespace_length == 1 && namespace_[0] == '/') {
-    // Ok to return here, it is valid and will not exceed RMW_NAMESPACE_MAX_LENGTH.
-    *validation_result = RMW_NAMESPACE_VALID;
+rmw_ret_t
+rmw_validate_namespaces(
+  const char * const * namespaces,
+  const size_t * namespace_lengths,
+  size_t count,
+  int * validation_results,
+  size_t * invalid_indices)
+{
+  if (count == 0) {
     return RMW_RET_OK;
   }
-
-  // All other cases should pass the validate topic name test.
-  int t_validation_result;
-  size_t t_invalid_index;
-  rmw_ret_t ret = rmw_validate_full_topic_name(namespace_, &t_validation_result, &t_invalid_index);
-  if (ret != RMW_RET_OK) {
-    // error already set
-    return ret;
+  if (!namespaces) {
+    return RMW_RET_INVALID_ARGUMENT;
   }
-
-  if (t_validation_result != RMW_TOPIC_VALID && t_validation_result != RMW_TOPIC_INVALID_TOO_LONG) {
-    switch (t_validation_result) {
-      case RMW_TOPIC_INVALID_IS_EMPTY_STRING:
-        *validation_result = RMW_NAMESPACE_INVALID_IS_EMPTY_STRING;
-        break;
-      case RMW_TOPIC_INVALID_NOT_ABSOLUTE:
-        *validation_result = RMW_NAMESPACE_INVALID_NOT_ABSOLUTE;
-        break;
-      case RMW_TOPIC_INVALID_ENDS_WITH_FORWARD_SLASH:
-        *validation_result = RMW_NAMESPACE_INVALID_ENDS_WITH_FORWARD_SLASH;
-        break;
-      case RMW_TOPIC_INVALID_CONTAINS_UNALLOWED_CHARACTERS:
-        *validation_result = RMW_NAMESPACE_INVALID_CONTAINS_UNALLOWED_CHARACTERS;
-        break;
-      case RMW_TOPIC_INVALID_CONTAINS_REPEATED_FORWARD_SLASH:
-        *validation_result = RMW_NAMESPACE_INVALID_CONTAINS_REPEATED_FORWARD_SLASH;
-        break;
-      case RMW_TOPIC_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER:
-        *validation_result = RMW_NAMESPACE_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER;
-        break;
-      default:
-        {
-          char default_err_msg[256];
-          // explicitly not taking return value which is number of bytes written
-          int ret = rcutils_snprintf(
-            default_err_msg, sizeof(default_err_msg),
-            "rmw_validate_namespace(): unknown rmw_validate_full_topic_name() result '%d'",
-            t_validation_result);
-          if (ret < 0) {
-            RMW_SET_ERROR_MSG("rmw_validate_namespace(): rcutils_snprintf() failed");
-          } else {
-            RMW_SET_ERROR_MSG(default_err_msg);
-          }
-        }
-        return RMW_RET_ERROR;
-    }
-    if (invalid_index) {
-      *invalid_index = t_invalid_index;
-    }
-    return RMW_RET_OK;
+  if (!validation_results) {
+    return RMW_RET_INVALID_ARGUMENT;
   }
-
-  // check if the namespace is too long last, since it might be a soft invalidation
-  if (namespace_length > RMW_NAMESPACE_MAX_LENGTH) {
-    *validation_result = RMW_NAMESPACE_INVALID_TOO_LONG;
-    if (invalid_index) {
-      *invalid_index = RMW_NAMESPACE_MAX_LENGTH - 1;
+  for (size_t i = 0; i < count; ++i) {
+    const char * namespace_ = namespaces[i];
+    if (!namespace_) {
+      return RMW_RET_INVALID_ARGUMENT;
     }
-    return RMW_RET_OK;
+    size_t namespace_length = namespace_lengths ? namespace_lengths[i] : strlen(namespace_);
+    validation_results[i] = _rmw_validate_namespace(
+      namespace_, namespace_length, invalid_indices ? &invalid_indices[i] : NULL);
   }
-
-  // everything was ok, set result to valid namespace, avoid setting invalid_index, and return
-  *validation_result = RMW_NAMESPACE_VALID;
   return RMW_RET_OK;
 }
 
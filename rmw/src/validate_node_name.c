@@ -14,10 +14,42 @@
 
 #include <rmw/validate_node_name.h>
 
-#include <ctype.h>
 #include <string.h>
 
-#include "rcutils/isalnum_no_locale.h"
+#include "./validate_name_core.h"
+
+// Validation results for the errors of the name validation core which apply to node names.
+static const int g_node_name_validation_results[RMW_NAME_ERROR_COUNT] = {
+  [RMW_NAME_VALID] = RMW_NODE_NAME_VALID,
+  [RMW_NAME_INVALID_IS_EMPTY_STRING] = RMW_NODE_NAME_INVALID_IS_EMPTY_STRING,
+  [RMW_NAME_INVALID_CONTAINS_UNALLOWED_CHARACTERS] =
+    RMW_NODE_NAME_INVALID_CONTAINS_UNALLOWED_CHARACTERS,
+  [RMW_NAME_INVALID_TOKEN_STARTS_WITH_NUMBER] = RMW_NODE_NAME_INVALID_STARTS_WITH_NUMBER,
+};
+
+// Check a node name whose arguments were already checked, returning the validation result.
+static int
+_rmw_validate_node_name(
+  const char * node_name,
+  size_t node_name_length,
+  size_t * invalid_index)
+{
+  // check for emptiness, unallowed characters and a leading number, all at once
+  rmw_name_error_t error = rmw_validate_name_core(
+    node_name, node_name_length, RMW_NAME_KIND_TOKEN, invalid_index);
+  if (error != RMW_NAME_VALID) {
+    return g_node_name_validation_results[error];
+  }
+  // check if the node name is too long last, since it might be a soft invalidation
+  if (node_name_length > RMW_NODE_NAME_MAX_NAME_LENGTH) {
+    if (invalid_index) {
+      *invalid_index = RMW_NODE_NAME_MAX_NAME_LENGTH - 1;
+    }
+    return RMW_NODE_NAME_INVALID_TOO_LONG;
+  }
+  // everything was ok, avoid setting invalid_index and return valid node name
+  return RMW_NODE_NAME_VALID;
+}
 
 rmw_ret_t
 rmw_validate_node_name(
@@ -45,48 +77,36 @@ rmw_validate_node_name_with_size(
   if (!validation_result) {
     return RMW_RET_INVALID_ARGUMENT;
   }
-  if (node_name_length == 0) {
-    *validation_result = RMW_NODE_NAME_INVALID_IS_EMPTY_STRING;
-    if (invalid_index) {
-      *invalid_index = 0;
-    }
+  *validation_result = _rmw_validate_node_name(node_name, node_name_length, invalid_index);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_validate_node_names(
+  const char * const * node_names,
+  const size_t * node_name_lengths,
+  size_t count,
+  int * validation_results,
+  size_t * invalid_indices)
+{
+  if (count == 0) {
     return RMW_RET_OK;
   }
-  // check for unallowed characters
-  for (size_t i = 0; i < node_name_length; ++i) {
-    if (rcutils_isalnum_no_locale(node_name[i])) {
-      // if it is an alpha numeric character, i.e. [0-9|A-Z|a-z], continue
-      continue;
-    } else if (node_name[i] == '_') {
-      // if it is an underscore, continue
-      continue;
-    } else {
-      // if it is none of these, then it is an unallowed character in a node name
-      *validation_result = RMW_NODE_NAME_INVALID_CONTAINS_UNALLOWED_CHARACTERS;
-      if (invalid_index) {
-        *invalid_index = i;
-      }
-      return RMW_RET_OK;
-    }
+  if (!node_names) {
+    return RMW_RET_INVALID_ARGUMENT;
   }
-  if (isdigit(node_name[0]) != 0) {
-    // this is the case where the name starts with a number, i.e. [0-9]
-    *validation_result = RMW_NODE_NAME_INVALID_STARTS_WITH_NUMBER;
-    if (invalid_index) {
-      *invalid_index = 0;
-    }
-    return RMW_RET_OK;
+  if (!validation_results) {
+    return RMW_RET_INVALID_ARGUMENT;
   }
-  // check if the node name is too long last, since it might be a soft invalidation
-  if (node_name_length > RMW_NODE_NAME_MAX_NAME_LENGTH) {
-    *validation_result = RMW_NODE_NAME_INVALID_TOO_LONG;
-    if (invalid_index) {
-      *invalid_index = RMW_NODE_NAME_MAX_NAME_LENGTH - 1;
+  for (size_t i = 0; i < count; ++i) {
+    const char * node_name = node_names[i];
+    if (!node_name) {
+      return RMW_RET_INVALID_ARGUMENT;
     }
-    return RMW_RET_OK;
+    size_t node_name_length = node_name_lengths ? node_name_lengths[i] : strlen(node_name);
+    validation_results[i] = _rmw_validate_node_name(
+      node_name, node_name_length, invalid_indices ? &invalid_indices[i] : NULL);
   }
-  // everything was ok, set result to valid node name, avoid setting invalid_index, and return
-  *validation_result = RMW_NODE_NAME_VALID;
   return RMW_RET_OK;
 }
 
@@ -0,0 +1,128 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rcutils/allocator.h"
+
+#include "rmw/message_info_batch.h"
+#include "rmw/message_sequence.h"
+
+namespace
+{
+constexpr size_t kBatchSize = 4096u;
+
+class PerformanceTestMessageInfoBatch : public performance_test_fixture::PerformanceTest
+{
+public:
+  void SetUp(benchmark::State & st) override
+  {
+    allocator = rcutils_get_default_allocator();
+    sequence = rmw_get_zero_initialized_message_info_sequence();
+    batch = rmw_get_zero_initialized_message_info_batch();
+    if (RMW_RET_OK != rmw_message_info_sequence_init(&sequence, kBatchSize, &allocator) ||
+      RMW_RET_OK != rmw_message_info_batch_init(&batch, kBatchSize, &allocator))
+    {
+      st.SkipWithError("failed to initialize the sequence or the batch");
+    }
+    for (size_t i = 0u; i < kBatchSize; ++i) {
+      rmw_message_info_t & message_info = sequence.data[i];
+      message_info = rmw_get_zero_initialized_message_info();
+      message_info.source_timestamp = 1700000000000000000 + static_cast<int64_t>(i) * 1000000;
+      message_info.received_timestamp =
+        message_info.source_timestamp + static_cast<int64_t>((i * 7919u) % 100000u);
+      message_info.publication_sequence_number = i;
+      message_info.reception_sequence_number = i;
+    }
+    sequence.size = kBatchSize;
+    if (RMW_RET_OK != rmw_message_info_batch_from_sequence(&batch, &sequence)) {
+      st.SkipWithError("failed to fill the batch");
+    }
+    performance_test_fixture::PerformanceTest::SetUp(st);
+  }
+
+  void TearDown(benchmark::State & st) override
+  {
+    performance_test_fixture::PerformanceTest::TearDown(st);
+    if (RMW_RET_OK != rmw_message_info_batch_fini(&batch) ||
+      RMW_RET_OK != rmw_message_info_sequence_fini(&sequence))
+    {
+      st.SkipWithError("failed to finalize the sequence or the batch");
+    }
+  }
+
+protected:
+  rcutils_allocator_t allocator;
+  rmw_message_info_sequence_t sequence;
+  rmw_message_info_batch_t batch;
+};
+}  // namespace
+
+// Same statistics over the message info sequence itself, as a baseline.
+BENCHMARK_F(PerformanceTestMessageInfoBatch, latency_statistics_sequence)(benchmark::State & st)
+{
+  reset_heap_counters();
+  for (auto _ : st) {
+    int64_t min = INT64_MAX;
+    int64_t max = INT64_MIN;
+    int64_t sum = 0;
+    size_t count = 0u;
+    for (size_t i = 0u; i < sequence.size; ++i) {
+      const rmw_message_info_t & message_info = sequence.data[i];
+      if (0 == message_info.source_timestamp || 0 == message_info.received_timestamp) {
+        continue;
+      }
+      const int64_t latency = message_info.received_timestamp - message_info.source_timestamp;
+      min = latency < min ? latency : min;
+      max = latency > max ? latency : max;
+      sum += latency;
+      ++count;
+    }
+    benchmark::DoNotOptimize(min);
+    benchmark::DoNotOptimize(max);
+    benchmark::DoNotOptimize(sum);
+    benchmark::DoNotOptimize(count);
+  }
+  st.SetItemsProcessed(static_cast<int64_t>(st.iterations() * sequence.size));
+}
+
+BENCHMARK_F(PerformanceTestMessageInfoBatch, latency_statistics_batch)(benchmark::State & st)
+{
+  reset_heap_counters();
+  for (auto _ : st) {
+    rmw_message_info_batch_latency_statistics_t statistics;
+    if (RMW_RET_OK != rmw_message_info_batch_get_latency_statistics(&batch, &statistics)) {
+      st.SkipWithError("failed to compute latency statistics");
+      break;
+    }
+    benchmark::DoNotOptimize(statistics);
+  }
+  st.SetItemsProcessed(static_cast<int64_t>(st.iterations() * batch.size));
+}
+
+BENCHMARK_F(PerformanceTestMessageInfoBatch, find_sequence_gaps_batch)(benchmark::State & st)
+{
+  reset_heap_counters();
+  for (auto _ : st) {
+    rmw_message_info_batch_sequence_gaps_t gaps;
+    if (RMW_RET_OK != rmw_message_info_batch_find_sequence_gaps(&batch, &gaps)) {
+      st.SkipWithError("failed to find sequence gaps");
+      break;
+    }
+    benchmark::DoNotOptimize(gaps);
+  }
+  st.SetItemsProcessed(static_cast<int64_t>(st.iterations() * batch.size));
+}
@@ -0,0 +1,129 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rmw/qos_string_conversions.h"
+
+namespace
+{
+// Policy kinds as found in QoS overrides, including a couple of typos.
+const std::vector<std::string> & policy_kind_strings()
+{
+  static const std::vector<std::string> strings = {
+    "durability",
+    "deadline",
+    "liveliness",
+    "reliability",
+    "history",
+    "lifespan",
+    "depth",
+    "liveliness_lease_duration",
+    "avoid_ros_namespace_conventions",
+    "reliabilty",
+    "durabilty",
+  };
+  return strings;
+}
+
+const std::pair<const char *, rmw_qos_policy_kind_t> policy_kinds[] = {
+  {"durability", RMW_QOS_POLICY_DURABILITY},
+  {"deadline", RMW_QOS_POLICY_DEADLINE},
+  {"liveliness", RMW_QOS_POLICY_LIVELINESS},
+  {"reliability", RMW_QOS_POLICY_RELIABILITY},
+  {"history", RMW_QOS_POLICY_HISTORY},
+  {"lifespan", RMW_QOS_POLICY_LIFESPAN},
+  {"depth", RMW_QOS_POLICY_DEPTH},
+  {"liveliness_lease_duration", RMW_QOS_POLICY_LIVELINESS_LEASE_DURATION},
+  {"avoid_ros_namespace_conventions", RMW_QOS_POLICY_AVOID_ROS_NAMESPACE_CONVENTIONS},
+};
+
+const std::pair<const char *, rmw_qos_liveliness_policy_t> liveliness_policies[] = {
+  {"system_default", RMW_QOS_POLICY_LIVELINESS_SYSTEM_DEFAULT},
+  {"automatic", RMW_QOS_POLICY_LIVELINESS_AUTOMATIC},
+  {"manual_by_topic", RMW_QOS_POLICY_LIVELINESS_MANUAL_BY_TOPIC},
+  {"best_available", RMW_QOS_POLICY_LIVELINESS_BEST_AVAILABLE},
+};
+
+// The parsing as it was before it switched on length: a chain of comparisons, kept as a baseline.
+template<typename T, size_t N>
+T legacy_from_str(const std::pair<const char *, T>(&table)[N], T unknown, const char * str)
+{
+  for (const auto & entry : table) {
+    if (0 == strncmp(entry.first, str, strlen(entry.first) + 1)) {
+      return entry.second;
+    }
+  }
+  return unknown;
+}
+}  // namespace
+
+BENCHMARK_F(PerformanceTest, qos_policy_kind_from_str_legacy)(benchmark::State & st)
+{
+  const std::vector<std::string> & strings = policy_kind_strings();
+  reset_heap_counters();
+  for (auto _ : st) {
+    for (const std::string & str : strings) {
+      rmw_qos_policy_kind_t kind =
+        legacy_from_str(policy_kinds, RMW_QOS_POLICY_INVALID, str.c_str());
+      benchmark::DoNotOptimize(kind);
+    }
+  }
+  st.SetItemsProcessed(static_cast<int64_t>(st.iterations() * strings.size()));
+}
+
+BENCHMARK_F(PerformanceTest, qos_policy_kind_from_str)(benchmark::State & st)
+{
+  const std::vector<std::string> & strings = policy_kind_strings();
+  reset_heap_counters();
+  for (auto _ : st) {
+    for (const std::string & str : strings) {
+      rmw_qos_policy_kind_t kind = rmw_qos_policy_kind_from_str(str.c_str());
+      benchmark::DoNotOptimize(kind);
+    }
+  }
+  st.SetItemsProcessed(static_cast<int64_t>(st.iterations() * strings.size()));
+}
+
+BENCHMARK_F(PerformanceTest, qos_liveliness_policy_from_str_legacy)(benchmark::State & st)
+{
+  reset_heap_counters();
+  for (auto _ : st) {
+    for (const auto & entry : liveliness_policies) {
+      rmw_qos_liveliness_policy_t policy =
+        legacy_from_str(liveliness_policies, RMW_QOS_POLICY_LIVELINESS_UNKNOWN, entry.first);
+      benchmark::DoNotOptimize(policy);
+    }
+  }
+  st.SetItemsProcessed(static_cast<int64_t>(
+      st.iterations() * sizeof(liveliness_policies) / sizeof(liveliness_policies[0])));
+}
+
+BENCHMARK_F(PerformanceTest, qos_liveliness_policy_from_str)(benchmark::State & st)
+{
+  reset_heap_counters();
+  for (auto _ : st) {
+    for (const auto & entry : liveliness_policies) {
+      rmw_qos_liveliness_policy_t policy = rmw_qos_liveliness_policy_from_str(entry.first);
+      benchmark::DoNotOptimize(policy);
+    }
+  }
+  st.SetItemsProcessed(static_cast<int64_t>(
+      st.iterations() * sizeof(liveliness_policies) / sizeof(liveliness_policies[0])));
+}
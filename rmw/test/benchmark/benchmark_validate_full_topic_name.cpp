@@ -0,0 +1,136 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cctype>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rcutils/isalnum_no_locale.h"
+
+#include "rmw/validate_full_topic_name.h"
+
+namespace
+{
+// Topic names as found in the graph of a mid sized robot.
+const std::vector<std::string> & topic_names()
+{
+  static const std::vector<std::string> names = {
+    "/rosout",
+    "/parameter_events",
+    "/tf",
+    "/tf_static",
+    "/clock",
+    "/cmd_vel",
+    "/odom",
+    "/joint_states",
+    "/robot_description",
+    "/diagnostics",
+    "/scan",
+    "/map",
+    "/map_updates",
+    "/amcl_pose",
+    "/initialpose",
+    "/goal_pose",
+    "/plan",
+    "/local_plan",
+    "/camera/color/image_raw",
+    "/camera/color/image_raw/compressed",
+    "/camera/color/camera_info",
+    "/camera/depth/image_rect_raw",
+    "/camera/depth/color/points",
+    "/robot_1/front_lidar/scan_filtered",
+    "/robot_1/arm_controller/follow_joint_trajectory/_action/feedback",
+    "/robot_1/arm_controller/follow_joint_trajectory/_action/status",
+    "/global_costmap/global_costmap/transition_event",
+    "/local_costmap/local_costmap/parameter_events",
+    "/navigate_to_pose/_action/feedback",
+    "/behavior_server/transition_event",
+    "/perception/object_detection/tracked_objects_with_covariance",
+    "/rt/robot_1/manipulation/grasp_planner/candidate_grasps_visualization_markers",
+  };
+  return names;
+}
+
+// The validation as it was before it became single pass, kept as a baseline.
+int legacy_validate_full_topic_name(const char * topic_name, size_t topic_name_length)
+{
+  if (topic_name_length == 0) {
+    return RMW_TOPIC_INVALID_IS_EMPTY_STRING;
+  }
+  if (topic_name[0] != '/') {
+    return RMW_TOPIC_INVALID_NOT_ABSOLUTE;
+  }
+  if (topic_name[topic_name_length - 1] == '/') {
+    return RMW_TOPIC_INVALID_ENDS_WITH_FORWARD_SLASH;
+  }
+  for (size_t i = 0; i < topic_name_length; ++i) {
+    if (!rcutils_isalnum_no_locale(topic_name[i]) && topic_name[i] != '_' &&
+      topic_name[i] != '/')
+    {
+      return RMW_TOPIC_INVALID_CONTAINS_UNALLOWED_CHARACTERS;
+    }
+  }
+  for (size_t i = 0; i + 1 < topic_name_length; ++i) {
+    if (topic_name[i] == '/') {
+      if (topic_name[i + 1] == '/') {
+        return RMW_TOPIC_INVALID_CONTAINS_REPEATED_FORWARD_SLASH;
+      }
+      if (isdigit(topic_name[i + 1]) != 0) {
+        return RMW_TOPIC_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER;
+      }
+    }
+  }
+  if (topic_name_length > RMW_TOPIC_MAX_NAME_LENGTH) {
+    return RMW_TOPIC_INVALID_TOO_LONG;
+  }
+  return RMW_TOPIC_VALID;
+}
+}  // namespace
+
+BENCHMARK_F(PerformanceTest, validate_full_topic_name_legacy)(benchmark::State & st)
+{
+  const std::vector<std::string> & names = topic_names();
+  reset_heap_counters();
+  for (auto _ : st) {
+    for (const std::string & name : names) {
+      int result = legacy_validate_full_topic_name(name.c_str(), name.size());
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  st.SetItemsProcessed(static_cast<int64_t>(st.iterations() * names.size()));
+}
+
+BENCHMARK_F(PerformanceTest, validate_full_topic_name)(benchmark::State & st)
+{
+  const std::vector<std::string> & names = topic_names();
+  reset_heap_counters();
+  for (auto _ : st) {
+    for (const std::string & name : names) {
+      int result = -1;
+      size_t invalid_index = 0;
+      if (rmw_validate_full_topic_name_with_size(
+          name.c_str(), name.size(), &result, &invalid_index) != RMW_RET_OK ||
+        result != RMW_TOPIC_VALID)
+      {
+        st.SkipWithError("topic name unexpectedly failed to validate");
+        break;
+      }
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  st.SetItemsProcessed(static_cast<int64_t>(st.iterations() * names.size()));
+}
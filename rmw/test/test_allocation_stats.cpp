@@ -0,0 +1,213 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "rcutils/allocator.h"
+
+#include "rmw/allocation_stats.h"
+#include "rmw/allocators.h"
+#include "rmw/error_handling.h"
+#include "rmw/message_sequence.h"
+#include "rmw/names_and_types.h"
+#include "rmw/subscription_content_filter_options.h"
+#include "rmw/topic_endpoint_info.h"
+
+#include "./time_bomb_allocator_testing_utils.h"
+
+namespace
+{
+rmw_allocation_stats_t get_stats(rmw_allocation_domain_t domain)
+{
+  rmw_allocation_stats_t stats;
+  EXPECT_EQ(RMW_RET_OK, rmw_get_allocation_stats(domain, &stats));
+  return stats;
+}
+
+struct trapped_allocation
+{
+  rmw_allocation_domain_t domain;
+  size_t size;
+};
+
+void record_trapped_allocation(rmw_allocation_domain_t domain, size_t size, void * data)
+{
+  static_cast<std::vector<trapped_allocation> *>(data)->push_back({domain, size});
+}
+}  // namespace
+
+TEST(test_allocation_stats, bad_arguments) {
+  rmw_allocation_stats_t stats;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_get_allocation_stats(RMW_ALLOCATION_DOMAIN_COUNT, &stats));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_get_allocation_stats(RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE, nullptr));
+  rmw_reset_error();
+
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rmw_counting_allocator_t counting_allocator;
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_counting_allocator_init(nullptr, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_counting_allocator_init(&counting_allocator, nullptr));
+  rmw_reset_error();
+  rcutils_allocator_t invalid_allocator = rcutils_get_zero_initialized_allocator();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_counting_allocator_init(&counting_allocator, &invalid_allocator));
+  rmw_reset_error();
+}
+
+TEST(test_allocation_stats, default_allocator) {
+  rmw_reset_allocation_stats();
+  void * pointer = rmw_allocate(24u);
+  ASSERT_NE(nullptr, pointer);
+  rmw_free(pointer);
+  rmw_free(nullptr);
+
+  rmw_allocation_stats_t stats = get_stats(RMW_ALLOCATION_DOMAIN_DEFAULT_ALLOCATOR);
+  EXPECT_EQ(1u, stats.allocations);
+  EXPECT_EQ(1u, stats.deallocations);
+  EXPECT_EQ(24u, stats.bytes);
+
+  rmw_reset_allocation_stats();
+  stats = get_stats(RMW_ALLOCATION_DOMAIN_DEFAULT_ALLOCATOR);
+  EXPECT_EQ(0u, stats.allocations);
+  EXPECT_EQ(0u, stats.deallocations);
+  EXPECT_EQ(0u, stats.bytes);
+}
+
+TEST(test_allocation_stats, utilities) {
+  rmw_reset_allocation_stats();
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+
+  rmw_message_sequence_t sequence = rmw_get_zero_initialized_message_sequence();
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_init(&sequence, 4u, &allocator));
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_fini(&sequence));
+  rmw_allocation_stats_t stats = get_stats(RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE);
+  EXPECT_EQ(1u, stats.allocations);
+  EXPECT_EQ(1u, stats.deallocations);
+  EXPECT_EQ(4u * sizeof(void *), stats.bytes);
+
+  // Failed allocations are not accounted
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, rmw_message_sequence_init(&sequence, 4u, &failing_allocator));
+  rmw_reset_error();
+  EXPECT_EQ(1u, get_stats(RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE).allocations);
+
+  rmw_names_and_types_t names_and_types = rmw_get_zero_initialized_names_and_types();
+  ASSERT_EQ(RMW_RET_OK, rmw_names_and_types_init(&names_and_types, 2u, &allocator));
+  ASSERT_EQ(RMW_RET_OK, rmw_names_and_types_fini(&names_and_types));
+  stats = get_stats(RMW_ALLOCATION_DOMAIN_NAMES_AND_TYPES);
+  EXPECT_EQ(2u, stats.allocations);
+  EXPECT_EQ(2u, stats.deallocations);
+
+  rmw_topic_endpoint_info_t topic_endpoint_info = rmw_get_zero_initialized_topic_endpoint_info();
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_topic_endpoint_info_set_node_name(&topic_endpoint_info, "node", &allocator));
+  ASSERT_EQ(RMW_RET_OK, rmw_topic_endpoint_info_fini(&topic_endpoint_info, &allocator));
+  stats = get_stats(RMW_ALLOCATION_DOMAIN_TOPIC_ENDPOINT_INFO);
+  EXPECT_EQ(1u, stats.allocations);
+  EXPECT_EQ(1u, stats.deallocations);
+  EXPECT_EQ(sizeof("node"), stats.bytes);
+
+  rmw_subscription_content_filter_options_t options =
+    rmw_get_zero_initialized_content_filter_options();
+  const char * parameters[] = {"1", "2"};
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_subscription_content_filter_options_init("a < %0", 2u, parameters, &allocator, &options));
+  ASSERT_EQ(RMW_RET_OK, rmw_subscription_content_filter_options_fini(&options, &allocator));
+  stats = get_stats(RMW_ALLOCATION_DOMAIN_CONTENT_FILTER_OPTIONS);
+  EXPECT_EQ(4u, stats.allocations);
+  EXPECT_EQ(4u, stats.deallocations);
+}
+
+TEST(test_allocation_stats, counting_allocator) {
+  rmw_reset_allocation_stats();
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rmw_counting_allocator_t counting_allocator;
+  ASSERT_EQ(RMW_RET_OK, rmw_counting_allocator_init(&counting_allocator, &allocator));
+  rcutils_allocator_t * wrapper = &counting_allocator.allocator;
+  ASSERT_TRUE(rcutils_allocator_is_valid(wrapper));
+
+  void * pointer = wrapper->allocate(8u, wrapper->state);
+  ASSERT_NE(nullptr, pointer);
+  pointer = wrapper->reallocate(pointer, 16u, wrapper->state);
+  ASSERT_NE(nullptr, pointer);
+  wrapper->deallocate(pointer, wrapper->state);
+  pointer = wrapper->zero_allocate(4u, 8u, wrapper->state);
+  ASSERT_NE(nullptr, pointer);
+  wrapper->deallocate(pointer, wrapper->state);
+
+  rmw_allocation_stats_t stats = get_stats(RMW_ALLOCATION_DOMAIN_COUNTING_ALLOCATOR);
+  EXPECT_EQ(3u, stats.allocations);
+  EXPECT_EQ(3u, stats.deallocations);
+  EXPECT_EQ(8u + 16u + 32u, stats.bytes);
+
+  // Allocations through it are accounted in the utilities' domain as well
+  rmw_message_info_sequence_t sequence = rmw_get_zero_initialized_message_info_sequence();
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_sequence_init(&sequence, 2u, wrapper));
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_sequence_fini(&sequence));
+  EXPECT_EQ(4u, get_stats(RMW_ALLOCATION_DOMAIN_COUNTING_ALLOCATOR).allocations);
+  EXPECT_EQ(1u, get_stats(RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE).allocations);
+}
+
+TEST(test_allocation_stats, allocation_trap) {
+  EXPECT_FALSE(rmw_allocation_trap_is_armed());
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rmw_counting_allocator_t counting_allocator;
+  ASSERT_EQ(RMW_RET_OK, rmw_counting_allocator_init(&counting_allocator, &allocator));
+  rcutils_allocator_t * wrapper = &counting_allocator.allocator;
+  // Memory allocated before arming the trap can be freed once armed
+  void * pointer = wrapper->allocate(8u, wrapper->state);
+  ASSERT_NE(nullptr, pointer);
+
+  std::vector<trapped_allocation> trapped_allocations;
+  rmw_allocation_trap_arm(record_trapped_allocation, &trapped_allocations);
+  EXPECT_TRUE(rmw_allocation_trap_is_armed());
+  wrapper->deallocate(pointer, wrapper->state);
+  EXPECT_TRUE(trapped_allocations.empty());
+
+  rmw_message_sequence_t sequence = rmw_get_zero_initialized_message_sequence();
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_init(&sequence, 1u, wrapper));
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_fini(&sequence));
+  ASSERT_EQ(2u, trapped_allocations.size());
+  EXPECT_EQ(RMW_ALLOCATION_DOMAIN_COUNTING_ALLOCATOR, trapped_allocations[0].domain);
+  EXPECT_EQ(sizeof(void *), trapped_allocations[0].size);
+  EXPECT_EQ(RMW_ALLOCATION_DOMAIN_MESSAGE_SEQUENCE, trapped_allocations[1].domain);
+  EXPECT_EQ(sizeof(void *), trapped_allocations[1].size);
+
+  rmw_allocation_trap_disarm();
+  EXPECT_FALSE(rmw_allocation_trap_is_armed());
+  pointer = rmw_allocate(8u);
+  ASSERT_NE(nullptr, pointer);
+  rmw_free(pointer);
+  EXPECT_EQ(2u, trapped_allocations.size());
+  rmw_allocation_trap_disarm();
+}
+
+TEST(test_allocation_stats, default_allocation_trap_aborts) {
+  EXPECT_DEATH(
+  {
+    rmw_allocation_trap_arm(nullptr, nullptr);
+    rmw_free(rmw_allocate(8u));
+  }, "allocation of 8 bytes in default allocator");
+}
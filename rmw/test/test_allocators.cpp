@@ -12,8 +12,19 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 #include "gmock/gmock.h"
+
+#include "rcutils/allocator.h"
+
 #include "rmw/allocators.h"
+#include "rmw/error_handling.h"
+#include "rmw/impl/config.h"
+
+#include "./time_bomb_allocator_testing_utils.h"
 
 TEST(test_rmw_allocators, rmw_allocate_free) {
   void * ptr = rmw_allocate(100u);
@@ -62,3 +73,297 @@ TEST(test_rmw_allocators, rmw_wait_set_allocate_free) {
   EXPECT_NE(wait_set, nullptr);
   rmw_wait_set_free(wait_set);
 }
+
+TEST(test_rmw_allocators, rmw_handle_statistics) {
+  rmw_handle_statistics_t statistics;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_get_handle_statistics(RMW_HANDLE_TYPE_COUNT, &statistics));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_get_handle_statistics(RMW_HANDLE_TYPE_NODE, nullptr));
+  rmw_reset_error();
+
+  ASSERT_EQ(RMW_RET_OK, rmw_get_handle_statistics(RMW_HANDLE_TYPE_NODE, &statistics));
+  const size_t initial_peak = statistics.peak;
+  EXPECT_EQ(0u, statistics.live);
+  // Static pools are only threaded on first use
+  EXPECT_LE(
+    statistics.capacity, RMW_AVOID_MEMORY_ALLOCATION ? size_t{RMW_STATIC_MAX_NODES} : 0u);
+
+  rmw_node_t * first = rmw_node_allocate();
+  ASSERT_NE(nullptr, first);
+  rmw_node_t * second = rmw_node_allocate();
+  ASSERT_NE(nullptr, second);
+  ASSERT_EQ(RMW_RET_OK, rmw_get_handle_statistics(RMW_HANDLE_TYPE_NODE, &statistics));
+  EXPECT_EQ(2u, statistics.live);
+  EXPECT_EQ(std::max<size_t>(2u, initial_peak), statistics.peak);
+
+  rmw_node_free(first);
+  rmw_node_free(second);
+  rmw_node_free(nullptr);
+  ASSERT_EQ(RMW_RET_OK, rmw_get_handle_statistics(RMW_HANDLE_TYPE_NODE, &statistics));
+  EXPECT_EQ(0u, statistics.live);
+}
+
+TEST(test_rmw_allocators, rmw_handle_pools_bad_arguments) {
+  if (RMW_AVOID_MEMORY_ALLOCATION) {
+    GTEST_SKIP() << "handle pools are static when avoiding memory allocation";
+  }
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_handle_pools_init(0u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_handle_pools_init(4u, nullptr));
+  rmw_reset_error();
+  rcutils_allocator_t invalid_allocator = rcutils_get_zero_initialized_allocator();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_handle_pools_init(4u, &invalid_allocator));
+  rmw_reset_error();
+  EXPECT_FALSE(rmw_handle_pools_are_enabled());
+
+  // Pools cannot be enabled while handles are live
+  rmw_publisher_t * publisher = rmw_publisher_allocate();
+  ASSERT_NE(nullptr, publisher);
+  EXPECT_EQ(RMW_RET_ERROR, rmw_handle_pools_init(4u, &allocator));
+  rmw_reset_error();
+  EXPECT_FALSE(rmw_handle_pools_are_enabled());
+  rmw_publisher_free(publisher);
+
+  // Disabling pools which are not enabled is a no-op
+  EXPECT_EQ(RMW_RET_OK, rmw_handle_pools_fini());
+}
+
+TEST(test_rmw_allocators, rmw_handle_pools_allocate_free) {
+  if (RMW_AVOID_MEMORY_ALLOCATION) {
+    GTEST_SKIP() << "handle pools are static when avoiding memory allocation";
+  }
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  ASSERT_EQ(RMW_RET_OK, rmw_handle_pools_init(2u, &allocator));
+  EXPECT_TRUE(rmw_handle_pools_are_enabled());
+  EXPECT_EQ(RMW_RET_ERROR, rmw_handle_pools_init(2u, &allocator));
+  rmw_reset_error();
+
+  rmw_handle_statistics_t statistics;
+  ASSERT_EQ(RMW_RET_OK, rmw_get_handle_statistics(RMW_HANDLE_TYPE_SUBSCRIPTION, &statistics));
+  EXPECT_EQ(0u, statistics.live);
+  EXPECT_EQ(0u, statistics.peak);
+  EXPECT_EQ(0u, statistics.capacity);
+  EXPECT_EQ(0u, statistics.slab_count);
+
+  rmw_subscription_t * subscriptions[3];
+  for (rmw_subscription_t *& subscription : subscriptions) {
+    subscription = rmw_subscription_allocate();
+    ASSERT_NE(nullptr, subscription);
+    EXPECT_EQ(nullptr, subscription->implementation_identifier);
+    EXPECT_EQ(nullptr, subscription->data);
+    subscription->topic_name = "/dirty";
+  }
+  ASSERT_EQ(RMW_RET_OK, rmw_get_handle_statistics(RMW_HANDLE_TYPE_SUBSCRIPTION, &statistics));
+  EXPECT_EQ(3u, statistics.live);
+  EXPECT_EQ(3u, statistics.peak);
+  EXPECT_EQ(4u, statistics.capacity);
+  EXPECT_EQ(2u, statistics.slab_count);
+
+  // Pools cannot be disabled while handles are live
+  EXPECT_EQ(RMW_RET_ERROR, rmw_handle_pools_fini());
+  rmw_reset_error();
+
+  // Released handles are recycled, zero initialized
+  rmw_subscription_free(subscriptions[2]);
+  rmw_subscription_t * recycled = rmw_subscription_allocate();
+  EXPECT_EQ(subscriptions[2], recycled);
+  EXPECT_EQ(nullptr, recycled->topic_name);
+  subscriptions[2] = recycled;
+
+  for (rmw_subscription_t * subscription : subscriptions) {
+    rmw_subscription_free(subscription);
+  }
+  ASSERT_EQ(RMW_RET_OK, rmw_get_handle_statistics(RMW_HANDLE_TYPE_SUBSCRIPTION, &statistics));
+  EXPECT_EQ(0u, statistics.live);
+  EXPECT_EQ(3u, statistics.peak);
+  EXPECT_EQ(4u, statistics.capacity);
+
+  // Every handle type is pooled
+  rmw_node_t * node = rmw_node_allocate();
+  EXPECT_NE(nullptr, node);
+  rmw_node_free(node);
+  rmw_publisher_t * publisher = rmw_publisher_allocate();
+  EXPECT_NE(nullptr, publisher);
+  rmw_publisher_free(publisher);
+  rmw_guard_condition_t * guard_condition = rmw_guard_condition_allocate();
+  EXPECT_NE(nullptr, guard_condition);
+  rmw_guard_condition_free(guard_condition);
+  rmw_client_t * client = rmw_client_allocate();
+  EXPECT_NE(nullptr, client);
+  rmw_client_free(client);
+  rmw_service_t * service = rmw_service_allocate();
+  EXPECT_NE(nullptr, service);
+  rmw_service_free(service);
+  rmw_wait_set_t * wait_set = rmw_wait_set_allocate();
+  EXPECT_NE(nullptr, wait_set);
+  rmw_wait_set_free(wait_set);
+  for (int type = RMW_HANDLE_TYPE_NODE; type < RMW_HANDLE_TYPE_COUNT; ++type) {
+    ASSERT_EQ(
+      RMW_RET_OK, rmw_get_handle_statistics(static_cast<rmw_handle_type_t>(type), &statistics));
+    EXPECT_EQ(0u, statistics.live);
+    EXPECT_NE(0u, statistics.capacity);
+  }
+
+  EXPECT_EQ(RMW_RET_OK, rmw_handle_pools_fini());
+  EXPECT_FALSE(rmw_handle_pools_are_enabled());
+}
+
+TEST(test_rmw_allocators, rmw_handle_pools_bad_allocation) {
+  if (RMW_AVOID_MEMORY_ALLOCATION) {
+    GTEST_SKIP() << "handle pools are static when avoiding memory allocation";
+  }
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  ASSERT_EQ(RMW_RET_OK, rmw_handle_pools_init(8u, &failing_allocator));
+  EXPECT_EQ(nullptr, rmw_wait_set_allocate());
+
+  // The next slab can be reserved
+  rmw_wait_set_t * wait_set = rmw_wait_set_allocate();
+  EXPECT_NE(nullptr, wait_set);
+  rmw_wait_set_free(wait_set);
+  EXPECT_EQ(RMW_RET_OK, rmw_handle_pools_fini());
+}
+
+TEST(test_rmw_allocators, rmw_handle_pools_static) {
+  if (!RMW_AVOID_MEMORY_ALLOCATION) {
+    GTEST_SKIP() << "handle pools are only static when avoiding memory allocation";
+  }
+  EXPECT_TRUE(rmw_handle_pools_are_enabled());
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  EXPECT_EQ(RMW_RET_UNSUPPORTED, rmw_handle_pools_init(4u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_UNSUPPORTED, rmw_handle_pools_fini());
+  rmw_reset_error();
+  EXPECT_TRUE(rmw_handle_pools_are_enabled());
+
+  // Static pools are never extended
+  std::vector<rmw_wait_set_t *> wait_sets;
+  rmw_wait_set_t * wait_set = nullptr;
+  while ((wait_set = rmw_wait_set_allocate()) != nullptr) {
+    wait_sets.push_back(wait_set);
+  }
+  EXPECT_EQ(static_cast<size_t>(RMW_STATIC_MAX_WAIT_SETS), wait_sets.size());
+  rmw_handle_statistics_t statistics;
+  ASSERT_EQ(RMW_RET_OK, rmw_get_handle_statistics(RMW_HANDLE_TYPE_WAIT_SET, &statistics));
+  EXPECT_EQ(static_cast<size_t>(RMW_STATIC_MAX_WAIT_SETS), statistics.live);
+  EXPECT_EQ(static_cast<size_t>(RMW_STATIC_MAX_WAIT_SETS), statistics.capacity);
+  for (rmw_wait_set_t * w : wait_sets) {
+    rmw_wait_set_free(w);
+  }
+  wait_set = rmw_wait_set_allocate();
+  EXPECT_NE(nullptr, wait_set);
+  rmw_wait_set_free(wait_set);
+}
+
+TEST(test_rmw_allocators, rmw_static_allocator) {
+  rcutils_allocator_t allocator = rmw_get_static_allocator();
+  ASSERT_TRUE(rcutils_allocator_is_valid(&allocator));
+  if (!RMW_AVOID_MEMORY_ALLOCATION) {
+    // No static storage is reserved then
+    EXPECT_EQ(nullptr, allocator.allocate(1u, allocator.state));
+    EXPECT_EQ(nullptr, allocator.reallocate(nullptr, 1u, allocator.state));
+    return;
+  }
+
+  EXPECT_EQ(nullptr, allocator.allocate(RMW_STATIC_LARGE_BLOCK_SIZE + 1u, allocator.state));
+  EXPECT_EQ(
+    nullptr, allocator.zero_allocate(SIZE_MAX, RMW_STATIC_SMALL_BLOCK_SIZE, allocator.state));
+
+  char * small = static_cast<char *>(allocator.allocate(16u, allocator.state));
+  ASSERT_NE(nullptr, small);
+  strcpy(small, "/some/topic");  // NOLINT(runtime/printf)
+  // Growing within the block keeps it in place, beyond moves it to a larger block
+  EXPECT_EQ(small, allocator.reallocate(small, RMW_STATIC_SMALL_BLOCK_SIZE, allocator.state));
+  char * large = static_cast<char *>(
+    allocator.reallocate(small, RMW_STATIC_SMALL_BLOCK_SIZE + 1u, allocator.state));
+  ASSERT_NE(nullptr, large);
+  EXPECT_STREQ("/some/topic", large);
+
+  int not_from_the_static_allocator = 0;
+  EXPECT_EQ(
+    nullptr, allocator.reallocate(&not_from_the_static_allocator, 1u, allocator.state));
+  allocator.deallocate(&not_from_the_static_allocator, allocator.state);
+
+  // Exhaust large blocks, static storage is never extended
+  std::vector<void *> blocks{large};
+  void * block = nullptr;
+  while ((block = allocator.allocate(RMW_STATIC_LARGE_BLOCK_SIZE, allocator.state)) != nullptr) {
+    blocks.push_back(block);
+  }
+  EXPECT_EQ(static_cast<size_t>(RMW_STATIC_LARGE_BLOCK_COUNT), blocks.size());
+  allocator.deallocate(blocks.back(), allocator.state);
+  blocks.pop_back();
+  block = allocator.zero_allocate(2u, RMW_STATIC_LARGE_BLOCK_SIZE / 2u, allocator.state);
+  ASSERT_NE(nullptr, block);
+  EXPECT_TRUE(
+    std::all_of(
+      static_cast<char *>(block), static_cast<char *>(block) + RMW_STATIC_LARGE_BLOCK_SIZE,
+      [](char c) {return c == 0;}));
+  blocks.push_back(block);
+  for (void * b : blocks) {
+    allocator.deallocate(b, allocator.state);
+  }
+}
+
+namespace
+{
+size_t g_counted_allocations = 0u;
+size_t g_counted_deallocations = 0u;
+
+void * counting_allocate(size_t size, void * state)
+{
+  (void)state;
+  ++g_counted_allocations;
+  return rcutils_get_default_allocator().allocate(size, rcutils_get_default_allocator().state);
+}
+
+void counting_deallocate(void * pointer, void * state)
+{
+  (void)state;
+  ++g_counted_deallocations;
+  rcutils_get_default_allocator().deallocate(pointer, rcutils_get_default_allocator().state);
+}
+}  // namespace
+
+// Keep this test last, the default allocator can only be set once per process.
+TEST(test_rmw_allocators, rmw_set_default_allocator) {
+  rcutils_allocator_t invalid_allocator = rcutils_get_zero_initialized_allocator();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_set_default_allocator(nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_set_default_allocator(&invalid_allocator));
+  rmw_reset_error();
+
+  rcutils_allocator_t default_allocator = rmw_get_default_allocator();
+  if (RMW_AVOID_MEMORY_ALLOCATION) {
+    EXPECT_EQ(rmw_get_static_allocator().allocate, default_allocator.allocate);
+  } else {
+    EXPECT_EQ(rcutils_get_default_allocator().allocate, default_allocator.allocate);
+  }
+
+  rcutils_allocator_t counting_allocator = rcutils_get_default_allocator();
+  counting_allocator.allocate = counting_allocate;
+  counting_allocator.deallocate = counting_deallocate;
+  ASSERT_EQ(RMW_RET_OK, rmw_set_default_allocator(&counting_allocator));
+  EXPECT_EQ(RMW_RET_ERROR, rmw_set_default_allocator(&default_allocator));
+  rmw_reset_error();
+  EXPECT_EQ(counting_allocate, rmw_get_default_allocator().allocate);
+
+  void * ptr = rmw_allocate(16u);
+  ASSERT_NE(nullptr, ptr);
+  EXPECT_EQ(1u, g_counted_allocations);
+  rmw_free(ptr);
+  EXPECT_EQ(1u, g_counted_deallocations);
+
+  // Handle structs are allocated through it too, unless they come from static pools
+  const size_t handle_allocations = RMW_AVOID_MEMORY_ALLOCATION ? 0u : 1u;
+  rmw_client_t * client = rmw_client_allocate();
+  ASSERT_NE(nullptr, client);
+  EXPECT_EQ(1u + handle_allocations, g_counted_allocations);
+  rmw_client_free(client);
+  EXPECT_EQ(1u + handle_allocations, g_counted_deallocations);
+}
@@ -0,0 +1,177 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "gmock/gmock.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/mapped_serialized_message.h"
+
+#ifdef _WIN32
+
+TEST(test_mapped_serialized_message, unsupported) {
+  rmw_mapped_serialized_message_t message = rmw_get_zero_initialized_mapped_serialized_message();
+  EXPECT_EQ(RMW_RET_UNSUPPORTED, rmw_mapped_serialized_message_map_file(&message, "file"));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_UNSUPPORTED, rmw_mapped_serialized_message_create(&message, 1u));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_fini(&message));
+}
+
+#else
+
+TEST(test_mapped_serialized_message, bad_arguments) {
+  rmw_mapped_serialized_message_t message = rmw_get_zero_initialized_mapped_serialized_message();
+  EXPECT_EQ(-1, message.file_descriptor);
+  EXPECT_EQ(nullptr, message.mapping);
+
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_mapped_serialized_message_map_file(nullptr, "file"));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_mapped_serialized_message_map_file(&message, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_ERROR,
+    rmw_mapped_serialized_message_map_file(&message, "/this/file/does/not/exist"));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_mapped_serialized_message_map_file_descriptor(nullptr, 0, 0u, 1u, false));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_mapped_serialized_message_map_file_descriptor(&message, -1, 0u, 1u, false));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_mapped_serialized_message_map_file_descriptor(&message, 0, 0u, 0u, false));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_mapped_serialized_message_create(nullptr, 1u));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_mapped_serialized_message_create(&message, 0u));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_mapped_serialized_message_fini(nullptr));
+  rmw_reset_error();
+
+  // Finalizing a zero initialized message is a no-op.
+  EXPECT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_fini(&message));
+}
+
+TEST(test_mapped_serialized_message, map_file) {
+  char file_path[] = "/tmp/test_mapped_serialized_message_XXXXXX";
+  const int file_descriptor = mkstemp(file_path);
+  ASSERT_NE(-1, file_descriptor);
+  const std::string contents = "a serialized message, as recorded";
+  ASSERT_EQ(
+    static_cast<ssize_t>(contents.size()),
+    write(file_descriptor, contents.data(), contents.size()));
+  ASSERT_EQ(0, close(file_descriptor));
+
+  rmw_mapped_serialized_message_t message = rmw_get_zero_initialized_mapped_serialized_message();
+  rmw_ret_t ret = rmw_mapped_serialized_message_map_file(&message, file_path);
+  EXPECT_EQ(0, std::remove(file_path));
+  ASSERT_EQ(RMW_RET_OK, ret) << rmw_get_error_string().str;
+  EXPECT_EQ(-1, message.file_descriptor);
+  EXPECT_FALSE(message.is_writable);
+  ASSERT_EQ(contents.size(), message.serialized_message.buffer_length);
+  EXPECT_EQ(contents.size(), message.serialized_message.buffer_capacity);
+  EXPECT_EQ(0, memcmp(contents.data(), message.serialized_message.buffer, contents.size()));
+
+  // Read only mappings cannot be resized.
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, rmw_serialized_message_resize(&message.serialized_message, 1u));
+  rmw_reset_error();
+
+  EXPECT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_fini(&message)) <<
+    rmw_get_error_string().str;
+  EXPECT_EQ(nullptr, message.mapping);
+  EXPECT_EQ(nullptr, message.serialized_message.buffer);
+}
+
+TEST(test_mapped_serialized_message, map_empty_file) {
+  char file_path[] = "/tmp/test_mapped_serialized_message_XXXXXX";
+  const int file_descriptor = mkstemp(file_path);
+  ASSERT_NE(-1, file_descriptor);
+  ASSERT_EQ(0, close(file_descriptor));
+
+  rmw_mapped_serialized_message_t message = rmw_get_zero_initialized_mapped_serialized_message();
+  rmw_ret_t ret = rmw_mapped_serialized_message_map_file(&message, file_path);
+  EXPECT_EQ(0, std::remove(file_path));
+  ASSERT_EQ(RMW_RET_OK, ret) << rmw_get_error_string().str;
+  EXPECT_EQ(nullptr, message.mapping);
+  EXPECT_EQ(0u, message.serialized_message.buffer_length);
+  EXPECT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_fini(&message));
+}
+
+TEST(test_mapped_serialized_message, create_and_map_file_descriptor) {
+  rmw_mapped_serialized_message_t message = rmw_get_zero_initialized_mapped_serialized_message();
+  const size_t capacity = 3u * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  rmw_ret_t ret = rmw_mapped_serialized_message_create(&message, capacity);
+  if (RMW_RET_UNSUPPORTED == ret) {
+    rmw_reset_error();
+    GTEST_SKIP() << "anonymous memory files are not supported on this platform";
+  }
+  ASSERT_EQ(RMW_RET_OK, ret) << rmw_get_error_string().str;
+  EXPECT_NE(-1, message.file_descriptor);
+  EXPECT_TRUE(message.is_writable);
+  EXPECT_EQ(0u, message.serialized_message.buffer_length);
+  EXPECT_EQ(capacity, message.serialized_message.buffer_capacity);
+
+  // Resizing, e.g. when taking a serialized message, works within the mapping only.
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_resize(&message.serialized_message, 16u));
+  uint8_t * buffer = message.serialized_message.buffer;
+  EXPECT_EQ(
+    RMW_RET_OK, rmw_serialized_message_resize(&message.serialized_message, capacity));
+  EXPECT_EQ(buffer, message.serialized_message.buffer);
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC,
+    rmw_serialized_message_resize(&message.serialized_message, capacity + 1u));
+  rmw_reset_error();
+  EXPECT_EQ(capacity, message.serialized_message.buffer_capacity);
+
+  const size_t offset = capacity / 3u + 10u;
+  for (size_t i = 0u; i < 100u; ++i) {
+    message.serialized_message.buffer[offset + i] = static_cast<uint8_t>(i);
+  }
+  message.serialized_message.buffer_length = offset + 100u;
+
+  // Another mapping of the same memory, at an unaligned offset, sees what was written.
+  rmw_mapped_serialized_message_t view = rmw_get_zero_initialized_mapped_serialized_message();
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_mapped_serialized_message_map_file_descriptor(
+      &view, message.file_descriptor, offset, 100u, false)) << rmw_get_error_string().str;
+  EXPECT_EQ(-1, view.file_descriptor);
+  ASSERT_EQ(100u, view.serialized_message.buffer_length);
+  for (size_t i = 0u; i < 100u; ++i) {
+    EXPECT_EQ(static_cast<uint8_t>(i), view.serialized_message.buffer[i]);
+  }
+  EXPECT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_fini(&view)) <<
+    rmw_get_error_string().str;
+
+  // Finalizing the serialized message alone leaves the mapping alone.
+  rmw_serialized_message_t serialized_message = message.serialized_message;
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_fini(&serialized_message));
+  EXPECT_EQ(0u, message.serialized_message.buffer[offset]);
+  EXPECT_EQ(RMW_RET_OK, rmw_mapped_serialized_message_fini(&message)) <<
+    rmw_get_error_string().str;
+  EXPECT_EQ(-1, message.file_descriptor);
+}
+
+#endif
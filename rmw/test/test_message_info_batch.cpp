@@ -0,0 +1,277 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <cstring>
+
+#include "gmock/gmock.h"
+
+#include "rcutils/allocator.h"
+
+#include "./time_bomb_allocator_testing_utils.h"
+#include "rmw/error_handling.h"
+#include "rmw/impl/config.h"
+#include "rmw/message_info_batch.h"
+#include "rmw/message_sequence.h"
+
+namespace
+{
+
+rmw_message_info_t
+make_message_info(
+  rmw_time_point_value_t source_timestamp,
+  rmw_time_point_value_t received_timestamp,
+  uint64_t publication_sequence_number,
+  uint64_t reception_sequence_number,
+  uint8_t publisher)
+{
+  rmw_message_info_t message_info = rmw_get_zero_initialized_message_info();
+  message_info.source_timestamp = source_timestamp;
+  message_info.received_timestamp = received_timestamp;
+  message_info.publication_sequence_number = publication_sequence_number;
+  message_info.reception_sequence_number = reception_sequence_number;
+  message_info.publisher_gid.implementation_identifier = "test";
+  message_info.publisher_gid.data[0] = publisher;
+  message_info.from_intra_process = publisher % 2u == 0u;
+  return message_info;
+}
+
+}  // namespace
+
+class TestMessageInfoBatch : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    allocator = rcutils_get_default_allocator();
+    batch = rmw_get_zero_initialized_message_info_batch();
+    sequence = rmw_get_zero_initialized_message_info_sequence();
+    ASSERT_EQ(RMW_RET_OK, rmw_message_info_batch_init(&batch, 8u, &allocator));
+    ASSERT_EQ(RMW_RET_OK, rmw_message_info_sequence_init(&sequence, 8u, &allocator));
+  }
+
+  void TearDown() override
+  {
+    EXPECT_EQ(RMW_RET_OK, rmw_message_info_batch_fini(&batch));
+    EXPECT_EQ(RMW_RET_OK, rmw_message_info_sequence_fini(&sequence));
+  }
+
+  // Fill the batch with the given message infos, through the sequence.
+  template<size_t N>
+  void fill(const rmw_message_info_t (& message_infos)[N])
+  {
+    static_assert(N <= 8u, "too many message infos");
+    for (size_t i = 0u; i < N; ++i) {
+      sequence.data[i] = message_infos[i];
+    }
+    sequence.size = N;
+    ASSERT_EQ(RMW_RET_OK, rmw_message_info_batch_from_sequence(&batch, &sequence));
+  }
+
+  rcutils_allocator_t allocator;
+  rmw_message_info_batch_t batch;
+  rmw_message_info_sequence_t sequence;
+};
+
+TEST(test_message_info_batch, init_fini) {
+  auto batch = rmw_get_zero_initialized_message_info_batch();
+  auto allocator = rcutils_get_default_allocator();
+
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_info_batch_init(nullptr, 5u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_info_batch_init(&batch, 5u, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_info_batch_fini(nullptr));
+  rmw_reset_error();
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_info_batch_init(&batch, 0u, &allocator));
+  EXPECT_EQ(0u, batch.size);
+  EXPECT_EQ(0u, batch.capacity);
+  EXPECT_EQ(nullptr, batch.source_timestamps);
+  EXPECT_EQ(RMW_RET_OK, rmw_message_info_batch_fini(&batch));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_info_batch_init(&batch, 5u, &allocator));
+  EXPECT_EQ(0u, batch.size);
+  EXPECT_EQ(5u, batch.capacity);
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(batch.received_timestamps) % alignof(int64_t));
+  EXPECT_EQ(
+    0u, reinterpret_cast<uintptr_t>(batch.publication_sequence_numbers) % alignof(uint64_t));
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(batch.reception_sequence_numbers) % alignof(uint64_t));
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(batch.publisher_gids) % alignof(rmw_gid_t));
+  EXPECT_EQ(RMW_RET_OK, rmw_message_info_batch_fini(&batch));
+  EXPECT_EQ(0u, batch.capacity);
+  EXPECT_EQ(nullptr, batch.source_timestamps);
+
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, rmw_message_info_batch_init(&batch, 5u, &failing_allocator));
+  rmw_reset_error();
+}
+
+TEST_F(TestMessageInfoBatch, sequence_round_trip) {
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_info_batch_from_sequence(nullptr, &sequence));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_info_batch_from_sequence(&batch, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_info_batch_to_sequence(nullptr, &sequence));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_info_batch_to_sequence(&batch, nullptr));
+  rmw_reset_error();
+
+  const rmw_message_info_t message_infos[] = {
+    make_message_info(10, 15, 1u, 1u, 1u),
+    make_message_info(20, 27, 2u, 2u, 2u),
+    make_message_info(30, 31, 3u, 3u, 1u),
+  };
+  fill(message_infos);
+  EXPECT_EQ(3u, batch.size);
+  EXPECT_EQ(20, batch.source_timestamps[1]);
+  EXPECT_EQ(27, batch.received_timestamps[1]);
+  EXPECT_EQ(3u, batch.publication_sequence_numbers[2]);
+  EXPECT_EQ(2u, batch.publisher_gids[1].data[0]);
+  EXPECT_TRUE(batch.from_intra_process[1]);
+
+  auto other_sequence = rmw_get_zero_initialized_message_info_sequence();
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_sequence_init(&other_sequence, 2u, &allocator));
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_info_batch_to_sequence(&batch, &other_sequence));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_OK, rmw_message_info_sequence_fini(&other_sequence));
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_sequence_init(&other_sequence, 3u, &allocator));
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_batch_to_sequence(&batch, &other_sequence));
+  ASSERT_EQ(3u, other_sequence.size);
+  for (size_t i = 0u; i < 3u; ++i) {
+    const rmw_message_info_t & expected = message_infos[i];
+    const rmw_message_info_t & actual = other_sequence.data[i];
+    EXPECT_EQ(expected.source_timestamp, actual.source_timestamp);
+    EXPECT_EQ(expected.received_timestamp, actual.received_timestamp);
+    EXPECT_EQ(expected.publication_sequence_number, actual.publication_sequence_number);
+    EXPECT_EQ(expected.reception_sequence_number, actual.reception_sequence_number);
+    EXPECT_EQ(
+      expected.publisher_gid.implementation_identifier,
+      actual.publisher_gid.implementation_identifier);
+    EXPECT_EQ(
+      0, memcmp(expected.publisher_gid.data, actual.publisher_gid.data, RMW_GID_STORAGE_SIZE));
+    EXPECT_EQ(expected.from_intra_process, actual.from_intra_process);
+  }
+  EXPECT_EQ(RMW_RET_OK, rmw_message_info_sequence_fini(&other_sequence));
+
+  // The batch must be large enough
+  auto small_batch = rmw_get_zero_initialized_message_info_batch();
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_batch_init(&small_batch, 2u, &allocator));
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_message_info_batch_from_sequence(&small_batch, &sequence));
+  rmw_reset_error();
+  EXPECT_EQ(0u, small_batch.size);
+  EXPECT_EQ(RMW_RET_OK, rmw_message_info_batch_fini(&small_batch));
+}
+
+TEST_F(TestMessageInfoBatch, latency_statistics) {
+  rmw_message_info_batch_latency_statistics_t statistics;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_message_info_batch_get_latency_statistics(nullptr, &statistics));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_message_info_batch_get_latency_statistics(&batch, nullptr));
+  rmw_reset_error();
+
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_batch_get_latency_statistics(&batch, &statistics));
+  EXPECT_EQ(0u, statistics.count);
+  EXPECT_EQ(0, statistics.min);
+  EXPECT_EQ(0, statistics.max);
+  EXPECT_EQ(0, statistics.mean);
+
+  // Message infos missing a timestamp are ignored
+  const rmw_message_info_t message_infos[] = {
+    make_message_info(1000, 1500, 1u, 1u, 1u),
+    make_message_info(0, 1000000, 2u, 2u, 1u),
+    make_message_info(2000, 2100, 3u, 3u, 1u),
+    make_message_info(3000, 0, 4u, 4u, 1u),
+    make_message_info(4000, 4402, 5u, 5u, 1u),
+    make_message_info(5000, 4990, 6u, 6u, 1u),
+  };
+  fill(message_infos);
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_batch_get_latency_statistics(&batch, &statistics));
+  EXPECT_EQ(4u, statistics.count);
+  EXPECT_EQ(-10, statistics.min);
+  EXPECT_EQ(500, statistics.max);
+  EXPECT_EQ((500 + 100 + 402 - 10) / 4, statistics.mean);
+}
+
+TEST(test_message_info_batch, latency_statistics_large_batch) {
+  // Large enough to be summed in several chunks
+  constexpr size_t size = 5000u;
+  auto allocator = rcutils_get_default_allocator();
+  auto batch = rmw_get_zero_initialized_message_info_batch();
+  if (RMW_AVOID_MEMORY_ALLOCATION) {
+    GTEST_SKIP() << "batch is larger than RMW_STATIC_MAX_SEQUENCE_LENGTH";
+  }
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_batch_init(&batch, size, &allocator));
+  int64_t sum = 0;
+  for (size_t i = 0u; i < size; ++i) {
+    const int64_t latency = static_cast<int64_t>((i * 7919u) % 1000u) + 1;
+    batch.source_timestamps[i] = 1700000000000000000 + static_cast<int64_t>(i) * 1000000;
+    batch.received_timestamps[i] = batch.source_timestamps[i] + latency;
+    sum += latency;
+  }
+  batch.size = size;
+  rmw_message_info_batch_latency_statistics_t statistics;
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_batch_get_latency_statistics(&batch, &statistics));
+  EXPECT_EQ(size, statistics.count);
+  EXPECT_EQ(1, statistics.min);
+  EXPECT_EQ(1000, statistics.max);
+  EXPECT_EQ(sum / static_cast<int64_t>(size), statistics.mean);
+  EXPECT_EQ(RMW_RET_OK, rmw_message_info_batch_fini(&batch));
+}
+
+TEST_F(TestMessageInfoBatch, sequence_gaps) {
+  rmw_message_info_batch_sequence_gaps_t gaps;
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_info_batch_find_sequence_gaps(nullptr, &gaps));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_info_batch_find_sequence_gaps(&batch, nullptr));
+  rmw_reset_error();
+
+  const rmw_message_info_t message_infos[] = {
+    make_message_info(1, 1, 10u, 100u, 1u),
+    make_message_info(1, 1, 11u, 101u, 1u),
+    // Three messages of the same publisher lost, and taken by someone else
+    make_message_info(1, 1, 15u, 105u, 1u),
+    // Another publisher, far ahead, is not a gap
+    make_message_info(1, 1, 500u, 106u, 2u),
+    make_message_info(1, 1, 502u, 108u, 2u),
+    // Unsupported sequence numbers are ignored
+    make_message_info(
+      1, 1, RMW_MESSAGE_INFO_SEQUENCE_NUMBER_UNSUPPORTED,
+      RMW_MESSAGE_INFO_SEQUENCE_NUMBER_UNSUPPORTED, 2u),
+    make_message_info(1, 1, 600u, 300u, 2u),
+  };
+  fill(message_infos);
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_batch_find_sequence_gaps(&batch, &gaps));
+  EXPECT_EQ(2u, gaps.publication_gap_count);
+  EXPECT_EQ(3u + 1u, gaps.publication_missing_count);
+  EXPECT_EQ(2u, gaps.reception_gap_count);
+  EXPECT_EQ(3u + 1u, gaps.reception_missing_count);
+
+  // No gaps in a contiguous batch
+  const rmw_message_info_t contiguous_message_infos[] = {
+    make_message_info(1, 1, 1u, 1u, 1u),
+    make_message_info(1, 1, 2u, 2u, 1u),
+    make_message_info(1, 1, 1u, 3u, 2u),
+  };
+  fill(contiguous_message_infos);
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_batch_find_sequence_gaps(&batch, &gaps));
+  EXPECT_EQ(0u, gaps.publication_gap_count);
+  EXPECT_EQ(0u, gaps.publication_missing_count);
+  EXPECT_EQ(0u, gaps.reception_gap_count);
+  EXPECT_EQ(0u, gaps.reception_missing_count);
+}
@@ -77,6 +77,65 @@ TEST(test_message_info_sequence, bad_arguments) {
   rmw_reset_error();
 }
 
+TEST(test_message_info_sequence, reserve_and_resize) {
+  auto info_sequence = rmw_get_zero_initialized_message_info_sequence();
+  auto allocator = rcutils_get_default_allocator();
+
+  // Not initialized
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_info_sequence_reserve(nullptr, 1u));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_info_sequence_reserve(&info_sequence, 1u));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_info_sequence_resize(&info_sequence, 1u));
+  rmw_reset_error();
+
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_sequence_init(&info_sequence, 0u, &allocator));
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_sequence_resize(&info_sequence, 3u));
+  EXPECT_EQ(3u, info_sequence.size);
+  EXPECT_EQ(3u, info_sequence.capacity);
+  for (size_t i = 0u; i < info_sequence.size; ++i) {
+    EXPECT_EQ(0, info_sequence.data[i].source_timestamp);
+    EXPECT_FALSE(info_sequence.data[i].from_intra_process);
+    info_sequence.data[i].publication_sequence_number = i + 1u;
+  }
+
+  // Growth is geometric and keeps the contents
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_sequence_resize(&info_sequence, 4u));
+  EXPECT_EQ(4u, info_sequence.size);
+  EXPECT_EQ(6u, info_sequence.capacity);
+  for (size_t i = 0u; i < 3u; ++i) {
+    EXPECT_EQ(i + 1u, info_sequence.data[i].publication_sequence_number);
+  }
+  EXPECT_EQ(0u, info_sequence.data[3].publication_sequence_number);
+
+  // Shrinking keeps the capacity
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_sequence_resize(&info_sequence, 1u));
+  EXPECT_EQ(1u, info_sequence.size);
+  EXPECT_EQ(6u, info_sequence.capacity);
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_sequence_reserve(&info_sequence, 2u));
+  EXPECT_EQ(6u, info_sequence.capacity);
+
+  // Reserving more than twice the capacity gives exactly what was asked for
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_sequence_reserve(&info_sequence, 20u));
+  EXPECT_EQ(1u, info_sequence.size);
+  EXPECT_EQ(20u, info_sequence.capacity);
+  EXPECT_EQ(1u, info_sequence.data[0].publication_sequence_number);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_info_sequence_fini(&info_sequence));
+
+  // Failing to grow leaves the sequence untouched
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_sequence_init(&info_sequence, 2u, &failing_allocator));
+  rmw_message_info_t * data = info_sequence.data;
+  set_time_bomb_allocator_realloc_count(failing_allocator, 0);
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, rmw_message_info_sequence_resize(&info_sequence, 3u));
+  rmw_reset_error();
+  EXPECT_EQ(0u, info_sequence.size);
+  EXPECT_EQ(2u, info_sequence.capacity);
+  EXPECT_EQ(data, info_sequence.data);
+  EXPECT_EQ(RMW_RET_OK, rmw_message_info_sequence_fini(&info_sequence));
+}
+
 TEST(test_message_sequence, default_initialization) {
   auto message_sequence = rmw_get_zero_initialized_message_sequence();
   auto allocator = rcutils_get_default_allocator();
@@ -133,3 +192,145 @@ TEST(test_message_sequence, bad_arguments) {
   EXPECT_EQ(nullptr, message_sequence.data);
   rmw_reset_error();
 }
+
+TEST(test_message_sequence, reserve_and_resize) {
+  auto message_sequence = rmw_get_zero_initialized_message_sequence();
+  auto allocator = rcutils_get_default_allocator();
+
+  // Not initialized
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_sequence_reserve(nullptr, 1u));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_sequence_reserve(&message_sequence, 1u));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_sequence_resize(&message_sequence, 1u));
+  rmw_reset_error();
+
+  int messages[3] = {0, 1, 2};
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_init(&message_sequence, 2u, &allocator));
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_resize(&message_sequence, 2u));
+  EXPECT_EQ(2u, message_sequence.size);
+  EXPECT_EQ(2u, message_sequence.capacity);
+  EXPECT_EQ(nullptr, message_sequence.data[0]);
+  EXPECT_EQ(nullptr, message_sequence.data[1]);
+  message_sequence.data[0] = &messages[0];
+  message_sequence.data[1] = &messages[1];
+
+  // Growth is geometric and keeps the contents
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_resize(&message_sequence, 3u));
+  EXPECT_EQ(3u, message_sequence.size);
+  EXPECT_EQ(4u, message_sequence.capacity);
+  EXPECT_EQ(&messages[0], message_sequence.data[0]);
+  EXPECT_EQ(&messages[1], message_sequence.data[1]);
+  EXPECT_EQ(nullptr, message_sequence.data[2]);
+  message_sequence.data[2] = &messages[2];
+
+  // Shrinking keeps the capacity, and growing back clears the entries
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_resize(&message_sequence, 1u));
+  EXPECT_EQ(1u, message_sequence.size);
+  EXPECT_EQ(4u, message_sequence.capacity);
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_resize(&message_sequence, 3u));
+  EXPECT_EQ(&messages[0], message_sequence.data[0]);
+  EXPECT_EQ(nullptr, message_sequence.data[1]);
+  EXPECT_EQ(nullptr, message_sequence.data[2]);
+
+  // Reserving more than twice the capacity gives exactly what was asked for
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_reserve(&message_sequence, 20u));
+  EXPECT_EQ(3u, message_sequence.size);
+  EXPECT_EQ(20u, message_sequence.capacity);
+  EXPECT_EQ(&messages[0], message_sequence.data[0]);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_sequence_fini(&message_sequence));
+
+  // Failing to grow leaves the sequence untouched
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_init(&message_sequence, 2u, &failing_allocator));
+  void ** data = message_sequence.data;
+  set_time_bomb_allocator_realloc_count(failing_allocator, 0);
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, rmw_message_sequence_reserve(&message_sequence, 3u));
+  rmw_reset_error();
+  EXPECT_EQ(0u, message_sequence.size);
+  EXPECT_EQ(2u, message_sequence.capacity);
+  EXPECT_EQ(data, message_sequence.data);
+  EXPECT_EQ(RMW_RET_OK, rmw_message_sequence_fini(&message_sequence));
+}
+
+TEST(test_message_and_info_sequence, initialization_with_size) {
+  auto sequence = rmw_get_zero_initialized_message_and_info_sequence();
+  auto allocator = rcutils_get_default_allocator();
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_and_info_sequence_init(&sequence, 0u, &allocator));
+  EXPECT_EQ(0u, sequence.size);
+  EXPECT_EQ(0u, sequence.capacity);
+  EXPECT_EQ(nullptr, sequence.data);
+  EXPECT_EQ(RMW_RET_OK, rmw_message_and_info_sequence_fini(&sequence));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_and_info_sequence_init(&sequence, 5u, &allocator));
+  EXPECT_EQ(0u, sequence.size);
+  EXPECT_EQ(5u, sequence.capacity);
+  EXPECT_NE(nullptr, sequence.data);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_and_info_sequence_fini(&sequence));
+  EXPECT_EQ(0u, sequence.size);
+  EXPECT_EQ(0u, sequence.capacity);
+  EXPECT_EQ(nullptr, sequence.data);
+}
+
+TEST(test_message_and_info_sequence, bad_arguments) {
+  auto sequence = rmw_get_zero_initialized_message_and_info_sequence();
+  auto allocator = rcutils_get_default_allocator();
+
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_and_info_sequence_init(nullptr, 5u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_and_info_sequence_init(&sequence, 5u, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_and_info_sequence_fini(nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_and_info_sequence_resize(&sequence, 1u));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, rmw_message_and_info_sequence_get_message(nullptr, 0u));
+  EXPECT_EQ(nullptr, rmw_message_and_info_sequence_get_message_info(nullptr, 0u));
+
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC, rmw_message_and_info_sequence_init(&sequence, 5u, &failing_allocator));
+  EXPECT_EQ(0u, sequence.size);
+  EXPECT_EQ(0u, sequence.capacity);
+  EXPECT_EQ(nullptr, sequence.data);
+  rmw_reset_error();
+}
+
+TEST(test_message_and_info_sequence, accessors) {
+  auto sequence = rmw_get_zero_initialized_message_and_info_sequence();
+  auto allocator = rcutils_get_default_allocator();
+  ASSERT_EQ(RMW_RET_OK, rmw_message_and_info_sequence_init(&sequence, 2u, &allocator));
+  EXPECT_EQ(nullptr, rmw_message_and_info_sequence_get_message(&sequence, 0u));
+  EXPECT_EQ(nullptr, rmw_message_and_info_sequence_get_message_info(&sequence, 0u));
+
+  // Messages are stored along with their infos
+  int messages[3] = {0, 1, 2};
+  ASSERT_EQ(RMW_RET_OK, rmw_message_and_info_sequence_resize(&sequence, 2u));
+  EXPECT_EQ(nullptr, rmw_message_and_info_sequence_get_message(&sequence, 1u));
+  for (size_t i = 0u; i < 2u; ++i) {
+    sequence.data[i].message = &messages[i];
+    sequence.data[i].message_info.publication_sequence_number = i;
+  }
+
+  // Growth keeps the contents
+  ASSERT_EQ(RMW_RET_OK, rmw_message_and_info_sequence_resize(&sequence, 3u));
+  EXPECT_EQ(3u, sequence.size);
+  EXPECT_EQ(4u, sequence.capacity);
+  sequence.data[2].message = &messages[2];
+  sequence.data[2].message_info.publication_sequence_number = 2u;
+  for (size_t i = 0u; i < 3u; ++i) {
+    EXPECT_EQ(&messages[i], rmw_message_and_info_sequence_get_message(&sequence, i));
+    rmw_message_info_t * message_info =
+      rmw_message_and_info_sequence_get_message_info(&sequence, i);
+    ASSERT_NE(nullptr, message_info);
+    EXPECT_EQ(i, message_info->publication_sequence_number);
+  }
+  EXPECT_EQ(nullptr, rmw_message_and_info_sequence_get_message(&sequence, 3u));
+  EXPECT_EQ(nullptr, rmw_message_and_info_sequence_get_message_info(&sequence, 3u));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_and_info_sequence_fini(&sequence));
+}
@@ -0,0 +1,185 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gmock/gmock.h"
+
+#include "rcutils/allocator.h"
+
+#include "./time_bomb_allocator_testing_utils.h"
+#include "rmw/error_handling.h"
+#include "rmw/message_sequence_pool.h"
+
+TEST(test_message_sequence_pool, init_fini) {
+  auto pool = rmw_get_zero_initialized_message_sequence_pool();
+  auto allocator = rcutils_get_default_allocator();
+
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_sequence_pool_init(nullptr, 2u, 5u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_sequence_pool_init(&pool, 2u, 5u, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_sequence_pool_fini(nullptr));
+  rmw_reset_error();
+
+  // Empty pool
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_pool_init(&pool, 0u, 5u, &allocator));
+  rmw_message_sequence_pair_t * pair = nullptr;
+  EXPECT_EQ(RMW_RET_ERROR, rmw_message_sequence_pool_acquire(&pool, &pair));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_OK, rmw_message_sequence_pool_fini(&pool));
+
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_pool_init(&pool, 2u, 5u, &allocator));
+  EXPECT_EQ(2u, pool.size);
+  EXPECT_EQ(2u, pool.free_count);
+  for (size_t i = 0u; i < pool.size; ++i) {
+    EXPECT_EQ(0u, pool.pairs[i].message_sequence.size);
+    EXPECT_EQ(5u, pool.pairs[i].message_sequence.capacity);
+    EXPECT_EQ(0u, pool.pairs[i].message_info_sequence.size);
+    EXPECT_EQ(5u, pool.pairs[i].message_info_sequence.capacity);
+  }
+  EXPECT_EQ(RMW_RET_OK, rmw_message_sequence_pool_fini(&pool));
+  EXPECT_EQ(0u, pool.size);
+  EXPECT_EQ(nullptr, pool.pairs);
+  EXPECT_EQ(nullptr, pool.free_pairs);
+  EXPECT_EQ(nullptr, pool.pairs_in_use);
+}
+
+TEST(test_message_sequence_pool, acquire_release) {
+  auto pool = rmw_get_zero_initialized_message_sequence_pool();
+  auto allocator = rcutils_get_default_allocator();
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_pool_init(&pool, 2u, 2u, &allocator));
+
+  rmw_message_sequence_pair_t * first = nullptr;
+  rmw_message_sequence_pair_t * second = nullptr;
+  rmw_message_sequence_pair_t * third = nullptr;
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_sequence_pool_acquire(nullptr, &first));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_sequence_pool_acquire(&pool, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_ERROR, rmw_message_sequence_pool_release(&pool, &pool.pairs[0]));
+  rmw_reset_error();
+
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_pool_acquire(&pool, &first));
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_pool_acquire(&pool, &second));
+  EXPECT_EQ(&pool.pairs[0], first);
+  EXPECT_EQ(&pool.pairs[1], second);
+  EXPECT_EQ(RMW_RET_ERROR, rmw_message_sequence_pool_acquire(&pool, &third));
+  rmw_reset_error();
+
+  // Pairs in use prevent finalization
+  EXPECT_EQ(RMW_RET_ERROR, rmw_message_sequence_pool_fini(&pool));
+  rmw_reset_error();
+
+  // Grow and fill the first pair, as a take would
+  int messages[3] = {0, 1, 2};
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_resize(&first->message_sequence, 3u));
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_sequence_resize(&first->message_info_sequence, 3u));
+  for (size_t i = 0u; i < 3u; ++i) {
+    first->message_sequence.data[i] = &messages[i];
+  }
+  void ** data = first->message_sequence.data;
+  const size_t capacity = first->message_sequence.capacity;
+
+  rmw_message_sequence_pair_t foreign_pair;
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_sequence_pool_release(&pool, &foreign_pair));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_sequence_pool_release(&pool, nullptr));
+  rmw_reset_error();
+
+  // Released pairs are reset but keep their storage, and are handed out first
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_pool_release(&pool, first));
+  EXPECT_EQ(0u, first->message_sequence.size);
+  EXPECT_EQ(0u, first->message_info_sequence.size);
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_pool_acquire(&pool, &third));
+  EXPECT_EQ(first, third);
+  EXPECT_EQ(data, third->message_sequence.data);
+  EXPECT_EQ(capacity, third->message_sequence.capacity);
+
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_pool_release(&pool, second));
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_pool_release(&pool, third));
+  EXPECT_EQ(RMW_RET_OK, rmw_message_sequence_pool_fini(&pool));
+}
+
+TEST(test_message_sequence_pool, double_release) {
+  auto pool = rmw_get_zero_initialized_message_sequence_pool();
+  auto allocator = rcutils_get_default_allocator();
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_pool_init(&pool, 2u, 2u, &allocator));
+
+  rmw_message_sequence_pair_t * first = nullptr;
+  rmw_message_sequence_pair_t * second = nullptr;
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_pool_acquire(&pool, &first));
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_pool_acquire(&pool, &second));
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_pool_release(&pool, first));
+
+  // Releasing a pair twice is caught, even while another pair is in use
+  EXPECT_EQ(RMW_RET_ERROR, rmw_message_sequence_pool_release(&pool, first));
+  rmw_reset_error();
+  EXPECT_EQ(1u, pool.free_count);
+
+  // The free list was not corrupted, so each pair is handed out once
+  rmw_message_sequence_pair_t * third = nullptr;
+  rmw_message_sequence_pair_t * fourth = nullptr;
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_pool_acquire(&pool, &third));
+  EXPECT_EQ(first, third);
+  EXPECT_EQ(RMW_RET_ERROR, rmw_message_sequence_pool_acquire(&pool, &fourth));
+  rmw_reset_error();
+
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_pool_release(&pool, second));
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_pool_release(&pool, third));
+  EXPECT_EQ(RMW_RET_ERROR, rmw_message_sequence_pool_release(&pool, third));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_OK, rmw_message_sequence_pool_fini(&pool));
+}
+
+TEST(test_message_sequence_pool, pair_reset) {
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_message_sequence_pair_reset(nullptr));
+  rmw_reset_error();
+
+  auto allocator = rcutils_get_default_allocator();
+  rmw_message_sequence_pair_t pair;
+  pair.message_sequence = rmw_get_zero_initialized_message_sequence();
+  pair.message_info_sequence = rmw_get_zero_initialized_message_info_sequence();
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_init(&pair.message_sequence, 2u, &allocator));
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_message_info_sequence_init(&pair.message_info_sequence, 2u, &allocator));
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_resize(&pair.message_sequence, 2u));
+  ASSERT_EQ(RMW_RET_OK, rmw_message_info_sequence_resize(&pair.message_info_sequence, 2u));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_sequence_pair_reset(&pair));
+  EXPECT_EQ(0u, pair.message_sequence.size);
+  EXPECT_EQ(2u, pair.message_sequence.capacity);
+  EXPECT_EQ(0u, pair.message_info_sequence.size);
+  EXPECT_EQ(2u, pair.message_info_sequence.capacity);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_message_sequence_fini(&pair.message_sequence));
+  EXPECT_EQ(RMW_RET_OK, rmw_message_info_sequence_fini(&pair.message_info_sequence));
+}
+
+TEST(test_message_sequence_pool, bad_alloc) {
+  auto pool = rmw_get_zero_initialized_message_sequence_pool();
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+
+  // Fail each allocation in turn: pairs, free list, in use flags, then two sequences per pair
+  for (int count = 0; count < 7; ++count) {
+    set_time_bomb_allocator_malloc_count(failing_allocator, count);
+    EXPECT_EQ(
+      RMW_RET_BAD_ALLOC, rmw_message_sequence_pool_init(&pool, 2u, 5u, &failing_allocator));
+    rmw_reset_error();
+    EXPECT_EQ(nullptr, pool.pairs);
+    EXPECT_EQ(nullptr, pool.free_pairs);
+    EXPECT_EQ(nullptr, pool.pairs_in_use);
+  }
+  set_time_bomb_allocator_malloc_count(failing_allocator, 7);
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_pool_init(&pool, 2u, 5u, &failing_allocator));
+  EXPECT_EQ(RMW_RET_OK, rmw_message_sequence_pool_fini(&pool));
+}
@@ -0,0 +1,121 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "./time_bomb_allocator_testing_utils.h"
+#include "rmw/error_handling.h"
+#include "rmw/qos_profile_intern_table.h"
+#include "rmw/qos_profiles.h"
+
+TEST(test_qos_profile_intern_table, init_fini) {
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rmw_qos_profile_intern_table_t table = rmw_get_zero_initialized_qos_profile_intern_table();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_qos_profile_intern_table_init(nullptr, 0u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_qos_profile_intern_table_init(&table, 0u, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_qos_profile_intern_table_fini(nullptr));
+  rmw_reset_error();
+
+  // Finalizing a zero initialized table is fine.
+  EXPECT_EQ(RMW_RET_OK, rmw_qos_profile_intern_table_fini(&table));
+
+  // Interning requires an initialized table.
+  rmw_qos_profile_id_t id;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_qos_profile_intern(&table, &rmw_qos_profile_default, &id));
+  rmw_reset_error();
+
+  ASSERT_EQ(RMW_RET_OK, rmw_qos_profile_intern_table_init(&table, 0u, &allocator));
+  EXPECT_EQ(0u, table.size);
+  EXPECT_EQ(nullptr, rmw_qos_profile_intern_table_get(&table, 0u));
+  EXPECT_EQ(RMW_RET_OK, rmw_qos_profile_intern_table_fini(&table));
+
+  ASSERT_EQ(RMW_RET_OK, rmw_qos_profile_intern_table_init(&table, 50u, &allocator));
+  EXPECT_EQ(50u, table.capacity);
+  EXPECT_EQ(RMW_RET_OK, rmw_qos_profile_intern_table_fini(&table));
+  EXPECT_EQ(nullptr, table.profiles);
+  EXPECT_EQ(nullptr, table.slots);
+}
+
+TEST(test_qos_profile_intern_table, intern) {
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rmw_qos_profile_intern_table_t table = rmw_get_zero_initialized_qos_profile_intern_table();
+  ASSERT_EQ(RMW_RET_OK, rmw_qos_profile_intern_table_init(&table, 0u, &allocator));
+
+  rmw_qos_profile_id_t id;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_qos_profile_intern(nullptr, &rmw_qos_profile_default, &id));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_qos_profile_intern(&table, nullptr, &id));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_qos_profile_intern(&table, &rmw_qos_profile_default, nullptr));
+  rmw_reset_error();
+
+  // Many distinct profiles, enough to grow the table several times, each interned twice.
+  std::vector<rmw_qos_profile_t> profiles;
+  for (size_t depth = 0u; depth < 20u; ++depth) {
+    rmw_qos_profile_t profile = rmw_qos_profile_default;
+    profile.depth = depth;
+    profiles.push_back(profile);
+    profile.reliability = RMW_QOS_POLICY_RELIABILITY_BEST_EFFORT;
+    profiles.push_back(profile);
+  }
+  for (int round = 0; round < 2; ++round) {
+    for (size_t i = 0u; i < profiles.size(); ++i) {
+      ASSERT_EQ(RMW_RET_OK, rmw_qos_profile_intern(&table, &profiles[i], &id));
+      EXPECT_EQ(i, id);
+    }
+  }
+  EXPECT_EQ(profiles.size(), table.size);
+  for (size_t i = 0u; i < profiles.size(); ++i) {
+    const rmw_qos_profile_t * profile =
+      rmw_qos_profile_intern_table_get(&table, static_cast<rmw_qos_profile_id_t>(i));
+    ASSERT_NE(nullptr, profile);
+    EXPECT_TRUE(rmw_qos_profile_are_equal(&profiles[i], profile));
+  }
+  EXPECT_EQ(
+    nullptr,
+    rmw_qos_profile_intern_table_get(&table, static_cast<rmw_qos_profile_id_t>(profiles.size())));
+  EXPECT_EQ(nullptr, rmw_qos_profile_intern_table_get(nullptr, 0u));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_qos_profile_intern_table_fini(&table));
+}
+
+TEST(test_qos_profile_intern_table, bad_alloc) {
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  rmw_qos_profile_intern_table_t table = rmw_get_zero_initialized_qos_profile_intern_table();
+  set_time_bomb_allocator_calloc_count(failing_allocator, 0);
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, rmw_qos_profile_intern_table_init(&table, 1u, &failing_allocator));
+  rmw_reset_error();
+
+  set_time_bomb_allocator_calloc_count(failing_allocator, -1);
+  ASSERT_EQ(RMW_RET_OK, rmw_qos_profile_intern_table_init(&table, 0u, &failing_allocator));
+  rmw_qos_profile_id_t id;
+  set_time_bomb_allocator_realloc_count(table.allocator, 0);
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, rmw_qos_profile_intern(&table, &rmw_qos_profile_default, &id));
+  rmw_reset_error();
+  EXPECT_EQ(0u, table.size);
+
+  // A failed growth leaves the table usable.
+  set_time_bomb_allocator_realloc_count(table.allocator, -1);
+  ASSERT_EQ(RMW_RET_OK, rmw_qos_profile_intern(&table, &rmw_qos_profile_default, &id));
+  EXPECT_EQ(0u, id);
+  EXPECT_EQ(RMW_RET_OK, rmw_qos_profile_intern_table_fini(&table));
+}
@@ -0,0 +1,303 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/qos_profiles.h"
+
+namespace
+{
+
+// Default profile with policies that are fully specified, not left to the system.
+rmw_qos_profile_t
+get_specified_profile()
+{
+  rmw_qos_profile_t profile = rmw_qos_profile_default;
+  profile.liveliness = RMW_QOS_POLICY_LIVELINESS_AUTOMATIC;
+  return profile;
+}
+
+}  // namespace
+
+TEST(test_qos_profile_check_compatible, invalid_arguments) {
+  rmw_qos_compatibility_type_t compatibility;
+  char reason[64];
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_qos_profile_check_compatible(
+      rmw_qos_profile_default, rmw_qos_profile_default, nullptr, reason, sizeof(reason)));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_qos_profile_check_compatible(
+      rmw_qos_profile_default, rmw_qos_profile_default, &compatibility, nullptr, 1u));
+  rmw_reset_error();
+}
+
+TEST(test_qos_profile_check_compatible, compatible) {
+  rmw_qos_compatibility_type_t compatibility;
+  char reason[2048] = "garbage";
+  rmw_qos_profile_t publisher_profile = get_specified_profile();
+  rmw_qos_profile_t subscription_profile = rmw_qos_profile_sensor_data;
+  subscription_profile.liveliness = RMW_QOS_POLICY_LIVELINESS_AUTOMATIC;
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_qos_profile_check_compatible(
+      publisher_profile, subscription_profile, &compatibility, reason, sizeof(reason)));
+  EXPECT_EQ(RMW_QOS_COMPATIBILITY_OK, compatibility);
+  EXPECT_STREQ("", reason);
+
+  // Reason is optional.
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_qos_profile_check_compatible(
+      publisher_profile, publisher_profile, &compatibility, nullptr, 0u));
+  EXPECT_EQ(RMW_QOS_COMPATIBILITY_OK, compatibility);
+}
+
+TEST(test_qos_profile_check_compatible, errors) {
+  rmw_qos_compatibility_type_t compatibility;
+  char reason[2048];
+
+  rmw_qos_profile_t publisher_profile = rmw_qos_profile_sensor_data;
+  rmw_qos_profile_t subscription_profile = rmw_qos_profile_default;
+  subscription_profile.durability = RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL;
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_qos_profile_check_compatible(
+      publisher_profile, subscription_profile, &compatibility, reason, sizeof(reason)));
+  EXPECT_EQ(RMW_QOS_COMPATIBILITY_ERROR, compatibility);
+  EXPECT_STREQ(
+    "ERROR: Best effort publisher and reliable subscription;"
+    "ERROR: Volatile publisher and transient local subscription;", reason);
+
+  publisher_profile = rmw_qos_profile_default;
+  publisher_profile.liveliness = RMW_QOS_POLICY_LIVELINESS_AUTOMATIC;
+  subscription_profile = rmw_qos_profile_default;
+  subscription_profile.liveliness = RMW_QOS_POLICY_LIVELINESS_MANUAL_BY_TOPIC;
+  subscription_profile.deadline = {1u, 0u};
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_qos_profile_check_compatible(
+      publisher_profile, subscription_profile, &compatibility, reason, sizeof(reason)));
+  EXPECT_EQ(RMW_QOS_COMPATIBILITY_ERROR, compatibility);
+  EXPECT_STREQ(
+    "ERROR: Subscription has a deadline, but publisher does not;"
+    "ERROR: Publisher's liveliness is automatic and subscription's is manual by topic;", reason);
+
+  publisher_profile = get_specified_profile();
+  publisher_profile.deadline = {2u, 0u};
+  publisher_profile.liveliness_lease_duration = {0u, 2000000000u};
+  subscription_profile = get_specified_profile();
+  subscription_profile.deadline = {1u, 999999999u};
+  subscription_profile.liveliness_lease_duration = {1u, 0u};
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_qos_profile_check_compatible(
+      publisher_profile, subscription_profile, &compatibility, reason, sizeof(reason)));
+  EXPECT_EQ(RMW_QOS_COMPATIBILITY_ERROR, compatibility);
+  EXPECT_STREQ(
+    "ERROR: Subscription deadline is less than publisher deadline;"
+    "ERROR: Subscription liveliness lease duration is less than publisher;", reason);
+
+  // Equal durations, even if not normalized the same way, are compatible.
+  subscription_profile.deadline = {1u, 1000000000u};
+  subscription_profile.liveliness_lease_duration = {2u, 0u};
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_qos_profile_check_compatible(
+      publisher_profile, subscription_profile, &compatibility, reason, sizeof(reason)));
+  EXPECT_EQ(RMW_QOS_COMPATIBILITY_OK, compatibility);
+
+  // No lease duration for the publisher.
+  publisher_profile.liveliness_lease_duration = RMW_QOS_LIVELINESS_LEASE_DURATION_DEFAULT;
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_qos_profile_check_compatible(
+      publisher_profile, subscription_profile, &compatibility, reason, sizeof(reason)));
+  EXPECT_EQ(RMW_QOS_COMPATIBILITY_ERROR, compatibility);
+  EXPECT_STREQ(
+    "ERROR: Subscription has a liveliness lease duration, but publisher does not;", reason);
+}
+
+TEST(test_qos_profile_check_compatible, warnings) {
+  rmw_qos_compatibility_type_t compatibility;
+  char reason[2048];
+
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_qos_profile_check_compatible(
+      rmw_qos_profile_system_default, rmw_qos_profile_unknown, &compatibility, reason,
+      sizeof(reason)));
+  EXPECT_EQ(RMW_QOS_COMPATIBILITY_WARNING, compatibility);
+  EXPECT_STREQ(
+    "WARNING: Publisher reliability is system_default and subscription reliability is unknown;"
+    "WARNING: Publisher durability is system_default and subscription durability is unknown;"
+    "WARNING: Publisher liveliness is system_default and subscription liveliness is unknown;",
+    reason);
+
+  // Warnings are not reported along with errors.
+  rmw_qos_profile_t subscription_profile = rmw_qos_profile_unknown;
+  subscription_profile.deadline = {1u, 0u};
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_qos_profile_check_compatible(
+      rmw_qos_profile_system_default, subscription_profile, &compatibility, reason,
+      sizeof(reason)));
+  EXPECT_EQ(RMW_QOS_COMPATIBILITY_ERROR, compatibility);
+  EXPECT_STREQ("ERROR: Subscription has a deadline, but publisher does not;", reason);
+
+  // A reliable publisher settles the reliability of any subscription.
+  rmw_qos_profile_t publisher_profile = rmw_qos_profile_system_default;
+  publisher_profile.reliability = RMW_QOS_POLICY_RELIABILITY_RELIABLE;
+  publisher_profile.durability = RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL;
+  publisher_profile.liveliness = RMW_QOS_POLICY_LIVELINESS_MANUAL_BY_TOPIC;
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_qos_profile_check_compatible(
+      publisher_profile, rmw_qos_profile_unknown, &compatibility, reason, sizeof(reason)));
+  EXPECT_EQ(RMW_QOS_COMPATIBILITY_OK, compatibility);
+}
+
+TEST(test_qos_profile_check_compatible, reason_truncated) {
+  rmw_qos_compatibility_type_t compatibility;
+  char reason[16];
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_qos_profile_check_compatible(
+      rmw_qos_profile_system_default, rmw_qos_profile_unknown, &compatibility, reason,
+      sizeof(reason)));
+  EXPECT_EQ(RMW_QOS_COMPATIBILITY_WARNING, compatibility);
+  EXPECT_STREQ("WARNING: Publis", reason);
+}
+
+TEST(test_qos_profile_check_compatible, with_subscriptions) {
+  rmw_qos_compatibility_type_t compatibility;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_qos_profile_check_compatible_with_subscriptions(nullptr, nullptr, 0u, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_qos_profile_check_compatible_with_subscriptions(
+      &rmw_qos_profile_default, nullptr, 0u, nullptr));
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_qos_profile_check_compatible_with_subscriptions(
+      &rmw_qos_profile_default, nullptr, 1u, &compatibility));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_qos_profile_check_compatible_with_subscriptions(
+      &rmw_qos_profile_default, &rmw_qos_profile_default, 1u, nullptr));
+  rmw_reset_error();
+
+  // Every combination of policy values gives the same result as one by one checks.
+  std::vector<rmw_qos_profile_t> profiles;
+  for (int reliability = 0; reliability <= RMW_QOS_POLICY_RELIABILITY_BEST_AVAILABLE;
+    ++reliability)
+  {
+    for (int durability = 0; durability <= RMW_QOS_POLICY_DURABILITY_BEST_AVAILABLE;
+      ++durability)
+    {
+      for (int liveliness = 0; liveliness <= RMW_QOS_POLICY_LIVELINESS_BEST_AVAILABLE;
+        ++liveliness)
+      {
+        for (uint64_t deadline_sec = 0u; deadline_sec < 3u; ++deadline_sec) {
+          rmw_qos_profile_t profile = rmw_qos_profile_default;
+          profile.reliability = static_cast<rmw_qos_reliability_policy_t>(reliability);
+          profile.durability = static_cast<rmw_qos_durability_policy_t>(durability);
+          profile.liveliness = static_cast<rmw_qos_liveliness_policy_t>(liveliness);
+          profile.deadline = {deadline_sec, 0u};
+          profile.liveliness_lease_duration = {2u - deadline_sec, 0u};
+          profiles.push_back(profile);
+        }
+      }
+    }
+  }
+  std::vector<rmw_qos_compatibility_type_t> compatibilities(profiles.size());
+  for (const rmw_qos_profile_t & publisher_profile : profiles) {
+    ASSERT_EQ(
+      RMW_RET_OK,
+      rmw_qos_profile_check_compatible_with_subscriptions(
+        &publisher_profile, profiles.data(), profiles.size(), compatibilities.data()));
+    for (size_t i = 0u; i < profiles.size(); ++i) {
+      ASSERT_EQ(
+        RMW_RET_OK,
+        rmw_qos_profile_check_compatible(
+          publisher_profile, profiles[i], &compatibility, nullptr, 0u));
+      EXPECT_EQ(compatibility, compatibilities[i]);
+    }
+  }
+}
+
+TEST(test_qos_profile_hash, equal_profiles_have_equal_hashes) {
+  EXPECT_EQ(0u, rmw_qos_profile_hash(nullptr));
+  EXPECT_TRUE(rmw_qos_profile_are_equal(nullptr, nullptr));
+  EXPECT_FALSE(rmw_qos_profile_are_equal(&rmw_qos_profile_default, nullptr));
+  EXPECT_FALSE(rmw_qos_profile_are_equal(nullptr, &rmw_qos_profile_default));
+
+  // Padding bytes differ, policies do not.
+  rmw_qos_profile_t lhs;
+  rmw_qos_profile_t rhs;
+  memset(&lhs, 0x00, sizeof(lhs));
+  memset(&rhs, 0xff, sizeof(rhs));
+  lhs = rmw_qos_profile_sensor_data;
+  rhs.history = lhs.history;
+  rhs.depth = lhs.depth;
+  rhs.reliability = lhs.reliability;
+  rhs.durability = lhs.durability;
+  rhs.deadline = lhs.deadline;
+  rhs.lifespan = lhs.lifespan;
+  rhs.liveliness = lhs.liveliness;
+  rhs.liveliness_lease_duration = lhs.liveliness_lease_duration;
+  rhs.avoid_ros_namespace_conventions = lhs.avoid_ros_namespace_conventions;
+  EXPECT_TRUE(rmw_qos_profile_are_equal(&lhs, &rhs));
+  EXPECT_EQ(rmw_qos_profile_hash(&lhs), rmw_qos_profile_hash(&rhs));
+}
+
+TEST(test_qos_profile_hash, any_policy_change_is_told_apart) {
+  const rmw_qos_profile_t base = rmw_qos_profile_default;
+  std::vector<rmw_qos_profile_t> profiles(12u, base);
+  profiles[1].history = RMW_QOS_POLICY_HISTORY_KEEP_ALL;
+  profiles[2].depth = base.depth + 1u;
+  profiles[3].reliability = RMW_QOS_POLICY_RELIABILITY_BEST_EFFORT;
+  profiles[4].durability = RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL;
+  profiles[5].deadline.sec = 1u;
+  profiles[6].deadline.nsec = 1u;
+  profiles[7].lifespan.sec = 1u;
+  profiles[8].lifespan.nsec = 1u;
+  profiles[9].liveliness = RMW_QOS_POLICY_LIVELINESS_AUTOMATIC;
+  profiles[10].liveliness_lease_duration.sec = 1u;
+  profiles[11].avoid_ros_namespace_conventions = !base.avoid_ros_namespace_conventions;
+  for (size_t i = 0u; i < profiles.size(); ++i) {
+    for (size_t j = 0u; j < profiles.size(); ++j) {
+      EXPECT_EQ(i == j, rmw_qos_profile_are_equal(&profiles[i], &profiles[j])) << i << " " << j;
+      if (i != j) {
+        EXPECT_NE(rmw_qos_profile_hash(&profiles[i]), rmw_qos_profile_hash(&profiles[j]));
+      }
+    }
+  }
+
+  // Durations are not normalized.
+  rmw_qos_profile_t one_second = base;
+  one_second.deadline = {1u, 0u};
+  rmw_qos_profile_t billion_nanoseconds = base;
+  billion_nanoseconds.deadline = {0u, 1000000000u};
+  EXPECT_FALSE(rmw_qos_profile_are_equal(&one_second, &billion_nanoseconds));
+}
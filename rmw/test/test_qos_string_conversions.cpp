@@ -14,7 +14,13 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <string>
+
+#include "rmw/error_handling.h"
+#include "rmw/qos_profiles.h"
 #include "rmw/qos_string_conversions.h"
+#include "rmw/time.h"
 #include "rmw/types.h"
 
 // Converts to string and back to the policy value, check that it's the same
@@ -82,3 +88,154 @@ TEST(test_qos_policy_stringify, test_policy_kinds) {
   EXPECT_EQ(RMW_QOS_POLICY_INVALID, rmw_qos_policy_kind_from_str("this is not a policy kind!"));
   EXPECT_FALSE(rmw_qos_policy_kind_to_str(RMW_QOS_POLICY_INVALID));
 }
+
+TEST(test_qos_policy_stringify, test_near_misses) {
+  // Prefixes, extensions and same length strings of known strings are not recognized.
+  EXPECT_EQ(RMW_QOS_POLICY_INVALID, rmw_qos_policy_kind_from_str(""));
+  EXPECT_EQ(RMW_QOS_POLICY_INVALID, rmw_qos_policy_kind_from_str("durabilit"));
+  EXPECT_EQ(RMW_QOS_POLICY_INVALID, rmw_qos_policy_kind_from_str("durabilityy"));
+  EXPECT_EQ(RMW_QOS_POLICY_INVALID, rmw_qos_policy_kind_from_str("lurability"));
+  EXPECT_EQ(RMW_QOS_POLICY_INVALID, rmw_qos_policy_kind_from_str("deadlinf"));
+  EXPECT_EQ(RMW_QOS_POLICY_INVALID, rmw_qos_policy_kind_from_str("Depth"));
+  EXPECT_EQ(
+    RMW_QOS_POLICY_INVALID,
+    rmw_qos_policy_kind_from_str("avoid_ros_namespace_conventionss"));
+  EXPECT_EQ(
+    RMW_QOS_POLICY_DURABILITY_UNKNOWN, rmw_qos_durability_policy_from_str("best_availablf"));
+  EXPECT_EQ(
+    RMW_QOS_POLICY_DURABILITY_UNKNOWN, rmw_qos_durability_policy_from_str("xolatile"));
+  EXPECT_EQ(RMW_QOS_POLICY_HISTORY_UNKNOWN, rmw_qos_history_policy_from_str("keep_las"));
+  EXPECT_EQ(
+    RMW_QOS_POLICY_LIVELINESS_UNKNOWN, rmw_qos_liveliness_policy_from_str("system_defaul_"));
+  EXPECT_EQ(
+    RMW_QOS_POLICY_RELIABILITY_UNKNOWN, rmw_qos_reliability_policy_from_str("reliable\t"));
+}
+
+static bool
+qos_profiles_equal(const rmw_qos_profile_t & left, const rmw_qos_profile_t & right)
+{
+  return left.history == right.history && left.depth == right.depth &&
+         left.reliability == right.reliability && left.durability == right.durability &&
+         rmw_time_equal(left.deadline, right.deadline) &&
+         rmw_time_equal(left.lifespan, right.lifespan) &&
+         left.liveliness == right.liveliness &&
+         rmw_time_equal(left.liveliness_lease_duration, right.liveliness_lease_duration) &&
+         left.avoid_ros_namespace_conventions == right.avoid_ros_namespace_conventions;
+}
+
+TEST(test_qos_profile_stringify, round_trip) {
+  char buffer[RMW_QOS_PROFILE_STR_MAX_SIZE];
+  const rmw_qos_profile_t profiles[] = {
+    rmw_qos_profile_sensor_data, rmw_qos_profile_parameters, rmw_qos_profile_default,
+    rmw_qos_profile_services_default, rmw_qos_profile_parameter_events,
+    rmw_qos_profile_system_default, rmw_qos_profile_best_available,
+  };
+  for (const rmw_qos_profile_t & profile : profiles) {
+    ASSERT_EQ(RMW_RET_OK, rmw_qos_profile_to_str(&profile, buffer, sizeof(buffer)));
+    rmw_qos_profile_t parsed = rmw_qos_profile_unknown;
+    ASSERT_EQ(RMW_RET_OK, rmw_qos_profile_from_str(buffer, &parsed)) << buffer;
+    EXPECT_TRUE(qos_profiles_equal(profile, parsed)) << buffer;
+  }
+
+  rmw_qos_profile_t profile = rmw_qos_profile_default;
+  profile.deadline = {1u, 500000000u};
+  profile.lifespan = {0u, 1500000000u};
+  ASSERT_EQ(RMW_RET_OK, rmw_qos_profile_to_str(&profile, buffer, sizeof(buffer)));
+  EXPECT_STREQ(
+    "history=keep_last,depth=10,reliability=reliable,durability=volatile,"
+    "deadline=1.500000000,lifespan=1.500000000,liveliness=system_default,"
+    "liveliness_lease_duration=0.000000000,avoid_ros_namespace_conventions=false", buffer);
+}
+
+TEST(test_qos_profile_stringify, to_str_buffer_size) {
+  // Longest possible stringified profile.
+  rmw_qos_profile_t profile = rmw_qos_profile_default;
+  profile.history = RMW_QOS_POLICY_HISTORY_SYSTEM_DEFAULT;
+  profile.depth = SIZE_MAX;
+  profile.reliability = RMW_QOS_POLICY_RELIABILITY_SYSTEM_DEFAULT;
+  profile.durability = RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL;
+  profile.deadline = {9223372036u, 854775806u};
+  profile.lifespan = {9223372036u, 854775806u};
+  profile.liveliness = RMW_QOS_POLICY_LIVELINESS_MANUAL_BY_TOPIC;
+  profile.liveliness_lease_duration = {9223372036u, 854775806u};
+  profile.avoid_ros_namespace_conventions = false;
+
+  char buffer[RMW_QOS_PROFILE_STR_MAX_SIZE];
+  ASSERT_EQ(RMW_RET_OK, rmw_qos_profile_to_str(&profile, buffer, sizeof(buffer)));
+  if (SIZE_MAX == UINT64_MAX) {
+    EXPECT_EQ(sizeof(buffer) - 1u, strlen(buffer));
+  }
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_qos_profile_to_str(&profile, buffer, strlen(buffer)));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_qos_profile_to_str(&profile, buffer, 0u));
+  rmw_reset_error();
+
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_qos_profile_to_str(nullptr, buffer, sizeof(buffer)));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_qos_profile_to_str(&profile, nullptr, sizeof(buffer)));
+  rmw_reset_error();
+  profile.history = RMW_QOS_POLICY_HISTORY_UNKNOWN;
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_qos_profile_to_str(&profile, buffer, sizeof(buffer)));
+  rmw_reset_error();
+}
+
+TEST(test_qos_profile_stringify, from_str_overrides) {
+  rmw_qos_profile_t profile = rmw_qos_profile_default;
+  ASSERT_EQ(RMW_RET_OK, rmw_qos_profile_from_str("", &profile));
+  EXPECT_TRUE(qos_profiles_equal(rmw_qos_profile_default, profile));
+
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_qos_profile_from_str(
+      "depth=5,reliability=best_effort,deadline=0.25,lifespan=2,"
+      "avoid_ros_namespace_conventions=true", &profile));
+  EXPECT_EQ(rmw_qos_profile_default.history, profile.history);
+  EXPECT_EQ(5u, profile.depth);
+  EXPECT_EQ(RMW_QOS_POLICY_RELIABILITY_BEST_EFFORT, profile.reliability);
+  EXPECT_EQ(rmw_qos_profile_default.durability, profile.durability);
+  EXPECT_EQ(0u, profile.deadline.sec);
+  EXPECT_EQ(250000000u, profile.deadline.nsec);
+  EXPECT_EQ(2u, profile.lifespan.sec);
+  EXPECT_EQ(0u, profile.lifespan.nsec);
+  EXPECT_TRUE(profile.avoid_ros_namespace_conventions);
+}
+
+TEST(test_qos_profile_stringify, from_str_invalid) {
+  rmw_qos_profile_t profile = rmw_qos_profile_default;
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_qos_profile_from_str(nullptr, &profile));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_qos_profile_from_str("depth=1", nullptr));
+  rmw_reset_error();
+
+  const char * invalid_strings[] = {
+    "depth",
+    "depth=",
+    "depth=-1",
+    "depth=1x",
+    "depth=99999999999999999999",
+    "depth=1,",
+    ",depth=1",
+    "depth=1,,history=keep_all",
+    "depth =1",
+    "history=keep_some",
+    "reliability=",
+    "durability=volatile ",
+    "liveliness=manual",
+    "deadline=1.",
+    "deadline=.5",
+    "deadline=1.0000000001",
+    "deadline=1.5s",
+    "lifespan=infinity",
+    "avoid_ros_namespace_conventions=1",
+    "depht=1",
+    "history=keep_all,depth=1,unknown=2",
+  };
+  for (const char * invalid_string : invalid_strings) {
+    EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_qos_profile_from_str(invalid_string, &profile)) <<
+      invalid_string;
+    rmw_reset_error();
+    // The profile is left untouched, even if part of the string was valid.
+    EXPECT_TRUE(qos_profiles_equal(rmw_qos_profile_default, profile)) << invalid_string;
+  }
+}
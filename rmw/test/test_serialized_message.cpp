@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <thread>
+#include <vector>
+
 #include "gmock/gmock.h"
 
 #include "osrf_testing_tools_cpp/memory_tools/testing_helpers.hpp"
@@ -180,3 +183,294 @@ TEST(test_serialized_message, init_resize_fini) {
   EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_fini(&serialized_message)) <<
     rmw_get_error_string().str;
 }
+
+TEST(test_serialized_message, chained_append_prepend_linearize) {
+  rmw_chained_serialized_message_t message =
+    rmw_get_zero_initialized_chained_serialized_message();
+  rcutils_allocator_t default_allocator = rcutils_get_default_allocator();
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_chained_serialized_message_init(&message, 1lu, &default_allocator)) <<
+    rmw_get_error_string().str;
+
+  const uint8_t header[] = {0x01, 0x02};
+  const uint8_t payload[] = {0x10, 0x11, 0x12, 0x13};
+  const uint8_t trailer[] = {0x20};
+  rmw_serialized_message_t view = rmw_get_zero_initialized_serialized_message();
+
+  EXPECT_EQ(RMW_RET_OK, rmw_chained_serialized_message_linearize(&message, &view));
+  EXPECT_EQ(nullptr, view.buffer);
+  EXPECT_EQ(0lu, view.buffer_length);
+
+  // A single segment is handed out as is.
+  rmw_ret_t ret = RMW_RET_ERROR;
+  EXPECT_NO_MEMORY_OPERATIONS(
+  {
+    ret = rmw_chained_serialized_message_append(&message, payload, sizeof(payload));
+  });
+  ASSERT_EQ(RMW_RET_OK, ret) << rmw_get_error_string().str;
+  EXPECT_EQ(RMW_RET_OK, rmw_chained_serialized_message_append(&message, nullptr, 0lu));
+  EXPECT_EQ(1lu, message.segment_count);
+  EXPECT_EQ(RMW_RET_OK, rmw_chained_serialized_message_linearize(&message, &view));
+  EXPECT_EQ(payload, view.buffer);
+  EXPECT_EQ(sizeof(payload), view.buffer_length);
+
+  // Framing segments only move segment descriptors around.
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_chained_serialized_message_prepend(&message, header, sizeof(header))) <<
+    rmw_get_error_string().str;
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_chained_serialized_message_append(&message, trailer, sizeof(trailer))) <<
+    rmw_get_error_string().str;
+  EXPECT_EQ(3lu, message.segment_count);
+  EXPECT_LE(3lu, message.segment_capacity);
+  EXPECT_EQ(header, message.segments[0].buffer);
+  EXPECT_EQ(payload, message.segments[1].buffer);
+  EXPECT_EQ(trailer, message.segments[2].buffer);
+  EXPECT_EQ(7lu, rmw_chained_serialized_message_get_length(&message));
+
+  ASSERT_EQ(RMW_RET_OK, rmw_chained_serialized_message_linearize(&message, &view)) <<
+    rmw_get_error_string().str;
+  const uint8_t expected[] = {0x01, 0x02, 0x10, 0x11, 0x12, 0x13, 0x20};
+  ASSERT_EQ(sizeof(expected), view.buffer_length);
+  EXPECT_EQ(0, memcmp(expected, view.buffer, sizeof(expected)));
+  EXPECT_FALSE(rcutils_allocator_is_valid(&view.allocator));
+
+  // The contiguous copy is reused until the chain changes.
+  rmw_serialized_message_t same_view = rmw_get_zero_initialized_serialized_message();
+  EXPECT_NO_MEMORY_OPERATIONS(
+  {
+    ret = rmw_chained_serialized_message_linearize(&message, &same_view);
+  });
+  EXPECT_EQ(RMW_RET_OK, ret) << rmw_get_error_string().str;
+  EXPECT_EQ(view.buffer, same_view.buffer);
+
+  ASSERT_EQ(RMW_RET_OK, rmw_chained_serialized_message_reset(&message));
+  EXPECT_EQ(0lu, rmw_chained_serialized_message_get_length(&message));
+  ASSERT_EQ(RMW_RET_OK, rmw_chained_serialized_message_append(&message, trailer, 1lu));
+  ASSERT_EQ(RMW_RET_OK, rmw_chained_serialized_message_append(&message, header, 2lu));
+  ASSERT_EQ(RMW_RET_OK, rmw_chained_serialized_message_linearize(&message, &view)) <<
+    rmw_get_error_string().str;
+  const uint8_t expected_after_reset[] = {0x20, 0x01, 0x02};
+  ASSERT_EQ(sizeof(expected_after_reset), view.buffer_length);
+  EXPECT_EQ(0, memcmp(expected_after_reset, view.buffer, sizeof(expected_after_reset)));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_chained_serialized_message_fini(&message)) <<
+    rmw_get_error_string().str;
+  EXPECT_EQ(nullptr, message.segments);
+  EXPECT_EQ(nullptr, message.linearized.buffer);
+}
+
+TEST(test_serialized_message, chained_bad_arguments) {
+  rcutils_allocator_t default_allocator = rcutils_get_default_allocator();
+  rcutils_allocator_t invalid_allocator = rcutils_get_zero_initialized_allocator();
+  const uint8_t buffer[] = {0x01};
+  rmw_serialized_message_t view = rmw_get_zero_initialized_serialized_message();
+  rmw_chained_serialized_message_t message =
+    rmw_get_zero_initialized_chained_serialized_message();
+
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_chained_serialized_message_init(nullptr, 1lu, &default_allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_chained_serialized_message_init(&message, 1lu, &invalid_allocator));
+  rmw_reset_error();
+
+  // Zero initialized messages are not initialized, but can be finalized.
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_chained_serialized_message_append(&message, buffer, sizeof(buffer)));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_chained_serialized_message_prepend(&message, buffer, sizeof(buffer)));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_chained_serialized_message_linearize(&message, &view));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_OK, rmw_chained_serialized_message_fini(&message));
+
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_chained_serialized_message_init(&message, 0lu, &default_allocator)) <<
+    rmw_get_error_string().str;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_chained_serialized_message_append(nullptr, buffer, sizeof(buffer)));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_chained_serialized_message_append(&message, nullptr, 1lu));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_chained_serialized_message_prepend(nullptr, buffer, sizeof(buffer)));
+  rmw_reset_error();
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_chained_serialized_message_append(&message, buffer, sizeof(buffer))) <<
+    rmw_get_error_string().str;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_chained_serialized_message_append(&message, buffer, SIZE_MAX));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_chained_serialized_message_linearize(nullptr, &view));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_chained_serialized_message_linearize(&message, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_chained_serialized_message_reset(nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(0lu, rmw_chained_serialized_message_get_length(nullptr));
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_chained_serialized_message_fini(nullptr));
+  rmw_reset_error();
+
+  EXPECT_EQ(RMW_RET_OK, rmw_chained_serialized_message_fini(&message)) <<
+    rmw_get_error_string().str;
+}
+
+TEST(test_serialized_message, chained_bad_allocation) {
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  rmw_chained_serialized_message_t message =
+    rmw_get_zero_initialized_chained_serialized_message();
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC,
+    rmw_chained_serialized_message_init(&message, 1lu, &failing_allocator));
+  rmw_reset_error();
+
+  set_time_bomb_allocator_malloc_count(failing_allocator, -1);
+  set_time_bomb_allocator_realloc_count(failing_allocator, 0);
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_chained_serialized_message_init(&message, 1lu, &failing_allocator)) <<
+    rmw_get_error_string().str;
+  const uint8_t buffer[] = {0x01, 0x02};
+  ASSERT_EQ(RMW_RET_OK, rmw_chained_serialized_message_append(&message, buffer, 1lu)) <<
+    rmw_get_error_string().str;
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC,
+    rmw_chained_serialized_message_append(&message, buffer + 1, 1lu));
+  rmw_reset_error();
+  EXPECT_EQ(1lu, message.segment_count);
+  EXPECT_EQ(1lu, rmw_chained_serialized_message_get_length(&message));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_chained_serialized_message_fini(&message)) <<
+    rmw_get_error_string().str;
+}
+
+TEST(test_serialized_message, shared_retain_release) {
+  rcutils_allocator_t default_allocator = rcutils_get_default_allocator();
+  rmw_serialized_message_t serialized_message = rmw_get_zero_initialized_serialized_message();
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_serialized_message_init(&serialized_message, 4lu, &default_allocator)) <<
+    rmw_get_error_string().str;
+  serialized_message.buffer_length = 4lu;
+  uint8_t * buffer = serialized_message.buffer;
+
+  rmw_shared_serialized_message_t * shared = nullptr;
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_shared_serialized_message_create(
+      &serialized_message, nullptr, nullptr, &default_allocator, &shared)) <<
+    rmw_get_error_string().str;
+  EXPECT_EQ(nullptr, serialized_message.buffer);
+  EXPECT_EQ(1lu, rmw_shared_serialized_message_get_reference_count(shared));
+  const rmw_serialized_message_t * contents =
+    rmw_shared_serialized_message_get_serialized_message(shared);
+  ASSERT_NE(nullptr, contents);
+  EXPECT_EQ(buffer, contents->buffer);
+  EXPECT_EQ(4lu, contents->buffer_length);
+
+  std::vector<std::thread> threads;
+  for (size_t t = 0u; t < 4u; ++t) {
+    threads.emplace_back(
+      [shared]() {
+        for (size_t i = 0u; i < 1000u; ++i) {
+          if (
+            RMW_RET_OK != rmw_shared_serialized_message_retain(shared) ||
+            RMW_RET_OK != rmw_shared_serialized_message_release(shared))
+          {
+            ADD_FAILURE() << "failed to retain or release a reference";
+            return;
+          }
+        }
+      });
+  }
+  for (std::thread & thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(1lu, rmw_shared_serialized_message_get_reference_count(shared));
+
+  // The last release finalizes the contents, memory checkers catch a leak otherwise.
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_serialized_message_retain(shared));
+  EXPECT_EQ(2lu, rmw_shared_serialized_message_get_reference_count(shared));
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_serialized_message_release(shared));
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_serialized_message_release(shared)) <<
+    rmw_get_error_string().str;
+}
+
+TEST(test_serialized_message, shared_release_callback) {
+  struct ReleaseRecord
+  {
+    size_t calls;
+    uint8_t * buffer;
+  } record{0u, nullptr};
+  auto release_callback = [](rmw_serialized_message_t * serialized_message, void * data) {
+      auto record = static_cast<ReleaseRecord *>(data);
+      ++record->calls;
+      record->buffer = serialized_message->buffer;
+      EXPECT_EQ(RCUTILS_RET_OK, rmw_serialized_message_fini(serialized_message));
+    };
+
+  rcutils_allocator_t default_allocator = rcutils_get_default_allocator();
+  rmw_serialized_message_t serialized_message = rmw_get_zero_initialized_serialized_message();
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_serialized_message_init(&serialized_message, 8lu, &default_allocator)) <<
+    rmw_get_error_string().str;
+  uint8_t * buffer = serialized_message.buffer;
+
+  rmw_shared_serialized_message_t * shared = nullptr;
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_shared_serialized_message_create(
+      &serialized_message, release_callback, &record, &default_allocator, &shared)) <<
+    rmw_get_error_string().str;
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_serialized_message_retain(shared));
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_serialized_message_release(shared));
+  EXPECT_EQ(0u, record.calls);
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_serialized_message_release(shared));
+  EXPECT_EQ(1u, record.calls);
+  EXPECT_EQ(buffer, record.buffer);
+}
+
+TEST(test_serialized_message, shared_bad_arguments) {
+  rcutils_allocator_t default_allocator = rcutils_get_default_allocator();
+  rcutils_allocator_t invalid_allocator = rcutils_get_zero_initialized_allocator();
+  rmw_serialized_message_t serialized_message = rmw_get_zero_initialized_serialized_message();
+  rmw_shared_serialized_message_t * shared = nullptr;
+
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_shared_serialized_message_create(
+      nullptr, nullptr, nullptr, &default_allocator, &shared));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_shared_serialized_message_create(
+      &serialized_message, nullptr, nullptr, &invalid_allocator, &shared));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_shared_serialized_message_create(
+      &serialized_message, nullptr, nullptr, &default_allocator, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_shared_serialized_message_retain(nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_shared_serialized_message_release(nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, rmw_shared_serialized_message_get_serialized_message(nullptr));
+  EXPECT_EQ(0lu, rmw_shared_serialized_message_get_reference_count(nullptr));
+
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC, rmw_shared_serialized_message_create(
+      &serialized_message, nullptr, nullptr, &failing_allocator, &shared));
+  rmw_reset_error();
+}
@@ -0,0 +1,278 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+
+#include "gmock/gmock.h"
+#include "osrf_testing_tools_cpp/memory_tools/testing_helpers.hpp"
+
+#include "rcutils/allocator.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/serialized_message_pool.h"
+
+#include "./time_bomb_allocator_testing_utils.h"
+
+class TestSerializedMessagePool : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    pool = rmw_get_zero_initialized_serialized_message_pool();
+    ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_pool_init(&pool, 256u, 4096u, &allocator)) <<
+      rmw_get_error_string().str;
+  }
+
+  void TearDown() override
+  {
+    EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_pool_fini(&pool)) <<
+      rmw_get_error_string().str;
+  }
+
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rmw_serialized_message_pool_t pool;
+};
+
+TEST(test_serialized_message_pool, init_fini_bad_arguments) {
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rcutils_allocator_t invalid_allocator = rcutils_get_zero_initialized_allocator();
+  rmw_serialized_message_pool_t pool = rmw_get_zero_initialized_serialized_message_pool();
+
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_init(nullptr, 256u, 4096u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_serialized_message_pool_init(&pool, 256u, 4096u, &invalid_allocator));
+  rmw_reset_error();
+  // Buffer sizes must be powers of two, in order, with not too many classes in between.
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_init(&pool, 32u, 4096u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_init(&pool, 300u, 4096u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_init(&pool, 256u, 5000u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_init(&pool, 512u, 256u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_serialized_message_pool_init(&pool, 64u, SIZE_MAX / 2u + 1u, &allocator));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_fini(nullptr));
+  rmw_reset_error();
+
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_serialized_message_pool_init(
+      &pool, RMW_SERIALIZED_MESSAGE_POOL_DEFAULT_MIN_BUFFER_SIZE,
+      RMW_SERIALIZED_MESSAGE_POOL_DEFAULT_MAX_BUFFER_SIZE, &allocator)) <<
+    rmw_get_error_string().str;
+  EXPECT_EQ(19u, pool.class_count);
+  EXPECT_EQ(256u, pool.classes[0].buffer_size);
+  EXPECT_EQ(64u * 1024u * 1024u, pool.classes[18].buffer_size);
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_pool_fini(&pool)) <<
+    rmw_get_error_string().str;
+}
+
+TEST_F(TestSerializedMessagePool, acquire_release_reuses_buffers) {
+  rmw_serialized_message_t serialized_message = rmw_get_zero_initialized_serialized_message();
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_pool_acquire(&pool, 100u, &serialized_message)) <<
+    rmw_get_error_string().str;
+  EXPECT_EQ(100u, serialized_message.buffer_capacity);
+  uint8_t * buffer = serialized_message.buffer;
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_pool_release(&pool, &serialized_message)) <<
+    rmw_get_error_string().str;
+  EXPECT_EQ(nullptr, serialized_message.buffer);
+
+  const rmw_serialized_message_pool_class_t * size_class =
+    rmw_serialized_message_pool_get_class(&pool, 200u);
+  ASSERT_NE(nullptr, size_class);
+  EXPECT_EQ(256u, size_class->buffer_size);
+  EXPECT_EQ(1u, size_class->allocation_count);
+  EXPECT_EQ(1u, size_class->free_count);
+  EXPECT_EQ(0u, size_class->in_use);
+  EXPECT_EQ(1u, size_class->high_water_mark);
+
+  rmw_ret_t ret = RMW_RET_ERROR;
+  EXPECT_NO_MEMORY_OPERATIONS(
+  {
+    ret = rmw_serialized_message_pool_acquire(&pool, 200u, &serialized_message);
+  });
+  ASSERT_EQ(RMW_RET_OK, ret) << rmw_get_error_string().str;
+  EXPECT_EQ(buffer, serialized_message.buffer);
+  EXPECT_EQ(1u, size_class->allocation_count);
+  EXPECT_EQ(1u, size_class->in_use);
+  EXPECT_NO_MEMORY_OPERATIONS(
+  {
+    ret = rmw_serialized_message_fini(&serialized_message);
+  });
+  EXPECT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(1u, size_class->free_count);
+  EXPECT_EQ(0u, size_class->in_use);
+}
+
+TEST_F(TestSerializedMessagePool, resize_moves_to_larger_classes) {
+  rmw_serialized_message_t serialized_message = rmw_get_zero_initialized_serialized_message();
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_pool_acquire(&pool, 256u, &serialized_message)) <<
+    rmw_get_error_string().str;
+  for (size_t i = 0u; i < 256u; ++i) {
+    serialized_message.buffer[i] = static_cast<uint8_t>(i);
+  }
+  serialized_message.buffer_length = 256u;
+
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_resize(&serialized_message, 1000u));
+  EXPECT_EQ(1000u, serialized_message.buffer_capacity);
+  for (size_t i = 0u; i < 256u; ++i) {
+    EXPECT_EQ(static_cast<uint8_t>(i), serialized_message.buffer[i]);
+  }
+  const rmw_serialized_message_pool_class_t * small_class =
+    rmw_serialized_message_pool_get_class(&pool, 256u);
+  const rmw_serialized_message_pool_class_t * large_class =
+    rmw_serialized_message_pool_get_class(&pool, 1000u);
+  ASSERT_NE(nullptr, small_class);
+  ASSERT_NE(nullptr, large_class);
+  EXPECT_EQ(1024u, large_class->buffer_size);
+  EXPECT_EQ(0u, small_class->in_use);
+  EXPECT_EQ(1u, small_class->free_count);
+  EXPECT_EQ(1u, large_class->in_use);
+
+  // Resizing within the buffer size of the class does not touch memory.
+  uint8_t * buffer = serialized_message.buffer;
+  rmw_ret_t ret = RMW_RET_ERROR;
+  EXPECT_NO_MEMORY_OPERATIONS(
+  {
+    ret = rmw_serialized_message_resize(&serialized_message, 1024u);
+  });
+  EXPECT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(buffer, serialized_message.buffer);
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_resize(&serialized_message, 10u));
+  EXPECT_EQ(buffer, serialized_message.buffer);
+  EXPECT_EQ(10u, serialized_message.buffer_capacity);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_pool_release(&pool, &serialized_message));
+  EXPECT_EQ(0u, large_class->in_use);
+  EXPECT_EQ(1u, large_class->free_count);
+}
+
+TEST_F(TestSerializedMessagePool, oversized_buffers_bypass_classes) {
+  EXPECT_EQ(nullptr, rmw_serialized_message_pool_get_class(&pool, 4097u));
+  rmw_serialized_message_t serialized_message = rmw_get_zero_initialized_serialized_message();
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_pool_acquire(&pool, 4097u, &serialized_message)) <<
+    rmw_get_error_string().str;
+  EXPECT_EQ(1u, pool.oversized_in_use);
+  memset(serialized_message.buffer, 0xA5, 4097u);
+  EXPECT_EQ(RMW_RET_ERROR, rmw_serialized_message_pool_fini(&pool));
+  rmw_reset_error();
+
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_resize(&serialized_message, 10000u));
+  EXPECT_EQ(0xA5, serialized_message.buffer[4096]);
+  EXPECT_EQ(1u, pool.oversized_in_use);
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_pool_release(&pool, &serialized_message));
+  EXPECT_EQ(0u, pool.oversized_in_use);
+}
+
+TEST_F(TestSerializedMessagePool, reserve) {
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_reserve(nullptr, 300u, 1u));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_reserve(&pool, 0u, 1u));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_reserve(&pool, 4097u, 1u));
+  rmw_reset_error();
+
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_pool_reserve(&pool, 300u, 3u)) <<
+    rmw_get_error_string().str;
+  const rmw_serialized_message_pool_class_t * size_class =
+    rmw_serialized_message_pool_get_class(&pool, 300u);
+  ASSERT_NE(nullptr, size_class);
+  EXPECT_EQ(512u, size_class->buffer_size);
+  EXPECT_EQ(3u, size_class->free_count);
+  EXPECT_EQ(3u, size_class->allocation_count);
+
+  rmw_serialized_message_t serialized_messages[3];
+  EXPECT_NO_MEMORY_OPERATIONS(
+  {
+    for (rmw_serialized_message_t & serialized_message : serialized_messages) {
+      serialized_message = rmw_get_zero_initialized_serialized_message();
+      EXPECT_EQ(
+        RMW_RET_OK, rmw_serialized_message_pool_acquire(&pool, 512u, &serialized_message));
+    }
+  });
+  EXPECT_EQ(0u, size_class->free_count);
+  EXPECT_EQ(3u, size_class->high_water_mark);
+  for (rmw_serialized_message_t & serialized_message : serialized_messages) {
+    EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_pool_release(&pool, &serialized_message));
+  }
+  EXPECT_EQ(3u, size_class->high_water_mark);
+  EXPECT_EQ(3u, size_class->allocation_count);
+}
+
+TEST_F(TestSerializedMessagePool, acquire_release_bad_arguments) {
+  rmw_serialized_message_t serialized_message = rmw_get_zero_initialized_serialized_message();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_serialized_message_pool_acquire(nullptr, 1u, &serialized_message));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_acquire(&pool, 1u, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_serialized_message_pool_release(nullptr, &serialized_message));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_serialized_message_pool_release(&pool, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, rmw_serialized_message_pool_get_class(nullptr, 1u));
+  rcutils_allocator_t no_allocator = rmw_serialized_message_pool_get_allocator(nullptr);
+  EXPECT_FALSE(rcutils_allocator_is_valid(&no_allocator));
+
+  // Serialized messages not acquired from the pool are rejected.
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_init(&serialized_message, 1u, &allocator));
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_serialized_message_pool_release(&pool, &serialized_message));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_fini(&serialized_message));
+}
+
+TEST(test_serialized_message_pool, bad_allocation) {
+  rcutils_allocator_t failing_allocator = get_time_bomb_allocator();
+  rmw_serialized_message_pool_t pool = rmw_get_zero_initialized_serialized_message_pool();
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_serialized_message_pool_init(&pool, 256u, 4096u, &failing_allocator)) <<
+    rmw_get_error_string().str;
+
+  set_time_bomb_allocator_malloc_count(failing_allocator, 1);
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, rmw_serialized_message_pool_reserve(&pool, 256u, 2u));
+  rmw_reset_error();
+  EXPECT_EQ(1u, pool.classes[0].free_count);
+
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  rmw_serialized_message_t serialized_message = rmw_get_zero_initialized_serialized_message();
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC, rmw_serialized_message_pool_acquire(&pool, 1024u, &serialized_message));
+  rmw_reset_error();
+  EXPECT_EQ(0u, pool.classes[2].in_use);
+
+  // Free buffers are still served without the allocator.
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_pool_acquire(&pool, 256u, &serialized_message)) <<
+    rmw_get_error_string().str;
+  set_time_bomb_allocator_malloc_count(failing_allocator, 0);
+  EXPECT_EQ(RMW_RET_BAD_ALLOC, rmw_serialized_message_resize(&serialized_message, 1024u));
+  rmw_reset_error();
+  EXPECT_NE(nullptr, serialized_message.buffer);
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_pool_release(&pool, &serialized_message));
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_pool_fini(&pool)) << rmw_get_error_string().str;
+}
@@ -0,0 +1,326 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <unistd.h>
+
+#include <cstring>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/shared_memory_chunk_pool.h"
+
+class TestSharedMemoryChunkPool : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    pool = rmw_get_zero_initialized_shared_memory_chunk_pool();
+    rmw_ret_t ret = rmw_shared_memory_chunk_pool_create(&pool, nullptr, 100u, 4u);
+    if (RMW_RET_UNSUPPORTED == ret) {
+      rmw_reset_error();
+      GTEST_SKIP() << "shared memory chunk pools are not supported on this platform";
+    }
+    ASSERT_EQ(RMW_RET_OK, ret) << rmw_get_error_string().str;
+  }
+
+  void TearDown() override
+  {
+    EXPECT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_fini(&pool)) <<
+      rmw_get_error_string().str;
+  }
+
+  rmw_shared_memory_chunk_pool_t pool;
+};
+
+TEST(test_shared_memory_chunk_pool, bad_arguments) {
+  rmw_shared_memory_chunk_pool_t pool = rmw_get_zero_initialized_shared_memory_chunk_pool();
+  EXPECT_EQ(-1, pool.file_descriptor);
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_shared_memory_chunk_pool_create(nullptr, nullptr, 1u, 1u));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_shared_memory_chunk_pool_create(&pool, nullptr, 0u, 1u));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_shared_memory_chunk_pool_create(&pool, nullptr, 1u, 0u));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_shared_memory_chunk_pool_create(&pool, nullptr, 1u, UINT32_MAX));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_shared_memory_chunk_pool_attach(nullptr, "/name"));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_shared_memory_chunk_pool_attach(&pool, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_shared_memory_chunk_pool_attach_file_descriptor(nullptr, 0));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_shared_memory_chunk_pool_attach_file_descriptor(&pool, -1));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_shared_memory_chunk_pool_fini(nullptr));
+  rmw_reset_error();
+
+  // Chunks of a pool that is not initialized cannot be used.
+  size_t chunk_index = 0u;
+  uint32_t reference_count = 0u;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_shared_memory_chunk_pool_acquire(&pool, 1u, &chunk_index));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_shared_memory_chunk_pool_retain(&pool, 0u));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_shared_memory_chunk_pool_release(&pool, 0u));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_shared_memory_chunk_pool_get_chunk_state(&pool, 0u, &reference_count, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(nullptr, rmw_shared_memory_chunk_pool_get_chunk(&pool, 0u));
+  EXPECT_EQ(nullptr, rmw_shared_memory_chunk_pool_get_chunk(nullptr, 0u));
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_fini(&pool));
+}
+
+TEST_F(TestSharedMemoryChunkPool, acquire_retain_release) {
+  EXPECT_EQ(128u, pool.chunk_size);
+  EXPECT_EQ(4u, pool.chunk_count);
+  EXPECT_TRUE(pool.is_creator);
+  EXPECT_NE(-1, pool.file_descriptor);
+
+  std::set<size_t> acquired;
+  for (size_t i = 0u; i < pool.chunk_count; ++i) {
+    size_t chunk_index = 0u;
+    ASSERT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_acquire(&pool, 42u, &chunk_index)) <<
+      rmw_get_error_string().str;
+    EXPECT_TRUE(acquired.insert(chunk_index).second);
+  }
+  size_t chunk_index = 0u;
+  EXPECT_EQ(RMW_RET_ERROR, rmw_shared_memory_chunk_pool_acquire(&pool, 42u, &chunk_index));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_shared_memory_chunk_pool_acquire(&pool, 0u, &chunk_index));
+  rmw_reset_error();
+
+  // A chunk is only freed once its last reference is released.
+  uint32_t reference_count = 0u;
+  uint32_t owner = 0u;
+  ASSERT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_retain(&pool, 2u));
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_shared_memory_chunk_pool_get_chunk_state(&pool, 2u, &reference_count, &owner));
+  EXPECT_EQ(2u, reference_count);
+  EXPECT_EQ(42u, owner);
+  ASSERT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_release(&pool, 2u));
+  EXPECT_EQ(RMW_RET_ERROR, rmw_shared_memory_chunk_pool_acquire(&pool, 42u, &chunk_index));
+  rmw_reset_error();
+  ASSERT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_release(&pool, 2u));
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_shared_memory_chunk_pool_get_chunk_state(&pool, 2u, &reference_count, &owner));
+  EXPECT_EQ(0u, reference_count);
+  EXPECT_EQ(0u, owner);
+  EXPECT_EQ(RMW_RET_ERROR, rmw_shared_memory_chunk_pool_release(&pool, 2u));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_ERROR, rmw_shared_memory_chunk_pool_retain(&pool, 2u));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_shared_memory_chunk_pool_release(&pool, 4u));
+  rmw_reset_error();
+
+  ASSERT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_acquire(&pool, 7u, &chunk_index));
+  EXPECT_EQ(2u, chunk_index);
+  for (size_t index : acquired) {
+    EXPECT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_release(&pool, index));
+  }
+}
+
+TEST_F(TestSharedMemoryChunkPool, chunk_addresses) {
+  std::set<uintptr_t> addresses;
+  for (size_t i = 0u; i < pool.chunk_count; ++i) {
+    void * chunk = rmw_shared_memory_chunk_pool_get_chunk(&pool, i);
+    ASSERT_NE(nullptr, chunk);
+    EXPECT_EQ(
+      0u, reinterpret_cast<uintptr_t>(chunk) % RMW_SHARED_MEMORY_CHUNK_POOL_CHUNK_ALIGNMENT);
+    std::memset(chunk, static_cast<int>(i), pool.chunk_size);
+    size_t chunk_index = pool.chunk_count;
+    ASSERT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_get_chunk_index(&pool, chunk, &chunk_index));
+    EXPECT_EQ(i, chunk_index);
+    addresses.insert(reinterpret_cast<uintptr_t>(chunk));
+  }
+  EXPECT_EQ(pool.chunk_count, addresses.size());
+  EXPECT_EQ(nullptr, rmw_shared_memory_chunk_pool_get_chunk(&pool, pool.chunk_count));
+
+  size_t chunk_index = 0u;
+  uint8_t * chunk = static_cast<uint8_t *>(rmw_shared_memory_chunk_pool_get_chunk(&pool, 1u));
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_shared_memory_chunk_pool_get_chunk_index(&pool, chunk + 1, &chunk_index));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_shared_memory_chunk_pool_get_chunk_index(&pool, &chunk_index, &chunk_index));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_shared_memory_chunk_pool_get_chunk_index(&pool, chunk, nullptr));
+  rmw_reset_error();
+
+  // Another mapping of the segment sees the same chunks and chunk states.
+  rmw_shared_memory_chunk_pool_t other_pool = rmw_get_zero_initialized_shared_memory_chunk_pool();
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_shared_memory_chunk_pool_attach_file_descriptor(&other_pool, pool.file_descriptor)) <<
+    rmw_get_error_string().str;
+  EXPECT_FALSE(other_pool.is_creator);
+  EXPECT_NE(pool.file_descriptor, other_pool.file_descriptor);
+  EXPECT_EQ(pool.chunk_size, other_pool.chunk_size);
+  EXPECT_EQ(pool.chunk_count, other_pool.chunk_count);
+  const uint8_t * other_chunk =
+    static_cast<uint8_t *>(rmw_shared_memory_chunk_pool_get_chunk(&other_pool, 3u));
+  ASSERT_NE(nullptr, other_chunk);
+  EXPECT_EQ(3u, other_chunk[pool.chunk_size - 1u]);
+
+  ASSERT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_acquire(&other_pool, 5u, &chunk_index));
+  uint32_t reference_count = 0u;
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_shared_memory_chunk_pool_get_chunk_state(&pool, chunk_index, &reference_count, nullptr));
+  EXPECT_EQ(1u, reference_count);
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_release(&pool, chunk_index));
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_fini(&other_pool)) <<
+    rmw_get_error_string().str;
+}
+
+TEST_F(TestSharedMemoryChunkPool, reclaim) {
+  size_t chunk_indices[4];
+  const uint32_t owners[4] = {1u, 2u, 1u, 2u};
+  for (size_t i = 0u; i < 4u; ++i) {
+    ASSERT_EQ(
+      RMW_RET_OK, rmw_shared_memory_chunk_pool_acquire(&pool, owners[i], &chunk_indices[i]));
+  }
+  ASSERT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_retain(&pool, chunk_indices[0]));
+
+  size_t reclaimed_count = 0u;
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_shared_memory_chunk_pool_reclaim(&pool, 0u, nullptr));
+  rmw_reset_error();
+  ASSERT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_reclaim(&pool, 1u, &reclaimed_count));
+  EXPECT_EQ(2u, reclaimed_count);
+  ASSERT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_reclaim(&pool, 1u, &reclaimed_count));
+  EXPECT_EQ(0u, reclaimed_count);
+
+  // Releasing a reclaimed chunk fails rather than freeing it twice.
+  EXPECT_EQ(RMW_RET_ERROR, rmw_shared_memory_chunk_pool_release(&pool, chunk_indices[0]));
+  rmw_reset_error();
+  size_t chunk_index = 0u;
+  ASSERT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_acquire(&pool, 3u, &chunk_index));
+  ASSERT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_acquire(&pool, 3u, &chunk_index));
+  EXPECT_EQ(RMW_RET_ERROR, rmw_shared_memory_chunk_pool_acquire(&pool, 3u, &chunk_index));
+  rmw_reset_error();
+  ASSERT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_reclaim(&pool, 2u, &reclaimed_count));
+  EXPECT_EQ(2u, reclaimed_count);
+  ASSERT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_reclaim(&pool, 3u, &reclaimed_count));
+  EXPECT_EQ(2u, reclaimed_count);
+}
+
+TEST_F(TestSharedMemoryChunkPool, concurrent_acquire_release) {
+  std::vector<std::thread> threads;
+  std::vector<int> failures(4u, 0);
+  for (size_t t = 0u; t < failures.size(); ++t) {
+    threads.emplace_back(
+      [this, &failures, t]() {
+        const uint32_t owner = static_cast<uint32_t>(t + 1u);
+        for (size_t i = 0u; i < 10000u; ++i) {
+          size_t chunk_index = 0u;
+          rmw_ret_t ret = rmw_shared_memory_chunk_pool_acquire(&pool, owner, &chunk_index);
+          if (RMW_RET_ERROR == ret) {
+            // More threads than chunks, the pool may be exhausted for a moment.
+            rmw_reset_error();
+            continue;
+          }
+          uint32_t reference_count = 0u;
+          uint32_t chunk_owner = 0u;
+          if (
+            RMW_RET_OK != ret ||
+            RMW_RET_OK != rmw_shared_memory_chunk_pool_get_chunk_state(
+              &pool, chunk_index, &reference_count, &chunk_owner) ||
+            1u != reference_count || owner != chunk_owner ||
+            RMW_RET_OK != rmw_shared_memory_chunk_pool_release(&pool, chunk_index))
+          {
+            ++failures[t];
+          }
+        }
+      });
+  }
+  for (std::thread & thread : threads) {
+    thread.join();
+  }
+  for (int thread_failures : failures) {
+    EXPECT_EQ(0, thread_failures);
+  }
+
+  // Every chunk made it back to the free list exactly once.
+  std::set<size_t> acquired;
+  size_t chunk_index = 0u;
+  while (RMW_RET_OK == rmw_shared_memory_chunk_pool_acquire(&pool, 1u, &chunk_index)) {
+    EXPECT_TRUE(acquired.insert(chunk_index).second);
+  }
+  rmw_reset_error();
+  EXPECT_EQ(pool.chunk_count, acquired.size());
+  size_t reclaimed_count = 0u;
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_reclaim(&pool, 1u, &reclaimed_count));
+  EXPECT_EQ(pool.chunk_count, reclaimed_count);
+}
+
+TEST(test_shared_memory_chunk_pool, named_segment) {
+  const std::string name = "/rmw_test_chunk_pool_" + std::to_string(getpid());
+  rmw_shared_memory_chunk_pool_t pool = rmw_get_zero_initialized_shared_memory_chunk_pool();
+  rmw_ret_t ret = rmw_shared_memory_chunk_pool_create(&pool, name.c_str(), 64u, 2u);
+  if (RMW_RET_UNSUPPORTED == ret) {
+    rmw_reset_error();
+    GTEST_SKIP() << "shared memory chunk pools are not supported on this platform";
+  }
+  ASSERT_EQ(RMW_RET_OK, ret) << rmw_get_error_string().str;
+  EXPECT_EQ(name, pool.name);
+
+  rmw_shared_memory_chunk_pool_t duplicate = rmw_get_zero_initialized_shared_memory_chunk_pool();
+  EXPECT_EQ(
+    RMW_RET_BAD_ALLOC, rmw_shared_memory_chunk_pool_create(&duplicate, name.c_str(), 64u, 2u));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_shared_memory_chunk_pool_create(&duplicate, "name", 64u, 2u));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT, rmw_shared_memory_chunk_pool_attach(&duplicate, "/a/b"));
+  rmw_reset_error();
+
+  rmw_shared_memory_chunk_pool_t attached = rmw_get_zero_initialized_shared_memory_chunk_pool();
+  ASSERT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_attach(&attached, name.c_str())) <<
+    rmw_get_error_string().str;
+  EXPECT_FALSE(attached.is_creator);
+  EXPECT_EQ(2u, attached.chunk_count);
+  size_t chunk_index = 0u;
+  ASSERT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_acquire(&attached, 9u, &chunk_index));
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_fini(&attached));
+
+  // Detaching does not give chunks back.
+  ASSERT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_acquire(&pool, 9u, &chunk_index));
+  EXPECT_EQ(RMW_RET_ERROR, rmw_shared_memory_chunk_pool_acquire(&pool, 9u, &chunk_index));
+  rmw_reset_error();
+
+  // The name is unlinked once its creator is finalized.
+  EXPECT_EQ(RMW_RET_OK, rmw_shared_memory_chunk_pool_fini(&pool));
+  EXPECT_EQ(RMW_RET_ERROR, rmw_shared_memory_chunk_pool_attach(&attached, name.c_str()));
+  rmw_reset_error();
+}
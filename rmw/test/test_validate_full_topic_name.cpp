@@ -17,6 +17,7 @@
 #include "gmock/gmock.h"
 
 #include "rmw/error_handling.h"
+#include "rmw/impl/cpp/validate_full_topic_name.hpp"
 #include "rmw/validate_full_topic_name.h"
 
 TEST(test_validate_topic_name, invalid_parameters) {
@@ -208,6 +209,41 @@ TEST(test_validate_topic_name, starts_with_number) {
   ASSERT_NE((char *)nullptr, rmw_full_topic_name_validation_result_string(validation_result));
 }
 
+TEST(test_validate_topic_name, first_error_in_long_topic) {
+  int validation_result;
+  size_t invalid_index;
+  rmw_ret_t ret;
+
+  // Unallowed characters take precedence over earlier repeated slashes
+  ret = rmw_validate_full_topic_name(
+    "/robot//arm_controller/follow_joint_trajectory/feedback-", &validation_result,
+    &invalid_index);
+  ASSERT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(RMW_TOPIC_INVALID_CONTAINS_UNALLOWED_CHARACTERS, validation_result);
+  EXPECT_EQ(55ul, invalid_index);
+
+  // The first of several errors is reported
+  ret = rmw_validate_full_topic_name(
+    "/robot/arm_controller/follow_joint_trajectory/1feedback//status", &validation_result,
+    &invalid_index);
+  ASSERT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(RMW_TOPIC_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER, validation_result);
+  EXPECT_EQ(46ul, invalid_index);
+
+  // Errors straddling a 16 bytes boundary
+  ret = rmw_validate_full_topic_name(
+    "/fifteen_chars_/" "/after_the_boundary", &validation_result, &invalid_index);
+  ASSERT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(RMW_TOPIC_INVALID_CONTAINS_REPEATED_FORWARD_SLASH, validation_result);
+  EXPECT_EQ(16ul, invalid_index);
+
+  // Bytes beyond the given size are not looked at
+  const char * topic_name = "/a_topic_name_longer_than_16/with$_beyond";
+  ret = rmw_validate_full_topic_name_with_size(topic_name, 33u, &validation_result, nullptr);
+  ASSERT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(RMW_TOPIC_VALID, validation_result);
+}
+
 TEST(test_validate_topic_name, topic_too_long) {
   int validation_result;
   size_t invalid_index;
@@ -244,3 +280,95 @@ TEST(test_validate_topic_name, topic_too_long) {
 
   ASSERT_NE((char *)nullptr, rmw_full_topic_name_validation_result_string(validation_result));
 }
+
+TEST(test_validate_topic_name, batch) {
+  const char * topic_names[] = {"/foo", "foo", "/foo/", "/foo//bar", "/foo/bar"};
+  size_t topic_name_lengths[] = {4, 3, 5, 9, 4};
+  int validation_results[5];
+  size_t invalid_indices[5] = {42, 42, 42, 42, 42};
+
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_validate_full_topic_names(nullptr, nullptr, 0, nullptr, nullptr));
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_validate_full_topic_names(nullptr, nullptr, 5, validation_results, invalid_indices));
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_validate_full_topic_names(topic_names, nullptr, 5, nullptr, invalid_indices));
+
+  rmw_ret_t ret = rmw_validate_full_topic_names(
+    topic_names, nullptr, 5, validation_results, invalid_indices);
+  ASSERT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(RMW_TOPIC_VALID, validation_results[0]);
+  EXPECT_EQ(42u, invalid_indices[0]);
+  EXPECT_EQ(RMW_TOPIC_INVALID_NOT_ABSOLUTE, validation_results[1]);
+  EXPECT_EQ(0u, invalid_indices[1]);
+  EXPECT_EQ(RMW_TOPIC_INVALID_ENDS_WITH_FORWARD_SLASH, validation_results[2]);
+  EXPECT_EQ(4u, invalid_indices[2]);
+  EXPECT_EQ(RMW_TOPIC_INVALID_CONTAINS_REPEATED_FORWARD_SLASH, validation_results[3]);
+  EXPECT_EQ(5u, invalid_indices[3]);
+  EXPECT_EQ(RMW_TOPIC_VALID, validation_results[4]);
+  EXPECT_EQ(42u, invalid_indices[4]);
+
+  // with explicit lengths, "/foo/bar" is truncated to "/foo" and "/foo/" is still invalid
+  ret = rmw_validate_full_topic_names(
+    topic_names, topic_name_lengths, 5, validation_results, nullptr);
+  ASSERT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(RMW_TOPIC_VALID, validation_results[0]);
+  EXPECT_EQ(RMW_TOPIC_INVALID_NOT_ABSOLUTE, validation_results[1]);
+  EXPECT_EQ(RMW_TOPIC_INVALID_ENDS_WITH_FORWARD_SLASH, validation_results[2]);
+  EXPECT_EQ(RMW_TOPIC_INVALID_CONTAINS_REPEATED_FORWARD_SLASH, validation_results[3]);
+  EXPECT_EQ(RMW_TOPIC_VALID, validation_results[4]);
+
+  // a null name stops the batch, earlier results are kept
+  validation_results[2] = -1;
+  topic_names[2] = nullptr;
+  ret = rmw_validate_full_topic_names(
+    topic_names, nullptr, 5, validation_results, invalid_indices);
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, ret);
+  EXPECT_EQ(RMW_TOPIC_VALID, validation_results[0]);
+  EXPECT_EQ(RMW_TOPIC_INVALID_NOT_ABSOLUTE, validation_results[1]);
+  EXPECT_EQ(-1, validation_results[2]);
+}
+
+RMW_STATIC_ASSERT_VALID_FULL_TOPIC_NAME("/foo/bar_42");
+
+TEST(test_validate_topic_name, constexpr_matches_runtime) {
+  constexpr auto valid = rmw::impl::cpp::validate_full_topic_name("/foo/bar");
+  static_assert(valid.is_valid(), "topic name should be valid");
+  constexpr auto repeated_slash = rmw::impl::cpp::validate_full_topic_name("/foo//bar");
+  static_assert(
+    RMW_TOPIC_INVALID_CONTAINS_REPEATED_FORWARD_SLASH == repeated_slash.validation_result,
+    "topic name should have a repeated '/'");
+  static_assert(5u == repeated_slash.invalid_index, "repeated '/' should be at index 5");
+
+  // Arrays are only validated up to their first null character
+  char buffer[64] = "/foo/bar";
+  EXPECT_TRUE(rmw::impl::cpp::validate_full_topic_name(buffer).is_valid());
+  buffer[1] = '1';
+  EXPECT_EQ(
+    RMW_TOPIC_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER,
+    rmw::impl::cpp::validate_full_topic_name(buffer).validation_result);
+  constexpr char unterminated[] = {'/', 'f', 'o', 'o'};
+  static_assert(
+    rmw::impl::cpp::validate_full_topic_name(unterminated).is_valid(),
+    "unterminated topic name should be valid");
+
+  const std::string topic_names[] = {
+    "", "foo", "/", "/foo/", "/foo bar", "/foo//bar", "/foo/1bar", "/1foo", "/foo/bar",
+    "/foo/b@r//", "/foo/_bar", "/" + std::string(RMW_TOPIC_MAX_NAME_LENGTH, 'a'),
+    "/" + std::string(RMW_TOPIC_MAX_NAME_LENGTH, 'a') + "/1",
+  };
+  for (const std::string & topic_name : topic_names) {
+    int validation_result;
+    size_t invalid_index = 0u;
+    ASSERT_EQ(
+      RMW_RET_OK,
+      rmw_validate_full_topic_name(topic_name.c_str(), &validation_result, &invalid_index));
+    auto validation = rmw::impl::cpp::validate_full_topic_name(
+      topic_name.c_str(), topic_name.size());
+    EXPECT_EQ(validation_result, validation.validation_result) << topic_name;
+    EXPECT_EQ(invalid_index, validation.invalid_index) << topic_name;
+  }
+}
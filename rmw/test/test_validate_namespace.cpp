@@ -67,6 +67,30 @@ TEST(test_validate_namespace, valid_namespace) {
   ASSERT_EQ((char *)nullptr, rmw_namespace_validation_result_string(validation_result));
 }
 
+TEST(test_validate_namespace, with_size) {
+  int validation_result;
+  size_t invalid_index;
+  rmw_ret_t ret;
+
+  // Only the given number of characters is validated
+  const char namespace_[] = "/robot_1/arm/{unexpanded}";
+  ret = rmw_validate_namespace_with_size(namespace_, 12u, &validation_result, &invalid_index);
+  ASSERT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(RMW_NAMESPACE_VALID, validation_result);
+
+  ret = rmw_validate_namespace_with_size(namespace_, 13u, &validation_result, &invalid_index);
+  ASSERT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(RMW_NAMESPACE_INVALID_ENDS_WITH_FORWARD_SLASH, validation_result);
+  EXPECT_EQ(12u, invalid_index);
+
+  // Including when the namespace is not null terminated
+  const char unterminated_namespace[] = {'/', 'r', 'o', 'b', 'o', 't'};
+  ret = rmw_validate_namespace_with_size(
+    unterminated_namespace, sizeof(unterminated_namespace), &validation_result, &invalid_index);
+  ASSERT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(RMW_NAMESPACE_VALID, validation_result);
+}
+
 TEST(test_validate_namespace, empty_namespace) {
   int validation_result;
   size_t invalid_index;
@@ -242,3 +266,41 @@ TEST(test_validate_namespace, topic_too_long) {
 
   ASSERT_NE((char *)nullptr, rmw_namespace_validation_result_string(validation_result));
 }
+
+TEST(test_validate_namespace, batch) {
+  const char * namespaces[] = {"/", "/foo", "foo", "/foo/", "/7foo"};
+  int validation_results[5];
+  size_t invalid_indices[5] = {42, 42, 42, 42, 42};
+
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_validate_namespaces(nullptr, nullptr, 0, nullptr, nullptr));
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_validate_namespaces(nullptr, nullptr, 5, validation_results, invalid_indices));
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_validate_namespaces(namespaces, nullptr, 5, nullptr, invalid_indices));
+
+  rmw_ret_t ret = rmw_validate_namespaces(
+    namespaces, nullptr, 5, validation_results, invalid_indices);
+  ASSERT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(RMW_NAMESPACE_VALID, validation_results[0]);
+  EXPECT_EQ(42u, invalid_indices[0]);
+  EXPECT_EQ(RMW_NAMESPACE_VALID, validation_results[1]);
+  EXPECT_EQ(42u, invalid_indices[1]);
+  EXPECT_EQ(RMW_NAMESPACE_INVALID_NOT_ABSOLUTE, validation_results[2]);
+  EXPECT_EQ(0u, invalid_indices[2]);
+  EXPECT_EQ(RMW_NAMESPACE_INVALID_ENDS_WITH_FORWARD_SLASH, validation_results[3]);
+  EXPECT_EQ(4u, invalid_indices[3]);
+  EXPECT_EQ(RMW_NAMESPACE_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER, validation_results[4]);
+  EXPECT_EQ(1u, invalid_indices[4]);
+
+  // a null namespace stops the batch, earlier results are kept
+  validation_results[1] = -1;
+  namespaces[1] = nullptr;
+  ret = rmw_validate_namespaces(namespaces, nullptr, 5, validation_results, nullptr);
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, ret);
+  EXPECT_EQ(RMW_NAMESPACE_VALID, validation_results[0]);
+  EXPECT_EQ(-1, validation_results[1]);
+}
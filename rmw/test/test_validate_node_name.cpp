@@ -176,3 +176,49 @@ TEST(test_validate_node_name, node_name_too_long) {
 
   ASSERT_NE((char *)nullptr, rmw_node_name_validation_result_string(validation_result));
 }
+
+TEST(test_validate_node_name, batch) {
+  const char * node_names[] = {"foo", "", "foo/bar", "42foo", "foo_bar"};
+  size_t node_name_lengths[] = {3, 0, 3, 5, 3};
+  int validation_results[5];
+  size_t invalid_indices[5] = {42, 42, 42, 42, 42};
+
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_validate_node_names(nullptr, nullptr, 0, nullptr, nullptr));
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_validate_node_names(nullptr, nullptr, 5, validation_results, invalid_indices));
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_validate_node_names(node_names, nullptr, 5, nullptr, invalid_indices));
+
+  rmw_ret_t ret = rmw_validate_node_names(
+    node_names, nullptr, 5, validation_results, invalid_indices);
+  ASSERT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(RMW_NODE_NAME_VALID, validation_results[0]);
+  EXPECT_EQ(42u, invalid_indices[0]);
+  EXPECT_EQ(RMW_NODE_NAME_INVALID_IS_EMPTY_STRING, validation_results[1]);
+  EXPECT_EQ(0u, invalid_indices[1]);
+  EXPECT_EQ(RMW_NODE_NAME_INVALID_CONTAINS_UNALLOWED_CHARACTERS, validation_results[2]);
+  EXPECT_EQ(3u, invalid_indices[2]);
+  EXPECT_EQ(RMW_NODE_NAME_INVALID_STARTS_WITH_NUMBER, validation_results[3]);
+  EXPECT_EQ(0u, invalid_indices[3]);
+  EXPECT_EQ(RMW_NODE_NAME_VALID, validation_results[4]);
+  EXPECT_EQ(42u, invalid_indices[4]);
+
+  // with explicit lengths, "foo/bar" is truncated to "foo"
+  ret = rmw_validate_node_names(
+    node_names, node_name_lengths, 5, validation_results, nullptr);
+  ASSERT_EQ(RMW_RET_OK, ret);
+  EXPECT_EQ(RMW_NODE_NAME_VALID, validation_results[2]);
+  EXPECT_EQ(RMW_NODE_NAME_INVALID_STARTS_WITH_NUMBER, validation_results[3]);
+
+  // a null node name stops the batch, earlier results are kept
+  validation_results[1] = -1;
+  node_names[1] = nullptr;
+  ret = rmw_validate_node_names(node_names, nullptr, 5, validation_results, nullptr);
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, ret);
+  EXPECT_EQ(RMW_NODE_NAME_VALID, validation_results[0]);
+  EXPECT_EQ(-1, validation_results[1]);
+}
@@ -0,0 +1,256 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BENCHMARK_COMMON_HPP_
+#define BENCHMARK_COMMON_HPP_
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rcutils/allocator.h"
+#include "rcutils/strdup.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/init.h"
+#include "rmw/init_options.h"
+#include "rmw/rmw.h"
+
+#include "rmw_native_common/testing/type_supports.hpp"
+
+#include "rosidl_runtime_c/message_type_support_struct.h"
+#include "rosidl_runtime_c/primitives_sequence.h"
+#include "rosidl_runtime_c/primitives_sequence_functions.h"
+#include "rosidl_runtime_c/service_type_support_struct.h"
+#include "rosidl_typesupport_introspection_c/field_types.h"
+#include "rosidl_typesupport_introspection_c/message_introspection.h"
+#include "rosidl_typesupport_introspection_c/service_introspection.h"
+
+// Type supports are put together with the helpers of rmw_native_common,
+// so that benchmarks do not depend on any interface package.
+
+namespace benchmark_common
+{
+
+/// Message carrying an opaque payload, of a size chosen by each benchmark.
+struct Payload
+{
+  uint64_t sequence_number;
+  rosidl_runtime_c__uint8__Sequence data;
+};
+
+inline bool
+init_payload(Payload * payload, size_t size)
+{
+  payload->sequence_number = 0u;
+  if (!rosidl_runtime_c__uint8__Sequence__init(&payload->data, size)) {
+    return false;
+  }
+  std::fill_n(payload->data.data, size, static_cast<uint8_t>(0x5a));
+  return true;
+}
+
+inline void
+fini_payload(Payload * payload)
+{
+  rosidl_runtime_c__uint8__Sequence__fini(&payload->data);
+}
+
+namespace detail
+{
+
+inline rosidl_typesupport_introspection_c__MessageMembers
+make_payload_members(const char * message_namespace, const char * message_name)
+{
+  static const rosidl_typesupport_introspection_c__MessageMember members[] = {
+    rmw_native_common::testing::make_member(
+      "sequence_number", rosidl_typesupport_introspection_c__ROS_TYPE_UINT64,
+      offsetof(Payload, sequence_number)),
+    rmw_native_common::testing::make_sequence_member<
+      rosidl_runtime_c__uint8__Sequence,
+      rosidl_runtime_c__uint8__Sequence__init,
+      rosidl_runtime_c__uint8__Sequence__fini>(
+      "data", rosidl_typesupport_introspection_c__ROS_TYPE_UINT8, offsetof(Payload, data)),
+  };
+  return rmw_native_common::testing::make_message_members(
+    message_namespace, message_name, sizeof(Payload), members, 2u);
+}
+
+}  // namespace detail
+
+/// Type support of Payload, as "benchmark_msgs/msg/Payload".
+inline const rosidl_message_type_support_t *
+get_payload_type_support()
+{
+  static const rosidl_typesupport_introspection_c__MessageMembers message_members =
+    detail::make_payload_members("benchmark_msgs__msg", "Payload");
+  static const rosidl_message_type_support_t type_support =
+    rmw_native_common::testing::make_message_type_support(&message_members);
+  return &type_support;
+}
+
+/// Type support of Echo, as "benchmark_msgs/srv/Echo", with a Payload as request and response.
+inline const rosidl_service_type_support_t *
+get_echo_type_support()
+{
+  static const rosidl_typesupport_introspection_c__MessageMembers request =
+    detail::make_payload_members("benchmark_msgs__srv", "Echo_Request");
+  static const rosidl_typesupport_introspection_c__MessageMembers response =
+    detail::make_payload_members("benchmark_msgs__srv", "Echo_Response");
+  static const rosidl_typesupport_introspection_c__ServiceMembers service_members =
+    rmw_native_common::testing::make_service_members(
+    "benchmark_msgs__srv", "Echo", &request, &response);
+  static const rosidl_service_type_support_t type_support =
+    rmw_native_common::testing::make_service_type_support(&service_members);
+  return &type_support;
+}
+
+/// Name unique to this process, so that benchmarks running side by side do not see each other.
+inline std::string
+make_unique_name(const char * name)
+{
+  return std::string("/rmw_benchmark_") + std::to_string(::getpid()) + "/" + name;
+}
+
+/// Time to wait for discovery, or for any single message, before giving up.
+constexpr std::chrono::seconds kTimeout{10};
+
+inline rmw_time_t
+to_rmw_time(std::chrono::nanoseconds duration)
+{
+  return {
+    static_cast<uint64_t>(duration.count() / 1000000000),
+    static_cast<uint64_t>(duration.count() % 1000000000)};
+}
+
+/// Report latency percentiles of the samples as counters, in nanoseconds.
+/**
+ * Samples are sorted in place.
+ */
+inline void
+set_percentile_counters(benchmark::State & st, std::vector<int64_t> & samples)
+{
+  if (samples.empty()) {
+    return;
+  }
+  std::sort(samples.begin(), samples.end());
+  auto percentile = [&samples](double fraction) {
+      const size_t index = static_cast<size_t>(fraction * static_cast<double>(samples.size() - 1u));
+      return static_cast<double>(samples[index]);
+    };
+  st.counters["p50_ns"] = percentile(0.50);
+  st.counters["p90_ns"] = percentile(0.90);
+  st.counters["p99_ns"] = percentile(0.99);
+  st.counters["max_ns"] = static_cast<double>(samples.back());
+}
+
+/// Fixture providing an initialized context and a node of the implementation under test.
+class PerformanceTestRmw : public performance_test_fixture::PerformanceTest
+{
+public:
+  void SetUp(benchmark::State & st) override
+  {
+    // Results of all implementations can then be told apart in the same report.
+    st.SetLabel(rmw_get_implementation_identifier());
+    context = rmw_get_zero_initialized_context();
+    rmw_init_options_t options = rmw_get_zero_initialized_init_options();
+    if (RMW_RET_OK != rmw_init_options_init(&options, rcutils_get_default_allocator())) {
+      st.SkipWithError(rmw_get_error_string().str);
+      return;
+    }
+    options.enclave = rcutils_strdup("/", rcutils_get_default_allocator());
+    const rmw_ret_t ret = rmw_init(&options, &context);
+    if (RMW_RET_OK != rmw_init_options_fini(&options) || RMW_RET_OK != ret) {
+      st.SkipWithError(rmw_get_error_string().str);
+      return;
+    }
+    node = rmw_create_node(&context, "rmw_benchmark", "/");
+    if (nullptr == node) {
+      st.SkipWithError(rmw_get_error_string().str);
+      return;
+    }
+    performance_test_fixture::PerformanceTest::SetUp(st);
+  }
+
+  void TearDown(benchmark::State & st) override
+  {
+    performance_test_fixture::PerformanceTest::TearDown(st);
+    if (nullptr != node && RMW_RET_OK != rmw_destroy_node(node)) {
+      st.SkipWithError(rmw_get_error_string().str);
+    }
+    node = nullptr;
+    if (nullptr != context.impl &&
+      (RMW_RET_OK != rmw_shutdown(&context) || RMW_RET_OK != rmw_context_fini(&context)))
+    {
+      st.SkipWithError(rmw_get_error_string().str);
+    }
+    rmw_reset_error();
+  }
+
+protected:
+  /// Wait until the publisher and the subscription discovered each other.
+  bool
+  wait_for_match(const rmw_publisher_t * publisher, const rmw_subscription_t * subscription)
+  {
+    const auto deadline = std::chrono::steady_clock::now() + kTimeout;
+    do {
+      size_t subscription_count = 0u;
+      size_t publisher_count = 0u;
+      if (RMW_RET_OK !=
+        rmw_publisher_count_matched_subscriptions(publisher, &subscription_count) ||
+        RMW_RET_OK != rmw_subscription_count_matched_publishers(subscription, &publisher_count))
+      {
+        return false;
+      }
+      if (subscription_count > 0u && publisher_count > 0u) {
+        return true;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    } while (std::chrono::steady_clock::now() < deadline);
+    return false;
+  }
+
+  /// Wait until the client discovered a server.
+  bool
+  wait_for_server(const rmw_client_t * client)
+  {
+    const auto deadline = std::chrono::steady_clock::now() + kTimeout;
+    do {
+      bool is_available = false;
+      if (RMW_RET_OK != rmw_service_server_is_available(node, client, &is_available)) {
+        return false;
+      }
+      if (is_available) {
+        return true;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    } while (std::chrono::steady_clock::now() < deadline);
+    return false;
+  }
+
+  rmw_context_t context;
+  rmw_node_t * node{nullptr};
+};
+
+}  // namespace benchmark_common
+
+#endif  // BENCHMARK_COMMON_HPP_
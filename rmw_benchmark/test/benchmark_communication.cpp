@@ -0,0 +1,419 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rmw/error_handling.h"
+#include "rmw/qos_profiles.h"
+#include "rmw/rmw.h"
+
+#include "./benchmark_common.hpp"
+
+using benchmark_common::Payload;
+
+namespace
+{
+// Payload sizes, in bytes.
+constexpr int64_t kMinPayloadSize = 64;
+constexpr int64_t kMaxPayloadSize = 32 * 1024;
+
+// Iterations of each latency benchmark, fixed so that all samples can be kept.
+constexpr size_t kLatencyIterations = 5000u;
+
+// Messages published back to back before any of them is taken.
+constexpr size_t kBurstSize = 64u;
+
+std::chrono::nanoseconds
+elapsed_since(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::steady_clock::now() - start;
+}
+
+class PerformanceTestPubSub : public benchmark_common::PerformanceTestRmw
+{
+public:
+  void SetUp(benchmark::State & st) override
+  {
+    PerformanceTestRmw::SetUp(st);
+    if (nullptr == node) {
+      return;
+    }
+    const size_t size = static_cast<size_t>(st.range(0));
+    if (!benchmark_common::init_payload(&message, size) ||
+      !benchmark_common::init_payload(&received, 0u))
+    {
+      st.SkipWithError("failed to initialize payloads");
+      return;
+    }
+    // Reliable and deep enough for a whole burst, so that no message is ever dropped.
+    rmw_qos_profile_t qos = rmw_qos_profile_default;
+    qos.reliability = RMW_QOS_POLICY_RELIABILITY_RELIABLE;
+    qos.history = RMW_QOS_POLICY_HISTORY_KEEP_LAST;
+    qos.depth = 2u * kBurstSize;
+    const std::string topic_name = benchmark_common::make_unique_name("payload");
+    rmw_publisher_options_t publisher_options = rmw_get_default_publisher_options();
+    publisher = rmw_create_publisher(
+      node, benchmark_common::get_payload_type_support(), topic_name.c_str(), &qos,
+      &publisher_options);
+    rmw_subscription_options_t subscription_options = rmw_get_default_subscription_options();
+    subscription = rmw_create_subscription(
+      node, benchmark_common::get_payload_type_support(), topic_name.c_str(), &qos,
+      &subscription_options);
+    wait_set = rmw_create_wait_set(&context, 1u);
+    if (nullptr == publisher || nullptr == subscription || nullptr == wait_set) {
+      st.SkipWithError(rmw_get_error_string().str);
+      return;
+    }
+    if (!wait_for_match(publisher, subscription)) {
+      st.SkipWithError("publisher and subscription did not match");
+    }
+  }
+
+  void TearDown(benchmark::State & st) override
+  {
+    if (nullptr != wait_set && RMW_RET_OK != rmw_destroy_wait_set(wait_set)) {
+      st.SkipWithError(rmw_get_error_string().str);
+    }
+    if (nullptr != subscription && RMW_RET_OK != rmw_destroy_subscription(node, subscription)) {
+      st.SkipWithError(rmw_get_error_string().str);
+    }
+    if (nullptr != publisher && RMW_RET_OK != rmw_destroy_publisher(node, publisher)) {
+      st.SkipWithError(rmw_get_error_string().str);
+    }
+    wait_set = nullptr;
+    subscription = nullptr;
+    publisher = nullptr;
+    benchmark_common::fini_payload(&message);
+    benchmark_common::fini_payload(&received);
+    PerformanceTestRmw::TearDown(st);
+  }
+
+protected:
+  /// Block until the subscription has a message, or the timeout expires.
+  bool wait_for_message()
+  {
+    void * subscription_handles[] = {subscription->data};
+    rmw_subscriptions_t subscriptions = {1u, subscription_handles};
+    rmw_time_t timeout = benchmark_common::to_rmw_time(benchmark_common::kTimeout);
+    return RMW_RET_OK ==
+           rmw_wait(&subscriptions, nullptr, nullptr, nullptr, nullptr, wait_set, &timeout);
+  }
+
+  Payload message{};
+  Payload received{};
+  rmw_publisher_t * publisher{nullptr};
+  rmw_subscription_t * subscription{nullptr};
+  rmw_wait_set_t * wait_set{nullptr};
+};
+}  // namespace
+
+// Time from publishing a message to having taken it, both from the same thread.
+BENCHMARK_DEFINE_F(PerformanceTestPubSub, publish_take_latency)(benchmark::State & st)
+{
+  std::vector<int64_t> samples;
+  samples.reserve(kLatencyIterations);
+  reset_heap_counters();
+  for (auto _ : st) {
+    const auto start = std::chrono::steady_clock::now();
+    ++message.sequence_number;
+    if (RMW_RET_OK != rmw_publish(publisher, &message, nullptr)) {
+      st.SkipWithError(rmw_get_error_string().str);
+      break;
+    }
+    bool taken = false;
+    while (!taken) {
+      if (!wait_for_message()) {
+        st.SkipWithError("timed out waiting for a message");
+        break;
+      }
+      if (RMW_RET_OK != rmw_take(subscription, &received, &taken, nullptr)) {
+        st.SkipWithError(rmw_get_error_string().str);
+        break;
+      }
+    }
+    if (!taken) {
+      break;
+    }
+    samples.push_back(elapsed_since(start).count());
+  }
+  benchmark_common::set_percentile_counters(st, samples);
+  st.SetBytesProcessed(static_cast<int64_t>(st.iterations()) * st.range(0));
+}
+BENCHMARK_REGISTER_F(PerformanceTestPubSub, publish_take_latency)
+->RangeMultiplier(8)->Range(kMinPayloadSize, kMaxPayloadSize)
+->Iterations(kLatencyIterations)->Unit(benchmark::kMicrosecond);
+
+// Bursts of messages published back to back, then all taken.
+BENCHMARK_DEFINE_F(PerformanceTestPubSub, publish_take_throughput)(benchmark::State & st)
+{
+  reset_heap_counters();
+  for (auto _ : st) {
+    for (size_t i = 0u; i < kBurstSize; ++i) {
+      ++message.sequence_number;
+      if (RMW_RET_OK != rmw_publish(publisher, &message, nullptr)) {
+        st.SkipWithError(rmw_get_error_string().str);
+        break;
+      }
+    }
+    size_t taken_count = 0u;
+    while (taken_count < kBurstSize) {
+      bool taken = false;
+      if (RMW_RET_OK != rmw_take(subscription, &received, &taken, nullptr)) {
+        st.SkipWithError(rmw_get_error_string().str);
+        break;
+      }
+      if (taken) {
+        ++taken_count;
+      } else if (!wait_for_message()) {
+        st.SkipWithError("timed out waiting for a message");
+        break;
+      }
+    }
+    if (taken_count < kBurstSize) {
+      break;
+    }
+  }
+  const int64_t message_count = static_cast<int64_t>(st.iterations() * kBurstSize);
+  st.SetItemsProcessed(message_count);
+  st.SetBytesProcessed(message_count * st.range(0));
+}
+BENCHMARK_REGISTER_F(PerformanceTestPubSub, publish_take_throughput)
+->RangeMultiplier(8)->Range(kMinPayloadSize, kMaxPayloadSize)->Unit(benchmark::kMicrosecond);
+
+namespace
+{
+class PerformanceTestWait : public benchmark_common::PerformanceTestRmw
+{
+public:
+  void SetUp(benchmark::State & st) override
+  {
+    PerformanceTestRmw::SetUp(st);
+    if (nullptr == node) {
+      return;
+    }
+    guard_condition = rmw_create_guard_condition(&context);
+    wait_set = rmw_create_wait_set(&context, 1u);
+    if (nullptr == guard_condition || nullptr == wait_set) {
+      st.SkipWithError(rmw_get_error_string().str);
+    }
+  }
+
+  void TearDown(benchmark::State & st) override
+  {
+    if (nullptr != wait_set && RMW_RET_OK != rmw_destroy_wait_set(wait_set)) {
+      st.SkipWithError(rmw_get_error_string().str);
+    }
+    if (nullptr != guard_condition && RMW_RET_OK != rmw_destroy_guard_condition(guard_condition)) {
+      st.SkipWithError(rmw_get_error_string().str);
+    }
+    wait_set = nullptr;
+    guard_condition = nullptr;
+    PerformanceTestRmw::TearDown(st);
+  }
+
+protected:
+  rmw_guard_condition_t * guard_condition{nullptr};
+  rmw_wait_set_t * wait_set{nullptr};
+};
+}  // namespace
+
+// Time from triggering a guard condition in one thread to rmw_wait() returning in another.
+BENCHMARK_DEFINE_F(PerformanceTestWait, wait_wake_up_latency)(benchmark::State & st)
+{
+  // The triggering thread is handed one round at a time, and gives the waiting thread a head
+  // start so that it is blocked in rmw_wait() by the time the guard condition is triggered.
+  std::atomic<size_t> armed_rounds{0u};
+  std::atomic<bool> done{false};
+  std::atomic<int64_t> trigger_time{0};
+  std::thread trigger_thread(
+    [this, &armed_rounds, &done, &trigger_time]() {
+      size_t handled_rounds = 0u;
+      while (!done.load()) {
+        if (armed_rounds.load() == handled_rounds) {
+          std::this_thread::yield();
+          continue;
+        }
+        ++handled_rounds;
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        trigger_time.store(std::chrono::steady_clock::now().time_since_epoch().count());
+        if (RMW_RET_OK != rmw_trigger_guard_condition(guard_condition)) {
+          // The waiting thread then times out and reports the failure.
+          break;
+        }
+      }
+    });
+
+  std::vector<int64_t> samples;
+  samples.reserve(kLatencyIterations);
+  reset_heap_counters();
+  for (auto _ : st) {
+    void * guard_condition_handles[] = {guard_condition->data};
+    rmw_guard_conditions_t guard_conditions = {1u, guard_condition_handles};
+    rmw_time_t timeout = benchmark_common::to_rmw_time(benchmark_common::kTimeout);
+    armed_rounds.fetch_add(1u);
+    const rmw_ret_t ret =
+      rmw_wait(nullptr, &guard_conditions, nullptr, nullptr, nullptr, wait_set, &timeout);
+    const int64_t wake_up_time = std::chrono::steady_clock::now().time_since_epoch().count();
+    if (RMW_RET_OK != ret) {
+      st.SkipWithError("timed out waiting for the guard condition");
+      break;
+    }
+    const int64_t latency = wake_up_time - trigger_time.load();
+    st.SetIterationTime(static_cast<double>(latency) / 1e9);
+    samples.push_back(latency);
+  }
+  done.store(true);
+  trigger_thread.join();
+  benchmark_common::set_percentile_counters(st, samples);
+}
+BENCHMARK_REGISTER_F(PerformanceTestWait, wait_wake_up_latency)
+->Iterations(kLatencyIterations)->UseManualTime()->Unit(benchmark::kMicrosecond);
+
+namespace
+{
+class PerformanceTestService : public benchmark_common::PerformanceTestRmw
+{
+public:
+  void SetUp(benchmark::State & st) override
+  {
+    PerformanceTestRmw::SetUp(st);
+    if (nullptr == node) {
+      return;
+    }
+    const size_t size = static_cast<size_t>(st.range(0));
+    if (!benchmark_common::init_payload(&request, size) ||
+      !benchmark_common::init_payload(&response, size) ||
+      !benchmark_common::init_payload(&taken_request, 0u) ||
+      !benchmark_common::init_payload(&taken_response, 0u))
+    {
+      st.SkipWithError("failed to initialize payloads");
+      return;
+    }
+    const std::string service_name = benchmark_common::make_unique_name("echo");
+    service = rmw_create_service(
+      node, benchmark_common::get_echo_type_support(), service_name.c_str(),
+      &rmw_qos_profile_services_default);
+    client = rmw_create_client(
+      node, benchmark_common::get_echo_type_support(), service_name.c_str(),
+      &rmw_qos_profile_services_default);
+    wait_set = rmw_create_wait_set(&context, 1u);
+    if (nullptr == service || nullptr == client || nullptr == wait_set) {
+      st.SkipWithError(rmw_get_error_string().str);
+      return;
+    }
+    if (!wait_for_server(client)) {
+      st.SkipWithError("service server did not become available");
+    }
+  }
+
+  void TearDown(benchmark::State & st) override
+  {
+    if (nullptr != wait_set && RMW_RET_OK != rmw_destroy_wait_set(wait_set)) {
+      st.SkipWithError(rmw_get_error_string().str);
+    }
+    if (nullptr != client && RMW_RET_OK != rmw_destroy_client(node, client)) {
+      st.SkipWithError(rmw_get_error_string().str);
+    }
+    if (nullptr != service && RMW_RET_OK != rmw_destroy_service(node, service)) {
+      st.SkipWithError(rmw_get_error_string().str);
+    }
+    wait_set = nullptr;
+    client = nullptr;
+    service = nullptr;
+    benchmark_common::fini_payload(&request);
+    benchmark_common::fini_payload(&response);
+    benchmark_common::fini_payload(&taken_request);
+    benchmark_common::fini_payload(&taken_response);
+    PerformanceTestRmw::TearDown(st);
+  }
+
+protected:
+  Payload request{};
+  Payload response{};
+  Payload taken_request{};
+  Payload taken_response{};
+  rmw_service_t * service{nullptr};
+  rmw_client_t * client{nullptr};
+  rmw_wait_set_t * wait_set{nullptr};
+};
+}  // namespace
+
+// Time from sending a request to having taken its response, with the server answering from
+// the same thread, so that only the middleware is measured and not any thread hand-off.
+BENCHMARK_DEFINE_F(PerformanceTestService, service_round_trip)(benchmark::State & st)
+{
+  rmw_time_t timeout = benchmark_common::to_rmw_time(benchmark_common::kTimeout);
+  std::vector<int64_t> samples;
+  samples.reserve(kLatencyIterations);
+  reset_heap_counters();
+  for (auto _ : st) {
+    const auto start = std::chrono::steady_clock::now();
+    int64_t sequence_id = 0;
+    if (RMW_RET_OK != rmw_send_request(client, &request, &sequence_id)) {
+      st.SkipWithError(rmw_get_error_string().str);
+      break;
+    }
+
+    rmw_service_info_t request_header;
+    bool taken = false;
+    while (!taken) {
+      void * service_handles[] = {service->data};
+      rmw_services_t services = {1u, service_handles};
+      if (RMW_RET_OK !=
+        rmw_wait(nullptr, nullptr, &services, nullptr, nullptr, wait_set, &timeout) ||
+        RMW_RET_OK != rmw_take_request(service, &request_header, &taken_request, &taken))
+      {
+        break;
+      }
+    }
+    if (!taken) {
+      st.SkipWithError("failed to take the request");
+      break;
+    }
+    response.sequence_number = taken_request.sequence_number;
+    if (RMW_RET_OK != rmw_send_response(service, &request_header.request_id, &response)) {
+      st.SkipWithError(rmw_get_error_string().str);
+      break;
+    }
+
+    rmw_service_info_t response_header;
+    taken = false;
+    while (!taken) {
+      void * client_handles[] = {client->data};
+      rmw_clients_t clients = {1u, client_handles};
+      if (RMW_RET_OK !=
+        rmw_wait(nullptr, nullptr, nullptr, &clients, nullptr, wait_set, &timeout) ||
+        RMW_RET_OK != rmw_take_response(client, &response_header, &taken_response, &taken))
+      {
+        break;
+      }
+    }
+    if (!taken) {
+      st.SkipWithError("failed to take the response");
+      break;
+    }
+    samples.push_back(elapsed_since(start).count());
+  }
+  benchmark_common::set_percentile_counters(st, samples);
+}
+BENCHMARK_REGISTER_F(PerformanceTestService, service_round_trip)
+->RangeMultiplier(8)->Range(kMinPayloadSize, kMaxPayloadSize)
+->Iterations(kLatencyIterations)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,136 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <string>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rmw/error_handling.h"
+#include "rmw/qos_profiles.h"
+#include "rmw/rmw.h"
+
+#include "./benchmark_common.hpp"
+
+// Only creating entities is timed, destroying them is left out of the measurements.
+
+namespace
+{
+class PerformanceTestEntities : public benchmark_common::PerformanceTestRmw
+{
+public:
+  void SetUp(benchmark::State & st) override
+  {
+    topic_name = benchmark_common::make_unique_name("entities");
+    PerformanceTestRmw::SetUp(st);
+  }
+
+protected:
+  template<typename CreateT, typename DestroyT>
+  void
+  measure_creation(benchmark::State & st, CreateT create, DestroyT destroy)
+  {
+    if (nullptr == node) {
+      return;
+    }
+    reset_heap_counters();
+    for (auto _ : st) {
+      const auto start = std::chrono::steady_clock::now();
+      auto entity = create();
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      if (nullptr == entity) {
+        st.SkipWithError(rmw_get_error_string().str);
+        break;
+      }
+      st.SetIterationTime(elapsed.count());
+      if (RMW_RET_OK != destroy(entity)) {
+        st.SkipWithError(rmw_get_error_string().str);
+        break;
+      }
+    }
+  }
+
+  std::string topic_name;
+};
+}  // namespace
+
+BENCHMARK_DEFINE_F(PerformanceTestEntities, create_node)(benchmark::State & st)
+{
+  measure_creation(
+    st,
+    [this]() {return rmw_create_node(&context, "rmw_benchmark_created", "/");},
+    [](rmw_node_t * created_node) {return rmw_destroy_node(created_node);});
+}
+BENCHMARK_REGISTER_F(PerformanceTestEntities, create_node)
+->UseManualTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(PerformanceTestEntities, create_publisher)(benchmark::State & st)
+{
+  rmw_publisher_options_t options = rmw_get_default_publisher_options();
+  measure_creation(
+    st,
+    [this, &options]() {
+      return rmw_create_publisher(
+        node, benchmark_common::get_payload_type_support(), topic_name.c_str(),
+        &rmw_qos_profile_default, &options);
+    },
+    [this](rmw_publisher_t * publisher) {return rmw_destroy_publisher(node, publisher);});
+}
+BENCHMARK_REGISTER_F(PerformanceTestEntities, create_publisher)
+->UseManualTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(PerformanceTestEntities, create_subscription)(benchmark::State & st)
+{
+  rmw_subscription_options_t options = rmw_get_default_subscription_options();
+  measure_creation(
+    st,
+    [this, &options]() {
+      return rmw_create_subscription(
+        node, benchmark_common::get_payload_type_support(), topic_name.c_str(),
+        &rmw_qos_profile_default, &options);
+    },
+    [this](rmw_subscription_t * subscription) {
+      return rmw_destroy_subscription(node, subscription);
+    });
+}
+BENCHMARK_REGISTER_F(PerformanceTestEntities, create_subscription)
+->UseManualTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(PerformanceTestEntities, create_service)(benchmark::State & st)
+{
+  measure_creation(
+    st,
+    [this]() {
+      return rmw_create_service(
+        node, benchmark_common::get_echo_type_support(), topic_name.c_str(),
+        &rmw_qos_profile_services_default);
+    },
+    [this](rmw_service_t * service) {return rmw_destroy_service(node, service);});
+}
+BENCHMARK_REGISTER_F(PerformanceTestEntities, create_service)
+->UseManualTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(PerformanceTestEntities, create_client)(benchmark::State & st)
+{
+  measure_creation(
+    st,
+    [this]() {
+      return rmw_create_client(
+        node, benchmark_common::get_echo_type_support(), topic_name.c_str(),
+        &rmw_qos_profile_services_default);
+    },
+    [this](rmw_client_t * client) {return rmw_destroy_client(node, client);});
+}
+BENCHMARK_REGISTER_F(PerformanceTestEntities, create_client)
+->UseManualTime()->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,513 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./domain.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "rcutils/time.h"
+
+#include "rmw/error_handling.h"
+
+#include "./identifier.hpp"
+
+namespace rmw_loopback_cpp
+{
+
+Notifier &
+Notifier::get()
+{
+  static Notifier notifier;
+  return notifier;
+}
+
+void
+Notifier::notify()
+{
+  generation_.fetch_add(1u);
+  if (0u != waiter_count_.load()) {
+    // Taking the lock makes sure a waiter either sees the new generation or is woken up.
+    std::lock_guard<std::mutex> lock(mutex_);
+    condition_.notify_all();
+  }
+}
+
+uint64_t
+Notifier::begin_wait()
+{
+  waiter_count_.fetch_add(1u);
+  return generation_.load();
+}
+
+uint64_t
+Notifier::wait(uint64_t generation, const std::chrono::steady_clock::time_point * deadline)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto is_notified = [this, generation]() {return generation_.load() != generation;};
+  if (nullptr == deadline) {
+    condition_.wait(lock, is_notified);
+  } else {
+    condition_.wait_until(lock, *deadline, is_notified);
+  }
+  return generation_.load();
+}
+
+void
+Notifier::end_wait()
+{
+  waiter_count_.fetch_sub(1u);
+}
+
+void
+EventCallback::set(rmw_event_callback_t callback, const void * user_data)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  callback_ = callback;
+  user_data_ = user_data;
+  is_set_.store(nullptr != callback);
+  if (nullptr != callback) {
+    const size_t unread_count = unread_count_.exchange(0u);
+    if (0u != unread_count) {
+      callback(user_data, unread_count);
+    }
+  }
+}
+
+void
+EventCallback::notify()
+{
+  unread_count_.fetch_add(1u);
+  if (!is_set_.load()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  const size_t unread_count = unread_count_.exchange(0u);
+  if (nullptr != callback_ && 0u != unread_count) {
+    callback_(user_data_, unread_count);
+  }
+}
+
+void
+GuardCondition::trigger()
+{
+  triggered.store(true);
+  Notifier::get().notify();
+}
+
+rmw_qos_profile_t
+resolve_qos(const rmw_qos_profile_t & qos)
+{
+  rmw_qos_profile_t actual = qos;
+  if (RMW_QOS_POLICY_HISTORY_KEEP_ALL == actual.history) {
+    actual.depth = keep_all_depth;
+  } else {
+    actual.history = RMW_QOS_POLICY_HISTORY_KEEP_LAST;
+    if (0u == actual.depth) {
+      actual.depth = 1u;
+    }
+  }
+  actual.reliability = RMW_QOS_POLICY_RELIABILITY_RELIABLE;
+  actual.durability = RMW_QOS_POLICY_DURABILITY_VOLATILE;
+  if (RMW_QOS_POLICY_LIVELINESS_SYSTEM_DEFAULT == actual.liveliness ||
+    RMW_QOS_POLICY_LIVELINESS_UNKNOWN == actual.liveliness)
+  {
+    actual.liveliness = RMW_QOS_POLICY_LIVELINESS_AUTOMATIC;
+  }
+  return actual;
+}
+
+namespace
+{
+
+// GIDs hold the id of their entity in their first bytes, the rest is zero.
+uint64_t
+get_entity_id(const uint8_t * gid_data)
+{
+  uint64_t entity_id;
+  memcpy(&entity_id, gid_data, sizeof(entity_id));
+  return entity_id;
+}
+
+template<typename EntityT>
+void
+erase(std::vector<EntityT *> & entities, EntityT * entity)
+{
+  entities.erase(std::remove(entities.begin(), entities.end(), entity), entities.end());
+}
+
+rmw_time_point_value_t
+now()
+{
+  rcutils_time_point_value_t now = 0;
+  (void)rcutils_system_time_now(&now);
+  return now;
+}
+
+template<typename EndpointT>
+void
+append_endpoints_info(
+  const std::vector<EndpointT *> & endpoints,
+  std::vector<rmw_native_common::EndpointInfo> & endpoints_info)
+{
+  endpoints_info.reserve(endpoints.size());
+  for (const EndpointT * endpoint : endpoints) {
+    endpoints_info.push_back(
+      {endpoint->name, endpoint->type_name, endpoint->node->name, endpoint->node->namespace_,
+        endpoint->type_hash, endpoint->qos, endpoint->gid});
+  }
+}
+
+}  // namespace
+
+void
+generate_gid(rmw_gid_t * gid)
+{
+  static std::atomic<uint64_t> next_entity_id{1u};
+  const uint64_t entity_id = next_entity_id.fetch_add(1u, std::memory_order_relaxed);
+  memset(gid, 0, sizeof(*gid));
+  gid->implementation_identifier = identifier;
+  memcpy(gid->data, &entity_id, sizeof(entity_id));
+}
+
+std::shared_ptr<Domain>
+Domain::get(size_t domain_id)
+{
+  static std::mutex mutex;
+  static std::map<size_t, std::weak_ptr<Domain>> domains;
+  std::lock_guard<std::mutex> lock(mutex);
+  std::shared_ptr<Domain> domain = domains[domain_id].lock();
+  if (!domain) {
+    domain = std::make_shared<Domain>();
+    domains[domain_id] = domain;
+  }
+  return domain;
+}
+
+void
+Domain::add(Node * node)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  nodes_.push_back(node);
+  notify_graph_change();
+}
+
+void
+Domain::remove(Node * node)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  erase(nodes_, node);
+  notify_graph_change();
+}
+
+void
+Domain::add(Publisher * publisher)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  publishers_.push_back(publisher);
+  notify_graph_change();
+}
+
+void
+Domain::remove(Publisher * publisher)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  erase(publishers_, publisher);
+  notify_graph_change();
+}
+
+void
+Domain::add(Subscription * subscription)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  subscriptions_.push_back(subscription);
+  subscriptions_by_topic_[subscription->name].push_back(subscription);
+  notify_graph_change();
+}
+
+void
+Domain::remove(Subscription * subscription)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  erase(subscriptions_, subscription);
+  auto it = subscriptions_by_topic_.find(subscription->name);
+  if (subscriptions_by_topic_.end() != it) {
+    erase(it->second, subscription);
+    if (it->second.empty()) {
+      subscriptions_by_topic_.erase(it);
+    }
+  }
+  notify_graph_change();
+}
+
+void
+Domain::add(Service * service)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  services_.push_back(service);
+  services_by_name_[service->name].push_back(service);
+  notify_graph_change();
+}
+
+void
+Domain::remove(Service * service)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  erase(services_, service);
+  auto it = services_by_name_.find(service->name);
+  if (services_by_name_.end() != it) {
+    erase(it->second, service);
+    if (it->second.empty()) {
+      services_by_name_.erase(it);
+    }
+  }
+  notify_graph_change();
+}
+
+void
+Domain::add(Client * client)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  clients_.push_back(client);
+  clients_by_id_[get_entity_id(client->gid.data)] = client;
+  notify_graph_change();
+}
+
+void
+Domain::remove(Client * client)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  erase(clients_, client);
+  clients_by_id_.erase(get_entity_id(client->gid.data));
+  notify_graph_change();
+}
+
+rmw_ret_t
+Domain::publish(Publisher * publisher, const uint8_t * data, size_t length)
+{
+  const rmw_time_point_value_t source_timestamp = now();
+  const uint64_t sequence_number = ++publisher->sequence_number;
+  bool is_delivered = false;
+  bool is_bad_alloc = false;
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = subscriptions_by_topic_.find(publisher->name);
+    if (subscriptions_by_topic_.end() == it) {
+      return RMW_RET_OK;
+    }
+    for (Subscription * subscription : it->second) {
+      if (subscription->type_name != publisher->type_name ||
+        (subscription->ignore_local_publications &&
+        subscription->node->context == publisher->node->context))
+      {
+        continue;
+      }
+      subscription->queue.push(
+        [&](Sample & sample) {
+          try {
+            sample.payload.assign(data, data + length);
+          } catch (const std::bad_alloc &) {
+            // Left empty, the sample fails to deserialize when taken.
+            sample.payload.clear();
+            is_bad_alloc = true;
+          }
+          sample.writer_gid = publisher->gid;
+          sample.source_timestamp = source_timestamp;
+          sample.sequence_number = static_cast<int64_t>(sequence_number);
+        });
+      subscription->on_new_message.notify();
+      is_delivered = true;
+    }
+  }
+  if (is_delivered) {
+    Notifier::get().notify();
+  }
+  return is_bad_alloc ? RMW_RET_BAD_ALLOC : RMW_RET_OK;
+}
+
+rmw_ret_t
+Domain::send_request(
+  Client * client, const uint8_t * data, size_t length, int64_t * sequence_number)
+{
+  const rmw_time_point_value_t source_timestamp = now();
+  *sequence_number = ++client->sequence_number;
+  bool is_delivered = false;
+  bool is_bad_alloc = false;
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = services_by_name_.find(client->name);
+    if (services_by_name_.end() == it) {
+      return RMW_RET_OK;
+    }
+    for (Service * service : it->second) {
+      if (service->type_name != client->type_name) {
+        continue;
+      }
+      service->requests.push(
+        [&](Sample & sample) {
+          try {
+            sample.payload.assign(data, data + length);
+          } catch (const std::bad_alloc &) {
+            sample.payload.clear();
+            is_bad_alloc = true;
+          }
+          sample.writer_gid = client->gid;
+          sample.source_timestamp = source_timestamp;
+          sample.sequence_number = *sequence_number;
+        });
+      service->on_new_request.notify();
+      is_delivered = true;
+    }
+  }
+  if (is_delivered) {
+    Notifier::get().notify();
+  }
+  return is_bad_alloc ? RMW_RET_BAD_ALLOC : RMW_RET_OK;
+}
+
+rmw_ret_t
+Domain::send_response(const rmw_request_id_t & request_id, const uint8_t * data, size_t length)
+{
+  const rmw_time_point_value_t source_timestamp = now();
+  bool is_bad_alloc = false;
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = clients_by_id_.find(get_entity_id(request_id.writer_guid));
+    if (clients_by_id_.end() == it) {
+      return RMW_RET_OK;
+    }
+    Client * client = it->second;
+    client->responses.push(
+      [&](Sample & sample) {
+        try {
+          sample.payload.assign(data, data + length);
+        } catch (const std::bad_alloc &) {
+          sample.payload.clear();
+          is_bad_alloc = true;
+        }
+        sample.writer_gid = client->gid;
+        sample.source_timestamp = source_timestamp;
+        sample.sequence_number = request_id.sequence_number;
+      });
+    client->on_new_response.notify();
+  }
+  Notifier::get().notify();
+  return is_bad_alloc ? RMW_RET_BAD_ALLOC : RMW_RET_OK;
+}
+
+size_t
+Domain::count_matched_subscriptions(const Publisher * publisher) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  auto it = subscriptions_by_topic_.find(publisher->name);
+  if (subscriptions_by_topic_.end() == it) {
+    return 0u;
+  }
+  return static_cast<size_t>(
+    std::count_if(
+      it->second.begin(), it->second.end(),
+      [publisher](const Subscription * subscription) {
+        return subscription->type_name == publisher->type_name;
+      }));
+}
+
+size_t
+Domain::count_matched_publishers(const Subscription * subscription) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return static_cast<size_t>(
+    std::count_if(
+      publishers_.begin(), publishers_.end(),
+      [subscription](const Publisher * publisher) {
+        return publisher->name == subscription->name &&
+        publisher->type_name == subscription->type_name;
+      }));
+}
+
+bool
+Domain::is_service_available(const Client * client) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  auto it = services_by_name_.find(client->name);
+  return services_by_name_.end() != it && std::any_of(
+    it->second.begin(), it->second.end(),
+    [client](const Service * service) {
+      return service->type_name == client->type_name;
+    });
+}
+
+std::vector<rmw_native_common::NodeInfo>
+Domain::get_nodes()
+{
+  std::vector<rmw_native_common::NodeInfo> nodes;
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  nodes.reserve(nodes_.size());
+  for (const Node * node : nodes_) {
+    const char * enclave = node->context->options.enclave;
+    nodes.push_back({node->name, node->namespace_, nullptr != enclave ? enclave : "/"});
+  }
+  return nodes;
+}
+
+std::vector<rmw_native_common::EndpointInfo>
+Domain::get_endpoints(rmw_native_common::EndpointKind kind)
+{
+  std::vector<rmw_native_common::EndpointInfo> endpoints;
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  switch (kind) {
+    case rmw_native_common::EndpointKind::publisher:
+      append_endpoints_info(publishers_, endpoints);
+      break;
+    case rmw_native_common::EndpointKind::subscription:
+      append_endpoints_info(subscriptions_, endpoints);
+      break;
+    case rmw_native_common::EndpointKind::service:
+      append_endpoints_info(services_, endpoints);
+      break;
+    case rmw_native_common::EndpointKind::client:
+      append_endpoints_info(clients_, endpoints);
+      break;
+  }
+  return endpoints;
+}
+
+void
+Domain::notify_graph_change()
+{
+  for (Node * node : nodes_) {
+    node->graph_guard_condition.triggered.store(true);
+  }
+  Notifier::get().notify();
+}
+
+}  // namespace rmw_loopback_cpp
+
+namespace rmw_native_common
+{
+
+Graph &
+get_graph(const rmw_node_t * node)
+{
+  return *static_cast<rmw_loopback_cpp::Node *>(node->data)->domain;
+}
+
+}  // namespace rmw_native_common
@@ -0,0 +1,306 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DOMAIN_HPP_
+#define DOMAIN_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "rmw/event_callback_type.h"
+#include "rmw/init.h"
+#include "rmw/ret_types.h"
+#include "rmw/types.h"
+
+#include "rosidl_runtime_c/type_hash.h"
+
+#include "rmw_native_common/graph.hpp"
+#include "rmw_native_common/type_support.hpp"
+
+#include "./message_queue.hpp"
+
+namespace rmw_loopback_cpp
+{
+
+class Domain;
+
+/// Process wide wake up of rmw_wait() callers, whenever any entity may have become ready.
+/**
+ * Notifying only takes a lock when some thread is actually waiting.
+ */
+class Notifier
+{
+public:
+  static Notifier &
+  get();
+
+  /// Wake up all waiting threads.
+  void
+  notify();
+
+  /// Register the calling thread as a waiter, see wait().
+  /**
+   * \return the generation to pass to wait(), to be taken before checking for ready entities.
+   */
+  uint64_t
+  begin_wait();
+
+  /// Block until notified after `generation` was taken, or until `deadline` if not null.
+  /**
+   * \return the current generation, to be passed to the next wait() call.
+   */
+  uint64_t
+  wait(uint64_t generation, const std::chrono::steady_clock::time_point * deadline);
+
+  /// Unregister the calling thread as a waiter.
+  void
+  end_wait();
+
+private:
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::atomic<uint64_t> generation_{0u};
+  std::atomic<size_t> waiter_count_{0u};
+};
+
+/// On new event callback of a subscription, service or client.
+/**
+ * Events happening while no callback is set are counted, and reported at once
+ * when a callback is set.
+ */
+class EventCallback
+{
+public:
+  void
+  set(rmw_event_callback_t callback, const void * user_data);
+
+  /// Report one new event.
+  void
+  notify();
+
+private:
+  std::mutex mutex_;
+  rmw_event_callback_t callback_{nullptr};
+  const void * user_data_{nullptr};
+  std::atomic<bool> is_set_{false};
+  std::atomic<size_t> unread_count_{0u};
+};
+
+struct GuardCondition
+{
+  /// Whether the guard condition was triggered since it was last waited on.
+  std::atomic<bool> triggered{false};
+
+  void
+  trigger();
+};
+
+struct Node
+{
+  rmw_context_t * context;
+  Domain * domain;
+  std::string name;
+  std::string namespace_;
+  GuardCondition graph_guard_condition;
+  rmw_guard_condition_t graph_guard_condition_handle;
+};
+
+/// Members shared by publishers, subscriptions, services and clients.
+struct Endpoint
+{
+  Node * node;
+  /// Topic or service name.
+  std::string name;
+  std::string type_name;
+  rosidl_type_hash_t type_hash;
+  rmw_qos_profile_t qos;
+  rmw_gid_t gid;
+};
+
+struct Publisher : Endpoint
+{
+  const rmw_native_common::MessageMembers * members;
+  std::atomic<uint64_t> sequence_number{0u};
+};
+
+struct Subscription : Endpoint
+{
+  explicit Subscription(size_t depth)
+  : queue(depth)
+  {}
+
+  const rmw_native_common::MessageMembers * members;
+  bool ignore_local_publications;
+  MessageQueue queue;
+  EventCallback on_new_message;
+};
+
+struct Service : Endpoint
+{
+  explicit Service(size_t depth)
+  : requests(depth)
+  {}
+
+  const rmw_native_common::ServiceMembers * members;
+  MessageQueue requests;
+  EventCallback on_new_request;
+};
+
+struct Client : Endpoint
+{
+  explicit Client(size_t depth)
+  : responses(depth)
+  {}
+
+  const rmw_native_common::ServiceMembers * members;
+  std::atomic<int64_t> sequence_number{0};
+  MessageQueue responses;
+  EventCallback on_new_response;
+};
+
+/// Resolve the system default policies of a QoS profile to the behavior of this implementation.
+/**
+ * Samples are never lost short of history overflow, so reliability is always
+ * reliable, and durability is always volatile as no samples are kept for late
+ * joiners.
+ * Keep all history is bounded to `keep_all_depth` samples.
+ * Deadline, lifespan and liveliness are not enforced.
+ */
+rmw_qos_profile_t
+resolve_qos(const rmw_qos_profile_t & qos);
+
+/// Depth of queues with a keep all history.
+constexpr size_t keep_all_depth = 1000u;
+
+/// Fill a GID unique within the process.
+void
+generate_gid(rmw_gid_t * gid);
+
+/// Entities of all contexts sharing a domain id, which communicate with each other.
+/**
+ * Publishers deliver samples straight into the queues of matching
+ * subscriptions, and so do clients and services with requests and responses.
+ * Matching is done on names and type names, QoS are not checked for compatibility.
+ *
+ * Entities are added and removed under an exclusive lock, while delivering
+ * samples and graph queries only take a shared lock.
+ */
+class Domain : public rmw_native_common::Graph
+{
+public:
+  /// Get the domain with the given id, creating it if no context uses it yet.
+  static std::shared_ptr<Domain>
+  get(size_t domain_id);
+
+  void
+  add(Node * node);
+
+  void
+  remove(Node * node);
+
+  void
+  add(Publisher * publisher);
+
+  void
+  remove(Publisher * publisher);
+
+  void
+  add(Subscription * subscription);
+
+  void
+  remove(Subscription * subscription);
+
+  void
+  add(Service * service);
+
+  void
+  remove(Service * service);
+
+  void
+  add(Client * client);
+
+  void
+  remove(Client * client);
+
+  /// Deliver a serialized message to all matching subscriptions.
+  /**
+   * \return `RMW_RET_OK` if successful, or
+   * \return `RMW_RET_BAD_ALLOC` if the message could not be copied into some subscription queue.
+   */
+  rmw_ret_t
+  publish(Publisher * publisher, const uint8_t * data, size_t length);
+
+  /// Deliver a serialized request to all matching services.
+  rmw_ret_t
+  send_request(Client * client, const uint8_t * data, size_t length, int64_t * sequence_number);
+
+  /// Deliver a serialized response to the client that sent the request.
+  /**
+   * Responses to clients that no longer exist are dropped.
+   */
+  rmw_ret_t
+  send_response(const rmw_request_id_t & request_id, const uint8_t * data, size_t length);
+
+  /// Count publishers or subscriptions matching a publisher or a subscription.
+  size_t
+  count_matched_subscriptions(const Publisher * publisher) const;
+
+  size_t
+  count_matched_publishers(const Subscription * subscription) const;
+
+  /// Check whether a service matching a client exists.
+  bool
+  is_service_available(const Client * client) const;
+
+  std::vector<rmw_native_common::NodeInfo>
+  get_nodes() override;
+
+  std::vector<rmw_native_common::EndpointInfo>
+  get_endpoints(rmw_native_common::EndpointKind kind) override;
+
+private:
+  // Trigger the graph guard condition of all nodes, the exclusive lock must be held.
+  void
+  notify_graph_change();
+
+  mutable std::shared_mutex mutex_;
+  std::vector<Node *> nodes_;
+  std::vector<Publisher *> publishers_;
+  std::vector<Subscription *> subscriptions_;
+  std::vector<Service *> services_;
+  std::vector<Client *> clients_;
+  std::unordered_map<std::string, std::vector<Subscription *>> subscriptions_by_topic_;
+  std::unordered_map<std::string, std::vector<Service *>> services_by_name_;
+  std::unordered_map<uint64_t, Client *> clients_by_id_;
+};
+
+}  // namespace rmw_loopback_cpp
+
+/// Implementation defined context, holding the domain shared with other contexts.
+struct rmw_context_impl_s
+{
+  std::shared_ptr<rmw_loopback_cpp::Domain> domain;
+  bool is_shutdown{false};
+};
+
+#endif  // DOMAIN_HPP_
@@ -0,0 +1,176 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MESSAGE_QUEUE_HPP_
+#define MESSAGE_QUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "rmw/types.h"
+
+namespace rmw_loopback_cpp
+{
+
+/// Message, request or response in flight, recycled in place by the queue holding it.
+struct Sample
+{
+  /// Message serialized with rmw_native_common::serialize_message().
+  std::vector<uint8_t> payload;
+  /// GID of the publisher, or of the client for requests and responses.
+  rmw_gid_t writer_gid;
+  /// Time at which the sample was published or sent.
+  rmw_time_point_value_t source_timestamp;
+  /// Publication sequence number, or sequence number of the request for services.
+  int64_t sequence_number;
+};
+
+/// Bounded multi-producer multi-consumer queue of samples, keeping the last ones only.
+/**
+ * Each cell carries a sequence number telling whether it is ready to be
+ * written or read at a given position, so that producers and consumers only
+ * contend on a compare and swap of their own position.
+ * When the queue holds `depth` samples, pushing drops the oldest one.
+ *
+ * Cells are never freed while the queue lives, so payload buffers are reused
+ * and steady state traffic does not allocate.
+ */
+class MessageQueue
+{
+public:
+  /// Create a queue keeping up to `depth` samples, which must be greater than zero.
+  explicit MessageQueue(size_t depth)
+  : depth_(depth),
+    // One spare cell tells a full queue apart from a cell still being read.
+    capacity_(depth + 1u),
+    cells_(new Cell[depth + 1u])
+  {
+    for (size_t i = 0u; i < capacity_; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  MessageQueue(const MessageQueue &) = delete;
+  MessageQueue & operator=(const MessageQueue &) = delete;
+
+  /// Push a sample filled in place by `fill(Sample &)`, dropping the oldest one if needed.
+  /**
+   * \return the reception sequence number of the sample, starting at 1.
+   */
+  template<typename FillT>
+  uint64_t
+  push(FillT && fill)
+  {
+    Cell * cell = nullptr;
+    size_t position = enqueue_position_.load(std::memory_order_relaxed);
+    for (;;) {
+      if (position >= dequeue_position_.load(std::memory_order_acquire) + depth_) {
+        pop([](Sample &, uint64_t) {});
+        position = enqueue_position_.load(std::memory_order_relaxed);
+        continue;
+      }
+      cell = &cells_[position % capacity_];
+      const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      const intptr_t difference = static_cast<intptr_t>(sequence - position);
+      if (0 == difference) {
+        if (enqueue_position_.compare_exchange_weak(
+            position, position + 1u, std::memory_order_relaxed))
+        {
+          break;
+        }
+      } else {
+        if (difference < 0) {
+          // The cell is still being read, which does not take long.
+          std::this_thread::yield();
+        }
+        position = enqueue_position_.load(std::memory_order_relaxed);
+      }
+    }
+    fill(cell->sample);
+    cell->sequence.store(position + 1u, std::memory_order_release);
+    return position + 1u;
+  }
+
+  /// Pop the oldest sample, handing it to `consume(Sample &, uint64_t)` before recycling it.
+  /**
+   * The second argument is the reception sequence number of the sample.
+   *
+   * \return `true` if a sample was popped, or
+   * \return `false` if the queue is empty.
+   */
+  template<typename ConsumeT>
+  bool
+  pop(ConsumeT && consume)
+  {
+    Cell * cell = nullptr;
+    size_t position = dequeue_position_.load(std::memory_order_relaxed);
+    for (;;) {
+      cell = &cells_[position % capacity_];
+      const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      const intptr_t difference = static_cast<intptr_t>(sequence - (position + 1u));
+      if (0 == difference) {
+        if (dequeue_position_.compare_exchange_weak(
+            position, position + 1u, std::memory_order_relaxed))
+        {
+          break;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = dequeue_position_.load(std::memory_order_relaxed);
+      }
+    }
+    consume(cell->sample, static_cast<uint64_t>(position + 1u));
+    cell->sequence.store(position + capacity_, std::memory_order_release);
+    return true;
+  }
+
+  /// Check whether no sample is ready to be popped.
+  bool
+  empty() const
+  {
+    const size_t position = dequeue_position_.load(std::memory_order_acquire);
+    return cells_[position % capacity_].sequence.load(std::memory_order_acquire) !=
+           position + 1u;
+  }
+
+  /// Get the maximum number of samples kept.
+  size_t
+  depth() const
+  {
+    return depth_;
+  }
+
+private:
+  struct Cell
+  {
+    std::atomic<size_t> sequence;
+    Sample sample;
+  };
+
+  const size_t depth_;
+  const size_t capacity_;
+  std::unique_ptr<Cell[]> cells_;
+  // Positions are on their own cache lines, producers and consumers do not share them.
+  alignas(64) std::atomic<size_t> enqueue_position_{0u};
+  alignas(64) std::atomic<size_t> dequeue_position_{0u};
+};
+
+}  // namespace rmw_loopback_cpp
+
+#endif  // MESSAGE_QUEUE_HPP_
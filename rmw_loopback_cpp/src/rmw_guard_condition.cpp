@@ -0,0 +1,80 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <new>
+
+#include "rmw/allocators.h"
+#include "rmw/check_type_identifiers_match.h"
+#include "rmw/error_handling.h"
+#include "rmw/rmw.h"
+
+#include "./domain.hpp"
+#include "./identifier.hpp"
+
+extern "C"
+{
+rmw_guard_condition_t *
+rmw_create_guard_condition(rmw_context_t * context)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(context, nullptr);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    context,
+    context->implementation_identifier,
+    rmw_loopback_cpp::identifier,
+    return nullptr);
+
+  auto impl = new (std::nothrow) rmw_loopback_cpp::GuardCondition();
+  if (nullptr == impl) {
+    RMW_SET_ERROR_MSG("failed to allocate guard condition impl");
+    return nullptr;
+  }
+  rmw_guard_condition_t * guard_condition = rmw_guard_condition_allocate();
+  if (nullptr == guard_condition) {
+    delete impl;
+    RMW_SET_ERROR_MSG("failed to allocate guard condition");
+    return nullptr;
+  }
+  guard_condition->implementation_identifier = rmw_loopback_cpp::identifier;
+  guard_condition->data = impl;
+  guard_condition->context = context;
+  return guard_condition;
+}
+
+rmw_ret_t
+rmw_destroy_guard_condition(rmw_guard_condition_t * guard_condition)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(guard_condition, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    guard_condition,
+    guard_condition->implementation_identifier,
+    rmw_loopback_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  delete static_cast<rmw_loopback_cpp::GuardCondition *>(guard_condition->data);
+  rmw_guard_condition_free(guard_condition);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_trigger_guard_condition(const rmw_guard_condition_t * guard_condition)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(guard_condition, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    guard_condition,
+    guard_condition->implementation_identifier,
+    rmw_loopback_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  static_cast<rmw_loopback_cpp::GuardCondition *>(guard_condition->data)->trigger();
+  return RMW_RET_OK;
+}
+}  // extern "C"
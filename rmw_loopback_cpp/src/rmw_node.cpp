@@ -0,0 +1,145 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <new>
+
+#include "rmw/allocators.h"
+#include "rmw/check_type_identifiers_match.h"
+#include "rmw/error_handling.h"
+#include "rmw/rmw.h"
+#include "rmw/validate_namespace.h"
+#include "rmw/validate_node_name.h"
+
+#include "./domain.hpp"
+#include "./identifier.hpp"
+
+extern "C"
+{
+rmw_node_t *
+rmw_create_node(
+  rmw_context_t * context,
+  const char * name,
+  const char * namespace_)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(context, nullptr);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    context,
+    context->implementation_identifier,
+    rmw_loopback_cpp::identifier,
+    return nullptr);
+  RMW_CHECK_FOR_NULL_WITH_MSG(
+    context->impl,
+    "expected initialized context",
+    return nullptr);
+  if (context->impl->is_shutdown) {
+    RMW_SET_ERROR_MSG("context has been shutdown");
+    return nullptr;
+  }
+  RMW_CHECK_ARGUMENT_FOR_NULL(name, nullptr);
+  RMW_CHECK_ARGUMENT_FOR_NULL(namespace_, nullptr);
+
+  int validation_result = RMW_NODE_NAME_VALID;
+  rmw_ret_t ret = rmw_validate_node_name(name, &validation_result, nullptr);
+  if (RMW_RET_OK != ret) {
+    return nullptr;
+  }
+  if (RMW_NODE_NAME_VALID != validation_result) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+      "invalid node name: %s", rmw_node_name_validation_result_string(validation_result));
+    return nullptr;
+  }
+  validation_result = RMW_NAMESPACE_VALID;
+  ret = rmw_validate_namespace(namespace_, &validation_result, nullptr);
+  if (RMW_RET_OK != ret) {
+    return nullptr;
+  }
+  if (RMW_NAMESPACE_VALID != validation_result) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+      "invalid node namespace: %s", rmw_namespace_validation_result_string(validation_result));
+    return nullptr;
+  }
+
+  rmw_loopback_cpp::Node * impl = nullptr;
+  try {
+    impl = new rmw_loopback_cpp::Node();
+    impl->name = name;
+    impl->namespace_ = namespace_;
+  } catch (const std::bad_alloc &) {
+    delete impl;
+    RMW_SET_ERROR_MSG("failed to allocate node impl");
+    return nullptr;
+  }
+  impl->context = context;
+  impl->domain = context->impl->domain.get();
+  impl->graph_guard_condition_handle.implementation_identifier = rmw_loopback_cpp::identifier;
+  impl->graph_guard_condition_handle.data = &impl->graph_guard_condition;
+  impl->graph_guard_condition_handle.context = context;
+
+  rmw_node_t * node = rmw_node_allocate();
+  if (nullptr == node) {
+    delete impl;
+    RMW_SET_ERROR_MSG("failed to allocate node");
+    return nullptr;
+  }
+  node->implementation_identifier = rmw_loopback_cpp::identifier;
+  node->data = impl;
+  node->name = impl->name.c_str();
+  node->namespace_ = impl->namespace_.c_str();
+  node->context = context;
+  try {
+    impl->domain->add(impl);
+  } catch (const std::bad_alloc &) {
+    rmw_node_free(node);
+    delete impl;
+    RMW_SET_ERROR_MSG("failed to register node");
+    return nullptr;
+  }
+  return node;
+}
+
+rmw_ret_t
+rmw_destroy_node(rmw_node_t * node)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(node, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    node,
+    node->implementation_identifier,
+    rmw_loopback_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  auto impl = static_cast<rmw_loopback_cpp::Node *>(node->data);
+  impl->domain->remove(impl);
+  delete impl;
+  rmw_node_free(node);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_node_assert_liveliness(const rmw_node_t * node)
+{
+  (void)node;
+  return RMW_RET_OK;
+}
+
+const rmw_guard_condition_t *
+rmw_node_get_graph_guard_condition(const rmw_node_t * node)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(node, nullptr);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    node,
+    node->implementation_identifier,
+    rmw_loopback_cpp::identifier,
+    return nullptr);
+  return &static_cast<rmw_loopback_cpp::Node *>(node->data)->graph_guard_condition_handle;
+}
+}  // extern "C"
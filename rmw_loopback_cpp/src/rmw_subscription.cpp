@@ -0,0 +1,535 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+#include "rcutils/time.h"
+
+#include "rmw/allocators.h"
+#include "rmw/check_type_identifiers_match.h"
+#include "rmw/convert_rcutils_ret_to_rmw_ret.h"
+#include "rmw/dynamic_message_type_support.h"
+#include "rmw/error_handling.h"
+#include "rmw/get_network_flow_endpoints.h"
+#include "rmw/rmw.h"
+#include "rmw/serialized_message.h"
+
+#include "rmw_native_common/graph.hpp"
+#include "rmw_native_common/type_support.hpp"
+
+#include "./domain.hpp"
+#include "./identifier.hpp"
+
+namespace
+{
+
+void
+fill_message_info(
+  const rmw_loopback_cpp::Sample & sample,
+  uint64_t reception_sequence_number,
+  rmw_message_info_t * message_info)
+{
+  *message_info = rmw_get_zero_initialized_message_info();
+  message_info->source_timestamp = sample.source_timestamp;
+  rcutils_time_point_value_t received_timestamp = 0;
+  (void)rcutils_system_time_now(&received_timestamp);
+  message_info->received_timestamp = received_timestamp;
+  message_info->publication_sequence_number = static_cast<uint64_t>(sample.sequence_number);
+  message_info->reception_sequence_number = reception_sequence_number;
+  message_info->publisher_gid = sample.writer_gid;
+  message_info->from_intra_process = false;
+}
+
+rmw_ret_t
+take(
+  const rmw_subscription_t * subscription,
+  void * ros_message,
+  bool * taken,
+  rmw_message_info_t * message_info)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(subscription, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    subscription,
+    subscription->implementation_identifier,
+    rmw_loopback_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  RMW_CHECK_ARGUMENT_FOR_NULL(ros_message, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(taken, RMW_RET_INVALID_ARGUMENT);
+  auto impl = static_cast<rmw_loopback_cpp::Subscription *>(subscription->data);
+  *taken = false;
+  bool is_deserialized = false;
+  const bool is_popped = impl->queue.pop(
+    [&](const rmw_loopback_cpp::Sample & sample, uint64_t reception_sequence_number) {
+      is_deserialized = rmw_native_common::deserialize_message(
+        impl->members, sample.payload.data(), sample.payload.size(), ros_message);
+      if (is_deserialized && nullptr != message_info) {
+        fill_message_info(sample, reception_sequence_number, message_info);
+      }
+    });
+  if (!is_popped) {
+    return RMW_RET_OK;
+  }
+  if (!is_deserialized) {
+    RMW_SET_ERROR_MSG("failed to deserialize message");
+    return RMW_RET_ERROR;
+  }
+  *taken = true;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+take_serialized_message(
+  const rmw_subscription_t * subscription,
+  rmw_serialized_message_t * serialized_message,
+  bool * taken,
+  rmw_message_info_t * message_info)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(subscription, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    subscription,
+    subscription->implementation_identifier,
+    rmw_loopback_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  RMW_CHECK_ARGUMENT_FOR_NULL(serialized_message, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(taken, RMW_RET_INVALID_ARGUMENT);
+  auto impl = static_cast<rmw_loopback_cpp::Subscription *>(subscription->data);
+  *taken = false;
+  rmw_ret_t ret = RMW_RET_OK;
+  const bool is_popped = impl->queue.pop(
+    [&](const rmw_loopback_cpp::Sample & sample, uint64_t reception_sequence_number) {
+      const size_t length = sample.payload.size();
+      if (serialized_message->buffer_capacity < length) {
+        ret = rmw_convert_rcutils_ret_to_rmw_ret(
+          rmw_serialized_message_resize(serialized_message, length));
+        if (RMW_RET_OK != ret) {
+          return;
+        }
+      }
+      if (0u != length) {
+        memcpy(serialized_message->buffer, sample.payload.data(), length);
+      }
+      serialized_message->buffer_length = length;
+      if (nullptr != message_info) {
+        fill_message_info(sample, reception_sequence_number, message_info);
+      }
+    });
+  if (!is_popped || RMW_RET_OK != ret) {
+    return ret;
+  }
+  *taken = true;
+  return RMW_RET_OK;
+}
+
+}  // namespace
+
+extern "C"
+{
+rmw_ret_t
+rmw_init_subscription_allocation(
+  const rosidl_message_type_support_t * type_support,
+  const rosidl_runtime_c__Sequence__bound * message_bounds,
+  rmw_subscription_allocation_t * allocation)
+{
+  (void)type_support;
+  (void)message_bounds;
+  (void)allocation;
+  RMW_SET_ERROR_MSG("rmw_init_subscription_allocation is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+
+rmw_ret_t
+rmw_fini_subscription_allocation(rmw_subscription_allocation_t * allocation)
+{
+  (void)allocation;
+  RMW_SET_ERROR_MSG("rmw_fini_subscription_allocation is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+
+rmw_subscription_t *
+rmw_create_subscription(
+  const rmw_node_t * node,
+  const rosidl_message_type_support_t * type_support,
+  const char * topic_name,
+  const rmw_qos_profile_t * qos_policies,
+  const rmw_subscription_options_t * subscription_options)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(node, nullptr);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    node,
+    node->implementation_identifier,
+    rmw_loopback_cpp::identifier,
+    return nullptr);
+  RMW_CHECK_ARGUMENT_FOR_NULL(type_support, nullptr);
+  RMW_CHECK_ARGUMENT_FOR_NULL(topic_name, nullptr);
+  RMW_CHECK_ARGUMENT_FOR_NULL(qos_policies, nullptr);
+  RMW_CHECK_ARGUMENT_FOR_NULL(subscription_options, nullptr);
+  if (!rmw_native_common::validate_name(
+      topic_name, qos_policies->avoid_ros_namespace_conventions))
+  {
+    return nullptr;
+  }
+  if (RMW_UNIQUE_NETWORK_FLOW_ENDPOINTS_STRICTLY_REQUIRED ==
+    subscription_options->require_unique_network_flow_endpoints)
+  {
+    RMW_SET_ERROR_MSG("unique network flow endpoints are not supported");
+    return nullptr;
+  }
+  if (nullptr != subscription_options->content_filter_options) {
+    RMW_SET_ERROR_MSG("content filtered topics are not supported");
+    return nullptr;
+  }
+  const rmw_native_common::MessageMembers * members =
+    rmw_native_common::get_message_members(type_support);
+  if (nullptr == members) {
+    return nullptr;
+  }
+
+  auto node_impl = static_cast<rmw_loopback_cpp::Node *>(node->data);
+  const rmw_qos_profile_t qos = rmw_loopback_cpp::resolve_qos(*qos_policies);
+  rmw_loopback_cpp::Subscription * impl = nullptr;
+  try {
+    impl = new rmw_loopback_cpp::Subscription(qos.depth);
+    impl->name = topic_name;
+    impl->type_name = rmw_native_common::get_type_name(members);
+  } catch (const std::bad_alloc &) {
+    delete impl;
+    RMW_SET_ERROR_MSG("failed to allocate subscription impl");
+    return nullptr;
+  }
+  impl->node = node_impl;
+  impl->type_hash = rmw_native_common::get_type_hash(type_support);
+  impl->qos = qos;
+  rmw_loopback_cpp::generate_gid(&impl->gid);
+  impl->members = members;
+  impl->ignore_local_publications = subscription_options->ignore_local_publications;
+
+  rmw_subscription_t * subscription = rmw_subscription_allocate();
+  if (nullptr == subscription) {
+    delete impl;
+    RMW_SET_ERROR_MSG("failed to allocate subscription");
+    return nullptr;
+  }
+  subscription->implementation_identifier = rmw_loopback_cpp::identifier;
+  subscription->data = impl;
+  subscription->topic_name = impl->name.c_str();
+  subscription->options = *subscription_options;
+  subscription->can_loan_messages = false;
+  subscription->is_cft_enabled = false;
+  try {
+    node_impl->domain->add(impl);
+  } catch (const std::bad_alloc &) {
+    rmw_subscription_free(subscription);
+    delete impl;
+    RMW_SET_ERROR_MSG("failed to register subscription");
+    return nullptr;
+  }
+  return subscription;
+}
+
+rmw_ret_t
+rmw_destroy_subscription(rmw_node_t * node, rmw_subscription_t * subscription)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(node, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(subscription, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    node,
+    node->implementation_identifier,
+    rmw_loopback_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    subscription,
+    subscription->implementation_identifier,
+    rmw_loopback_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  auto impl = static_cast<rmw_loopback_cpp::Subscription *>(subscription->data);
+  impl->node->domain->remove(impl);
+  delete impl;
+  rmw_subscription_free(subscription);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_subscription_count_matched_publishers(
+  const rmw_subscription_t * subscription,
+  size_t * publisher_count)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(subscription, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    subscription,
+    subscription->implementation_identifier,
+    rmw_loopback_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  RMW_CHECK_ARGUMENT_FOR_NULL(publisher_count, RMW_RET_INVALID_ARGUMENT);
+  auto impl = static_cast<rmw_loopback_cpp::Subscription *>(subscription->data);
+  *publisher_count = impl->node->domain->count_matched_publishers(impl);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_subscription_get_actual_qos(
+  const rmw_subscription_t * subscription,
+  rmw_qos_profile_t * qos)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(subscription, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    subscription,
+    subscription->implementation_identifier,
+    rmw_loopback_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  RMW_CHECK_ARGUMENT_FOR_NULL(qos, RMW_RET_INVALID_ARGUMENT);
+  *qos = static_cast<rmw_loopback_cpp::Subscription *>(subscription->data)->qos;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_subscription_set_content_filter(
+  rmw_subscription_t * subscription,
+  const rmw_subscription_content_filter_options_t * options)
+{
+  (void)subscription;
+  (void)options;
+  RMW_SET_ERROR_MSG("rmw_subscription_set_content_filter is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+
+rmw_ret_t
+rmw_subscription_get_content_filter(
+  const rmw_subscription_t * subscription,
+  rcutils_allocator_t * allocator,
+  rmw_subscription_content_filter_options_t * options)
+{
+  (void)subscription;
+  (void)allocator;
+  (void)options;
+  RMW_SET_ERROR_MSG("rmw_subscription_get_content_filter is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+
+rmw_ret_t
+rmw_take(
+  const rmw_subscription_t * subscription,
+  void * ros_message,
+  bool * taken,
+  rmw_subscription_allocation_t * allocation)
+{
+  (void)allocation;
+  return take(subscription, ros_message, taken, nullptr);
+}
+
+rmw_ret_t
+rmw_take_with_info(
+  const rmw_subscription_t * subscription,
+  void * ros_message,
+  bool * taken,
+  rmw_message_info_t * message_info,
+  rmw_subscription_allocation_t * allocation)
+{
+  (void)allocation;
+  RMW_CHECK_ARGUMENT_FOR_NULL(message_info, RMW_RET_INVALID_ARGUMENT);
+  return take(subscription, ros_message, taken, message_info);
+}
+
+rmw_ret_t
+rmw_take_sequence(
+  const rmw_subscription_t * subscription,
+  size_t count,
+  rmw_message_sequence_t * message_sequence,
+  rmw_message_info_sequence_t * message_info_sequence,
+  size_t * taken,
+  rmw_subscription_allocation_t * allocation)
+{
+  (void)allocation;
+  RMW_CHECK_ARGUMENT_FOR_NULL(subscription, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    subscription,
+    subscription->implementation_identifier,
+    rmw_loopback_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  RMW_CHECK_ARGUMENT_FOR_NULL(message_sequence, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(message_info_sequence, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(taken, RMW_RET_INVALID_ARGUMENT);
+  if (0u == count) {
+    RMW_SET_ERROR_MSG("count cannot be 0");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (count > message_sequence->capacity) {
+    RMW_SET_ERROR_MSG("insufficient capacity in message_sequence");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (count > message_info_sequence->capacity) {
+    RMW_SET_ERROR_MSG("insufficient capacity in message_info_sequence");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  *taken = 0u;
+  rmw_ret_t ret = RMW_RET_OK;
+  while (*taken < count) {
+    bool is_taken = false;
+    ret = take(
+      subscription, message_sequence->data[*taken], &is_taken,
+      &message_info_sequence->data[*taken]);
+    if (RMW_RET_OK != ret || !is_taken) {
+      break;
+    }
+    ++*taken;
+  }
+  message_sequence->size = *taken;
+  message_info_sequence->size = *taken;
+  return ret;
+}
+
+rmw_ret_t
+rmw_take_serialized_message(
+  const rmw_subscription_t * subscription,
+  rmw_serialized_message_t * serialized_message,
+  bool * taken,
+  rmw_subscription_allocation_t * allocation)
+{
+  (void)allocation;
+  return take_serialized_message(subscription, serialized_message, taken, nullptr);
+}
+
+rmw_ret_t
+rmw_take_serialized_message_with_info(
+  const rmw_subscription_t * subscription,
+  rmw_serialized_message_t * serialized_message,
+  bool * taken,
+  rmw_message_info_t * message_info,
+  rmw_subscription_allocation_t * allocation)
+{
+  (void)allocation;
+  RMW_CHECK_ARGUMENT_FOR_NULL(message_info, RMW_RET_INVALID_ARGUMENT);
+  return take_serialized_message(subscription, serialized_message, taken, message_info);
+}
+
+rmw_ret_t
+rmw_take_loaned_message(
+  const rmw_subscription_t * subscription,
+  void ** loaned_message,
+  bool * taken,
+  rmw_subscription_allocation_t * allocation)
+{
+  (void)subscription;
+  (void)loaned_message;
+  (void)taken;
+  (void)allocation;
+  RMW_SET_ERROR_MSG("rmw_take_loaned_message is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+
+rmw_ret_t
+rmw_take_loaned_message_with_info(
+  const rmw_subscription_t * subscription,
+  void ** loaned_message,
+  bool * taken,
+  rmw_message_info_t * message_info,
+  rmw_subscription_allocation_t * allocation)
+{
+  (void)subscription;
+  (void)loaned_message;
+  (void)taken;
+  (void)message_info;
+  (void)allocation;
+  RMW_SET_ERROR_MSG("rmw_take_loaned_message_with_info is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+
+rmw_ret_t
+rmw_return_loaned_message_from_subscription(
+  const rmw_subscription_t * subscription,
+  void * loaned_message)
+{
+  (void)subscription;
+  (void)loaned_message;
+  RMW_SET_ERROR_MSG("rmw_return_loaned_message_from_subscription is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+
+rmw_ret_t
+rmw_take_dynamic_message(
+  const rmw_subscription_t * subscription,
+  rosidl_dynamic_typesupport_dynamic_data_t * dynamic_message,
+  bool * taken,
+  rmw_subscription_allocation_t * allocation)
+{
+  (void)subscription;
+  (void)dynamic_message;
+  (void)taken;
+  (void)allocation;
+  RMW_SET_ERROR_MSG("rmw_take_dynamic_message is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+
+rmw_ret_t
+rmw_take_dynamic_message_with_info(
+  const rmw_subscription_t * subscription,
+  rosidl_dynamic_typesupport_dynamic_data_t * dynamic_message,
+  bool * taken,
+  rmw_message_info_t * message_info,
+  rmw_subscription_allocation_t * allocation)
+{
+  (void)subscription;
+  (void)dynamic_message;
+  (void)taken;
+  (void)message_info;
+  (void)allocation;
+  RMW_SET_ERROR_MSG("rmw_take_dynamic_message_with_info is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+
+rmw_ret_t
+rmw_serialization_support_init(
+  const char * serialization_lib_name,
+  rcutils_allocator_t * allocator,
+  rosidl_dynamic_typesupport_serialization_support_t * serialization_support)
+{
+  (void)serialization_lib_name;
+  (void)allocator;
+  (void)serialization_support;
+  RMW_SET_ERROR_MSG("rmw_serialization_support_init is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+
+rmw_ret_t
+rmw_subscription_set_on_new_message_callback(
+  rmw_subscription_t * subscription,
+  rmw_event_callback_t callback,
+  const void * user_data)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(subscription, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    subscription,
+    subscription->implementation_identifier,
+    rmw_loopback_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  static_cast<rmw_loopback_cpp::Subscription *>(subscription->data)->on_new_message.set(
+    callback, user_data);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_subscription_get_network_flow_endpoints(
+  const rmw_subscription_t * subscription,
+  rcutils_allocator_t * allocator,
+  rmw_network_flow_endpoint_array_t * network_flow_endpoint_array)
+{
+  (void)subscription;
+  (void)allocator;
+  (void)network_flow_endpoint_array;
+  RMW_SET_ERROR_MSG("rmw_subscription_get_network_flow_endpoints is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+}  // extern "C"
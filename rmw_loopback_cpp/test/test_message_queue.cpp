@@ -0,0 +1,149 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "../src/message_queue.hpp"
+
+using rmw_loopback_cpp::MessageQueue;
+using rmw_loopback_cpp::Sample;
+
+namespace
+{
+
+uint64_t
+push_value(MessageQueue & queue, int64_t value)
+{
+  return queue.push([value](Sample & sample) {sample.sequence_number = value;});
+}
+
+}  // namespace
+
+TEST(test_message_queue, push_pop) {
+  MessageQueue queue(3u);
+  EXPECT_EQ(3u, queue.depth());
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.pop([](Sample &, uint64_t) {}));
+
+  EXPECT_EQ(1u, push_value(queue, 10));
+  EXPECT_EQ(2u, push_value(queue, 20));
+  EXPECT_FALSE(queue.empty());
+
+  int64_t value = 0;
+  uint64_t reception_sequence_number = 0u;
+  auto consume = [&](Sample & sample, uint64_t sequence_number) {
+      value = sample.sequence_number;
+      reception_sequence_number = sequence_number;
+    };
+  EXPECT_TRUE(queue.pop(consume));
+  EXPECT_EQ(10, value);
+  EXPECT_EQ(1u, reception_sequence_number);
+  EXPECT_TRUE(queue.pop(consume));
+  EXPECT_EQ(20, value);
+  EXPECT_EQ(2u, reception_sequence_number);
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.pop(consume));
+}
+
+TEST(test_message_queue, drop_oldest) {
+  MessageQueue queue(2u);
+  for (int64_t value = 1; value <= 5; ++value) {
+    EXPECT_EQ(static_cast<uint64_t>(value), push_value(queue, value));
+  }
+
+  // Only the last two samples are kept, with their reception sequence numbers showing the gap.
+  std::vector<int64_t> values;
+  std::vector<uint64_t> reception_sequence_numbers;
+  while (queue.pop(
+      [&](Sample & sample, uint64_t sequence_number) {
+        values.push_back(sample.sequence_number);
+        reception_sequence_numbers.push_back(sequence_number);
+      }))
+  {
+  }
+  EXPECT_EQ((std::vector<int64_t>{4, 5}), values);
+  EXPECT_EQ((std::vector<uint64_t>{4u, 5u}), reception_sequence_numbers);
+}
+
+TEST(test_message_queue, payload_reuse) {
+  MessageQueue queue(1u);
+  queue.push([](Sample & sample) {sample.payload.assign(64u, 0xAB);});
+  const uint8_t * data = nullptr;
+  EXPECT_TRUE(queue.pop([&data](Sample & sample, uint64_t) {data = sample.payload.data();}));
+
+  // Cells are recycled in turn, the first one eventually comes back with its buffer.
+  queue.push([](Sample & sample) {sample.payload.assign(64u, 0xCD);});
+  EXPECT_TRUE(queue.pop([](Sample &, uint64_t) {}));
+  queue.push(
+    [data](Sample & sample) {
+      EXPECT_EQ(data, sample.payload.data());
+      sample.payload.assign(32u, 0xEF);
+    });
+  EXPECT_TRUE(
+    queue.pop([data](Sample & sample, uint64_t) {EXPECT_EQ(data, sample.payload.data());}));
+}
+
+TEST(test_message_queue, concurrent_push_pop) {
+  constexpr size_t producer_count = 4u;
+  constexpr int64_t push_count = 10000;
+  // Deep enough for nothing to be dropped, so that every sample can be accounted for.
+  MessageQueue queue(producer_count * push_count);
+
+  std::vector<std::thread> producers;
+  for (size_t i = 0u; i < producer_count; ++i) {
+    producers.emplace_back(
+      [&queue, i]() {
+        for (int64_t value = 0; value < push_count; ++value) {
+          queue.push(
+            [i, value](Sample & sample) {
+              sample.writer_gid.data[0] = static_cast<uint8_t>(i);
+              sample.sequence_number = value;
+            });
+        }
+      });
+  }
+
+  // Samples of each producer must come out in the order they were pushed.
+  std::vector<int64_t> next_values(producer_count, 0);
+  uint64_t last_reception_sequence_number = 0u;
+  size_t popped_count = 0u;
+  while (popped_count < producer_count * push_count) {
+    const bool is_popped = queue.pop(
+      [&](Sample & sample, uint64_t reception_sequence_number) {
+        const size_t producer = sample.writer_gid.data[0];
+        ASSERT_LT(producer, producer_count);
+        EXPECT_EQ(next_values[producer], sample.sequence_number);
+        next_values[producer] = sample.sequence_number + 1;
+        EXPECT_GT(reception_sequence_number, last_reception_sequence_number);
+        last_reception_sequence_number = reception_sequence_number;
+      });
+    if (is_popped) {
+      ++popped_count;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  for (std::thread & producer : producers) {
+    producer.join();
+  }
+  EXPECT_TRUE(queue.empty());
+  for (int64_t next_value : next_values) {
+    EXPECT_EQ(push_count, next_value);
+  }
+}
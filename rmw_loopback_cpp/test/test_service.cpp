@@ -0,0 +1,149 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include "rmw/error_handling.h"
+#include "rmw/qos_profiles.h"
+#include "rmw/rmw.h"
+
+#include "./test_common.hpp"
+
+using test_common::AddTwoIntsRequest;
+using test_common::AddTwoIntsResponse;
+
+class TestService : public test_common::LoopbackTest
+{
+};
+
+TEST_F(TestService, request_response) {
+  rmw_client_t * client = rmw_create_client(
+    node, test_common::get_service_type_support(), "/add_two_ints",
+    &rmw_qos_profile_services_default);
+  ASSERT_NE(nullptr, client) << rmw_get_error_string().str;
+
+  bool is_available = true;
+  EXPECT_EQ(RMW_RET_OK, rmw_service_server_is_available(node, client, &is_available));
+  EXPECT_FALSE(is_available);
+
+  rmw_service_t * service = rmw_create_service(
+    node, test_common::get_service_type_support(), "/add_two_ints",
+    &rmw_qos_profile_services_default);
+  ASSERT_NE(nullptr, service) << rmw_get_error_string().str;
+  EXPECT_EQ(RMW_RET_OK, rmw_service_server_is_available(node, client, &is_available));
+  EXPECT_TRUE(is_available);
+
+  for (int64_t i = 1; i <= 2; ++i) {
+    AddTwoIntsRequest request{i, 40};
+    int64_t sequence_id = 0;
+    ASSERT_EQ(RMW_RET_OK, rmw_send_request(client, &request, &sequence_id)) <<
+      rmw_get_error_string().str;
+    EXPECT_EQ(i, sequence_id);
+  }
+
+  rmw_gid_t client_gid;
+  ASSERT_EQ(RMW_RET_OK, rmw_get_gid_for_client(client, &client_gid));
+  for (int64_t i = 1; i <= 2; ++i) {
+    AddTwoIntsRequest request{};
+    rmw_service_info_t request_header{};
+    bool taken = false;
+    ASSERT_EQ(RMW_RET_OK, rmw_take_request(service, &request_header, &request, &taken)) <<
+      rmw_get_error_string().str;
+    ASSERT_TRUE(taken);
+    EXPECT_EQ(i, request.a);
+    EXPECT_EQ(40, request.b);
+    EXPECT_EQ(i, request_header.request_id.sequence_number);
+    EXPECT_EQ(
+      0, memcmp(
+        client_gid.data, request_header.request_id.writer_guid, sizeof(client_gid.data)));
+
+    AddTwoIntsResponse response{request.a + request.b};
+    ASSERT_EQ(RMW_RET_OK, rmw_send_response(service, &request_header.request_id, &response)) <<
+      rmw_get_error_string().str;
+  }
+
+  // Responses come back to the client with the sequence number of their request.
+  for (int64_t i = 1; i <= 2; ++i) {
+    AddTwoIntsResponse response{};
+    rmw_service_info_t request_header{};
+    bool taken = false;
+    ASSERT_EQ(RMW_RET_OK, rmw_take_response(client, &request_header, &response, &taken)) <<
+      rmw_get_error_string().str;
+    ASSERT_TRUE(taken);
+    EXPECT_EQ(i + 40, response.sum);
+    EXPECT_EQ(i, request_header.request_id.sequence_number);
+  }
+  AddTwoIntsResponse response{};
+  rmw_service_info_t request_header{};
+  bool taken = true;
+  EXPECT_EQ(RMW_RET_OK, rmw_take_response(client, &request_header, &response, &taken));
+  EXPECT_FALSE(taken);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_service(node, service));
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_client(node, client));
+}
+
+TEST_F(TestService, response_to_destroyed_client) {
+  rmw_service_t * service = rmw_create_service(
+    node, test_common::get_service_type_support(), "/add_two_ints",
+    &rmw_qos_profile_services_default);
+  ASSERT_NE(nullptr, service) << rmw_get_error_string().str;
+  rmw_client_t * client = rmw_create_client(
+    node, test_common::get_service_type_support(), "/add_two_ints",
+    &rmw_qos_profile_services_default);
+  ASSERT_NE(nullptr, client) << rmw_get_error_string().str;
+
+  AddTwoIntsRequest request{1, 2};
+  int64_t sequence_id = 0;
+  ASSERT_EQ(RMW_RET_OK, rmw_send_request(client, &request, &sequence_id));
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_client(node, client));
+
+  rmw_service_info_t request_header{};
+  bool taken = false;
+  ASSERT_EQ(RMW_RET_OK, rmw_take_request(service, &request_header, &request, &taken));
+  ASSERT_TRUE(taken);
+  // The response is dropped, as it would be if the client had gone away over the network.
+  AddTwoIntsResponse response{3};
+  EXPECT_EQ(RMW_RET_OK, rmw_send_response(service, &request_header.request_id, &response));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_service(node, service));
+}
+
+TEST_F(TestService, bad_arguments) {
+  EXPECT_EQ(
+    nullptr,
+    rmw_create_service(
+      node, test_common::get_service_type_support(), "not a valid name",
+      &rmw_qos_profile_services_default));
+  EXPECT_TRUE(rmw_error_is_set());
+  rmw_reset_error();
+  EXPECT_EQ(
+    nullptr,
+    rmw_create_client(
+      nullptr, test_common::get_service_type_support(), "/add_two_ints",
+      &rmw_qos_profile_services_default));
+  rmw_reset_error();
+
+  rmw_node_t other_node = *node;
+  other_node.implementation_identifier = "other_rmw";
+  EXPECT_EQ(
+    nullptr,
+    rmw_create_service(
+      &other_node, test_common::get_service_type_support(), "/add_two_ints",
+      &rmw_qos_profile_services_default));
+  rmw_reset_error();
+}
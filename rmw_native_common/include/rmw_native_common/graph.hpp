@@ -0,0 +1,164 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_NATIVE_COMMON__GRAPH_HPP_
+#define RMW_NATIVE_COMMON__GRAPH_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "rcutils/allocator.h"
+#include "rcutils/types/string_array.h"
+
+#include "rmw/names_and_types.h"
+#include "rmw/topic_endpoint_info_array.h"
+#include "rmw/types.h"
+
+#include "rosidl_runtime_c/type_hash.h"
+
+#include "rmw_native_common/visibility_control.h"
+
+namespace rmw_native_common
+{
+
+enum class EndpointKind
+{
+  publisher,
+  subscription,
+  service,
+  client,
+};
+
+/// Snapshots of nodes and endpoints, for graph queries.
+struct NodeInfo
+{
+  std::string name;
+  std::string namespace_;
+  std::string enclave;
+};
+
+struct EndpointInfo
+{
+  /// Topic or service name.
+  std::string name;
+  std::string type_name;
+  std::string node_name;
+  std::string node_namespace;
+  rosidl_type_hash_t type_hash;
+  rmw_qos_profile_t qos;
+  rmw_gid_t gid;
+};
+
+/// Nodes and endpoints of a domain, as seen by graph queries.
+/**
+ * Nodes are matched with their endpoints on their names and namespaces, as
+ * remote nodes would be.
+ */
+class Graph
+{
+public:
+  virtual
+  ~Graph() = default;
+
+  /// Get a snapshot of all nodes.
+  /**
+   * \throws std::bad_alloc
+   */
+  virtual std::vector<NodeInfo>
+  get_nodes() = 0;
+
+  /// Get a snapshot of all endpoints of a kind.
+  /**
+   * \throws std::bad_alloc
+   */
+  virtual std::vector<EndpointInfo>
+  get_endpoints(EndpointKind kind) = 0;
+};
+
+/// Check that a topic or service name is valid, setting an error message if not.
+RMW_NATIVE_COMMON_PUBLIC
+bool
+validate_name(const char * name, bool avoid_ros_namespace_conventions);
+
+/// Implement rmw_get_node_names() and rmw_get_node_names_with_enclaves().
+/**
+ * Enclaves are not collected if `enclaves` is null.
+ */
+RMW_NATIVE_COMMON_PUBLIC
+rmw_ret_t
+get_node_names(
+  Graph & graph,
+  rcutils_allocator_t * allocator,
+  rcutils_string_array_t * node_names,
+  rcutils_string_array_t * node_namespaces,
+  rcutils_string_array_t * enclaves);
+
+/// Implement rmw_count_publishers() and the like.
+RMW_NATIVE_COMMON_PUBLIC
+rmw_ret_t
+count_endpoints(Graph & graph, EndpointKind kind, const char * name, size_t * count);
+
+/// Implement rmw_get_topic_names_and_types().
+RMW_NATIVE_COMMON_PUBLIC
+rmw_ret_t
+get_topic_names_and_types(
+  Graph & graph,
+  rcutils_allocator_t * allocator,
+  rmw_names_and_types_t * topic_names_and_types);
+
+/// Implement rmw_get_service_names_and_types().
+RMW_NATIVE_COMMON_PUBLIC
+rmw_ret_t
+get_service_names_and_types(
+  Graph & graph,
+  rcutils_allocator_t * allocator,
+  rmw_names_and_types_t * service_names_and_types);
+
+/// Implement rmw_get_publisher_names_and_types_by_node() and the like.
+/**
+ * \return `RMW_RET_NODE_NAME_NON_EXISTENT` if no such node exists.
+ */
+RMW_NATIVE_COMMON_PUBLIC
+rmw_ret_t
+get_names_and_types_by_node(
+  Graph & graph,
+  EndpointKind kind,
+  rcutils_allocator_t * allocator,
+  const char * node_name,
+  const char * node_namespace,
+  rmw_names_and_types_t * names_and_types);
+
+/// Implement rmw_get_publishers_info_by_topic() and rmw_get_subscriptions_info_by_topic().
+RMW_NATIVE_COMMON_PUBLIC
+rmw_ret_t
+get_endpoints_info_by_topic(
+  Graph & graph,
+  EndpointKind kind,
+  rcutils_allocator_t * allocator,
+  const char * topic_name,
+  rmw_topic_endpoint_info_array_t * endpoints_info);
+
+/// Get the graph of the domain of a node, for the entry points of graph queries.
+/**
+ * The `rmw_native_common_entry_points` object library, which defines the
+ * graph entry points, calls this hook to be defined by each implementation
+ * it is linked into, with a node already checked to be of that implementation.
+ */
+Graph &
+get_graph(const rmw_node_t * node);
+
+}  // namespace rmw_native_common
+
+#endif  // RMW_NATIVE_COMMON__GRAPH_HPP_
@@ -0,0 +1,66 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_NATIVE_COMMON__RMW_SERIALIZE_HPP_
+#define RMW_NATIVE_COMMON__RMW_SERIALIZE_HPP_
+
+#include <cstddef>
+
+#include "rmw/serialized_message.h"
+#include "rmw/types.h"
+
+#include "rosidl_runtime_c/message_type_support_struct.h"
+#include "rosidl_runtime_c/sequence_bound.h"
+
+#include "rmw_native_common/visibility_control.h"
+
+namespace rmw_native_common
+{
+
+/// Implement rmw_serialize() with the format of serialize_message().
+/**
+ * \sa rmw_serialize()
+ */
+RMW_NATIVE_COMMON_PUBLIC
+rmw_ret_t
+serialize(
+  const void * ros_message,
+  const rosidl_message_type_support_t * type_support,
+  rmw_serialized_message_t * serialized_message);
+
+/// Implement rmw_deserialize() with the format of serialize_message().
+/**
+ * \sa rmw_deserialize()
+ */
+RMW_NATIVE_COMMON_PUBLIC
+rmw_ret_t
+deserialize(
+  const rmw_serialized_message_t * serialized_message,
+  const rosidl_message_type_support_t * type_support,
+  void * ros_message);
+
+/// Implement rmw_get_serialized_message_size(), which this format does not support.
+/**
+ * \return `RMW_RET_UNSUPPORTED`, with an error message set.
+ */
+RMW_NATIVE_COMMON_PUBLIC
+rmw_ret_t
+get_serialized_message_size(
+  const rosidl_message_type_support_t * type_support,
+  const rosidl_runtime_c__Sequence__bound * message_bounds,
+  size_t * size);
+
+}  // namespace rmw_native_common
+
+#endif  // RMW_NATIVE_COMMON__RMW_SERIALIZE_HPP_
@@ -0,0 +1,208 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_NATIVE_COMMON__TESTING__GRAPH_TESTS_HPP_
+#define RMW_NATIVE_COMMON__TESTING__GRAPH_TESTS_HPP_
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+
+#include "rcutils/allocator.h"
+#include "rcutils/types/string_array.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/get_node_info_and_types.h"
+#include "rmw/get_service_names_and_types.h"
+#include "rmw/get_topic_endpoint_info.h"
+#include "rmw/get_topic_names_and_types.h"
+#include "rmw/names_and_types.h"
+#include "rmw/qos_profiles.h"
+#include "rmw/rmw.h"
+#include "rmw/topic_endpoint_info_array.h"
+
+#include "rmw_native_common/testing/node_test.hpp"
+#include "rmw_native_common/testing/type_supports.hpp"
+
+namespace rmw_native_common
+{
+namespace testing
+{
+
+/// Graph queries, for each implementation to instantiate with a DomainIdParam.
+template<typename DomainIdT>
+class TestGraph : public NodeTest<DomainIdT::value>
+{
+protected:
+  void
+  SetUp() override
+  {
+    NodeTest<DomainIdT::value>::SetUp();
+    allocator = rcutils_get_default_allocator();
+    rmw_publisher_options_t publisher_options = rmw_get_default_publisher_options();
+    publisher = rmw_create_publisher(
+      this->node, get_message_type_support(), "/chatter", &rmw_qos_profile_default,
+      &publisher_options);
+    ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+    service = rmw_create_service(
+      this->node, get_service_type_support(), "/add_two_ints",
+      &rmw_qos_profile_services_default);
+    ASSERT_NE(nullptr, service) << rmw_get_error_string().str;
+  }
+
+  void
+  TearDown() override
+  {
+    EXPECT_EQ(RMW_RET_OK, rmw_destroy_service(this->node, service));
+    EXPECT_EQ(RMW_RET_OK, rmw_destroy_publisher(this->node, publisher));
+    NodeTest<DomainIdT::value>::TearDown();
+  }
+
+  rcutils_allocator_t allocator;
+  rmw_publisher_t * publisher{nullptr};
+  rmw_service_t * service{nullptr};
+};
+
+TYPED_TEST_SUITE_P(TestGraph);
+
+TYPED_TEST_P(TestGraph, node_names) {
+  rcutils_string_array_t node_names = rcutils_get_zero_initialized_string_array();
+  rcutils_string_array_t node_namespaces = rcutils_get_zero_initialized_string_array();
+  rcutils_string_array_t enclaves = rcutils_get_zero_initialized_string_array();
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_get_node_names_with_enclaves(this->node, &node_names, &node_namespaces, &enclaves)) <<
+    rmw_get_error_string().str;
+  ASSERT_EQ(1u, node_names.size);
+  EXPECT_EQ(std::string("test_node"), node_names.data[0]);
+  EXPECT_EQ(std::string("/test_ns"), node_namespaces.data[0]);
+  EXPECT_EQ(std::string("/"), enclaves.data[0]);
+  EXPECT_EQ(RCUTILS_RET_OK, rcutils_string_array_fini(&node_names));
+  EXPECT_EQ(RCUTILS_RET_OK, rcutils_string_array_fini(&node_namespaces));
+  EXPECT_EQ(RCUTILS_RET_OK, rcutils_string_array_fini(&enclaves));
+}
+
+TYPED_TEST_P(TestGraph, count_endpoints) {
+  size_t count = 0u;
+  EXPECT_EQ(RMW_RET_OK, rmw_count_publishers(this->node, "/chatter", &count));
+  EXPECT_EQ(1u, count);
+  EXPECT_EQ(RMW_RET_OK, rmw_count_subscribers(this->node, "/chatter", &count));
+  EXPECT_EQ(0u, count);
+  EXPECT_EQ(RMW_RET_OK, rmw_count_services(this->node, "/add_two_ints", &count));
+  EXPECT_EQ(1u, count);
+  EXPECT_EQ(RMW_RET_OK, rmw_count_clients(this->node, "/add_two_ints", &count));
+  EXPECT_EQ(0u, count);
+  EXPECT_EQ(RMW_RET_INVALID_ARGUMENT, rmw_count_publishers(this->node, "not a valid name", &count));
+  rmw_reset_error();
+}
+
+TYPED_TEST_P(TestGraph, names_and_types) {
+  rmw_names_and_types_t names_and_types = rmw_get_zero_initialized_names_and_types();
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_get_topic_names_and_types(this->node, &this->allocator, false, &names_and_types)) <<
+    rmw_get_error_string().str;
+  ASSERT_EQ(1u, names_and_types.names.size);
+  EXPECT_EQ(std::string("/chatter"), names_and_types.names.data[0]);
+  ASSERT_EQ(1u, names_and_types.types[0].size);
+  EXPECT_EQ(std::string("test_msgs/msg/Message"), names_and_types.types[0].data[0]);
+  EXPECT_EQ(RMW_RET_OK, rmw_names_and_types_fini(&names_and_types));
+
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_get_service_names_and_types(this->node, &this->allocator, &names_and_types)) <<
+    rmw_get_error_string().str;
+  ASSERT_EQ(1u, names_and_types.names.size);
+  EXPECT_EQ(std::string("/add_two_ints"), names_and_types.names.data[0]);
+  ASSERT_EQ(1u, names_and_types.types[0].size);
+  EXPECT_EQ(std::string("test_msgs/srv/AddTwoInts"), names_and_types.types[0].data[0]);
+  EXPECT_EQ(RMW_RET_OK, rmw_names_and_types_fini(&names_and_types));
+}
+
+TYPED_TEST_P(TestGraph, names_and_types_by_node) {
+  rmw_names_and_types_t names_and_types = rmw_get_zero_initialized_names_and_types();
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_get_publisher_names_and_types_by_node(
+      this->node, &this->allocator, "test_node", "/test_ns", false, &names_and_types)) <<
+    rmw_get_error_string().str;
+  ASSERT_EQ(1u, names_and_types.names.size);
+  EXPECT_EQ(std::string("/chatter"), names_and_types.names.data[0]);
+  EXPECT_EQ(RMW_RET_OK, rmw_names_and_types_fini(&names_and_types));
+
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_get_subscriber_names_and_types_by_node(
+      this->node, &this->allocator, "test_node", "/test_ns", false, &names_and_types)) <<
+    rmw_get_error_string().str;
+  EXPECT_EQ(0u, names_and_types.names.size);
+
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_get_service_names_and_types_by_node(
+      this->node, &this->allocator, "test_node", "/test_ns", &names_and_types)) <<
+    rmw_get_error_string().str;
+  ASSERT_EQ(1u, names_and_types.names.size);
+  EXPECT_EQ(std::string("/add_two_ints"), names_and_types.names.data[0]);
+  EXPECT_EQ(RMW_RET_OK, rmw_names_and_types_fini(&names_and_types));
+
+  EXPECT_EQ(
+    RMW_RET_NODE_NAME_NON_EXISTENT,
+    rmw_get_client_names_and_types_by_node(
+      this->node, &this->allocator, "other_node", "/test_ns", &names_and_types));
+  rmw_reset_error();
+}
+
+TYPED_TEST_P(TestGraph, endpoints_info) {
+  rmw_topic_endpoint_info_array_t publishers_info =
+    rmw_get_zero_initialized_topic_endpoint_info_array();
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_get_publishers_info_by_topic(
+      this->node, &this->allocator, "/chatter", false, &publishers_info)) <<
+    rmw_get_error_string().str;
+  ASSERT_EQ(1u, publishers_info.size);
+  const rmw_topic_endpoint_info_t & info = publishers_info.info_array[0];
+  EXPECT_EQ(std::string("test_node"), info.node_name);
+  EXPECT_EQ(std::string("/test_ns"), info.node_namespace);
+  EXPECT_EQ(std::string("test_msgs/msg/Message"), info.topic_type);
+  EXPECT_EQ(RMW_ENDPOINT_PUBLISHER, info.endpoint_type);
+  rmw_gid_t gid;
+  ASSERT_EQ(RMW_RET_OK, rmw_get_gid_for_publisher(this->publisher, &gid));
+  EXPECT_EQ(0, memcmp(gid.data, info.endpoint_gid, sizeof(gid.data)));
+  EXPECT_EQ(RMW_RET_OK, rmw_topic_endpoint_info_array_fini(&publishers_info, &this->allocator));
+
+  rmw_topic_endpoint_info_array_t subscriptions_info =
+    rmw_get_zero_initialized_topic_endpoint_info_array();
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_get_subscriptions_info_by_topic(
+      this->node, &this->allocator, "/chatter", false, &subscriptions_info)) <<
+    rmw_get_error_string().str;
+  EXPECT_EQ(0u, subscriptions_info.size);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(
+  TestGraph,
+  node_names,
+  count_endpoints,
+  names_and_types,
+  names_and_types_by_node,
+  endpoints_info);
+
+}  // namespace testing
+}  // namespace rmw_native_common
+
+#endif  // RMW_NATIVE_COMMON__TESTING__GRAPH_TESTS_HPP_
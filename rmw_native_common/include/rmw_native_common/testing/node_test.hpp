@@ -0,0 +1,94 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_NATIVE_COMMON__TESTING__NODE_TEST_HPP_
+#define RMW_NATIVE_COMMON__TESTING__NODE_TEST_HPP_
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <type_traits>
+
+#include "rcutils/allocator.h"
+#include "rcutils/strdup.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/init.h"
+#include "rmw/init_options.h"
+#include "rmw/rmw.h"
+
+namespace rmw_native_common
+{
+namespace testing
+{
+
+/// Fixture providing an initialized context of the implementation under test, and a node.
+/**
+ * Test executables running in parallel may use domains of their own, so that
+ * they do not see each other.
+ */
+template<size_t DomainId>
+class NodeTest : public ::testing::Test
+{
+protected:
+  void
+  SetUp() override
+  {
+    rmw_init_options_t options = rmw_get_zero_initialized_init_options();
+    ASSERT_EQ(RMW_RET_OK, rmw_init_options_init(&options, rcutils_get_default_allocator())) <<
+      rmw_get_error_string().str;
+    options.domain_id = DomainId;
+    options.enclave = rcutils_strdup("/", rcutils_get_default_allocator());
+    ASSERT_NE(nullptr, options.enclave);
+    context = rmw_get_zero_initialized_context();
+    rmw_ret_t ret = rmw_init(&options, &context);
+    EXPECT_EQ(RMW_RET_OK, rmw_init_options_fini(&options)) << rmw_get_error_string().str;
+    ASSERT_EQ(RMW_RET_OK, ret) << rmw_get_error_string().str;
+    node = rmw_create_node(&context, "test_node", "/test_ns");
+    ASSERT_NE(nullptr, node) << rmw_get_error_string().str;
+  }
+
+  void
+  TearDown() override
+  {
+    EXPECT_EQ(RMW_RET_OK, rmw_destroy_node(node)) << rmw_get_error_string().str;
+    EXPECT_EQ(RMW_RET_OK, rmw_shutdown(&context)) << rmw_get_error_string().str;
+    EXPECT_EQ(RMW_RET_OK, rmw_context_fini(&context)) << rmw_get_error_string().str;
+    rmw_reset_error();
+  }
+
+  rmw_context_t context;
+  rmw_node_t * node{nullptr};
+};
+
+/// Type parameter of the typed test suites of this directory, selecting the domain id to use.
+/**
+ * Suites are instantiated within this namespace, by each implementation:
+ * \code
+ * namespace rmw_native_common
+ * {
+ * namespace testing
+ * {
+ * INSTANTIATE_TYPED_TEST_SUITE_P(Shm, TestGraph, DomainIdParam<104u>);
+ * }  // namespace testing
+ * }  // namespace rmw_native_common
+ * \endcode
+ */
+template<size_t DomainId>
+using DomainIdParam = std::integral_constant<size_t, DomainId>;
+
+}  // namespace testing
+}  // namespace rmw_native_common
+
+#endif  // RMW_NATIVE_COMMON__TESTING__NODE_TEST_HPP_
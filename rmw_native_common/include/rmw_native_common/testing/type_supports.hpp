@@ -0,0 +1,291 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_NATIVE_COMMON__TESTING__TYPE_SUPPORTS_HPP_
+#define RMW_NATIVE_COMMON__TESTING__TYPE_SUPPORTS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "rosidl_runtime_c/message_type_support_struct.h"
+#include "rosidl_runtime_c/primitives_sequence.h"
+#include "rosidl_runtime_c/primitives_sequence_functions.h"
+#include "rosidl_runtime_c/service_type_support_struct.h"
+#include "rosidl_runtime_c/string.h"
+#include "rosidl_runtime_c/string_functions.h"
+#include "rosidl_typesupport_introspection_c/field_types.h"
+#include "rosidl_typesupport_introspection_c/identifier.h"
+#include "rosidl_typesupport_introspection_c/message_introspection.h"
+#include "rosidl_typesupport_introspection_c/service_introspection.h"
+
+// Type supports are put together by hand, as generated ones would be,
+// so that tests and benchmarks do not depend on any interface package.
+
+namespace rmw_native_common
+{
+namespace testing
+{
+
+namespace detail
+{
+
+template<typename SequenceT>
+size_t
+sequence_size(const void * untyped_sequence)
+{
+  return static_cast<const SequenceT *>(untyped_sequence)->size;
+}
+
+template<typename SequenceT>
+const void *
+sequence_get_const(const void * untyped_sequence, size_t index)
+{
+  return &static_cast<const SequenceT *>(untyped_sequence)->data[index];
+}
+
+template<typename SequenceT>
+void *
+sequence_get(void * untyped_sequence, size_t index)
+{
+  return &static_cast<SequenceT *>(untyped_sequence)->data[index];
+}
+
+template<typename SequenceT, bool (*Init)(SequenceT *, size_t), void (*Fini)(SequenceT *)>
+bool
+sequence_resize(void * untyped_sequence, size_t size)
+{
+  auto sequence = static_cast<SequenceT *>(untyped_sequence);
+  Fini(sequence);
+  return Init(sequence, size);
+}
+
+}  // namespace detail
+
+/// Make the member `name` of a message, found at `offset` in its struct.
+inline rosidl_typesupport_introspection_c__MessageMember
+make_member(const char * name, uint8_t type_id, size_t offset)
+{
+  rosidl_typesupport_introspection_c__MessageMember member{};
+  member.name_ = name;
+  member.type_id_ = type_id;
+  member.offset_ = static_cast<uint32_t>(offset);
+  return member;
+}
+
+/// Make the member `name` of a message, an unbounded sequence of primitive values.
+/**
+ * \tparam SequenceT the sequence struct, e.g. rosidl_runtime_c__int32__Sequence.
+ * \tparam Init the function initializing `SequenceT`, used to resize it.
+ * \tparam Fini the function finalizing `SequenceT`, used to resize it.
+ */
+template<typename SequenceT, bool (*Init)(SequenceT *, size_t), void (*Fini)(SequenceT *)>
+rosidl_typesupport_introspection_c__MessageMember
+make_sequence_member(const char * name, uint8_t type_id, size_t offset)
+{
+  rosidl_typesupport_introspection_c__MessageMember member = make_member(name, type_id, offset);
+  member.is_array_ = true;
+  member.size_function = detail::sequence_size<SequenceT>;
+  member.get_const_function = detail::sequence_get_const<SequenceT>;
+  member.get_function = detail::sequence_get<SequenceT>;
+  member.resize_function = detail::sequence_resize<SequenceT, Init, Fini>;
+  return member;
+}
+
+/// Make the members of a message type, e.g. "test_msgs__msg" and "Message".
+inline rosidl_typesupport_introspection_c__MessageMembers
+make_message_members(
+  const char * message_namespace,
+  const char * message_name,
+  size_t size_of,
+  const rosidl_typesupport_introspection_c__MessageMember * members,
+  uint32_t member_count)
+{
+  rosidl_typesupport_introspection_c__MessageMembers message_members{};
+  message_members.message_namespace_ = message_namespace;
+  message_members.message_name_ = message_name;
+  message_members.member_count_ = member_count;
+  message_members.size_of_ = size_of;
+  message_members.members_ = members;
+  return message_members;
+}
+
+inline rosidl_message_type_support_t
+make_message_type_support(const rosidl_typesupport_introspection_c__MessageMembers * members)
+{
+  rosidl_message_type_support_t type_support{};
+  type_support.typesupport_identifier = rosidl_typesupport_introspection_c__identifier;
+  type_support.data = members;
+  type_support.func = get_message_typesupport_handle_function;
+  return type_support;
+}
+
+/// Make the members of a service type, e.g. "test_msgs__srv" and "AddTwoInts".
+inline rosidl_typesupport_introspection_c__ServiceMembers
+make_service_members(
+  const char * service_namespace,
+  const char * service_name,
+  const rosidl_typesupport_introspection_c__MessageMembers * request,
+  const rosidl_typesupport_introspection_c__MessageMembers * response)
+{
+  rosidl_typesupport_introspection_c__ServiceMembers service_members{};
+  service_members.service_namespace_ = service_namespace;
+  service_members.service_name_ = service_name;
+  service_members.request_members_ = request;
+  service_members.response_members_ = response;
+  return service_members;
+}
+
+inline rosidl_service_type_support_t
+make_service_type_support(const rosidl_typesupport_introspection_c__ServiceMembers * members)
+{
+  rosidl_service_type_support_t type_support{};
+  type_support.typesupport_identifier = rosidl_typesupport_introspection_c__identifier;
+  type_support.data = members;
+  type_support.func = get_service_typesupport_handle_function;
+  return type_support;
+}
+
+struct Message
+{
+  int32_t count;
+  double value;
+  rosidl_runtime_c__String text;
+  rosidl_runtime_c__int32__Sequence numbers;
+};
+
+/// Initialize an empty Message.
+/**
+ * \return `true` if successful, or
+ * \return `false` if memory could not be allocated.
+ */
+inline bool
+init_message(Message * message)
+{
+  message->count = 0;
+  message->value = 0.0;
+  if (!rosidl_runtime_c__String__init(&message->text)) {
+    return false;
+  }
+  if (!rosidl_runtime_c__int32__Sequence__init(&message->numbers, 0u)) {
+    rosidl_runtime_c__String__fini(&message->text);
+    return false;
+  }
+  return true;
+}
+
+inline void
+fini_message(Message * message)
+{
+  rosidl_runtime_c__String__fini(&message->text);
+  rosidl_runtime_c__int32__Sequence__fini(&message->numbers);
+}
+
+/// Message without strings nor sequences, which can be loaned.
+struct PlainMessage
+{
+  int64_t count;
+  double values[16];
+};
+
+struct AddTwoIntsRequest
+{
+  int64_t a;
+  int64_t b;
+};
+
+struct AddTwoIntsResponse
+{
+  int64_t sum;
+};
+
+/// Type support of Message, as "test_msgs/msg/Message".
+inline const rosidl_message_type_support_t *
+get_message_type_support()
+{
+  static const rosidl_typesupport_introspection_c__MessageMember members[] = {
+    make_member(
+      "count", rosidl_typesupport_introspection_c__ROS_TYPE_INT32, offsetof(Message, count)),
+    make_member(
+      "value", rosidl_typesupport_introspection_c__ROS_TYPE_DOUBLE, offsetof(Message, value)),
+    make_member(
+      "text", rosidl_typesupport_introspection_c__ROS_TYPE_STRING, offsetof(Message, text)),
+    make_sequence_member<
+      rosidl_runtime_c__int32__Sequence,
+      rosidl_runtime_c__int32__Sequence__init,
+      rosidl_runtime_c__int32__Sequence__fini>(
+      "numbers", rosidl_typesupport_introspection_c__ROS_TYPE_INT32, offsetof(Message, numbers)),
+  };
+  static const rosidl_typesupport_introspection_c__MessageMembers message_members =
+    make_message_members("test_msgs__msg", "Message", sizeof(Message), members, 4u);
+  static const rosidl_message_type_support_t type_support =
+    make_message_type_support(&message_members);
+  return &type_support;
+}
+
+/// Type support of PlainMessage, as "test_msgs/msg/PlainMessage".
+inline const rosidl_message_type_support_t *
+get_plain_message_type_support()
+{
+  static const rosidl_typesupport_introspection_c__MessageMember members[] = {
+    make_member(
+      "count", rosidl_typesupport_introspection_c__ROS_TYPE_INT64,
+      offsetof(PlainMessage, count)),
+    [] {
+      auto member = make_member(
+        "values", rosidl_typesupport_introspection_c__ROS_TYPE_DOUBLE,
+        offsetof(PlainMessage, values));
+      member.is_array_ = true;
+      member.array_size_ = 16u;
+      return member;
+    }(),
+  };
+  static const rosidl_typesupport_introspection_c__MessageMembers message_members =
+    make_message_members("test_msgs__msg", "PlainMessage", sizeof(PlainMessage), members, 2u);
+  static const rosidl_message_type_support_t type_support =
+    make_message_type_support(&message_members);
+  return &type_support;
+}
+
+/// Type support of AddTwoInts, as "test_msgs/srv/AddTwoInts".
+inline const rosidl_service_type_support_t *
+get_service_type_support()
+{
+  static const rosidl_typesupport_introspection_c__MessageMember request_members[] = {
+    make_member(
+      "a", rosidl_typesupport_introspection_c__ROS_TYPE_INT64, offsetof(AddTwoIntsRequest, a)),
+    make_member(
+      "b", rosidl_typesupport_introspection_c__ROS_TYPE_INT64, offsetof(AddTwoIntsRequest, b)),
+  };
+  static const rosidl_typesupport_introspection_c__MessageMember response_members[] = {
+    make_member(
+      "sum", rosidl_typesupport_introspection_c__ROS_TYPE_INT64,
+      offsetof(AddTwoIntsResponse, sum)),
+  };
+  static const rosidl_typesupport_introspection_c__MessageMembers request =
+    make_message_members(
+    "test_msgs__srv", "AddTwoInts_Request", sizeof(AddTwoIntsRequest), request_members, 2u);
+  static const rosidl_typesupport_introspection_c__MessageMembers response =
+    make_message_members(
+    "test_msgs__srv", "AddTwoInts_Response", sizeof(AddTwoIntsResponse), response_members, 1u);
+  static const rosidl_typesupport_introspection_c__ServiceMembers service_members =
+    make_service_members("test_msgs__srv", "AddTwoInts", &request, &response);
+  static const rosidl_service_type_support_t type_support =
+    make_service_type_support(&service_members);
+  return &type_support;
+}
+
+}  // namespace testing
+}  // namespace rmw_native_common
+
+#endif  // RMW_NATIVE_COMMON__TESTING__TYPE_SUPPORTS_HPP_
@@ -0,0 +1,254 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_NATIVE_COMMON__TESTING__WAIT_TESTS_HPP_
+#define RMW_NATIVE_COMMON__TESTING__WAIT_TESTS_HPP_
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include "rmw/error_handling.h"
+#include "rmw/qos_profiles.h"
+#include "rmw/rmw.h"
+
+#include "rmw_native_common/testing/node_test.hpp"
+#include "rmw_native_common/testing/type_supports.hpp"
+
+namespace rmw_native_common
+{
+namespace testing
+{
+
+/// Waits on all kinds of entities, for each implementation to instantiate with a DomainIdParam.
+template<typename DomainIdT>
+class TestWait : public NodeTest<DomainIdT::value>
+{
+protected:
+  void
+  SetUp() override
+  {
+    NodeTest<DomainIdT::value>::SetUp();
+    wait_set = rmw_create_wait_set(&this->context, 0u);
+    ASSERT_NE(nullptr, wait_set) << rmw_get_error_string().str;
+  }
+
+  void
+  TearDown() override
+  {
+    EXPECT_EQ(RMW_RET_OK, rmw_destroy_wait_set(wait_set)) << rmw_get_error_string().str;
+    NodeTest<DomainIdT::value>::TearDown();
+  }
+
+  rmw_wait_set_t * wait_set{nullptr};
+};
+
+TYPED_TEST_SUITE_P(TestWait);
+
+TYPED_TEST_P(TestWait, timeout) {
+  rmw_guard_condition_t * guard_condition = rmw_create_guard_condition(&this->context);
+  ASSERT_NE(nullptr, guard_condition) << rmw_get_error_string().str;
+
+  void * guard_condition_handles[] = {guard_condition->data};
+  rmw_guard_conditions_t guard_conditions = {1u, guard_condition_handles};
+  rmw_time_t timeout = {0u, 10000000u};
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(
+    RMW_RET_TIMEOUT,
+    rmw_wait(nullptr, &guard_conditions, nullptr, nullptr, nullptr, this->wait_set, &timeout));
+  EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(10));
+  EXPECT_EQ(nullptr, guard_condition_handles[0]);
+
+  // A zero timeout does not block.
+  guard_condition_handles[0] = guard_condition->data;
+  timeout = {0u, 0u};
+  EXPECT_EQ(
+    RMW_RET_TIMEOUT,
+    rmw_wait(nullptr, &guard_conditions, nullptr, nullptr, nullptr, this->wait_set, &timeout));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_guard_condition(guard_condition));
+}
+
+TYPED_TEST_P(TestWait, guard_condition) {
+  rmw_guard_condition_t * guard_condition = rmw_create_guard_condition(&this->context);
+  ASSERT_NE(nullptr, guard_condition) << rmw_get_error_string().str;
+
+  // Already triggered guard conditions are ready at once, even with no timeout.
+  ASSERT_EQ(RMW_RET_OK, rmw_trigger_guard_condition(guard_condition));
+  void * guard_condition_handles[] = {guard_condition->data};
+  rmw_guard_conditions_t guard_conditions = {1u, guard_condition_handles};
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_wait(nullptr, &guard_conditions, nullptr, nullptr, nullptr, this->wait_set, nullptr));
+  EXPECT_EQ(guard_condition->data, guard_condition_handles[0]);
+
+  // Waiting clears the trigger.
+  rmw_time_t timeout = {0u, 0u};
+  EXPECT_EQ(
+    RMW_RET_TIMEOUT,
+    rmw_wait(nullptr, &guard_conditions, nullptr, nullptr, nullptr, this->wait_set, &timeout));
+
+  // Triggering from another thread wakes up the waiting one.
+  guard_condition_handles[0] = guard_condition->data;
+  std::thread trigger_thread(
+    [guard_condition]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      EXPECT_EQ(RMW_RET_OK, rmw_trigger_guard_condition(guard_condition));
+    });
+  timeout = {10u, 0u};
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_wait(nullptr, &guard_conditions, nullptr, nullptr, nullptr, this->wait_set, &timeout));
+  EXPECT_EQ(guard_condition->data, guard_condition_handles[0]);
+  trigger_thread.join();
+
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_guard_condition(guard_condition));
+}
+
+TYPED_TEST_P(TestWait, subscription) {
+  rmw_publisher_options_t publisher_options = rmw_get_default_publisher_options();
+  rmw_publisher_t * publisher = rmw_create_publisher(
+    this->node, get_message_type_support(), "/chatter", &rmw_qos_profile_default,
+    &publisher_options);
+  ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+  rmw_subscription_options_t subscription_options = rmw_get_default_subscription_options();
+  rmw_subscription_t * subscription = rmw_create_subscription(
+    this->node, get_message_type_support(), "/chatter", &rmw_qos_profile_default,
+    &subscription_options);
+  ASSERT_NE(nullptr, subscription) << rmw_get_error_string().str;
+
+  Message message;
+  ASSERT_TRUE(init_message(&message));
+  std::thread publish_thread(
+    [publisher, &message]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      EXPECT_EQ(RMW_RET_OK, rmw_publish(publisher, &message, nullptr));
+    });
+  void * subscription_handles[] = {subscription->data};
+  rmw_subscriptions_t subscriptions = {1u, subscription_handles};
+  // Overly large timeouts behave as no timeout.
+  rmw_time_t timeout = {UINT64_MAX, 0u};
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_wait(&subscriptions, nullptr, nullptr, nullptr, nullptr, this->wait_set, &timeout));
+  EXPECT_EQ(subscription->data, subscription_handles[0]);
+  publish_thread.join();
+
+  // The subscription stays ready until the message is taken.
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_wait(&subscriptions, nullptr, nullptr, nullptr, nullptr, this->wait_set, &timeout));
+  bool taken = false;
+  EXPECT_EQ(RMW_RET_OK, rmw_take(subscription, &message, &taken, nullptr));
+  EXPECT_TRUE(taken);
+  timeout = {0u, 0u};
+  EXPECT_EQ(
+    RMW_RET_TIMEOUT,
+    rmw_wait(&subscriptions, nullptr, nullptr, nullptr, nullptr, this->wait_set, &timeout));
+  EXPECT_EQ(nullptr, subscription_handles[0]);
+
+  fini_message(&message);
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_subscription(this->node, subscription));
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_publisher(this->node, publisher));
+}
+
+TYPED_TEST_P(TestWait, graph_guard_condition) {
+  const rmw_guard_condition_t * graph_guard_condition =
+    rmw_node_get_graph_guard_condition(this->node);
+  ASSERT_NE(nullptr, graph_guard_condition) << rmw_get_error_string().str;
+  void * guard_condition_handles[] = {graph_guard_condition->data};
+  rmw_guard_conditions_t guard_conditions = {1u, guard_condition_handles};
+  rmw_time_t timeout = {0u, 0u};
+  // The creation of the this->node triggered it already, waiting clears that.
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_wait(nullptr, &guard_conditions, nullptr, nullptr, nullptr, this->wait_set, &timeout));
+  EXPECT_EQ(
+    RMW_RET_TIMEOUT,
+    rmw_wait(nullptr, &guard_conditions, nullptr, nullptr, nullptr, this->wait_set, &timeout));
+
+  guard_condition_handles[0] = graph_guard_condition->data;
+  rmw_publisher_options_t publisher_options = rmw_get_default_publisher_options();
+  rmw_publisher_t * publisher = rmw_create_publisher(
+    this->node, get_message_type_support(), "/chatter", &rmw_qos_profile_default,
+    &publisher_options);
+  ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_wait(nullptr, &guard_conditions, nullptr, nullptr, nullptr, this->wait_set, &timeout));
+  EXPECT_EQ(graph_guard_condition->data, guard_condition_handles[0]);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_publisher(this->node, publisher));
+}
+
+TYPED_TEST_P(TestWait, service_and_client) {
+  rmw_service_t * service = rmw_create_service(
+    this->node, get_service_type_support(), "/add_two_ints",
+    &rmw_qos_profile_services_default);
+  ASSERT_NE(nullptr, service) << rmw_get_error_string().str;
+  rmw_client_t * client = rmw_create_client(
+    this->node, get_service_type_support(), "/add_two_ints",
+    &rmw_qos_profile_services_default);
+  ASSERT_NE(nullptr, client) << rmw_get_error_string().str;
+
+  void * service_handles[] = {service->data};
+  rmw_services_t services = {1u, service_handles};
+  void * client_handles[] = {client->data};
+  rmw_clients_t clients = {1u, client_handles};
+  rmw_time_t timeout = {0u, 0u};
+  EXPECT_EQ(
+    RMW_RET_TIMEOUT,
+    rmw_wait(nullptr, nullptr, &services, &clients, nullptr, this->wait_set, &timeout));
+
+  AddTwoIntsRequest request{1, 2};
+  int64_t sequence_id = 0;
+  ASSERT_EQ(RMW_RET_OK, rmw_send_request(client, &request, &sequence_id));
+  service_handles[0] = service->data;
+  client_handles[0] = client->data;
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_wait(nullptr, nullptr, &services, &clients, nullptr, this->wait_set, &timeout));
+  EXPECT_EQ(service->data, service_handles[0]);
+  EXPECT_EQ(nullptr, client_handles[0]);
+
+  rmw_service_info_t request_header{};
+  bool taken = false;
+  ASSERT_EQ(RMW_RET_OK, rmw_take_request(service, &request_header, &request, &taken));
+  AddTwoIntsResponse response{3};
+  ASSERT_EQ(RMW_RET_OK, rmw_send_response(service, &request_header.request_id, &response));
+  service_handles[0] = service->data;
+  client_handles[0] = client->data;
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_wait(nullptr, nullptr, &services, &clients, nullptr, this->wait_set, &timeout));
+  EXPECT_EQ(nullptr, service_handles[0]);
+  EXPECT_EQ(client->data, client_handles[0]);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_client(this->node, client));
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_service(this->node, service));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(
+  TestWait,
+  timeout,
+  guard_condition,
+  subscription,
+  graph_guard_condition,
+  service_and_client);
+
+}  // namespace testing
+}  // namespace rmw_native_common
+
+#endif  // RMW_NATIVE_COMMON__TESTING__WAIT_TESTS_HPP_
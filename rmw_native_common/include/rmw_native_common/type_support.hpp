@@ -0,0 +1,117 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_NATIVE_COMMON__TYPE_SUPPORT_HPP_
+#define RMW_NATIVE_COMMON__TYPE_SUPPORT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "rosidl_runtime_c/message_type_support_struct.h"
+#include "rosidl_runtime_c/service_type_support_struct.h"
+#include "rosidl_runtime_c/type_hash.h"
+#include "rosidl_typesupport_introspection_c/message_introspection.h"
+#include "rosidl_typesupport_introspection_c/service_introspection.h"
+
+#include "rmw_native_common/visibility_control.h"
+
+namespace rmw_native_common
+{
+
+using MessageMembers = rosidl_typesupport_introspection_c__MessageMembers;
+using MessageMember = rosidl_typesupport_introspection_c__MessageMember;
+using ServiceMembers = rosidl_typesupport_introspection_c__ServiceMembers;
+
+/// Get the C introspection members of a message type.
+/**
+ * \return the members of the message type, or
+ * \return `nullptr`, with an error message set, if the type has no C introspection type support.
+ */
+RMW_NATIVE_COMMON_PUBLIC
+const MessageMembers *
+get_message_members(const rosidl_message_type_support_t * type_support);
+
+/// Get the C introspection members of a service type.
+/**
+ * \return the members of the service type, or
+ * \return `nullptr`, with an error message set, if the type has no C introspection type support.
+ */
+RMW_NATIVE_COMMON_PUBLIC
+const ServiceMembers *
+get_service_members(const rosidl_service_type_support_t * type_support);
+
+/// Get the hash of a message or service type, or a zero hash if the type support has none.
+RMW_NATIVE_COMMON_PUBLIC
+rosidl_type_hash_t
+get_type_hash(const rosidl_message_type_support_t * type_support);
+
+RMW_NATIVE_COMMON_PUBLIC
+rosidl_type_hash_t
+get_type_hash(const rosidl_service_type_support_t * type_support);
+
+/// Get the fully qualified name of a message type, e.g. "std_msgs/msg/String".
+RMW_NATIVE_COMMON_PUBLIC
+std::string
+get_type_name(const MessageMembers * members);
+
+/// Get the fully qualified name of a service type, e.g. "std_srvs/srv/Empty".
+RMW_NATIVE_COMMON_PUBLIC
+std::string
+get_type_name(const ServiceMembers * members);
+
+/// Check whether messages of a type are made of primitive values and fixed size arrays only.
+/**
+ * Such messages own no memory outside of their struct, so they can be copied
+ * as is, and built in place in shared memory.
+ */
+RMW_NATIVE_COMMON_PUBLIC
+bool
+is_plain(const MessageMembers * members);
+
+/// Serialize a message, replacing the contents of `buffer`.
+/**
+ * Messages never leave the host, so they are serialized in native byte
+ * order without any padding.
+ * Primitive values are stored as is, while strings and sequences are stored
+ * as a 32 bits length followed by their elements.
+ *
+ * \return `true` if successful, or
+ * \return `false` if the message has members this format cannot represent.
+ * \throws std::bad_alloc if `buffer` cannot grow.
+ */
+RMW_NATIVE_COMMON_PUBLIC
+bool
+serialize_message(
+  const MessageMembers * members,
+  const void * ros_message,
+  std::vector<uint8_t> & buffer);
+
+/// Deserialize a message produced by serialize_message() into an initialized message.
+/**
+ * \return `true` if successful, or
+ * \return `false` if the data is truncated or does not match the message type.
+ */
+RMW_NATIVE_COMMON_PUBLIC
+bool
+deserialize_message(
+  const MessageMembers * members,
+  const uint8_t * data,
+  size_t length,
+  void * ros_message);
+
+}  // namespace rmw_native_common
+
+#endif  // RMW_NATIVE_COMMON__TYPE_SUPPORT_HPP_
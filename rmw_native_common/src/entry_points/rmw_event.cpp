@@ -0,0 +1,74 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw/error_handling.h"
+#include "rmw/event.h"
+#include "rmw/rmw.h"
+
+// QoS are never violated within a host, so there are no events to report.
+
+extern "C"
+{
+rmw_ret_t
+rmw_publisher_event_init(
+  rmw_event_t * rmw_event,
+  const rmw_publisher_t * publisher,
+  rmw_event_type_t event_type)
+{
+  (void)rmw_event;
+  (void)publisher;
+  (void)event_type;
+  RMW_SET_ERROR_MSG("rmw_publisher_event_init is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+
+rmw_ret_t
+rmw_subscription_event_init(
+  rmw_event_t * rmw_event,
+  const rmw_subscription_t * subscription,
+  rmw_event_type_t event_type)
+{
+  (void)rmw_event;
+  (void)subscription;
+  (void)event_type;
+  RMW_SET_ERROR_MSG("rmw_subscription_event_init is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+
+rmw_ret_t
+rmw_take_event(
+  const rmw_event_t * event_handle,
+  void * event_info,
+  bool * taken)
+{
+  (void)event_handle;
+  (void)event_info;
+  (void)taken;
+  RMW_SET_ERROR_MSG("rmw_take_event is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+
+rmw_ret_t
+rmw_event_set_callback(
+  rmw_event_t * event,
+  rmw_event_callback_t callback,
+  const void * user_data)
+{
+  (void)event;
+  (void)callback;
+  (void)user_data;
+  RMW_SET_ERROR_MSG("rmw_event_set_callback is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+}  // extern "C"
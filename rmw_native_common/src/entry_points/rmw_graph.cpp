@@ -0,0 +1,295 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+
+#include "rcutils/types/string_array.h"
+
+#include "rmw/check_type_identifiers_match.h"
+#include "rmw/error_handling.h"
+#include "rmw/get_node_info_and_types.h"
+#include "rmw/get_service_names_and_types.h"
+#include "rmw/get_topic_endpoint_info.h"
+#include "rmw/get_topic_names_and_types.h"
+#include "rmw/names_and_types.h"
+#include "rmw/rmw.h"
+#include "rmw/topic_endpoint_info_array.h"
+
+#include "rmw_native_common/graph.hpp"
+
+namespace
+{
+
+using rmw_native_common::EndpointKind;
+
+rmw_ret_t
+check_node(const rmw_node_t * node)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(node, RMW_RET_INVALID_ARGUMENT);
+  const char * identifier = rmw_get_implementation_identifier();
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    node,
+    node->implementation_identifier,
+    identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+get_node_names(
+  const rmw_node_t * node,
+  rcutils_string_array_t * node_names,
+  rcutils_string_array_t * node_namespaces,
+  rcutils_string_array_t * enclaves)
+{
+  rmw_ret_t ret = check_node(node);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  return rmw_native_common::get_node_names(
+    rmw_native_common::get_graph(node), &node->context->options.allocator, node_names,
+    node_namespaces, enclaves);
+}
+
+rmw_ret_t
+count_endpoints(
+  const rmw_node_t * node,
+  const char * name,
+  size_t * count,
+  EndpointKind kind)
+{
+  rmw_ret_t ret = check_node(node);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  return rmw_native_common::count_endpoints(
+    rmw_native_common::get_graph(node), kind, name, count);
+}
+
+rmw_ret_t
+get_names_and_types_by_node(
+  const rmw_node_t * node,
+  rcutils_allocator_t * allocator,
+  const char * node_name,
+  const char * node_namespace,
+  rmw_names_and_types_t * names_and_types,
+  EndpointKind kind)
+{
+  rmw_ret_t ret = check_node(node);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  return rmw_native_common::get_names_and_types_by_node(
+    rmw_native_common::get_graph(node), kind, allocator, node_name, node_namespace,
+    names_and_types);
+}
+
+rmw_ret_t
+get_endpoints_info_by_topic(
+  const rmw_node_t * node,
+  rcutils_allocator_t * allocator,
+  const char * topic_name,
+  rmw_topic_endpoint_info_array_t * endpoints_info,
+  EndpointKind kind)
+{
+  rmw_ret_t ret = check_node(node);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  return rmw_native_common::get_endpoints_info_by_topic(
+    rmw_native_common::get_graph(node), kind, allocator, topic_name, endpoints_info);
+}
+
+}  // namespace
+
+extern "C"
+{
+rmw_ret_t
+rmw_get_node_names(
+  const rmw_node_t * node,
+  rcutils_string_array_t * node_names,
+  rcutils_string_array_t * node_namespaces)
+{
+  return get_node_names(node, node_names, node_namespaces, nullptr);
+}
+
+rmw_ret_t
+rmw_get_node_names_with_enclaves(
+  const rmw_node_t * node,
+  rcutils_string_array_t * node_names,
+  rcutils_string_array_t * node_namespaces,
+  rcutils_string_array_t * enclaves)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(enclaves, RMW_RET_INVALID_ARGUMENT);
+  return get_node_names(node, node_names, node_namespaces, enclaves);
+}
+
+rmw_ret_t
+rmw_count_publishers(const rmw_node_t * node, const char * topic_name, size_t * count)
+{
+  return count_endpoints(node, topic_name, count, EndpointKind::publisher);
+}
+
+rmw_ret_t
+rmw_count_subscribers(const rmw_node_t * node, const char * topic_name, size_t * count)
+{
+  return count_endpoints(node, topic_name, count, EndpointKind::subscription);
+}
+
+rmw_ret_t
+rmw_count_clients(const rmw_node_t * node, const char * service_name, size_t * count)
+{
+  return count_endpoints(node, service_name, count, EndpointKind::client);
+}
+
+rmw_ret_t
+rmw_count_services(const rmw_node_t * node, const char * service_name, size_t * count)
+{
+  return count_endpoints(node, service_name, count, EndpointKind::service);
+}
+
+rmw_ret_t
+rmw_get_topic_names_and_types(
+  const rmw_node_t * node,
+  rcutils_allocator_t * allocator,
+  bool no_demangle,
+  rmw_names_and_types_t * topic_names_and_types)
+{
+  // Names are never mangled, there is nothing to demangle.
+  (void)no_demangle;
+  rmw_ret_t ret = check_node(node);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  return rmw_native_common::get_topic_names_and_types(
+    rmw_native_common::get_graph(node), allocator, topic_names_and_types);
+}
+
+rmw_ret_t
+rmw_get_service_names_and_types(
+  const rmw_node_t * node,
+  rcutils_allocator_t * allocator,
+  rmw_names_and_types_t * service_names_and_types)
+{
+  rmw_ret_t ret = check_node(node);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  return rmw_native_common::get_service_names_and_types(
+    rmw_native_common::get_graph(node), allocator, service_names_and_types);
+}
+
+rmw_ret_t
+rmw_get_subscriber_names_and_types_by_node(
+  const rmw_node_t * node,
+  rcutils_allocator_t * allocator,
+  const char * node_name,
+  const char * node_namespace,
+  bool no_demangle,
+  rmw_names_and_types_t * topic_names_and_types)
+{
+  (void)no_demangle;
+  return get_names_and_types_by_node(
+    node, allocator, node_name, node_namespace, topic_names_and_types,
+    EndpointKind::subscription);
+}
+
+rmw_ret_t
+rmw_get_publisher_names_and_types_by_node(
+  const rmw_node_t * node,
+  rcutils_allocator_t * allocator,
+  const char * node_name,
+  const char * node_namespace,
+  bool no_demangle,
+  rmw_names_and_types_t * topic_names_and_types)
+{
+  (void)no_demangle;
+  return get_names_and_types_by_node(
+    node, allocator, node_name, node_namespace, topic_names_and_types,
+    EndpointKind::publisher);
+}
+
+rmw_ret_t
+rmw_get_service_names_and_types_by_node(
+  const rmw_node_t * node,
+  rcutils_allocator_t * allocator,
+  const char * node_name,
+  const char * node_namespace,
+  rmw_names_and_types_t * service_names_and_types)
+{
+  return get_names_and_types_by_node(
+    node, allocator, node_name, node_namespace, service_names_and_types,
+    EndpointKind::service);
+}
+
+rmw_ret_t
+rmw_get_client_names_and_types_by_node(
+  const rmw_node_t * node,
+  rcutils_allocator_t * allocator,
+  const char * node_name,
+  const char * node_namespace,
+  rmw_names_and_types_t * service_names_and_types)
+{
+  return get_names_and_types_by_node(
+    node, allocator, node_name, node_namespace, service_names_and_types,
+    EndpointKind::client);
+}
+
+rmw_ret_t
+rmw_get_publishers_info_by_topic(
+  const rmw_node_t * node,
+  rcutils_allocator_t * allocator,
+  const char * topic_name,
+  bool no_mangle,
+  rmw_topic_endpoint_info_array_t * publishers_info)
+{
+  (void)no_mangle;
+  return get_endpoints_info_by_topic(
+    node, allocator, topic_name, publishers_info, EndpointKind::publisher);
+}
+
+rmw_ret_t
+rmw_get_subscriptions_info_by_topic(
+  const rmw_node_t * node,
+  rcutils_allocator_t * allocator,
+  const char * topic_name,
+  bool no_mangle,
+  rmw_topic_endpoint_info_array_t * subscriptions_info)
+{
+  (void)no_mangle;
+  return get_endpoints_info_by_topic(
+    node, allocator, topic_name, subscriptions_info, EndpointKind::subscription);
+}
+
+rmw_ret_t
+rmw_compare_gids_equal(const rmw_gid_t * gid1, const rmw_gid_t * gid2, bool * result)
+{
+  const char * identifier = rmw_get_implementation_identifier();
+  RMW_CHECK_ARGUMENT_FOR_NULL(gid1, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    gid1,
+    gid1->implementation_identifier,
+    identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  RMW_CHECK_ARGUMENT_FOR_NULL(gid2, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    gid2,
+    gid2->implementation_identifier,
+    identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  RMW_CHECK_ARGUMENT_FOR_NULL(result, RMW_RET_INVALID_ARGUMENT);
+  *result = 0 == memcmp(gid1->data, gid2->data, sizeof(gid1->data));
+  return RMW_RET_OK;
+}
+}  // extern "C"
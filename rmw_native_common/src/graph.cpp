@@ -0,0 +1,415 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw_native_common/graph.hpp"
+
+#include <algorithm>
+#include <map>
+#include <new>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "rcutils/strdup.h"
+
+#include "rmw/convert_rcutils_ret_to_rmw_ret.h"
+#include "rmw/error_handling.h"
+#include "rmw/sanity_checks.h"
+#include "rmw/validate_full_topic_name.h"
+#include "rmw/validate_namespace.h"
+#include "rmw/validate_node_name.h"
+
+namespace rmw_native_common
+{
+
+namespace
+{
+
+using NamesAndTypes = std::map<std::string, std::set<std::string>>;
+
+rmw_ret_t
+check_node_name_and_namespace(const char * node_name, const char * node_namespace)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(node_name, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(node_namespace, RMW_RET_INVALID_ARGUMENT);
+  int validation_result = RMW_NODE_NAME_VALID;
+  rmw_ret_t ret = rmw_validate_node_name(node_name, &validation_result, nullptr);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  if (RMW_NODE_NAME_VALID != validation_result) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+      "node_name argument is invalid: %s",
+      rmw_node_name_validation_result_string(validation_result));
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  validation_result = RMW_NAMESPACE_VALID;
+  ret = rmw_validate_namespace(node_namespace, &validation_result, nullptr);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  if (RMW_NAMESPACE_VALID != validation_result) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+      "node_namespace argument is invalid: %s",
+      rmw_namespace_validation_result_string(validation_result));
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  return RMW_RET_OK;
+}
+
+// Add names and types of the given endpoints, only of those of a node if not null.
+void
+collect_names_and_types(
+  const std::vector<EndpointInfo> & endpoints,
+  const char * node_name,
+  const char * node_namespace,
+  NamesAndTypes & names_and_types)
+{
+  for (const EndpointInfo & endpoint : endpoints) {
+    if (nullptr != node_name &&
+      (endpoint.node_name != node_name || endpoint.node_namespace != node_namespace))
+    {
+      continue;
+    }
+    names_and_types[endpoint.name].insert(endpoint.type_name);
+  }
+}
+
+bool
+has_node(Graph & graph, const char * name, const char * namespace_)
+{
+  for (const NodeInfo & node : graph.get_nodes()) {
+    if (node.name == name && node.namespace_ == namespace_) {
+      return true;
+    }
+  }
+  return false;
+}
+
+rmw_ret_t
+copy_names_and_types(
+  const NamesAndTypes & names_and_types,
+  rcutils_allocator_t * allocator,
+  rmw_names_and_types_t * output)
+{
+  if (names_and_types.empty()) {
+    return RMW_RET_OK;
+  }
+  rmw_ret_t ret = rmw_names_and_types_init(output, names_and_types.size(), allocator);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  size_t i = 0u;
+  for (const auto & name_and_types : names_and_types) {
+    output->names.data[i] = rcutils_strdup(name_and_types.first.c_str(), *allocator);
+    if (nullptr == output->names.data[i]) {
+      ret = RMW_RET_BAD_ALLOC;
+      break;
+    }
+    ret = rmw_convert_rcutils_ret_to_rmw_ret(
+      rcutils_string_array_init(&output->types[i], name_and_types.second.size(), allocator));
+    if (RMW_RET_OK != ret) {
+      break;
+    }
+    size_t j = 0u;
+    for (const std::string & type_name : name_and_types.second) {
+      output->types[i].data[j] = rcutils_strdup(type_name.c_str(), *allocator);
+      if (nullptr == output->types[i].data[j]) {
+        ret = RMW_RET_BAD_ALLOC;
+        break;
+      }
+      ++j;
+    }
+    if (RMW_RET_OK != ret) {
+      break;
+    }
+    ++i;
+  }
+  if (RMW_RET_OK != ret) {
+    RMW_SET_ERROR_MSG("failed to copy names and types");
+    rmw_ret_t fini_ret = rmw_names_and_types_fini(output);
+    (void)fini_ret;
+  }
+  return ret;
+}
+
+// Get the names and types of the endpoints of two kinds, of all nodes.
+rmw_ret_t
+get_names_and_types(
+  Graph & graph,
+  EndpointKind kind,
+  EndpointKind other_kind,
+  rcutils_allocator_t * allocator,
+  rmw_names_and_types_t * names_and_types)
+{
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    allocator, "allocator argument is invalid", return RMW_RET_INVALID_ARGUMENT);
+  rmw_ret_t ret = rmw_names_and_types_check_zero(names_and_types);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  NamesAndTypes result;
+  try {
+    collect_names_and_types(graph.get_endpoints(kind), nullptr, nullptr, result);
+    collect_names_and_types(graph.get_endpoints(other_kind), nullptr, nullptr, result);
+  } catch (const std::bad_alloc &) {
+    RMW_SET_ERROR_MSG("failed to collect names and types");
+    return RMW_RET_BAD_ALLOC;
+  }
+  return copy_names_and_types(result, allocator, names_and_types);
+}
+
+}  // namespace
+
+bool
+validate_name(const char * name, bool avoid_ros_namespace_conventions)
+{
+  if ('\0' == name[0]) {
+    RMW_SET_ERROR_MSG("name is an empty string");
+    return false;
+  }
+  if (avoid_ros_namespace_conventions) {
+    return true;
+  }
+  int validation_result = RMW_TOPIC_VALID;
+  if (RMW_RET_OK != rmw_validate_full_topic_name(name, &validation_result, nullptr)) {
+    return false;
+  }
+  if (RMW_TOPIC_VALID != validation_result) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+      "invalid name '%s': %s", name,
+      rmw_full_topic_name_validation_result_string(validation_result));
+    return false;
+  }
+  return true;
+}
+
+rmw_ret_t
+get_node_names(
+  Graph & graph,
+  rcutils_allocator_t * allocator,
+  rcutils_string_array_t * node_names,
+  rcutils_string_array_t * node_namespaces,
+  rcutils_string_array_t * enclaves)
+{
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    allocator, "allocator argument is invalid", return RMW_RET_INVALID_ARGUMENT);
+  if (RMW_RET_OK != rmw_check_zero_rmw_string_array(node_names)) {
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (RMW_RET_OK != rmw_check_zero_rmw_string_array(node_namespaces)) {
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (nullptr != enclaves && RMW_RET_OK != rmw_check_zero_rmw_string_array(enclaves)) {
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  std::vector<NodeInfo> nodes;
+  try {
+    nodes = graph.get_nodes();
+  } catch (const std::bad_alloc &) {
+    RMW_SET_ERROR_MSG("failed to collect nodes");
+    return RMW_RET_BAD_ALLOC;
+  }
+  rmw_ret_t ret = rmw_convert_rcutils_ret_to_rmw_ret(
+    rcutils_string_array_init(node_names, nodes.size(), allocator));
+  if (RMW_RET_OK == ret) {
+    ret = rmw_convert_rcutils_ret_to_rmw_ret(
+      rcutils_string_array_init(node_namespaces, nodes.size(), allocator));
+  }
+  if (RMW_RET_OK == ret && nullptr != enclaves) {
+    ret = rmw_convert_rcutils_ret_to_rmw_ret(
+      rcutils_string_array_init(enclaves, nodes.size(), allocator));
+  }
+  for (size_t i = 0u; i < nodes.size() && RMW_RET_OK == ret; ++i) {
+    node_names->data[i] = rcutils_strdup(nodes[i].name.c_str(), *allocator);
+    node_namespaces->data[i] = rcutils_strdup(nodes[i].namespace_.c_str(), *allocator);
+    if (nullptr == node_names->data[i] || nullptr == node_namespaces->data[i]) {
+      ret = RMW_RET_BAD_ALLOC;
+    }
+    if (nullptr != enclaves) {
+      enclaves->data[i] = rcutils_strdup(nodes[i].enclave.c_str(), *allocator);
+      if (nullptr == enclaves->data[i]) {
+        ret = RMW_RET_BAD_ALLOC;
+      }
+    }
+  }
+  if (RMW_RET_OK != ret) {
+    RMW_SET_ERROR_MSG("failed to copy node names");
+    rcutils_ret_t fini_ret = rcutils_string_array_fini(node_names);
+    fini_ret = rcutils_string_array_fini(node_namespaces);
+    if (nullptr != enclaves) {
+      fini_ret = rcutils_string_array_fini(enclaves);
+    }
+    (void)fini_ret;
+  }
+  return ret;
+}
+
+rmw_ret_t
+count_endpoints(Graph & graph, EndpointKind kind, const char * name, size_t * count)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(name, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(count, RMW_RET_INVALID_ARGUMENT);
+  if (!validate_name(name, false)) {
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  std::vector<EndpointInfo> endpoints;
+  try {
+    endpoints = graph.get_endpoints(kind);
+  } catch (const std::bad_alloc &) {
+    RMW_SET_ERROR_MSG("failed to collect endpoints");
+    return RMW_RET_BAD_ALLOC;
+  }
+  *count = 0u;
+  for (const EndpointInfo & endpoint : endpoints) {
+    if (endpoint.name == name) {
+      ++*count;
+    }
+  }
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+get_topic_names_and_types(
+  Graph & graph,
+  rcutils_allocator_t * allocator,
+  rmw_names_and_types_t * topic_names_and_types)
+{
+  return get_names_and_types(
+    graph, EndpointKind::publisher, EndpointKind::subscription, allocator,
+    topic_names_and_types);
+}
+
+rmw_ret_t
+get_service_names_and_types(
+  Graph & graph,
+  rcutils_allocator_t * allocator,
+  rmw_names_and_types_t * service_names_and_types)
+{
+  return get_names_and_types(
+    graph, EndpointKind::service, EndpointKind::client, allocator, service_names_and_types);
+}
+
+rmw_ret_t
+get_names_and_types_by_node(
+  Graph & graph,
+  EndpointKind kind,
+  rcutils_allocator_t * allocator,
+  const char * node_name,
+  const char * node_namespace,
+  rmw_names_and_types_t * names_and_types)
+{
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    allocator, "allocator argument is invalid", return RMW_RET_INVALID_ARGUMENT);
+  rmw_ret_t ret = rmw_names_and_types_check_zero(names_and_types);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  ret = check_node_name_and_namespace(node_name, node_namespace);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  NamesAndTypes result;
+  try {
+    if (!has_node(graph, node_name, node_namespace)) {
+      RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+        "cannot find node with name '%s' and namespace '%s'", node_name, node_namespace);
+      return RMW_RET_NODE_NAME_NON_EXISTENT;
+    }
+    collect_names_and_types(graph.get_endpoints(kind), node_name, node_namespace, result);
+  } catch (const std::bad_alloc &) {
+    RMW_SET_ERROR_MSG("failed to collect names and types");
+    return RMW_RET_BAD_ALLOC;
+  }
+  return copy_names_and_types(result, allocator, names_and_types);
+}
+
+rmw_ret_t
+get_endpoints_info_by_topic(
+  Graph & graph,
+  EndpointKind kind,
+  rcutils_allocator_t * allocator,
+  const char * topic_name,
+  rmw_topic_endpoint_info_array_t * endpoints_info)
+{
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    allocator, "allocator argument is invalid", return RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(topic_name, RMW_RET_INVALID_ARGUMENT);
+  if (RMW_RET_OK != rmw_topic_endpoint_info_array_check_zero(endpoints_info)) {
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  rmw_endpoint_type_t endpoint_type = RMW_ENDPOINT_INVALID;
+  if (EndpointKind::publisher == kind) {
+    endpoint_type = RMW_ENDPOINT_PUBLISHER;
+  } else if (EndpointKind::subscription == kind) {
+    endpoint_type = RMW_ENDPOINT_SUBSCRIPTION;
+  } else {
+    RMW_SET_ERROR_MSG("only publishers and subscriptions have endpoint info");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  std::vector<EndpointInfo> matches;
+  try {
+    matches = graph.get_endpoints(kind);
+  } catch (const std::bad_alloc &) {
+    RMW_SET_ERROR_MSG("failed to collect endpoints");
+    return RMW_RET_BAD_ALLOC;
+  }
+  matches.erase(
+    std::remove_if(
+      matches.begin(), matches.end(),
+      [topic_name](const EndpointInfo & endpoint) {
+        return endpoint.name != topic_name;
+      }),
+    matches.end());
+  if (matches.empty()) {
+    return RMW_RET_OK;
+  }
+  rmw_ret_t ret =
+    rmw_topic_endpoint_info_array_init_with_size(endpoints_info, matches.size(), allocator);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  for (size_t i = 0u; i < matches.size() && RMW_RET_OK == ret; ++i) {
+    const EndpointInfo & endpoint = matches[i];
+    rmw_topic_endpoint_info_t * info = &endpoints_info->info_array[i];
+    *info = rmw_get_zero_initialized_topic_endpoint_info();
+    ret = rmw_topic_endpoint_info_set_node_name(info, endpoint.node_name.c_str(), allocator);
+    if (RMW_RET_OK == ret) {
+      ret = rmw_topic_endpoint_info_set_node_namespace(
+        info, endpoint.node_namespace.c_str(), allocator);
+    }
+    if (RMW_RET_OK == ret) {
+      ret = rmw_topic_endpoint_info_set_topic_type(info, endpoint.type_name.c_str(), allocator);
+    }
+    if (RMW_RET_OK == ret) {
+      ret = rmw_topic_endpoint_info_set_topic_type_hash(info, &endpoint.type_hash);
+    }
+    if (RMW_RET_OK == ret) {
+      ret = rmw_topic_endpoint_info_set_endpoint_type(info, endpoint_type);
+    }
+    if (RMW_RET_OK == ret) {
+      ret = rmw_topic_endpoint_info_set_gid(info, endpoint.gid.data, RMW_GID_STORAGE_SIZE);
+    }
+    if (RMW_RET_OK == ret) {
+      ret = rmw_topic_endpoint_info_set_qos_profile(info, &endpoint.qos);
+    }
+  }
+  if (RMW_RET_OK != ret) {
+    rmw_ret_t fini_ret = rmw_topic_endpoint_info_array_fini(endpoints_info, allocator);
+    (void)fini_ret;
+  }
+  return ret;
+}
+
+}  // namespace rmw_native_common
@@ -0,0 +1,102 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw_native_common/rmw_serialize.hpp"
+
+#include <cstring>
+#include <new>
+#include <vector>
+
+#include "rmw/convert_rcutils_ret_to_rmw_ret.h"
+#include "rmw/error_handling.h"
+
+#include "rmw_native_common/type_support.hpp"
+
+namespace rmw_native_common
+{
+
+rmw_ret_t
+serialize(
+  const void * ros_message,
+  const rosidl_message_type_support_t * type_support,
+  rmw_serialized_message_t * serialized_message)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(ros_message, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(type_support, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(serialized_message, RMW_RET_INVALID_ARGUMENT);
+  const MessageMembers * members = get_message_members(type_support);
+  if (nullptr == members) {
+    return RMW_RET_ERROR;
+  }
+
+  thread_local std::vector<uint8_t> buffer;
+  try {
+    if (!serialize_message(members, ros_message, buffer)) {
+      RMW_SET_ERROR_MSG("failed to serialize message");
+      return RMW_RET_ERROR;
+    }
+  } catch (const std::bad_alloc &) {
+    RMW_SET_ERROR_MSG("failed to allocate serialization buffer");
+    return RMW_RET_BAD_ALLOC;
+  }
+  if (serialized_message->buffer_capacity < buffer.size()) {
+    rmw_ret_t ret = rmw_convert_rcutils_ret_to_rmw_ret(
+      rmw_serialized_message_resize(serialized_message, buffer.size()));
+    if (RMW_RET_OK != ret) {
+      return ret;
+    }
+  }
+  if (!buffer.empty()) {
+    memcpy(serialized_message->buffer, buffer.data(), buffer.size());
+  }
+  serialized_message->buffer_length = buffer.size();
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+deserialize(
+  const rmw_serialized_message_t * serialized_message,
+  const rosidl_message_type_support_t * type_support,
+  void * ros_message)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(serialized_message, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(type_support, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(ros_message, RMW_RET_INVALID_ARGUMENT);
+  const MessageMembers * members = get_message_members(type_support);
+  if (nullptr == members) {
+    return RMW_RET_ERROR;
+  }
+  if (!deserialize_message(
+      members, serialized_message->buffer, serialized_message->buffer_length, ros_message))
+  {
+    RMW_SET_ERROR_MSG("failed to deserialize message");
+    return RMW_RET_ERROR;
+  }
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+get_serialized_message_size(
+  const rosidl_message_type_support_t * type_support,
+  const rosidl_runtime_c__Sequence__bound * message_bounds,
+  size_t * size)
+{
+  (void)type_support;
+  (void)message_bounds;
+  (void)size;
+  RMW_SET_ERROR_MSG("rmw_get_serialized_message_size is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+
+}  // namespace rmw_native_common
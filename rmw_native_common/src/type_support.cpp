@@ -0,0 +1,450 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rmw_native_common/type_support.hpp"
+
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "rmw/error_handling.h"
+
+#include "rosidl_runtime_c/string.h"
+#include "rosidl_runtime_c/string_functions.h"
+#include "rosidl_runtime_c/u16string.h"
+#include "rosidl_runtime_c/u16string_functions.h"
+#include "rosidl_typesupport_introspection_c/field_types.h"
+#include "rosidl_typesupport_introspection_c/identifier.h"
+
+namespace rmw_native_common
+{
+
+const MessageMembers *
+get_message_members(const rosidl_message_type_support_t * type_support)
+{
+  const rosidl_message_type_support_t * handle = get_message_typesupport_handle(
+    type_support, rosidl_typesupport_introspection_c__identifier);
+  if (nullptr == handle) {
+    rcutils_error_string_t error_string = rcutils_get_error_string();
+    rcutils_reset_error();
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+      "type support has no C introspection type support: %s", error_string.str);
+    return nullptr;
+  }
+  return static_cast<const MessageMembers *>(handle->data);
+}
+
+const ServiceMembers *
+get_service_members(const rosidl_service_type_support_t * type_support)
+{
+  const rosidl_service_type_support_t * handle = get_service_typesupport_handle(
+    type_support, rosidl_typesupport_introspection_c__identifier);
+  if (nullptr == handle) {
+    rcutils_error_string_t error_string = rcutils_get_error_string();
+    rcutils_reset_error();
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+      "type support has no C introspection type support: %s", error_string.str);
+    return nullptr;
+  }
+  return static_cast<const ServiceMembers *>(handle->data);
+}
+
+rosidl_type_hash_t
+get_type_hash(const rosidl_message_type_support_t * type_support)
+{
+  if (nullptr == type_support->get_type_hash_func) {
+    return rosidl_get_zero_initialized_type_hash();
+  }
+  return *type_support->get_type_hash_func(type_support);
+}
+
+rosidl_type_hash_t
+get_type_hash(const rosidl_service_type_support_t * type_support)
+{
+  if (nullptr == type_support->get_type_hash_func) {
+    return rosidl_get_zero_initialized_type_hash();
+  }
+  return *type_support->get_type_hash_func(type_support);
+}
+
+namespace
+{
+
+// Turn a C namespace, e.g. "std_msgs__msg", into a ROS one, e.g. "std_msgs/msg".
+std::string
+make_type_name(const char * namespace_, const char * name)
+{
+  std::string type_name(namespace_);
+  for (size_t position = type_name.find("__"); std::string::npos != position;
+    position = type_name.find("__", position + 1u))
+  {
+    type_name.replace(position, 2u, "/");
+  }
+  return type_name + "/" + name;
+}
+
+// Size of primitive values, or 0 for strings and nested messages.
+size_t
+get_primitive_size(uint8_t type_id)
+{
+  switch (type_id) {
+    case rosidl_typesupport_introspection_c__ROS_TYPE_FLOAT:
+      return sizeof(float);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_DOUBLE:
+      return sizeof(double);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_LONG_DOUBLE:
+      return sizeof(long double);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_CHAR:
+    case rosidl_typesupport_introspection_c__ROS_TYPE_OCTET:
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT8:
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT8:
+      return sizeof(uint8_t);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_BOOLEAN:
+      return sizeof(bool);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_WCHAR:
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT16:
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT16:
+      return sizeof(uint16_t);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT32:
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT32:
+      return sizeof(uint32_t);
+    case rosidl_typesupport_introspection_c__ROS_TYPE_UINT64:
+    case rosidl_typesupport_introspection_c__ROS_TYPE_INT64:
+      return sizeof(uint64_t);
+    default:
+      return 0u;
+  }
+}
+
+bool
+is_sequence(const MessageMember & member)
+{
+  return member.is_array_ && (0u == member.array_size_ || member.is_upper_bound_);
+}
+
+const MessageMembers *
+get_nested_members(const MessageMember & member)
+{
+  return static_cast<const MessageMembers *>(member.members_->data);
+}
+
+class Writer
+{
+public:
+  explicit Writer(std::vector<uint8_t> & buffer)
+  : buffer_(buffer)
+  {
+    buffer_.clear();
+  }
+
+  void
+  write(const void * data, size_t size)
+  {
+    const uint8_t * bytes = static_cast<const uint8_t *>(data);
+    buffer_.insert(buffer_.end(), bytes, bytes + size);
+  }
+
+  bool
+  write_length(size_t length)
+  {
+    if (length > std::numeric_limits<uint32_t>::max()) {
+      return false;
+    }
+    const uint32_t value = static_cast<uint32_t>(length);
+    write(&value, sizeof(value));
+    return true;
+  }
+
+private:
+  std::vector<uint8_t> & buffer_;
+};
+
+class Reader
+{
+public:
+  Reader(const uint8_t * data, size_t length)
+  : data_(data), remaining_(length)
+  {}
+
+  // Get the next `size` bytes, or nullptr if fewer are left.
+  const uint8_t *
+  read(size_t size)
+  {
+    if (size > remaining_) {
+      return nullptr;
+    }
+    const uint8_t * data = data_;
+    data_ += size;
+    remaining_ -= size;
+    return data;
+  }
+
+  bool
+  read_length(size_t * length)
+  {
+    const uint8_t * data = read(sizeof(uint32_t));
+    if (nullptr == data) {
+      return false;
+    }
+    uint32_t value;
+    memcpy(&value, data, sizeof(value));
+    *length = value;
+    return true;
+  }
+
+  size_t
+  remaining() const
+  {
+    return remaining_;
+  }
+
+private:
+  const uint8_t * data_;
+  size_t remaining_;
+};
+
+bool
+serialize_members(const MessageMembers * members, const uint8_t * ros_message, Writer & writer);
+
+bool
+serialize_element(const MessageMember & member, const void * element, Writer & writer)
+{
+  switch (member.type_id_) {
+    case rosidl_typesupport_introspection_c__ROS_TYPE_STRING:
+      {
+        const auto string = static_cast<const rosidl_runtime_c__String *>(element);
+        if (!writer.write_length(string->size)) {
+          return false;
+        }
+        writer.write(string->data, string->size);
+        return true;
+      }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_WSTRING:
+      {
+        const auto string = static_cast<const rosidl_runtime_c__U16String *>(element);
+        if (!writer.write_length(string->size)) {
+          return false;
+        }
+        writer.write(string->data, string->size * sizeof(uint16_t));
+        return true;
+      }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_MESSAGE:
+      return serialize_members(
+        get_nested_members(member), static_cast<const uint8_t *>(element), writer);
+    default:
+      {
+        const size_t size = get_primitive_size(member.type_id_);
+        if (0u == size) {
+          return false;
+        }
+        writer.write(element, size);
+        return true;
+      }
+  }
+}
+
+bool
+serialize_members(const MessageMembers * members, const uint8_t * ros_message, Writer & writer)
+{
+  for (uint32_t i = 0u; i < members->member_count_; ++i) {
+    const MessageMember & member = members->members_[i];
+    const uint8_t * field = ros_message + member.offset_;
+    if (!member.is_array_) {
+      if (!serialize_element(member, field, writer)) {
+        return false;
+      }
+      continue;
+    }
+    size_t count = member.array_size_;
+    const void * elements = field;
+    if (is_sequence(member)) {
+      count = member.size_function(field);
+      if (!writer.write_length(count)) {
+        return false;
+      }
+      if (0u == count) {
+        continue;
+      }
+      elements = member.get_const_function(field, 0u);
+    }
+    // Primitive elements are contiguous, and copied at once.
+    const size_t primitive_size = get_primitive_size(member.type_id_);
+    if (0u != primitive_size) {
+      writer.write(elements, count * primitive_size);
+      continue;
+    }
+    for (size_t j = 0u; j < count; ++j) {
+      if (!serialize_element(member, member.get_const_function(field, j), writer)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool
+deserialize_members(const MessageMembers * members, Reader & reader, uint8_t * ros_message);
+
+bool
+deserialize_element(const MessageMember & member, Reader & reader, void * element)
+{
+  switch (member.type_id_) {
+    case rosidl_typesupport_introspection_c__ROS_TYPE_STRING:
+      {
+        size_t length = 0u;
+        if (!reader.read_length(&length) ||
+          (0u != member.string_upper_bound_ && length > member.string_upper_bound_))
+        {
+          return false;
+        }
+        const uint8_t * data = reader.read(length);
+        return nullptr != data && rosidl_runtime_c__String__assignn(
+          static_cast<rosidl_runtime_c__String *>(element),
+          reinterpret_cast<const char *>(data), length);
+      }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_WSTRING:
+      {
+        size_t length = 0u;
+        if (!reader.read_length(&length) ||
+          (0u != member.string_upper_bound_ && length > member.string_upper_bound_))
+        {
+          return false;
+        }
+        const uint8_t * data = reader.read(length * sizeof(uint16_t));
+        auto string = static_cast<rosidl_runtime_c__U16String *>(element);
+        if (nullptr == data || !rosidl_runtime_c__U16String__resize(string, length)) {
+          return false;
+        }
+        memcpy(string->data, data, length * sizeof(uint16_t));
+        return true;
+      }
+    case rosidl_typesupport_introspection_c__ROS_TYPE_MESSAGE:
+      return deserialize_members(
+        get_nested_members(member), reader, static_cast<uint8_t *>(element));
+    default:
+      {
+        const size_t size = get_primitive_size(member.type_id_);
+        const uint8_t * data = reader.read(size);
+        if (0u == size || nullptr == data) {
+          return false;
+        }
+        memcpy(element, data, size);
+        return true;
+      }
+  }
+}
+
+bool
+deserialize_members(const MessageMembers * members, Reader & reader, uint8_t * ros_message)
+{
+  for (uint32_t i = 0u; i < members->member_count_; ++i) {
+    const MessageMember & member = members->members_[i];
+    uint8_t * field = ros_message + member.offset_;
+    if (!member.is_array_) {
+      if (!deserialize_element(member, reader, field)) {
+        return false;
+      }
+      continue;
+    }
+    const size_t primitive_size = get_primitive_size(member.type_id_);
+    size_t count = member.array_size_;
+    void * elements = field;
+    if (is_sequence(member)) {
+      // Every element takes at least one byte, which bounds the length of valid sequences.
+      if (!reader.read_length(&count) ||
+        (member.is_upper_bound_ && count > member.array_size_) ||
+        count > reader.remaining() / (0u != primitive_size ? primitive_size : 1u) ||
+        nullptr == member.resize_function || !member.resize_function(field, count))
+      {
+        return false;
+      }
+      if (0u == count) {
+        continue;
+      }
+      elements = member.get_function(field, 0u);
+    }
+    if (0u != primitive_size) {
+      const uint8_t * data = reader.read(count * primitive_size);
+      if (nullptr == data) {
+        return false;
+      }
+      memcpy(elements, data, count * primitive_size);
+      continue;
+    }
+    for (size_t j = 0u; j < count; ++j) {
+      if (!deserialize_element(member, reader, member.get_function(field, j))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+std::string
+get_type_name(const MessageMembers * members)
+{
+  return make_type_name(members->message_namespace_, members->message_name_);
+}
+
+std::string
+get_type_name(const ServiceMembers * members)
+{
+  return make_type_name(members->service_namespace_, members->service_name_);
+}
+
+bool
+is_plain(const MessageMembers * members)
+{
+  for (uint32_t i = 0u; i < members->member_count_; ++i) {
+    const MessageMember & member = members->members_[i];
+    if (is_sequence(member)) {
+      return false;
+    }
+    if (rosidl_typesupport_introspection_c__ROS_TYPE_MESSAGE == member.type_id_) {
+      if (!is_plain(get_nested_members(member))) {
+        return false;
+      }
+    } else if (0u == get_primitive_size(member.type_id_)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool
+serialize_message(
+  const MessageMembers * members,
+  const void * ros_message,
+  std::vector<uint8_t> & buffer)
+{
+  Writer writer(buffer);
+  return serialize_members(members, static_cast<const uint8_t *>(ros_message), writer);
+}
+
+bool
+deserialize_message(
+  const MessageMembers * members,
+  const uint8_t * data,
+  size_t length,
+  void * ros_message)
+{
+  Reader reader(data, length);
+  return deserialize_members(members, reader, static_cast<uint8_t *>(ros_message)) &&
+         0u == reader.remaining();
+}
+
+}  // namespace rmw_native_common
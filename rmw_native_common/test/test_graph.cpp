@@ -0,0 +1,172 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/names_and_types.h"
+#include "rmw/qos_profiles.h"
+#include "rmw/topic_endpoint_info_array.h"
+
+#include "rmw_native_common/graph.hpp"
+
+using rmw_native_common::EndpointKind;
+
+namespace
+{
+
+class FakeGraph : public rmw_native_common::Graph
+{
+public:
+  std::vector<rmw_native_common::NodeInfo>
+  get_nodes() override
+  {
+    return nodes;
+  }
+
+  std::vector<rmw_native_common::EndpointInfo>
+  get_endpoints(EndpointKind kind) override
+  {
+    return endpoints[static_cast<size_t>(kind)];
+  }
+
+  void
+  add(EndpointKind kind, const char * name, const char * type_name, const char * node_name)
+  {
+    rmw_native_common::EndpointInfo info{};
+    info.name = name;
+    info.type_name = type_name;
+    info.node_name = node_name;
+    info.node_namespace = "/";
+    info.qos = rmw_qos_profile_default;
+    endpoints[static_cast<size_t>(kind)].push_back(info);
+  }
+
+  std::vector<rmw_native_common::NodeInfo> nodes;
+  std::vector<rmw_native_common::EndpointInfo> endpoints[4];
+};
+
+}  // namespace
+
+class TestGraph : public ::testing::Test
+{
+protected:
+  void
+  SetUp() override
+  {
+    allocator = rcutils_get_default_allocator();
+    graph.nodes = {{"talker", "/", "/"}, {"listener", "/", "/"}};
+    graph.add(EndpointKind::publisher, "/chatter", "std_msgs/msg/String", "talker");
+    graph.add(EndpointKind::publisher, "/chatter", "std_msgs/msg/Header", "talker");
+    graph.add(EndpointKind::subscription, "/chatter", "std_msgs/msg/String", "listener");
+    graph.add(EndpointKind::subscription, "/rosout", "rcl_interfaces/msg/Log", "listener");
+    graph.add(EndpointKind::service, "/add_two_ints", "test_msgs/srv/AddTwoInts", "talker");
+  }
+
+  void
+  TearDown() override
+  {
+    rmw_reset_error();
+  }
+
+  rcutils_allocator_t allocator;
+  FakeGraph graph;
+};
+
+TEST_F(TestGraph, validate_name) {
+  EXPECT_TRUE(rmw_native_common::validate_name("/chatter", false));
+  EXPECT_FALSE(rmw_native_common::validate_name("not a valid name", false));
+  rmw_reset_error();
+  // Names avoiding ROS conventions only need not be empty.
+  EXPECT_TRUE(rmw_native_common::validate_name("not a valid name", true));
+  EXPECT_FALSE(rmw_native_common::validate_name("", true));
+}
+
+TEST_F(TestGraph, count_endpoints) {
+  size_t count = 0u;
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_native_common::count_endpoints(graph, EndpointKind::publisher, "/chatter", &count));
+  EXPECT_EQ(2u, count);
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_native_common::count_endpoints(graph, EndpointKind::client, "/add_two_ints", &count));
+  EXPECT_EQ(0u, count);
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_native_common::count_endpoints(graph, EndpointKind::publisher, "chatter?", &count));
+}
+
+TEST_F(TestGraph, topic_names_and_types) {
+  // Names and types of publishers and subscriptions are merged, sorted and deduplicated.
+  rmw_names_and_types_t names_and_types = rmw_get_zero_initialized_names_and_types();
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_native_common::get_topic_names_and_types(graph, &allocator, &names_and_types)) <<
+    rmw_get_error_string().str;
+  ASSERT_EQ(2u, names_and_types.names.size);
+  EXPECT_EQ(std::string("/chatter"), names_and_types.names.data[0]);
+  ASSERT_EQ(2u, names_and_types.types[0].size);
+  EXPECT_EQ(std::string("std_msgs/msg/Header"), names_and_types.types[0].data[0]);
+  EXPECT_EQ(std::string("std_msgs/msg/String"), names_and_types.types[0].data[1]);
+  EXPECT_EQ(std::string("/rosout"), names_and_types.names.data[1]);
+  EXPECT_EQ(RMW_RET_OK, rmw_names_and_types_fini(&names_and_types));
+}
+
+TEST_F(TestGraph, names_and_types_by_node) {
+  rmw_names_and_types_t names_and_types = rmw_get_zero_initialized_names_and_types();
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_native_common::get_names_and_types_by_node(
+      graph, EndpointKind::subscription, &allocator, "listener", "/", &names_and_types)) <<
+    rmw_get_error_string().str;
+  ASSERT_EQ(2u, names_and_types.names.size);
+  EXPECT_EQ(RMW_RET_OK, rmw_names_and_types_fini(&names_and_types));
+
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_native_common::get_names_and_types_by_node(
+      graph, EndpointKind::subscription, &allocator, "talker", "/", &names_and_types));
+  EXPECT_EQ(0u, names_and_types.names.size);
+
+  EXPECT_EQ(
+    RMW_RET_NODE_NAME_NON_EXISTENT,
+    rmw_native_common::get_names_and_types_by_node(
+      graph, EndpointKind::subscription, &allocator, "talker", "/other", &names_and_types));
+}
+
+TEST_F(TestGraph, endpoints_info_by_topic) {
+  rmw_topic_endpoint_info_array_t endpoints_info =
+    rmw_get_zero_initialized_topic_endpoint_info_array();
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_native_common::get_endpoints_info_by_topic(
+      graph, EndpointKind::subscription, &allocator, "/chatter", &endpoints_info)) <<
+    rmw_get_error_string().str;
+  ASSERT_EQ(1u, endpoints_info.size);
+  EXPECT_EQ(std::string("listener"), endpoints_info.info_array[0].node_name);
+  EXPECT_EQ(RMW_ENDPOINT_SUBSCRIPTION, endpoints_info.info_array[0].endpoint_type);
+  EXPECT_EQ(RMW_RET_OK, rmw_topic_endpoint_info_array_fini(&endpoints_info, &allocator));
+
+  // Services have no endpoint info.
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_native_common::get_endpoints_info_by_topic(
+      graph, EndpointKind::service, &allocator, "/add_two_ints", &endpoints_info));
+}
@@ -0,0 +1,107 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/serialized_message.h"
+
+#include "rmw_native_common/rmw_serialize.hpp"
+#include "rmw_native_common/testing/type_supports.hpp"
+
+namespace testing_types = rmw_native_common::testing;
+
+TEST(TestRmwSerialize, round_trip) {
+  testing_types::Message input;
+  ASSERT_TRUE(testing_types::init_message(&input));
+  input.count = 7;
+  ASSERT_TRUE(rosidl_runtime_c__String__assign(&input.text, "hello native"));
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rmw_serialized_message_t serialized_message = rmw_get_zero_initialized_serialized_message();
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_init(&serialized_message, 0u, &allocator));
+
+  // The serialized message grows as needed.
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_native_common::serialize(
+      &input, testing_types::get_message_type_support(), &serialized_message)) <<
+    rmw_get_error_string().str;
+  EXPECT_LT(0u, serialized_message.buffer_length);
+  EXPECT_LE(serialized_message.buffer_length, serialized_message.buffer_capacity);
+
+  testing_types::Message output;
+  ASSERT_TRUE(testing_types::init_message(&output));
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_native_common::deserialize(
+      &serialized_message, testing_types::get_message_type_support(), &output)) <<
+    rmw_get_error_string().str;
+  EXPECT_EQ(input.count, output.count);
+  EXPECT_EQ(std::string(input.text.data), std::string(output.text.data));
+
+  // Data of another type is rejected.
+  EXPECT_EQ(
+    RMW_RET_ERROR,
+    rmw_native_common::deserialize(
+      &serialized_message, testing_types::get_plain_message_type_support(), &output));
+  rmw_reset_error();
+
+  testing_types::fini_message(&output);
+  testing_types::fini_message(&input);
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_fini(&serialized_message));
+}
+
+TEST(TestRmwSerialize, invalid_arguments) {
+  testing_types::Message message;
+  ASSERT_TRUE(testing_types::init_message(&message));
+  rmw_serialized_message_t serialized_message = rmw_get_zero_initialized_serialized_message();
+  const rosidl_message_type_support_t * type_support = testing_types::get_message_type_support();
+
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_native_common::serialize(nullptr, type_support, &serialized_message));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_native_common::serialize(&message, nullptr, &serialized_message));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_native_common::serialize(&message, type_support, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_native_common::deserialize(nullptr, type_support, &message));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_native_common::deserialize(&serialized_message, nullptr, &message));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_native_common::deserialize(&serialized_message, type_support, nullptr));
+  rmw_reset_error();
+
+  size_t size = 0u;
+  EXPECT_EQ(
+    RMW_RET_UNSUPPORTED,
+    rmw_native_common::get_serialized_message_size(type_support, nullptr, &size));
+  rmw_reset_error();
+
+  testing_types::fini_message(&message);
+}
@@ -0,0 +1,193 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "rmw/error_handling.h"
+
+#include "rmw_native_common/testing/type_supports.hpp"
+#include "rmw_native_common/type_support.hpp"
+
+namespace testing_types = rmw_native_common::testing;
+
+using testing_types::Message;
+using testing_types::PlainMessage;
+
+class TestTypeSupport : public ::testing::Test
+{
+protected:
+  void
+  SetUp() override
+  {
+    members = rmw_native_common::get_message_members(testing_types::get_message_type_support());
+    ASSERT_NE(nullptr, members) << rmw_get_error_string().str;
+    ASSERT_TRUE(testing_types::init_message(&input));
+    ASSERT_TRUE(testing_types::init_message(&output));
+    input.count = -42;
+    input.value = 3.5;
+    ASSERT_TRUE(rosidl_runtime_c__String__assign(&input.text, "hello native"));
+    ASSERT_TRUE(rosidl_runtime_c__int32__Sequence__init(&input.numbers, 3u));
+    input.numbers.data[0] = 1;
+    input.numbers.data[1] = -2;
+    input.numbers.data[2] = 3;
+  }
+
+  void
+  TearDown() override
+  {
+    testing_types::fini_message(&input);
+    testing_types::fini_message(&output);
+  }
+
+  const rmw_native_common::MessageMembers * members{nullptr};
+  Message input;
+  Message output;
+};
+
+TEST_F(TestTypeSupport, type_names) {
+  EXPECT_EQ("test_msgs/msg/Message", rmw_native_common::get_type_name(members));
+  const rmw_native_common::MessageMembers * plain_members =
+    rmw_native_common::get_message_members(testing_types::get_plain_message_type_support());
+  ASSERT_NE(nullptr, plain_members) << rmw_get_error_string().str;
+  EXPECT_EQ("test_msgs/msg/PlainMessage", rmw_native_common::get_type_name(plain_members));
+  const rmw_native_common::ServiceMembers * service_members =
+    rmw_native_common::get_service_members(testing_types::get_service_type_support());
+  ASSERT_NE(nullptr, service_members) << rmw_get_error_string().str;
+  EXPECT_EQ("test_msgs/srv/AddTwoInts", rmw_native_common::get_type_name(service_members));
+}
+
+TEST_F(TestTypeSupport, unsupported_type_support) {
+  rosidl_message_type_support_t type_support = *testing_types::get_message_type_support();
+  type_support.typesupport_identifier = "rosidl_typesupport_fastrtps_c";
+  EXPECT_EQ(nullptr, rmw_native_common::get_message_members(&type_support));
+  EXPECT_TRUE(rmw_error_is_set());
+  rmw_reset_error();
+}
+
+TEST_F(TestTypeSupport, is_plain) {
+  const rmw_native_common::MessageMembers * plain_members =
+    rmw_native_common::get_message_members(testing_types::get_plain_message_type_support());
+  ASSERT_NE(nullptr, plain_members) << rmw_get_error_string().str;
+  EXPECT_TRUE(rmw_native_common::is_plain(plain_members));
+
+  // Strings and sequences own memory outside of the struct.
+  EXPECT_FALSE(rmw_native_common::is_plain(members));
+
+  // Bounded sequences are no better than unbounded ones.
+  rosidl_typesupport_introspection_c__MessageMember bounded = plain_members->members_[1];
+  bounded.is_upper_bound_ = true;
+  rosidl_typesupport_introspection_c__MessageMember bounded_members[] = {
+    plain_members->members_[0], bounded};
+  rosidl_typesupport_introspection_c__MessageMembers bounded_message = *plain_members;
+  bounded_message.members_ = bounded_members;
+  EXPECT_FALSE(rmw_native_common::is_plain(&bounded_message));
+
+  // Nested messages are plain if all their members are.
+  const rosidl_message_type_support_t * nested_type_supports[] = {
+    testing_types::get_plain_message_type_support(), testing_types::get_message_type_support()};
+  for (const rosidl_message_type_support_t * nested_type_support : nested_type_supports) {
+    rosidl_typesupport_introspection_c__MessageMember nested_member =
+      testing_types::make_member(
+      "nested", rosidl_typesupport_introspection_c__ROS_TYPE_MESSAGE, 0u);
+    nested_member.members_ = nested_type_support;
+    rosidl_typesupport_introspection_c__MessageMembers nested_message = *plain_members;
+    nested_message.member_count_ = 1u;
+    nested_message.members_ = &nested_member;
+    EXPECT_EQ(
+      nested_type_support == testing_types::get_plain_message_type_support(),
+      rmw_native_common::is_plain(&nested_message));
+  }
+}
+
+TEST_F(TestTypeSupport, round_trip) {
+  std::vector<uint8_t> buffer;
+  ASSERT_TRUE(rmw_native_common::serialize_message(members, &input, buffer));
+  // Primitives without padding, then lengths ahead of the string and the sequence.
+  const size_t expected_size = sizeof(int32_t) + sizeof(double) +
+    sizeof(uint32_t) + input.text.size + sizeof(uint32_t) + 3u * sizeof(int32_t);
+  EXPECT_EQ(expected_size, buffer.size());
+
+  ASSERT_TRUE(
+    rmw_native_common::deserialize_message(members, buffer.data(), buffer.size(), &output));
+  EXPECT_EQ(input.count, output.count);
+  EXPECT_EQ(input.value, output.value);
+  EXPECT_EQ(std::string(input.text.data), std::string(output.text.data));
+  ASSERT_EQ(input.numbers.size, output.numbers.size);
+  for (size_t i = 0u; i < input.numbers.size; ++i) {
+    EXPECT_EQ(input.numbers.data[i], output.numbers.data[i]);
+  }
+}
+
+TEST_F(TestTypeSupport, plain_round_trip) {
+  const rmw_native_common::MessageMembers * plain_members =
+    rmw_native_common::get_message_members(testing_types::get_plain_message_type_support());
+  ASSERT_NE(nullptr, plain_members) << rmw_get_error_string().str;
+  PlainMessage plain_input{};
+  plain_input.count = -42;
+  for (size_t i = 0u; i < 16u; ++i) {
+    plain_input.values[i] = 0.5 * static_cast<double>(i);
+  }
+  std::vector<uint8_t> buffer;
+  ASSERT_TRUE(rmw_native_common::serialize_message(plain_members, &plain_input, buffer));
+  // Fixed size arrays have no length ahead of them.
+  EXPECT_EQ(sizeof(int64_t) + 16u * sizeof(double), buffer.size());
+
+  PlainMessage plain_output{};
+  ASSERT_TRUE(
+    rmw_native_common::deserialize_message(
+      plain_members, buffer.data(), buffer.size(), &plain_output));
+  EXPECT_EQ(plain_input.count, plain_output.count);
+  for (size_t i = 0u; i < 16u; ++i) {
+    EXPECT_EQ(plain_input.values[i], plain_output.values[i]);
+  }
+}
+
+TEST_F(TestTypeSupport, buffer_reuse) {
+  std::vector<uint8_t> buffer;
+  ASSERT_TRUE(rmw_native_common::serialize_message(members, &input, buffer));
+  const size_t size = buffer.size();
+  // Serializing again replaces the contents rather than appending to them.
+  ASSERT_TRUE(rmw_native_common::serialize_message(members, &input, buffer));
+  EXPECT_EQ(size, buffer.size());
+}
+
+TEST_F(TestTypeSupport, malformed_data) {
+  std::vector<uint8_t> buffer;
+  ASSERT_TRUE(rmw_native_common::serialize_message(members, &input, buffer));
+
+  // Truncated data.
+  for (size_t length = 0u; length < buffer.size(); ++length) {
+    EXPECT_FALSE(
+      rmw_native_common::deserialize_message(members, buffer.data(), length, &output)) <<
+      "length " << length;
+  }
+
+  // Trailing data.
+  buffer.push_back(0u);
+  EXPECT_FALSE(
+    rmw_native_common::deserialize_message(members, buffer.data(), buffer.size(), &output));
+  buffer.pop_back();
+
+  // Sequence length exceeding the data left.
+  const size_t sequence_length_offset = buffer.size() - sizeof(uint32_t) - 3u * sizeof(int32_t);
+  const uint32_t huge_length = 0x7FFFFFFFu;
+  memcpy(&buffer[sequence_length_offset], &huge_length, sizeof(huge_length));
+  EXPECT_FALSE(
+    rmw_native_common::deserialize_message(members, buffer.data(), buffer.size(), &output));
+}
@@ -0,0 +1,1011 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./domain.hpp"
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rcutils/env.h"
+#include "rcutils/time.h"
+
+#include "rmw/error_handling.h"
+
+#include "./identifier.hpp"
+
+namespace rmw_shm_cpp
+{
+
+namespace
+{
+
+/// Default size and number of chunks, overridden by the environment variables below.
+constexpr size_t default_chunk_size = 64u * 1024u;
+constexpr size_t default_chunk_count = 512u;
+constexpr const char * chunk_size_variable = "RMW_SHM_CPP_CHUNK_SIZE";
+constexpr const char * chunk_count_variable = "RMW_SHM_CPP_CHUNK_COUNT";
+
+/// Time given to the creator of a segment to initialize it.
+constexpr std::chrono::seconds initialization_timeout(1);
+
+/// Number of times attaching is retried when racing with the last process detaching.
+constexpr size_t max_attach_attempts = 16u;
+
+static_assert(
+  sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "atomics must be usable as futex words");
+
+long
+futex(std::atomic<uint32_t> * word, int operation, uint32_t value, const timespec * timeout)
+{
+  // Futexes are shared between processes, so FUTEX_PRIVATE_FLAG must not be used.
+  return syscall(
+    SYS_futex, reinterpret_cast<uint32_t *>(word), operation, value, timeout, nullptr, 0);
+}
+
+/// Lock of the robust mutex of a segment.
+class SegmentLock
+{
+public:
+  explicit SegmentLock(Segment * segment)
+  : mutex_(&segment->mutex)
+  {
+    if (EOWNERDEAD == pthread_mutex_lock(mutex_)) {
+      // Tables are only ever left with an entry half written, which does no harm.
+      (void)pthread_mutex_consistent(mutex_);
+    }
+  }
+
+  ~SegmentLock()
+  {
+    (void)pthread_mutex_unlock(mutex_);
+  }
+
+  SegmentLock(const SegmentLock &) = delete;
+  SegmentLock & operator=(const SegmentLock &) = delete;
+
+private:
+  pthread_mutex_t * mutex_;
+};
+
+bool
+is_alive(int32_t pid)
+{
+  return 0 == kill(pid, 0) || EPERM == errno;
+}
+
+bool
+copy_name(char (& destination)[max_name_length], const char * source)
+{
+  const size_t length = strlen(source);
+  if (length >= max_name_length) {
+    return false;
+  }
+  memcpy(destination, source, length + 1u);
+  return true;
+}
+
+bool
+is_equal(const char (& lhs)[max_name_length], const char (& rhs)[max_name_length])
+{
+  return 0 == strncmp(lhs, rhs, max_name_length);
+}
+
+rmw_time_point_value_t
+now()
+{
+  rcutils_time_point_value_t now = 0;
+  (void)rcutils_system_time_now(&now);
+  return now;
+}
+
+// Read a positive size from the environment, or use the default if the variable is not set.
+bool
+get_size_from_environment(const char * variable, size_t default_value, size_t * value)
+{
+  const char * string = nullptr;
+  const char * error = rcutils_get_env(variable, &string);
+  if (nullptr != error) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING("failed to read %s: %s", variable, error);
+    return false;
+  }
+  if ('\0' == string[0]) {
+    *value = default_value;
+    return true;
+  }
+  char * end = nullptr;
+  errno = 0;
+  const unsigned long long parsed = strtoull(string, &end, 10);
+  if (0 != errno || '\0' != *end || 0u == parsed || parsed > SIZE_MAX) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+      "%s must be a positive integer, got '%s'", variable, string);
+    return false;
+  }
+  *value = static_cast<size_t>(parsed);
+  return true;
+}
+
+// Publishers match subscriptions and clients match services with the same name and type.
+bool
+is_match(const EndpointEntry & lhs, const EndpointEntry & rhs)
+{
+  return is_equal(lhs.name, rhs.name) && is_equal(lhs.type_name, rhs.type_name) &&
+         lhs.message_size == rhs.message_size;
+}
+
+// GIDs hold the index and incarnation of their endpoint entry, then the process id.
+void
+make_gid(uint32_t index, uint32_t incarnation, int32_t pid, rmw_gid_t * gid)
+{
+  memset(gid, 0, sizeof(*gid));
+  gid->implementation_identifier = identifier;
+  memcpy(gid->data, &index, sizeof(index));
+  memcpy(gid->data + sizeof(index), &incarnation, sizeof(incarnation));
+  memcpy(gid->data + sizeof(index) + sizeof(incarnation), &pid, sizeof(pid));
+}
+
+void
+parse_gid(const uint8_t * gid_data, uint32_t * index, uint32_t * incarnation)
+{
+  memcpy(index, gid_data, sizeof(*index));
+  memcpy(incarnation, gid_data + sizeof(*index), sizeof(*incarnation));
+}
+
+// Kinds of endpoints of graph queries, as stored in the segment.
+EndpointKind
+to_segment_kind(rmw_native_common::EndpointKind kind)
+{
+  switch (kind) {
+    case rmw_native_common::EndpointKind::publisher:
+      return EndpointKind::publisher;
+    case rmw_native_common::EndpointKind::subscription:
+      return EndpointKind::subscription;
+    case rmw_native_common::EndpointKind::service:
+      return EndpointKind::service;
+    case rmw_native_common::EndpointKind::client:
+      return EndpointKind::client;
+  }
+  return EndpointKind::none;
+}
+
+}  // namespace
+
+void
+GuardCondition::trigger()
+{
+  triggered.store(true);
+  domain->notify();
+}
+
+bool
+GuardCondition::is_triggered() const
+{
+  return triggered.load() ||
+         (nullptr != graph_generation &&
+         graph_generation->load() != last_graph_generation.load());
+}
+
+bool
+GuardCondition::take()
+{
+  bool is_triggered = triggered.exchange(false);
+  if (nullptr != graph_generation) {
+    const uint32_t generation = graph_generation->load();
+    is_triggered = last_graph_generation.exchange(generation) != generation || is_triggered;
+  }
+  return is_triggered;
+}
+
+rmw_qos_profile_t
+resolve_qos(const rmw_qos_profile_t & qos)
+{
+  rmw_qos_profile_t actual = qos;
+  if (RMW_QOS_POLICY_HISTORY_KEEP_ALL == actual.history) {
+    actual.depth = max_queue_depth;
+  } else {
+    actual.history = RMW_QOS_POLICY_HISTORY_KEEP_LAST;
+    if (0u == actual.depth) {
+      actual.depth = 1u;
+    } else if (actual.depth > max_queue_depth) {
+      actual.depth = max_queue_depth;
+    }
+  }
+  actual.reliability = RMW_QOS_POLICY_RELIABILITY_RELIABLE;
+  actual.durability = RMW_QOS_POLICY_DURABILITY_VOLATILE;
+  if (RMW_QOS_POLICY_LIVELINESS_SYSTEM_DEFAULT == actual.liveliness ||
+    RMW_QOS_POLICY_LIVELINESS_UNKNOWN == actual.liveliness)
+  {
+    actual.liveliness = RMW_QOS_POLICY_LIVELINESS_AUTOMATIC;
+  }
+  return actual;
+}
+
+std::shared_ptr<Domain>
+Domain::get(size_t domain_id)
+{
+  static std::mutex mutex;
+  static std::map<size_t, std::weak_ptr<Domain>> domains;
+  std::lock_guard<std::mutex> lock(mutex);
+  std::shared_ptr<Domain> domain = domains[domain_id].lock();
+  // The domain of a parent process is registered with its process id, children attach anew.
+  if (domain && domain->pid_ == getpid()) {
+    return domain;
+  }
+  domain.reset(new Domain());
+  if (RMW_RET_OK != domain->attach(domain_id)) {
+    return nullptr;
+  }
+  domains[domain_id] = domain;
+  return domain;
+}
+
+Domain::~Domain()
+{
+  if (nullptr == segment_) {
+    return;
+  }
+  // Forked children leave the entries of their parent alone.
+  if (getpid() == pid_) {
+    bool is_changed = false;
+    {
+      SegmentLock lock(segment_);
+      for (uint32_t i = 0u; i < max_endpoints; ++i) {
+        if (EndpointKind::none != segment_->endpoints[i].kind &&
+          pid_ == segment_->endpoints[i].pid)
+        {
+          free_endpoint(i);
+          is_changed = true;
+        }
+      }
+      for (NodeEntry & node : segment_->nodes) {
+        if (pid_ == node.pid) {
+          node.pid = 0;
+          is_changed = true;
+        }
+      }
+      bool is_last = true;
+      for (int32_t & pid : segment_->pids) {
+        if (pid_ == pid) {
+          pid = 0;
+        } else if (0 != pid) {
+          is_last = false;
+        }
+      }
+      if (is_last) {
+        // Processes still attaching see the flag and start over with a new segment.
+        segment_->is_unlinked = true;
+        (void)shm_unlink(segment_name_.c_str());
+        (void)shm_unlink(pool_name_.c_str());
+      } else if (is_changed) {
+        segment_->graph_generation.fetch_add(1u);
+      }
+    }
+    if (is_changed) {
+      notify();
+    }
+  }
+  if (RMW_RET_OK != rmw_shared_memory_chunk_pool_fini(&pool_)) {
+    rmw_reset_error();
+  }
+  (void)munmap(segment_, sizeof(Segment));
+}
+
+rmw_ret_t
+Domain::attach(size_t domain_id)
+{
+  pid_ = getpid();
+  segment_name_ = "/rmw_shm_cpp_" + std::to_string(domain_id);
+  pool_name_ = segment_name_ + "_chunks";
+  size_t chunk_size = 0u;
+  size_t chunk_count = 0u;
+  if (!get_size_from_environment(chunk_size_variable, default_chunk_size, &chunk_size) ||
+    !get_size_from_environment(chunk_count_variable, default_chunk_count, &chunk_count))
+  {
+    return RMW_RET_ERROR;
+  }
+
+  for (size_t attempt = 0u; attempt < max_attach_attempts; ++attempt) {
+    bool is_creator = true;
+    int file_descriptor = shm_open(
+      segment_name_.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (-1 == file_descriptor && EEXIST == errno) {
+      is_creator = false;
+      file_descriptor = shm_open(segment_name_.c_str(), O_RDWR | O_CLOEXEC, 0);
+      if (-1 == file_descriptor && ENOENT == errno) {
+        // Unlinked by the last process to detach in the meantime.
+        continue;
+      }
+    }
+    if (-1 == file_descriptor) {
+      RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+        "failed to open shared memory segment '%s': %s", segment_name_.c_str(), strerror(errno));
+      return RMW_RET_ERROR;
+    }
+
+    if (is_creator && 0 != ftruncate(file_descriptor, sizeof(Segment))) {
+      RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+        "failed to size shared memory segment '%s': %s", segment_name_.c_str(), strerror(errno));
+      (void)close(file_descriptor);
+      (void)shm_unlink(segment_name_.c_str());
+      return RMW_RET_BAD_ALLOC;
+    }
+    if (!is_creator) {
+      // The creator may not have sized the segment yet.
+      const auto deadline = std::chrono::steady_clock::now() + initialization_timeout;
+      struct stat status {};
+      while (0 == fstat(file_descriptor, &status) && 0 == status.st_size &&
+        std::chrono::steady_clock::now() < deadline)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      if (static_cast<size_t>(status.st_size) != sizeof(Segment)) {
+        RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+          "shared memory segment '%s' is not used by a compatible rmw_shm_cpp, "
+          "remove it if no process uses it", segment_name_.c_str());
+        (void)close(file_descriptor);
+        return RMW_RET_ERROR;
+      }
+    }
+    void * address = mmap(
+      nullptr, sizeof(Segment), PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0);
+    (void)close(file_descriptor);
+    if (MAP_FAILED == address) {
+      RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+        "failed to map shared memory segment '%s': %s", segment_name_.c_str(), strerror(errno));
+      if (is_creator) {
+        (void)shm_unlink(segment_name_.c_str());
+      }
+      return RMW_RET_ERROR;
+    }
+    Segment * segment = static_cast<Segment *>(address);
+
+    if (is_creator) {
+      // The segment is zero filled, only what is not zero initially needs to be set.
+      segment->size = sizeof(Segment);
+      pthread_mutexattr_t attributes;
+      (void)pthread_mutexattr_init(&attributes);
+      (void)pthread_mutexattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+      (void)pthread_mutexattr_setrobust(&attributes, PTHREAD_MUTEX_ROBUST);
+      rmw_ret_t ret = RMW_RET_OK;
+      if (0 != pthread_mutex_init(&segment->mutex, &attributes)) {
+        RMW_SET_ERROR_MSG("failed to initialize shared memory segment mutex");
+        ret = RMW_RET_ERROR;
+      }
+      (void)pthread_mutexattr_destroy(&attributes);
+      for (Queue & queue : segment->queues) {
+        queue.init();
+      }
+      if (RMW_RET_OK == ret) {
+        // A pool left behind by processes that all died is of no use to anyone.
+        (void)shm_unlink(pool_name_.c_str());
+        ret = rmw_shared_memory_chunk_pool_create(
+          &pool_, pool_name_.c_str(), chunk_size, chunk_count);
+      }
+      if (RMW_RET_OK != ret) {
+        (void)munmap(segment, sizeof(Segment));
+        (void)shm_unlink(segment_name_.c_str());
+        return ret;
+      }
+      // Like the segment, the pool is unlinked by the last process to detach.
+      pool_.is_creator = false;
+      segment->magic.store(segment_magic, std::memory_order_release);
+    } else {
+      const auto deadline = std::chrono::steady_clock::now() + initialization_timeout;
+      while (segment_magic != segment->magic.load(std::memory_order_acquire) &&
+        std::chrono::steady_clock::now() < deadline)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      if (segment_magic != segment->magic.load(std::memory_order_acquire) ||
+        sizeof(Segment) != segment->size)
+      {
+        RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+          "shared memory segment '%s' was never initialized, remove it if no process uses it",
+          segment_name_.c_str());
+        (void)munmap(segment, sizeof(Segment));
+        return RMW_RET_ERROR;
+      }
+    }
+
+    bool is_changed = false;
+    {
+      SegmentLock lock(segment);
+      if (segment->is_unlinked) {
+        (void)munmap(segment, sizeof(Segment));
+        continue;
+      }
+      // The pool is unlinked along with the segment, so it is there as long as the segment is.
+      if (!is_creator) {
+        rmw_ret_t ret = rmw_shared_memory_chunk_pool_attach(&pool_, pool_name_.c_str());
+        if (RMW_RET_OK != ret) {
+          (void)munmap(segment, sizeof(Segment));
+          return ret;
+        }
+      }
+      int32_t * free_pid = nullptr;
+      for (int32_t & pid : segment->pids) {
+        if (0 == pid) {
+          free_pid = &pid;
+          break;
+        }
+      }
+      segment_ = segment;
+      is_changed = clean_up_dead_processes();
+      if (nullptr == free_pid) {
+        for (int32_t & pid : segment->pids) {
+          if (0 == pid) {
+            free_pid = &pid;
+            break;
+          }
+        }
+      }
+      if (nullptr == free_pid) {
+        RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+          "too many processes use shared memory segment '%s'", segment_name_.c_str());
+        segment_ = nullptr;
+        if (RMW_RET_OK != rmw_shared_memory_chunk_pool_fini(&pool_)) {
+          rmw_reset_error();
+        }
+        (void)munmap(segment, sizeof(Segment));
+        return RMW_RET_ERROR;
+      }
+      *free_pid = pid_;
+    }
+    if (is_changed) {
+      notify();
+    }
+    return RMW_RET_OK;
+  }
+  RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+    "failed to attach to shared memory segment '%s', it keeps being unlinked",
+    segment_name_.c_str());
+  return RMW_RET_ERROR;
+}
+
+bool
+Domain::clean_up_dead_processes()
+{
+  bool is_changed = false;
+  bool is_alone = true;
+  for (int32_t & pid : segment_->pids) {
+    if (0 == pid || pid_ == pid) {
+      continue;
+    }
+    if (is_alive(pid)) {
+      is_alone = false;
+      continue;
+    }
+    for (uint32_t i = 0u; i < max_endpoints; ++i) {
+      if (EndpointKind::none != segment_->endpoints[i].kind && pid == segment_->endpoints[i].pid) {
+        free_endpoint(i);
+      }
+    }
+    for (NodeEntry & node : segment_->nodes) {
+      if (pid == node.pid) {
+        node.pid = 0;
+      }
+    }
+    pid = 0;
+    is_changed = true;
+  }
+  if (is_alone) {
+    // Chunks still in use by other processes were leaked by processes that died,
+    // possibly long ago, and only stale cells of free entries may refer to them.
+    for (uint32_t i = 0u; i < max_endpoints; ++i) {
+      if (EndpointKind::none == segment_->endpoints[i].kind) {
+        free_endpoint(i);
+      }
+    }
+    for (size_t i = 0u; i < pool_.chunk_count; ++i) {
+      uint32_t reference_count = 0u;
+      uint32_t owner = 0u;
+      if (RMW_RET_OK == rmw_shared_memory_chunk_pool_get_chunk_state(
+          &pool_, i, &reference_count, &owner) &&
+        0u != reference_count && static_cast<uint32_t>(pid_) != owner &&
+        RMW_RET_OK != rmw_shared_memory_chunk_pool_reclaim(&pool_, owner, nullptr))
+      {
+        rmw_reset_error();
+      }
+    }
+  }
+  if (is_changed) {
+    segment_->graph_generation.fetch_add(1u);
+  }
+  return is_changed;
+}
+
+void
+Domain::free_endpoint(uint32_t index)
+{
+  EndpointEntry & entry = segment_->endpoints[index];
+  if (EndpointKind::none != entry.kind) {
+    entry.kind = EndpointKind::none;
+    entry.incarnation.fetch_add(1u);
+  }
+  Queue & queue = segment_->queues[index];
+  while (queue.pop([this](Cell & cell, uint64_t) {release_chunk(cell.chunk_index);})) {
+  }
+}
+
+rmw_ret_t
+Domain::add(Node * node)
+{
+  const char * enclave = node->context->options.enclave;
+  NodeEntry entry;
+  if (!copy_name(entry.name, node->name.c_str()) ||
+    !copy_name(entry.namespace_, node->namespace_.c_str()) ||
+    !copy_name(entry.enclave, nullptr != enclave ? enclave : "/"))
+  {
+    RMW_SET_ERROR_MSG("node name, namespace or enclave is too long");
+    return RMW_RET_ERROR;
+  }
+  entry.pid = pid_;
+  {
+    SegmentLock lock(segment_);
+    (void)clean_up_dead_processes();
+    uint32_t index = 0u;
+    while (index < max_nodes && 0 != segment_->nodes[index].pid) {
+      ++index;
+    }
+    if (max_nodes == index) {
+      RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+        "too many nodes in shared memory segment '%s'", segment_name_.c_str());
+      return RMW_RET_ERROR;
+    }
+    segment_->nodes[index] = entry;
+    node->index = index;
+    segment_->graph_generation.fetch_add(1u);
+  }
+  notify();
+  return RMW_RET_OK;
+}
+
+void
+Domain::remove(Node * node)
+{
+  {
+    SegmentLock lock(segment_);
+    segment_->nodes[node->index].pid = 0;
+    segment_->graph_generation.fetch_add(1u);
+  }
+  notify();
+}
+
+rmw_ret_t
+Domain::add(
+  Endpoint * endpoint,
+  EndpointKind kind,
+  size_t depth,
+  bool ignore_local_publications,
+  size_t message_size)
+{
+  char name[max_name_length];
+  char type_name[max_name_length];
+  if (!copy_name(name, endpoint->name.c_str()) ||
+    !copy_name(type_name, endpoint->type_name.c_str()))
+  {
+    RMW_SET_ERROR_MSG("topic or service name, or type name, is too long");
+    return RMW_RET_ERROR;
+  }
+  {
+    SegmentLock lock(segment_);
+    uint32_t index = 0u;
+    while (index < max_endpoints && EndpointKind::none != segment_->endpoints[index].kind) {
+      ++index;
+    }
+    if (max_endpoints == index) {
+      RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+        "too many endpoints in shared memory segment '%s'", segment_name_.c_str());
+      return RMW_RET_ERROR;
+    }
+    EndpointEntry & entry = segment_->endpoints[index];
+    // Cells pushed to a previous endpoint of the entry are tagged with its incarnation.
+    const uint32_t incarnation = entry.incarnation.fetch_add(1u) + 1u;
+    free_endpoint(index);
+    segment_->queues[index].depth.store(depth);
+    entry.kind = kind;
+    entry.pid = pid_;
+    entry.participant_id = endpoint->node->context->impl->participant_id;
+    entry.node_index = endpoint->node->index;
+    entry.ignore_local_publications = ignore_local_publications;
+    entry.message_size = message_size;
+    entry.type_hash = endpoint->type_hash;
+    entry.qos = endpoint->qos;
+    memcpy(entry.name, name, sizeof(name));
+    memcpy(entry.type_name, type_name, sizeof(type_name));
+    endpoint->index = index;
+    endpoint->incarnation = incarnation;
+    make_gid(index, incarnation, pid_, &endpoint->gid);
+    memcpy(entry.gid, endpoint->gid.data, sizeof(entry.gid));
+    segment_->graph_generation.fetch_add(1u);
+  }
+  notify();
+  return RMW_RET_OK;
+}
+
+void
+Domain::remove(Endpoint * endpoint)
+{
+  {
+    SegmentLock lock(segment_);
+    EndpointEntry & entry = segment_->endpoints[endpoint->index];
+    if (endpoint->incarnation == entry.incarnation.load() && pid_ == entry.pid) {
+      free_endpoint(endpoint->index);
+    }
+    segment_->graph_generation.fetch_add(1u);
+  }
+  notify();
+}
+
+size_t
+Domain::chunk_size() const
+{
+  return pool_.chunk_size;
+}
+
+void *
+Domain::acquire_chunk(size_t length, size_t * chunk_index)
+{
+  if (length > pool_.chunk_size) {
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+      "%zu bytes do not fit in shared memory chunks of %zu bytes, see %s", length,
+      pool_.chunk_size, chunk_size_variable);
+    return nullptr;
+  }
+  rmw_ret_t ret =
+    rmw_shared_memory_chunk_pool_acquire(&pool_, static_cast<uint32_t>(pid_), chunk_index);
+  if (RMW_RET_OK != ret) {
+    rmw_reset_error();
+    RMW_SET_ERROR_MSG_WITH_FORMAT_STRING(
+      "all %zu shared memory chunks are in use, see %s", pool_.chunk_count,
+      chunk_count_variable);
+    return nullptr;
+  }
+  return rmw_shared_memory_chunk_pool_get_chunk(&pool_, *chunk_index);
+}
+
+void
+Domain::release_chunk(size_t chunk_index)
+{
+  if (RMW_RET_OK != rmw_shared_memory_chunk_pool_release(&pool_, chunk_index)) {
+    // Only chunks reclaimed from a process that died cannot be released.
+    rmw_reset_error();
+  }
+}
+
+void *
+Domain::get_chunk(size_t chunk_index) const
+{
+  return rmw_shared_memory_chunk_pool_get_chunk(&pool_, chunk_index);
+}
+
+bool
+Domain::get_chunk_index(const void * chunk, size_t * chunk_index) const
+{
+  if (RMW_RET_OK != rmw_shared_memory_chunk_pool_get_chunk_index(&pool_, chunk, chunk_index)) {
+    rmw_reset_error();
+    return false;
+  }
+  return true;
+}
+
+void
+Domain::update_matches(const Endpoint * endpoint, EndpointKind kind, Matches & matches)
+{
+  // Taken before looking up, so that a change during the lookup is seen next time.
+  const uint32_t graph_generation = segment_->graph_generation.load(std::memory_order_acquire);
+  if (matches.is_valid && graph_generation == matches.graph_generation) {
+    return;
+  }
+  SegmentLock lock(segment_);
+  const EndpointEntry & self = segment_->endpoints[endpoint->index];
+  matches.entries.clear();
+  for (uint32_t i = 0u; i < max_endpoints; ++i) {
+    const EndpointEntry & entry = segment_->endpoints[i];
+    if (kind != entry.kind || !is_match(self, entry) ||
+      (entry.ignore_local_publications && self.pid == entry.pid &&
+      self.participant_id == entry.participant_id))
+    {
+      continue;
+    }
+    // Entries are reserved for all endpoints, this does not allocate.
+    matches.entries.push_back({i, entry.incarnation.load()});
+  }
+  matches.graph_generation = graph_generation;
+  matches.is_valid = true;
+}
+
+bool
+Domain::push(
+  uint32_t index,
+  uint32_t incarnation,
+  size_t chunk_index,
+  size_t length,
+  rmw_time_point_value_t source_timestamp,
+  int64_t sequence_number,
+  const rmw_gid_t & writer_gid)
+{
+  if (incarnation != segment_->endpoints[index].incarnation.load(std::memory_order_acquire)) {
+    return false;
+  }
+  if (RMW_RET_OK != rmw_shared_memory_chunk_pool_retain(&pool_, chunk_index)) {
+    rmw_reset_error();
+    return false;
+  }
+  const uint64_t reception_sequence_number = segment_->queues[index].push(
+    [&](Cell & cell) {
+      cell.incarnation = incarnation;
+      cell.chunk_index = static_cast<uint32_t>(chunk_index);
+      cell.length = length;
+      cell.source_timestamp = source_timestamp;
+      cell.sequence_number = sequence_number;
+      memcpy(cell.writer_gid, writer_gid.data, sizeof(cell.writer_gid));
+    },
+    [this](Cell & cell, uint64_t) {release_chunk(cell.chunk_index);});
+  if (0u == reception_sequence_number) {
+    release_chunk(chunk_index);
+    return false;
+  }
+  return true;
+}
+
+void
+Domain::publish(Publisher * publisher, size_t chunk_index, size_t length)
+{
+  const rmw_time_point_value_t source_timestamp = now();
+  const int64_t sequence_number = ++publisher->sequence_number;
+  bool is_delivered = false;
+  {
+    std::lock_guard<std::mutex> lock(publisher->subscriptions.mutex);
+    update_matches(publisher, EndpointKind::subscription, publisher->subscriptions);
+    for (const Matches::Match & match : publisher->subscriptions.entries) {
+      is_delivered |= push(
+        match.index, match.incarnation, chunk_index, length, source_timestamp,
+        sequence_number, publisher->gid);
+    }
+  }
+  release_chunk(chunk_index);
+  if (is_delivered) {
+    notify();
+  }
+}
+
+void
+Domain::send_request(
+  Client * client, size_t chunk_index, size_t length, int64_t * sequence_number)
+{
+  const rmw_time_point_value_t source_timestamp = now();
+  *sequence_number = ++client->sequence_number;
+  bool is_delivered = false;
+  {
+    std::lock_guard<std::mutex> lock(client->services.mutex);
+    update_matches(client, EndpointKind::service, client->services);
+    for (const Matches::Match & match : client->services.entries) {
+      is_delivered |= push(
+        match.index, match.incarnation, chunk_index, length, source_timestamp,
+        *sequence_number, client->gid);
+    }
+  }
+  release_chunk(chunk_index);
+  if (is_delivered) {
+    notify();
+  }
+}
+
+void
+Domain::send_response(const rmw_request_id_t & request_id, size_t chunk_index, size_t length)
+{
+  uint32_t index = 0u;
+  uint32_t incarnation = 0u;
+  parse_gid(reinterpret_cast<const uint8_t *>(request_id.writer_guid), &index, &incarnation);
+  bool is_delivered = false;
+  if (index < max_endpoints) {
+    rmw_gid_t client_gid;
+    memset(&client_gid, 0, sizeof(client_gid));
+    client_gid.implementation_identifier = identifier;
+    memcpy(client_gid.data, request_id.writer_guid, sizeof(request_id.writer_guid));
+    is_delivered = push(
+      index, incarnation, chunk_index, length, now(), request_id.sequence_number, client_gid);
+  }
+  release_chunk(chunk_index);
+  if (is_delivered) {
+    notify();
+  }
+}
+
+bool
+Domain::take(const Endpoint * endpoint, Sample * sample)
+{
+  Queue & queue = segment_->queues[endpoint->index];
+  for (;;) {
+    bool is_stale = false;
+    const bool is_popped = queue.pop(
+      [&](Cell & cell, uint64_t reception_sequence_number) {
+        if (endpoint->incarnation != cell.incarnation) {
+          release_chunk(cell.chunk_index);
+          is_stale = true;
+          return;
+        }
+        sample->chunk_index = cell.chunk_index;
+        sample->length = cell.length;
+        sample->source_timestamp = cell.source_timestamp;
+        sample->sequence_number = cell.sequence_number;
+        sample->reception_sequence_number = reception_sequence_number;
+        memset(&sample->writer_gid, 0, sizeof(sample->writer_gid));
+        sample->writer_gid.implementation_identifier = identifier;
+        memcpy(sample->writer_gid.data, cell.writer_gid, sizeof(cell.writer_gid));
+      });
+    if (!is_popped) {
+      return false;
+    }
+    if (!is_stale) {
+      return true;
+    }
+  }
+}
+
+bool
+Domain::has_samples(const Endpoint * endpoint) const
+{
+  return !segment_->queues[endpoint->index].empty();
+}
+
+size_t
+Domain::count_matches(const Endpoint * endpoint, EndpointKind kind)
+{
+  SegmentLock lock(segment_);
+  const EndpointEntry & self = segment_->endpoints[endpoint->index];
+  size_t count = 0u;
+  for (const EndpointEntry & entry : segment_->endpoints) {
+    if (kind == entry.kind && is_match(self, entry)) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+size_t
+Domain::count_matched_subscriptions(const Publisher * publisher)
+{
+  return count_matches(publisher, EndpointKind::subscription);
+}
+
+size_t
+Domain::count_matched_publishers(const Subscription * subscription)
+{
+  return count_matches(subscription, EndpointKind::publisher);
+}
+
+bool
+Domain::is_service_available(const Client * client)
+{
+  return 0u != count_matches(client, EndpointKind::service);
+}
+
+std::vector<rmw_native_common::NodeInfo>
+Domain::get_nodes()
+{
+  std::vector<rmw_native_common::NodeInfo> nodes;
+  SegmentLock lock(segment_);
+  for (const NodeEntry & entry : segment_->nodes) {
+    if (0 != entry.pid) {
+      nodes.push_back({entry.name, entry.namespace_, entry.enclave});
+    }
+  }
+  return nodes;
+}
+
+std::vector<rmw_native_common::EndpointInfo>
+Domain::get_endpoints(rmw_native_common::EndpointKind kind)
+{
+  const EndpointKind segment_kind = to_segment_kind(kind);
+  std::vector<rmw_native_common::EndpointInfo> endpoints;
+  SegmentLock lock(segment_);
+  for (const EndpointEntry & entry : segment_->endpoints) {
+    if (segment_kind != entry.kind) {
+      continue;
+    }
+    const NodeEntry & node = segment_->nodes[entry.node_index];
+    rmw_native_common::EndpointInfo info;
+    info.name = entry.name;
+    info.type_name = entry.type_name;
+    info.node_name = node.name;
+    info.node_namespace = node.namespace_;
+    info.type_hash = entry.type_hash;
+    info.qos = entry.qos;
+    memset(&info.gid, 0, sizeof(info.gid));
+    info.gid.implementation_identifier = identifier;
+    memcpy(info.gid.data, entry.gid, sizeof(entry.gid));
+    endpoints.push_back(std::move(info));
+  }
+  return endpoints;
+}
+
+const std::atomic<uint32_t> &
+Domain::graph_generation() const
+{
+  return segment_->graph_generation;
+}
+
+void
+Domain::notify()
+{
+  segment_->notification_sequence.fetch_add(1u);
+  if (0u != segment_->waiter_count.load()) {
+    (void)futex(&segment_->notification_sequence, FUTEX_WAKE, INT_MAX, nullptr);
+  }
+}
+
+uint32_t
+Domain::begin_wait()
+{
+  segment_->waiter_count.fetch_add(1u);
+  return segment_->notification_sequence.load();
+}
+
+uint32_t
+Domain::wait(uint32_t sequence, const std::chrono::steady_clock::time_point * deadline)
+{
+  timespec timeout;
+  if (nullptr != deadline) {
+    const auto remaining = *deadline - std::chrono::steady_clock::now();
+    if (remaining <= std::chrono::steady_clock::duration::zero()) {
+      return segment_->notification_sequence.load();
+    }
+    const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining);
+    timeout.tv_sec = static_cast<time_t>(nanoseconds.count() / 1000000000);
+    timeout.tv_nsec = static_cast<long>(nanoseconds.count() % 1000000000);
+  }
+  // Returns at once if the sequence changed since it was taken, so no notification is missed.
+  (void)futex(
+    &segment_->notification_sequence, FUTEX_WAIT, sequence,
+    nullptr != deadline ? &timeout : nullptr);
+  return segment_->notification_sequence.load();
+}
+
+void
+Domain::end_wait()
+{
+  segment_->waiter_count.fetch_sub(1u);
+}
+
+}  // namespace rmw_shm_cpp
+
+namespace rmw_native_common
+{
+
+Graph &
+get_graph(const rmw_node_t * node)
+{
+  return *static_cast<rmw_shm_cpp::Node *>(node->data)->domain;
+}
+
+}  // namespace rmw_native_common
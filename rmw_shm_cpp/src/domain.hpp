@@ -0,0 +1,379 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DOMAIN_HPP_
+#define DOMAIN_HPP_
+
+#include <sys/types.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "rmw/init.h"
+#include "rmw/ret_types.h"
+#include "rmw/shared_memory_chunk_pool.h"
+#include "rmw/types.h"
+
+#include "rosidl_runtime_c/type_hash.h"
+
+#include "rmw_native_common/graph.hpp"
+#include "rmw_native_common/type_support.hpp"
+
+#include "./segment.hpp"
+
+namespace rmw_shm_cpp
+{
+
+class Domain;
+
+struct GuardCondition
+{
+  Domain * domain;
+  /// Whether the guard condition was triggered since it was last waited on.
+  std::atomic<bool> triggered{false};
+  /// Graph generation of the domain for graph guard conditions, null for others.
+  const std::atomic<uint32_t> * graph_generation{nullptr};
+  /// Graph generation seen when the graph guard condition was last waited on.
+  std::atomic<uint32_t> last_graph_generation{0u};
+
+  void
+  trigger();
+
+  bool
+  is_triggered() const;
+
+  /// Check whether the guard condition is triggered, resetting it.
+  bool
+  take();
+};
+
+struct Node
+{
+  rmw_context_t * context;
+  Domain * domain;
+  std::string name;
+  std::string namespace_;
+  /// Index of the node entry in the segment.
+  uint32_t index;
+  GuardCondition graph_guard_condition;
+  rmw_guard_condition_t graph_guard_condition_handle;
+};
+
+/// Members shared by publishers, subscriptions, services and clients.
+struct Endpoint
+{
+  Node * node;
+  /// Topic or service name.
+  std::string name;
+  std::string type_name;
+  rosidl_type_hash_t type_hash;
+  rmw_qos_profile_t qos;
+  /// Holds the index and incarnation of the endpoint entry, see Domain::add().
+  rmw_gid_t gid;
+  /// Index and incarnation of the endpoint entry in the segment.
+  uint32_t index;
+  uint32_t incarnation;
+};
+
+/// Endpoint entries matching a publisher or a client, cached until the graph changes.
+struct Matches
+{
+  struct Match
+  {
+    uint32_t index;
+    uint32_t incarnation;
+  };
+
+  Matches()
+  {
+    entries.reserve(max_endpoints);
+  }
+
+  std::mutex mutex;
+  bool is_valid{false};
+  uint32_t graph_generation{0u};
+  std::vector<Match> entries;
+};
+
+struct Publisher : Endpoint
+{
+  const rmw_native_common::MessageMembers * members;
+  /// Whether messages are copied as is rather than serialized, see is_plain().
+  bool is_plain;
+  std::atomic<int64_t> sequence_number{0};
+  Matches subscriptions;
+};
+
+struct Subscription : Endpoint
+{
+  const rmw_native_common::MessageMembers * members;
+  bool is_plain;
+  bool ignore_local_publications;
+};
+
+struct Service : Endpoint
+{
+  const rmw_native_common::ServiceMembers * members;
+};
+
+struct Client : Endpoint
+{
+  const rmw_native_common::ServiceMembers * members;
+  std::atomic<int64_t> sequence_number{0};
+  Matches services;
+};
+
+/// Message, request or response taken out of a queue, holding a reference to its chunk.
+struct Sample
+{
+  size_t chunk_index;
+  size_t length;
+  rmw_time_point_value_t source_timestamp;
+  int64_t sequence_number;
+  uint64_t reception_sequence_number;
+  rmw_gid_t writer_gid;
+};
+
+/// Resolve the system default policies of a QoS profile to the behavior of this implementation.
+/**
+ * Samples are never lost short of history overflow, so reliability is always
+ * reliable, and durability is always volatile as no samples are kept for late
+ * joiners.
+ * Depth is bounded to `max_queue_depth`, and so is keep all history.
+ * Deadline, lifespan and liveliness are not enforced.
+ */
+rmw_qos_profile_t
+resolve_qos(const rmw_qos_profile_t & qos);
+
+/// Entities of all processes of the host using a domain id, which communicate with each other.
+/**
+ * Nodes and endpoints are registered in a named shared memory segment, see
+ * segment.hpp, while messages, requests and responses travel in the chunks of
+ * a shared memory chunk pool.
+ * Publishers hand a reference to the chunk of a message to the queue of each
+ * matching subscription, and so do clients and services with requests and
+ * responses; chunks go back to the pool once the last reference is released.
+ * Matching is done on names, type names and message sizes, QoS are not
+ * checked for compatibility.
+ *
+ * Entities are added and removed under the robust mutex of the segment,
+ * which publishers and clients only take when the graph changed since they
+ * last looked up their matches.
+ * Whenever any entity may have become ready, a futex in the segment wakes up
+ * all waiting threads of all processes.
+ *
+ * A process that dies without detaching is cleaned up by the next process to
+ * attach, see README.md for what is left behind.
+ */
+class Domain : public rmw_native_common::Graph
+{
+public:
+  /// Get the domain with the given id, attaching to its segment, or creating it if needed.
+  /**
+   * \return the domain, or
+   * \return `nullptr`, with an error message set, if its segment could not be attached.
+   */
+  static std::shared_ptr<Domain>
+  get(size_t domain_id);
+
+  ~Domain();
+
+  Domain(const Domain &) = delete;
+  Domain & operator=(const Domain &) = delete;
+
+  /// Register a node, setting its index.
+  /**
+   * \return `RMW_RET_OK` if successful, or
+   * \return `RMW_RET_ERROR`, with an error message set, if there is no room left for it.
+   */
+  rmw_ret_t
+  add(Node * node);
+
+  void
+  remove(Node * node);
+
+  /// Register an endpoint, setting its index, incarnation and GID.
+  /**
+   * \param[in] depth depth of the queue of the endpoint, unused for publishers.
+   * \param[in] message_size size of plain messages, or 0 for serialized ones.
+   * \return `RMW_RET_OK` if successful, or
+   * \return `RMW_RET_ERROR`, with an error message set, if there is no room left for it.
+   */
+  rmw_ret_t
+  add(
+    Endpoint * endpoint,
+    EndpointKind kind,
+    size_t depth,
+    bool ignore_local_publications,
+    size_t message_size);
+
+  void
+  remove(Endpoint * endpoint);
+
+  /// Usable size of the chunks of the pool.
+  size_t
+  chunk_size() const;
+
+  /// Acquire a chunk to hold `length` bytes, holding a single reference to it.
+  /**
+   * \return the address of the chunk, or
+   * \return `nullptr`, with an error message set, if chunks are too small or all in use.
+   */
+  void *
+  acquire_chunk(size_t length, size_t * chunk_index);
+
+  /// Release a reference to a chunk.
+  void
+  release_chunk(size_t chunk_index);
+
+  void *
+  get_chunk(size_t chunk_index) const;
+
+  /// Get the index of a chunk from its address.
+  /**
+   * \return `true` if successful, or
+   * \return `false` if `chunk` is not the address of a chunk of the pool.
+   */
+  bool
+  get_chunk_index(const void * chunk, size_t * chunk_index) const;
+
+  /// Deliver a message to all matching subscriptions, taking over the reference to its chunk.
+  void
+  publish(Publisher * publisher, size_t chunk_index, size_t length);
+
+  /// Deliver a request to all matching services, taking over the reference to its chunk.
+  void
+  send_request(Client * client, size_t chunk_index, size_t length, int64_t * sequence_number);
+
+  /// Deliver a response to the client that sent the request, taking over the reference.
+  /**
+   * Responses to clients that no longer exist are dropped.
+   */
+  void
+  send_response(const rmw_request_id_t & request_id, size_t chunk_index, size_t length);
+
+  /// Take the oldest message, request or response of a subscription, service or client.
+  /**
+   * The reference to the chunk of a taken sample must be released once done with it.
+   *
+   * \return `true` if a sample was taken, or
+   * \return `false` if there is none.
+   */
+  bool
+  take(const Endpoint * endpoint, Sample * sample);
+
+  /// Check whether a subscription, service or client may have a sample to take.
+  bool
+  has_samples(const Endpoint * endpoint) const;
+
+  size_t
+  count_matched_subscriptions(const Publisher * publisher);
+
+  size_t
+  count_matched_publishers(const Subscription * subscription);
+
+  bool
+  is_service_available(const Client * client);
+
+  std::vector<rmw_native_common::NodeInfo>
+  get_nodes() override;
+
+  std::vector<rmw_native_common::EndpointInfo>
+  get_endpoints(rmw_native_common::EndpointKind kind) override;
+
+  const std::atomic<uint32_t> &
+  graph_generation() const;
+
+  /// Wake up all waiting threads, of all processes.
+  void
+  notify();
+
+  /// Register the calling thread as a waiter, see wait().
+  /**
+   * \return the sequence to pass to wait(), to be taken before checking for ready entities.
+   */
+  uint32_t
+  begin_wait();
+
+  /// Block until notified after `sequence` was taken, or until `deadline` if not null.
+  /**
+   * \return the current sequence, to be passed to the next wait() call.
+   */
+  uint32_t
+  wait(uint32_t sequence, const std::chrono::steady_clock::time_point * deadline);
+
+  /// Unregister the calling thread as a waiter.
+  void
+  end_wait();
+
+private:
+  Domain() = default;
+
+  // Attach to or create the segment and the chunk pool, registering this process.
+  rmw_ret_t
+  attach(size_t domain_id);
+
+  // Free the entries of processes that died without detaching, the mutex must be held.
+  // Return whether the graph changed.
+  bool
+  clean_up_dead_processes();
+
+  // Free an endpoint entry, releasing the chunks left in its queue, the mutex must be held.
+  void
+  free_endpoint(uint32_t index);
+
+  // Refresh the entries matching a publisher or a client if the graph changed.
+  void
+  update_matches(const Endpoint * endpoint, EndpointKind kind, Matches & matches);
+
+  // Count the entries matching a publisher, subscription or client.
+  size_t
+  count_matches(const Endpoint * endpoint, EndpointKind kind);
+
+  // Hand a reference to a chunk to the queue of an endpoint entry.
+  bool
+  push(
+    uint32_t index,
+    uint32_t incarnation,
+    size_t chunk_index,
+    size_t length,
+    rmw_time_point_value_t source_timestamp,
+    int64_t sequence_number,
+    const rmw_gid_t & writer_gid);
+
+  pid_t pid_{0};
+  std::string segment_name_;
+  std::string pool_name_;
+  Segment * segment_{nullptr};
+  rmw_shared_memory_chunk_pool_t pool_{rmw_get_zero_initialized_shared_memory_chunk_pool()};
+};
+
+}  // namespace rmw_shm_cpp
+
+/// Implementation defined context, holding the domain shared with other contexts.
+struct rmw_context_impl_s
+{
+  std::shared_ptr<rmw_shm_cpp::Domain> domain;
+  /// Identifier of the context within the process, for ignore_local_publications.
+  uint32_t participant_id{0u};
+  bool is_shutdown{false};
+};
+
+#endif  // DOMAIN_HPP_
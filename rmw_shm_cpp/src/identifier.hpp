@@ -0,0 +1,29 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef IDENTIFIER_HPP_
+#define IDENTIFIER_HPP_
+
+namespace rmw_shm_cpp
+{
+
+/// Identifier of this rmw implementation, set in every handle it creates.
+extern const char * const identifier;
+
+/// Name of the format produced by rmw_serialize(), see rmw_native_common/type_support.hpp.
+extern const char * const serialization_format;
+
+}  // namespace rmw_shm_cpp
+
+#endif  // IDENTIFIER_HPP_
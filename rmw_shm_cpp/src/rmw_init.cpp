@@ -0,0 +1,255 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+#include "rcutils/strdup.h"
+
+#include "rmw/check_type_identifiers_match.h"
+#include "rmw/error_handling.h"
+#include "rmw/features.h"
+#include "rmw/init.h"
+#include "rmw/init_options.h"
+#include "rmw/rmw.h"
+
+#include "./domain.hpp"
+#include "./identifier.hpp"
+
+extern "C"
+{
+const char *
+rmw_get_implementation_identifier(void)
+{
+  return rmw_shm_cpp::identifier;
+}
+
+const char *
+rmw_get_serialization_format(void)
+{
+  return rmw_shm_cpp::serialization_format;
+}
+
+rmw_ret_t
+rmw_init_options_init(rmw_init_options_t * init_options, rcutils_allocator_t allocator)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(init_options, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR(&allocator, return RMW_RET_INVALID_ARGUMENT);
+  if (nullptr != init_options->implementation_identifier) {
+    RMW_SET_ERROR_MSG("expected zero-initialized init_options");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  init_options->instance_id = 0u;
+  init_options->implementation_identifier = rmw_shm_cpp::identifier;
+  init_options->allocator = allocator;
+  init_options->impl = nullptr;
+  init_options->domain_id = RMW_DEFAULT_DOMAIN_ID;
+  init_options->localhost_only = RMW_LOCALHOST_ONLY_DEFAULT;
+  init_options->security_options = rmw_get_default_security_options();
+  init_options->enclave = nullptr;
+  init_options->discovery_options = rmw_get_zero_initialized_discovery_options();
+  return rmw_discovery_options_init(&init_options->discovery_options, 0u, &allocator);
+}
+
+rmw_ret_t
+rmw_init_options_copy(const rmw_init_options_t * src, rmw_init_options_t * dst)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(src, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(dst, RMW_RET_INVALID_ARGUMENT);
+  if (nullptr == src->implementation_identifier) {
+    RMW_SET_ERROR_MSG("expected initialized src");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    src,
+    src->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  if (nullptr != dst->implementation_identifier) {
+    RMW_SET_ERROR_MSG("expected zero-initialized dst");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  const rcutils_allocator_t * allocator = &src->allocator;
+  RCUTILS_CHECK_ALLOCATOR(allocator, return RMW_RET_INVALID_ARGUMENT);
+
+  rmw_init_options_t tmp = *src;
+  tmp.enclave = rcutils_strdup(src->enclave, *allocator);
+  if (nullptr != src->enclave && nullptr == tmp.enclave) {
+    RMW_SET_ERROR_MSG("failed to copy the enclave");
+    return RMW_RET_BAD_ALLOC;
+  }
+  tmp.security_options = rmw_get_zero_initialized_security_options();
+  rmw_ret_t ret =
+    rmw_security_options_copy(&src->security_options, allocator, &tmp.security_options);
+  if (RMW_RET_OK != ret) {
+    allocator->deallocate(tmp.enclave, allocator->state);
+    return ret;
+  }
+  tmp.discovery_options = rmw_get_zero_initialized_discovery_options();
+  rcutils_allocator_t discovery_allocator = *allocator;
+  ret = rmw_discovery_options_copy(
+    &src->discovery_options, &discovery_allocator, &tmp.discovery_options);
+  if (RMW_RET_OK != ret) {
+    allocator->deallocate(tmp.enclave, allocator->state);
+    (void)rmw_security_options_fini(&tmp.security_options, allocator);
+    return ret;
+  }
+  *dst = tmp;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_init_options_fini(rmw_init_options_t * init_options)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(init_options, RMW_RET_INVALID_ARGUMENT);
+  if (nullptr == init_options->implementation_identifier) {
+    RMW_SET_ERROR_MSG("expected initialized init_options");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    init_options,
+    init_options->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  rcutils_allocator_t * allocator = &init_options->allocator;
+  RCUTILS_CHECK_ALLOCATOR(allocator, return RMW_RET_INVALID_ARGUMENT);
+
+  allocator->deallocate(init_options->enclave, allocator->state);
+  rmw_ret_t ret = rmw_security_options_fini(&init_options->security_options, allocator);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  ret = rmw_discovery_options_fini(&init_options->discovery_options);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  *init_options = rmw_get_zero_initialized_init_options();
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_init(const rmw_init_options_t * options, rmw_context_t * context)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(options, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(context, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_FOR_NULL_WITH_MSG(
+    options->implementation_identifier,
+    "expected initialized init options",
+    return RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    options,
+    options->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  if (nullptr != context->implementation_identifier) {
+    RMW_SET_ERROR_MSG("expected a zero-initialized context");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  const size_t domain_id =
+    RMW_DEFAULT_DOMAIN_ID == options->domain_id ? 0u : options->domain_id;
+  std::unique_ptr<rmw_context_impl_s> impl(new (std::nothrow) rmw_context_impl_s());
+  if (nullptr == impl) {
+    RMW_SET_ERROR_MSG("failed to allocate context impl");
+    return RMW_RET_BAD_ALLOC;
+  }
+  try {
+    impl->domain = rmw_shm_cpp::Domain::get(domain_id);
+  } catch (const std::bad_alloc &) {
+    RMW_SET_ERROR_MSG("failed to allocate domain");
+    return RMW_RET_BAD_ALLOC;
+  }
+  if (nullptr == impl->domain) {
+    return RMW_RET_ERROR;
+  }
+  static std::atomic<uint32_t> next_participant_id{1u};
+  impl->participant_id = next_participant_id.fetch_add(1u);
+
+  context->options = rmw_get_zero_initialized_init_options();
+  rmw_ret_t ret = rmw_init_options_copy(options, &context->options);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  context->instance_id = options->instance_id;
+  context->implementation_identifier = rmw_shm_cpp::identifier;
+  context->actual_domain_id = domain_id;
+  context->impl = impl.release();
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_shutdown(rmw_context_t * context)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(context, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_FOR_NULL_WITH_MSG(
+    context->impl,
+    "expected initialized context",
+    return RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    context,
+    context->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  context->impl->is_shutdown = true;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_context_fini(rmw_context_t * context)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(context, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_FOR_NULL_WITH_MSG(
+    context->impl,
+    "expected initialized context",
+    return RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    context,
+    context->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  if (!context->impl->is_shutdown) {
+    RMW_SET_ERROR_MSG("context has not been shutdown");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  rmw_ret_t ret = rmw_init_options_fini(&context->options);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  delete context->impl;
+  *context = rmw_get_zero_initialized_context();
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_set_log_severity(rmw_log_severity_t severity)
+{
+  // Nothing below rmw logs anything.
+  (void)severity;
+  return RMW_RET_OK;
+}
+
+bool
+rmw_feature_supported(rmw_feature_t feature)
+{
+  switch (feature) {
+    case RMW_FEATURE_MESSAGE_INFO_PUBLICATION_SEQUENCE_NUMBER:
+    case RMW_FEATURE_MESSAGE_INFO_RECEPTION_SEQUENCE_NUMBER:
+      return true;
+    default:
+      return false;
+  }
+}
+}  // extern "C"
@@ -0,0 +1,442 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <vector>
+
+#include "rmw/allocators.h"
+#include "rmw/check_type_identifiers_match.h"
+#include "rmw/error_handling.h"
+#include "rmw/get_network_flow_endpoints.h"
+#include "rmw/rmw.h"
+
+#include "rosidl_runtime_c/message_initialization.h"
+
+#include "rmw_native_common/graph.hpp"
+#include "rmw_native_common/type_support.hpp"
+
+#include "./domain.hpp"
+#include "./identifier.hpp"
+
+namespace
+{
+
+rmw_ret_t
+check_publisher(const rmw_publisher_t * publisher)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(publisher, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    publisher,
+    publisher->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  return RMW_RET_OK;
+}
+
+// Get the chunk of a loaned message, setting an error message if it is not one.
+rmw_ret_t
+get_loan_chunk_index(
+  const rmw_publisher_t * publisher,
+  const void * loaned_message,
+  size_t * chunk_index)
+{
+  rmw_ret_t ret = check_publisher(publisher);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  RMW_CHECK_ARGUMENT_FOR_NULL(loaned_message, RMW_RET_INVALID_ARGUMENT);
+  auto impl = static_cast<rmw_shm_cpp::Publisher *>(publisher->data);
+  if (!publisher->can_loan_messages) {
+    RMW_SET_ERROR_MSG("publisher cannot loan messages");
+    return RMW_RET_UNSUPPORTED;
+  }
+  if (!impl->node->domain->get_chunk_index(loaned_message, chunk_index)) {
+    RMW_SET_ERROR_MSG("message was not loaned by this publisher");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  return RMW_RET_OK;
+}
+
+}  // namespace
+
+extern "C"
+{
+rmw_ret_t
+rmw_init_publisher_allocation(
+  const rosidl_message_type_support_t * type_support,
+  const rosidl_runtime_c__Sequence__bound * message_bounds,
+  rmw_publisher_allocation_t * allocation)
+{
+  (void)type_support;
+  (void)message_bounds;
+  (void)allocation;
+  RMW_SET_ERROR_MSG("rmw_init_publisher_allocation is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+
+rmw_ret_t
+rmw_fini_publisher_allocation(rmw_publisher_allocation_t * allocation)
+{
+  (void)allocation;
+  RMW_SET_ERROR_MSG("rmw_fini_publisher_allocation is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+
+rmw_publisher_t *
+rmw_create_publisher(
+  const rmw_node_t * node,
+  const rosidl_message_type_support_t * type_support,
+  const char * topic_name,
+  const rmw_qos_profile_t * qos_profile,
+  const rmw_publisher_options_t * publisher_options)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(node, nullptr);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    node,
+    node->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return nullptr);
+  RMW_CHECK_ARGUMENT_FOR_NULL(type_support, nullptr);
+  RMW_CHECK_ARGUMENT_FOR_NULL(topic_name, nullptr);
+  RMW_CHECK_ARGUMENT_FOR_NULL(qos_profile, nullptr);
+  RMW_CHECK_ARGUMENT_FOR_NULL(publisher_options, nullptr);
+  if (!rmw_native_common::validate_name(topic_name, qos_profile->avoid_ros_namespace_conventions)) {
+    return nullptr;
+  }
+  if (RMW_UNIQUE_NETWORK_FLOW_ENDPOINTS_STRICTLY_REQUIRED ==
+    publisher_options->require_unique_network_flow_endpoints)
+  {
+    RMW_SET_ERROR_MSG("unique network flow endpoints are not supported");
+    return nullptr;
+  }
+  const rmw_native_common::MessageMembers * members =
+    rmw_native_common::get_message_members(type_support);
+  if (nullptr == members) {
+    return nullptr;
+  }
+
+  auto node_impl = static_cast<rmw_shm_cpp::Node *>(node->data);
+  rmw_shm_cpp::Publisher * impl = nullptr;
+  try {
+    impl = new rmw_shm_cpp::Publisher();
+    impl->name = topic_name;
+    impl->type_name = rmw_native_common::get_type_name(members);
+  } catch (const std::bad_alloc &) {
+    delete impl;
+    RMW_SET_ERROR_MSG("failed to allocate publisher impl");
+    return nullptr;
+  }
+  impl->node = node_impl;
+  impl->type_hash = rmw_native_common::get_type_hash(type_support);
+  impl->qos = rmw_shm_cpp::resolve_qos(*qos_profile);
+  impl->members = members;
+  impl->is_plain = rmw_native_common::is_plain(members);
+
+  rmw_publisher_t * publisher = rmw_publisher_allocate();
+  if (nullptr == publisher) {
+    delete impl;
+    RMW_SET_ERROR_MSG("failed to allocate publisher");
+    return nullptr;
+  }
+  publisher->implementation_identifier = rmw_shm_cpp::identifier;
+  publisher->data = impl;
+  publisher->topic_name = impl->name.c_str();
+  publisher->options = *publisher_options;
+  // Plain messages are built in place in a chunk, which subscriptions get as is.
+  publisher->can_loan_messages =
+    impl->is_plain && members->size_of_ <= node_impl->domain->chunk_size();
+  if (RMW_RET_OK != node_impl->domain->add(
+      impl, rmw_shm_cpp::EndpointKind::publisher, 0u, false,
+      impl->is_plain ? members->size_of_ : 0u))
+  {
+    rmw_publisher_free(publisher);
+    delete impl;
+    return nullptr;
+  }
+  return publisher;
+}
+
+rmw_ret_t
+rmw_destroy_publisher(rmw_node_t * node, rmw_publisher_t * publisher)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(node, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(publisher, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    node,
+    node->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    publisher,
+    publisher->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  auto impl = static_cast<rmw_shm_cpp::Publisher *>(publisher->data);
+  impl->node->domain->remove(impl);
+  delete impl;
+  rmw_publisher_free(publisher);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_publish(
+  const rmw_publisher_t * publisher,
+  const void * ros_message,
+  rmw_publisher_allocation_t * allocation)
+{
+  (void)allocation;
+  RMW_CHECK_ARGUMENT_FOR_NULL(publisher, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    publisher,
+    publisher->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  RMW_CHECK_ARGUMENT_FOR_NULL(ros_message, RMW_RET_INVALID_ARGUMENT);
+  auto impl = static_cast<rmw_shm_cpp::Publisher *>(publisher->data);
+  rmw_shm_cpp::Domain * domain = impl->node->domain;
+
+  // Copied once into a chunk, which all matching subscriptions share.
+  const void * data = ros_message;
+  size_t length = impl->members->size_of_;
+  if (!impl->is_plain) {
+    thread_local std::vector<uint8_t> buffer;
+    try {
+      if (!rmw_native_common::serialize_message(impl->members, ros_message, buffer)) {
+        RMW_SET_ERROR_MSG("failed to serialize message");
+        return RMW_RET_ERROR;
+      }
+    } catch (const std::bad_alloc &) {
+      RMW_SET_ERROR_MSG("failed to allocate serialization buffer");
+      return RMW_RET_BAD_ALLOC;
+    }
+    data = buffer.data();
+    length = buffer.size();
+  }
+  size_t chunk_index = 0u;
+  void * chunk = domain->acquire_chunk(length, &chunk_index);
+  if (nullptr == chunk) {
+    return RMW_RET_ERROR;
+  }
+  if (0u != length) {
+    memcpy(chunk, data, length);
+  }
+  domain->publish(impl, chunk_index, length);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_publish_serialized_message(
+  const rmw_publisher_t * publisher,
+  const rmw_serialized_message_t * serialized_message,
+  rmw_publisher_allocation_t * allocation)
+{
+  (void)allocation;
+  RMW_CHECK_ARGUMENT_FOR_NULL(publisher, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    publisher,
+    publisher->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  RMW_CHECK_ARGUMENT_FOR_NULL(serialized_message, RMW_RET_INVALID_ARGUMENT);
+  auto impl = static_cast<rmw_shm_cpp::Publisher *>(publisher->data);
+  rmw_shm_cpp::Domain * domain = impl->node->domain;
+  const size_t length =
+    impl->is_plain ? impl->members->size_of_ : serialized_message->buffer_length;
+  size_t chunk_index = 0u;
+  void * chunk = domain->acquire_chunk(length, &chunk_index);
+  if (nullptr == chunk) {
+    return RMW_RET_ERROR;
+  }
+  if (impl->is_plain) {
+    // Plain messages own no memory, they can be deserialized straight into the chunk.
+    if (!rmw_native_common::deserialize_message(
+        impl->members, serialized_message->buffer, serialized_message->buffer_length, chunk))
+    {
+      domain->release_chunk(chunk_index);
+      RMW_SET_ERROR_MSG("failed to deserialize message");
+      return RMW_RET_ERROR;
+    }
+  } else if (0u != length) {
+    memcpy(chunk, serialized_message->buffer, length);
+  }
+  domain->publish(impl, chunk_index, length);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_borrow_loaned_message(
+  const rmw_publisher_t * publisher,
+  const rosidl_message_type_support_t * type_support,
+  void ** ros_message)
+{
+  rmw_ret_t ret = check_publisher(publisher);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  RMW_CHECK_ARGUMENT_FOR_NULL(type_support, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(ros_message, RMW_RET_INVALID_ARGUMENT);
+  if (nullptr != *ros_message) {
+    RMW_SET_ERROR_MSG("ros_message must point to null");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  auto impl = static_cast<rmw_shm_cpp::Publisher *>(publisher->data);
+  if (!publisher->can_loan_messages) {
+    RMW_SET_ERROR_MSG("publisher cannot loan messages, its type is not plain");
+    return RMW_RET_UNSUPPORTED;
+  }
+  const rmw_native_common::MessageMembers * members =
+    rmw_native_common::get_message_members(type_support);
+  if (nullptr == members) {
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  if (members != impl->members) {
+    RMW_SET_ERROR_MSG("type support does not match the type of the publisher");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+  size_t chunk_index = 0u;
+  void * chunk = impl->node->domain->acquire_chunk(members->size_of_, &chunk_index);
+  if (nullptr == chunk) {
+    return RMW_RET_ERROR;
+  }
+  if (nullptr != members->init_function) {
+    members->init_function(chunk, ROSIDL_RUNTIME_C_MSG_INIT_ALL);
+  }
+  *ros_message = chunk;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_return_loaned_message_from_publisher(
+  const rmw_publisher_t * publisher,
+  void * loaned_message)
+{
+  size_t chunk_index = 0u;
+  rmw_ret_t ret = get_loan_chunk_index(publisher, loaned_message, &chunk_index);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  static_cast<rmw_shm_cpp::Publisher *>(publisher->data)->node->domain->release_chunk(
+    chunk_index);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_publish_loaned_message(
+  const rmw_publisher_t * publisher,
+  void * ros_message,
+  rmw_publisher_allocation_t * allocation)
+{
+  (void)allocation;
+  size_t chunk_index = 0u;
+  rmw_ret_t ret = get_loan_chunk_index(publisher, ros_message, &chunk_index);
+  if (RMW_RET_OK != ret) {
+    return ret;
+  }
+  auto impl = static_cast<rmw_shm_cpp::Publisher *>(publisher->data);
+  // The reference of the loan is handed over, the message is not copied.
+  impl->node->domain->publish(impl, chunk_index, impl->members->size_of_);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_publisher_count_matched_subscriptions(
+  const rmw_publisher_t * publisher,
+  size_t * subscription_count)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(publisher, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    publisher,
+    publisher->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  RMW_CHECK_ARGUMENT_FOR_NULL(subscription_count, RMW_RET_INVALID_ARGUMENT);
+  auto impl = static_cast<rmw_shm_cpp::Publisher *>(publisher->data);
+  *subscription_count = impl->node->domain->count_matched_subscriptions(impl);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_publisher_get_actual_qos(
+  const rmw_publisher_t * publisher,
+  rmw_qos_profile_t * qos)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(publisher, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    publisher,
+    publisher->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  RMW_CHECK_ARGUMENT_FOR_NULL(qos, RMW_RET_INVALID_ARGUMENT);
+  *qos = static_cast<rmw_shm_cpp::Publisher *>(publisher->data)->qos;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_publisher_assert_liveliness(const rmw_publisher_t * publisher)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(publisher, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    publisher,
+    publisher->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  // Liveliness is not enforced.
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_publisher_wait_for_all_acked(
+  const rmw_publisher_t * publisher,
+  rmw_time_t wait_timeout)
+{
+  (void)wait_timeout;
+  RMW_CHECK_ARGUMENT_FOR_NULL(publisher, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    publisher,
+    publisher->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  // Messages are in subscription queues by the time rmw_publish() returns.
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_get_gid_for_publisher(const rmw_publisher_t * publisher, rmw_gid_t * gid)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(publisher, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    publisher,
+    publisher->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  RMW_CHECK_ARGUMENT_FOR_NULL(gid, RMW_RET_INVALID_ARGUMENT);
+  *gid = static_cast<rmw_shm_cpp::Publisher *>(publisher->data)->gid;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_publisher_get_network_flow_endpoints(
+  const rmw_publisher_t * publisher,
+  rcutils_allocator_t * allocator,
+  rmw_network_flow_endpoint_array_t * network_flow_endpoint_array)
+{
+  (void)publisher;
+  (void)allocator;
+  (void)network_flow_endpoint_array;
+  RMW_SET_ERROR_MSG("rmw_publisher_get_network_flow_endpoints is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+}  // extern "C"
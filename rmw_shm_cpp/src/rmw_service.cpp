@@ -0,0 +1,248 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <vector>
+
+#include "rcutils/time.h"
+
+#include "rmw/allocators.h"
+#include "rmw/check_type_identifiers_match.h"
+#include "rmw/error_handling.h"
+#include "rmw/rmw.h"
+
+#include "rmw_native_common/graph.hpp"
+#include "rmw_native_common/type_support.hpp"
+
+#include "./domain.hpp"
+#include "./identifier.hpp"
+
+extern "C"
+{
+rmw_service_t *
+rmw_create_service(
+  const rmw_node_t * node,
+  const rosidl_service_type_support_t * type_support,
+  const char * service_name,
+  const rmw_qos_profile_t * qos_profile)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(node, nullptr);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    node,
+    node->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return nullptr);
+  RMW_CHECK_ARGUMENT_FOR_NULL(type_support, nullptr);
+  RMW_CHECK_ARGUMENT_FOR_NULL(service_name, nullptr);
+  RMW_CHECK_ARGUMENT_FOR_NULL(qos_profile, nullptr);
+  if (!rmw_native_common::validate_name(
+      service_name, qos_profile->avoid_ros_namespace_conventions))
+  {
+    return nullptr;
+  }
+  const rmw_native_common::ServiceMembers * members =
+    rmw_native_common::get_service_members(type_support);
+  if (nullptr == members) {
+    return nullptr;
+  }
+
+  auto node_impl = static_cast<rmw_shm_cpp::Node *>(node->data);
+  rmw_shm_cpp::Service * impl = nullptr;
+  try {
+    impl = new rmw_shm_cpp::Service();
+    impl->name = service_name;
+    impl->type_name = rmw_native_common::get_type_name(members);
+  } catch (const std::bad_alloc &) {
+    delete impl;
+    RMW_SET_ERROR_MSG("failed to allocate service impl");
+    return nullptr;
+  }
+  impl->node = node_impl;
+  impl->type_hash = rmw_native_common::get_type_hash(type_support);
+  impl->qos = rmw_shm_cpp::resolve_qos(*qos_profile);
+  impl->members = members;
+
+  rmw_service_t * service = rmw_service_allocate();
+  if (nullptr == service) {
+    delete impl;
+    RMW_SET_ERROR_MSG("failed to allocate service");
+    return nullptr;
+  }
+  service->implementation_identifier = rmw_shm_cpp::identifier;
+  service->data = impl;
+  service->service_name = impl->name.c_str();
+  if (RMW_RET_OK != node_impl->domain->add(
+      impl, rmw_shm_cpp::EndpointKind::service, impl->qos.depth, false, 0u))
+  {
+    rmw_service_free(service);
+    delete impl;
+    return nullptr;
+  }
+  return service;
+}
+
+rmw_ret_t
+rmw_destroy_service(rmw_node_t * node, rmw_service_t * service)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(node, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(service, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    node,
+    node->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    service,
+    service->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  auto impl = static_cast<rmw_shm_cpp::Service *>(service->data);
+  impl->node->domain->remove(impl);
+  delete impl;
+  rmw_service_free(service);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_take_request(
+  const rmw_service_t * service,
+  rmw_service_info_t * request_header,
+  void * ros_request,
+  bool * taken)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(service, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    service,
+    service->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  RMW_CHECK_ARGUMENT_FOR_NULL(request_header, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(ros_request, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(taken, RMW_RET_INVALID_ARGUMENT);
+  auto impl = static_cast<rmw_shm_cpp::Service *>(service->data);
+  rmw_shm_cpp::Domain * domain = impl->node->domain;
+  *taken = false;
+  rmw_shm_cpp::Sample sample;
+  if (!domain->take(impl, &sample)) {
+    return RMW_RET_OK;
+  }
+  const bool is_deserialized = rmw_native_common::deserialize_message(
+    impl->members->request_members_,
+    static_cast<const uint8_t *>(domain->get_chunk(sample.chunk_index)), sample.length,
+    ros_request);
+  domain->release_chunk(sample.chunk_index);
+  if (!is_deserialized) {
+    RMW_SET_ERROR_MSG("failed to deserialize request");
+    return RMW_RET_ERROR;
+  }
+  request_header->source_timestamp = sample.source_timestamp;
+  rcutils_time_point_value_t received_timestamp = 0;
+  (void)rcutils_system_time_now(&received_timestamp);
+  request_header->received_timestamp = received_timestamp;
+  // The client is identified by its GID, which is what the response is routed with.
+  memcpy(
+    request_header->request_id.writer_guid, sample.writer_gid.data,
+    sizeof(request_header->request_id.writer_guid));
+  request_header->request_id.sequence_number = sample.sequence_number;
+  *taken = true;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_send_response(
+  const rmw_service_t * service,
+  rmw_request_id_t * request_header,
+  void * ros_response)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(service, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    service,
+    service->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  RMW_CHECK_ARGUMENT_FOR_NULL(request_header, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_ARGUMENT_FOR_NULL(ros_response, RMW_RET_INVALID_ARGUMENT);
+  auto impl = static_cast<rmw_shm_cpp::Service *>(service->data);
+
+  thread_local std::vector<uint8_t> buffer;
+  try {
+    if (!rmw_native_common::serialize_message(
+        impl->members->response_members_, ros_response, buffer))
+    {
+      RMW_SET_ERROR_MSG("failed to serialize response");
+      return RMW_RET_ERROR;
+    }
+  } catch (const std::bad_alloc &) {
+    RMW_SET_ERROR_MSG("failed to allocate serialization buffer");
+    return RMW_RET_BAD_ALLOC;
+  }
+  size_t chunk_index = 0u;
+  void * chunk = impl->node->domain->acquire_chunk(buffer.size(), &chunk_index);
+  if (nullptr == chunk) {
+    return RMW_RET_ERROR;
+  }
+  if (!buffer.empty()) {
+    memcpy(chunk, buffer.data(), buffer.size());
+  }
+  impl->node->domain->send_response(*request_header, chunk_index, buffer.size());
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_service_request_subscription_get_actual_qos(
+  const rmw_service_t * service,
+  rmw_qos_profile_t * qos)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(service, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    service,
+    service->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  RMW_CHECK_ARGUMENT_FOR_NULL(qos, RMW_RET_INVALID_ARGUMENT);
+  *qos = static_cast<rmw_shm_cpp::Service *>(service->data)->qos;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_service_response_publisher_get_actual_qos(
+  const rmw_service_t * service,
+  rmw_qos_profile_t * qos)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(service, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    service,
+    service->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  RMW_CHECK_ARGUMENT_FOR_NULL(qos, RMW_RET_INVALID_ARGUMENT);
+  *qos = static_cast<rmw_shm_cpp::Service *>(service->data)->qos;
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_service_set_on_new_request_callback(
+  rmw_service_t * service,
+  rmw_event_callback_t callback,
+  const void * user_data)
+{
+  (void)service;
+  (void)callback;
+  (void)user_data;
+  RMW_SET_ERROR_MSG("rmw_service_set_on_new_request_callback is not supported");
+  return RMW_RET_UNSUPPORTED;
+}
+}  // extern "C"
@@ -0,0 +1,200 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstddef>
+
+#include "rmw/allocators.h"
+#include "rmw/check_type_identifiers_match.h"
+#include "rmw/error_handling.h"
+#include "rmw/rmw.h"
+#include "rmw/time.h"
+
+#include "./domain.hpp"
+#include "./identifier.hpp"
+
+namespace
+{
+
+// Check readiness without consuming anything, so that it can be repeated until something is ready.
+bool
+is_any_ready(
+  const rmw_subscriptions_t * subscriptions,
+  const rmw_guard_conditions_t * guard_conditions,
+  const rmw_services_t * services,
+  const rmw_clients_t * clients)
+{
+  if (nullptr != subscriptions) {
+    for (size_t i = 0u; i < subscriptions->subscriber_count; ++i) {
+      auto subscription = static_cast<rmw_shm_cpp::Subscription *>(
+        subscriptions->subscribers[i]);
+      if (subscription->node->domain->has_samples(subscription)) {
+        return true;
+      }
+    }
+  }
+  if (nullptr != guard_conditions) {
+    for (size_t i = 0u; i < guard_conditions->guard_condition_count; ++i) {
+      auto guard_condition = static_cast<rmw_shm_cpp::GuardCondition *>(
+        guard_conditions->guard_conditions[i]);
+      if (guard_condition->is_triggered()) {
+        return true;
+      }
+    }
+  }
+  if (nullptr != services) {
+    for (size_t i = 0u; i < services->service_count; ++i) {
+      auto service = static_cast<rmw_shm_cpp::Service *>(services->services[i]);
+      if (service->node->domain->has_samples(service)) {
+        return true;
+      }
+    }
+  }
+  if (nullptr != clients) {
+    for (size_t i = 0u; i < clients->client_count; ++i) {
+      auto client = static_cast<rmw_shm_cpp::Client *>(clients->clients[i]);
+      if (client->node->domain->has_samples(client)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+extern "C"
+{
+rmw_wait_set_t *
+rmw_create_wait_set(rmw_context_t * context, size_t max_conditions)
+{
+  (void)max_conditions;
+  RMW_CHECK_ARGUMENT_FOR_NULL(context, nullptr);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    context,
+    context->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return nullptr);
+  RMW_CHECK_ARGUMENT_FOR_NULL(context->impl, nullptr);
+  rmw_wait_set_t * wait_set = rmw_wait_set_allocate();
+  if (nullptr == wait_set) {
+    RMW_SET_ERROR_MSG("failed to allocate wait set");
+    return nullptr;
+  }
+  wait_set->implementation_identifier = rmw_shm_cpp::identifier;
+  wait_set->guard_conditions = nullptr;
+  // Entities are waited on as given to rmw_wait(), the wait set only holds the domain they
+  // are notified through.
+  wait_set->data = context->impl->domain.get();
+  return wait_set;
+}
+
+rmw_ret_t
+rmw_destroy_wait_set(rmw_wait_set_t * wait_set)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(wait_set, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    wait_set,
+    wait_set->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+  rmw_wait_set_free(wait_set);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+rmw_wait(
+  rmw_subscriptions_t * subscriptions,
+  rmw_guard_conditions_t * guard_conditions,
+  rmw_services_t * services,
+  rmw_clients_t * clients,
+  rmw_events_t * events,
+  rmw_wait_set_t * wait_set,
+  const rmw_time_t * wait_timeout)
+{
+  RMW_CHECK_ARGUMENT_FOR_NULL(wait_set, RMW_RET_INVALID_ARGUMENT);
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    wait_set,
+    wait_set->implementation_identifier,
+    rmw_shm_cpp::identifier,
+    return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+
+  // A timeout too large to be represented is as good as no timeout.
+  std::chrono::steady_clock::time_point deadline;
+  const std::chrono::steady_clock::time_point * deadline_ptr = nullptr;
+  if (nullptr != wait_timeout) {
+    const auto now = std::chrono::steady_clock::now();
+    const std::chrono::nanoseconds timeout(rmw_time_total_nsec(*wait_timeout));
+    if (timeout < std::chrono::steady_clock::time_point::max() - now) {
+      deadline = now + timeout;
+      deadline_ptr = &deadline;
+    }
+  }
+
+  // Taking the sequence before checking readiness guarantees that no notification is missed.
+  auto domain = static_cast<rmw_shm_cpp::Domain *>(wait_set->data);
+  uint32_t sequence = domain->begin_wait();
+  bool is_ready = is_any_ready(subscriptions, guard_conditions, services, clients);
+  while (!is_ready) {
+    if (nullptr != deadline_ptr && std::chrono::steady_clock::now() >= deadline) {
+      break;
+    }
+    sequence = domain->wait(sequence, deadline_ptr);
+    is_ready = is_any_ready(subscriptions, guard_conditions, services, clients);
+  }
+  domain->end_wait();
+
+  if (nullptr != subscriptions) {
+    for (size_t i = 0u; i < subscriptions->subscriber_count; ++i) {
+      auto subscription = static_cast<rmw_shm_cpp::Subscription *>(
+        subscriptions->subscribers[i]);
+      if (!subscription->node->domain->has_samples(subscription)) {
+        subscriptions->subscribers[i] = nullptr;
+      }
+    }
+  }
+  if (nullptr != guard_conditions) {
+    for (size_t i = 0u; i < guard_conditions->guard_condition_count; ++i) {
+      auto guard_condition = static_cast<rmw_shm_cpp::GuardCondition *>(
+        guard_conditions->guard_conditions[i]);
+      if (!guard_condition->take()) {
+        guard_conditions->guard_conditions[i] = nullptr;
+      }
+    }
+  }
+  if (nullptr != services) {
+    for (size_t i = 0u; i < services->service_count; ++i) {
+      auto service = static_cast<rmw_shm_cpp::Service *>(services->services[i]);
+      if (!service->node->domain->has_samples(service)) {
+        services->services[i] = nullptr;
+      }
+    }
+  }
+  if (nullptr != clients) {
+    for (size_t i = 0u; i < clients->client_count; ++i) {
+      auto client = static_cast<rmw_shm_cpp::Client *>(clients->clients[i]);
+      if (!client->node->domain->has_samples(client)) {
+        clients->clients[i] = nullptr;
+      }
+    }
+  }
+  // Events are not supported, so none of them can ever be ready.
+  if (nullptr != events) {
+    for (size_t i = 0u; i < events->event_count; ++i) {
+      events->events[i] = nullptr;
+    }
+  }
+  return is_ready ? RMW_RET_OK : RMW_RET_TIMEOUT;
+}
+}  // extern "C"
@@ -0,0 +1,257 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SEGMENT_HPP_
+#define SEGMENT_HPP_
+
+#include <pthread.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#include "rmw/types.h"
+
+#include "rosidl_runtime_c/type_hash.h"
+
+namespace rmw_shm_cpp
+{
+
+// Layout of the shared memory segment of a domain, which all processes using
+// the domain map.
+// Everything in it must be address free: no pointers, and atomics that are
+// always lock free.
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "32 bits atomics must be lock free");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "64 bits atomics must be lock free");
+
+/// Value of Segment::magic once the segment is initialized, "rmwshm01".
+constexpr uint64_t segment_magic = 0x31306d6873776d72u;
+
+/// Maximum number of processes, nodes, and endpoints of all kinds in a domain.
+constexpr size_t max_processes = 64u;
+constexpr size_t max_nodes = 256u;
+constexpr size_t max_endpoints = 512u;
+
+/// Maximum length of node names, namespaces, enclaves, topic and type names, null included.
+constexpr size_t max_name_length = 256u;
+
+/// Maximum depth of queues, which keep all history is bounded to.
+constexpr size_t max_queue_depth = 128u;
+
+enum class EndpointKind : uint32_t
+{
+  none,
+  publisher,
+  subscription,
+  service,
+  client,
+};
+
+struct NodeEntry
+{
+  /// Process the node belongs to, or 0 if the entry is free.
+  int32_t pid;
+  char name[max_name_length];
+  char namespace_[max_name_length];
+  char enclave[max_name_length];
+};
+
+struct EndpointEntry
+{
+  /// Incremented whenever the entry is taken or freed, to tell apart its successive endpoints.
+  std::atomic<uint32_t> incarnation;
+  /// Kind of the endpoint, or none if the entry is free.
+  EndpointKind kind;
+  int32_t pid;
+  /// Context of the endpoint within its process, for ignore_local_publications.
+  uint32_t participant_id;
+  uint32_t node_index;
+  bool ignore_local_publications;
+  /// Size of plain messages, or 0 if messages are serialized.
+  uint64_t message_size;
+  rosidl_type_hash_t type_hash;
+  rmw_qos_profile_t qos;
+  uint8_t gid[RMW_GID_STORAGE_SIZE];
+  char name[max_name_length];
+  char type_name[max_name_length];
+};
+
+/// Reference to a chunk holding a message, request or response, in a queue.
+struct Cell
+{
+  std::atomic<uint64_t> sequence;
+  /// Incarnation of the endpoint the chunk was pushed to, stale ones are dropped when popped.
+  uint32_t incarnation;
+  uint32_t chunk_index;
+  uint64_t length;
+  rmw_time_point_value_t source_timestamp;
+  /// Publication sequence number, or sequence number of the request for services.
+  int64_t sequence_number;
+  /// GID of the publisher, or of the client for requests and responses.
+  uint8_t writer_gid[RMW_GID_STORAGE_SIZE];
+};
+
+/// Bounded multi-producer multi-consumer queue of chunk references, keeping the last ones only.
+/**
+ * This is the same algorithm as the queues of rmw_loopback_cpp, over a fixed
+ * number of cells so that it can live in shared memory.
+ * Positions are never reset, so that producers still pushing to a previous
+ * endpoint of the entry cannot corrupt the queue.
+ *
+ * As processes may die at any time, waiting on a cell is bounded: a queue
+ * that cannot make progress drops what is pushed to it.
+ */
+struct Queue
+{
+  /// One spare cell tells a full queue apart from a cell still being read.
+  static constexpr size_t capacity = max_queue_depth + 1u;
+
+  /// Number of times a cell is waited on before giving up.
+  static constexpr size_t max_attempts = 1000u;
+
+  void
+  init()
+  {
+    enqueue_position.store(0u, std::memory_order_relaxed);
+    dequeue_position.store(0u, std::memory_order_relaxed);
+    depth.store(1u, std::memory_order_relaxed);
+    for (size_t i = 0u; i < capacity; ++i) {
+      cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  /// Push a cell filled in place by `fill(Cell &)`, dropping the oldest one if needed.
+  /**
+   * Dropped cells are handed to `drop(Cell &, uint64_t)`, as popped.
+   *
+   * \return the reception sequence number of the cell, starting at 1, or
+   * \return 0 if the queue could not make progress and nothing was pushed.
+   */
+  template<typename FillT, typename DropT>
+  uint64_t
+  push(FillT && fill, DropT && drop)
+  {
+    Cell * cell = nullptr;
+    uint64_t position = enqueue_position.load(std::memory_order_relaxed);
+    for (size_t attempt = 0u;; ++attempt) {
+      if (attempt >= max_attempts) {
+        return 0u;
+      }
+      if (position >= dequeue_position.load(std::memory_order_acquire) +
+        depth.load(std::memory_order_relaxed))
+      {
+        (void)pop(drop);
+        position = enqueue_position.load(std::memory_order_relaxed);
+        continue;
+      }
+      cell = &cells[position % capacity];
+      const uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+      const int64_t difference = static_cast<int64_t>(sequence - position);
+      if (0 == difference) {
+        if (enqueue_position.compare_exchange_weak(
+            position, position + 1u, std::memory_order_relaxed))
+        {
+          break;
+        }
+      } else {
+        if (difference < 0) {
+          // The cell is still being read, which does not take long.
+          std::this_thread::yield();
+        }
+        position = enqueue_position.load(std::memory_order_relaxed);
+      }
+    }
+    fill(*cell);
+    cell->sequence.store(position + 1u, std::memory_order_release);
+    return position + 1u;
+  }
+
+  /// Pop the oldest cell, handing it to `consume(Cell &, uint64_t)` before recycling it.
+  /**
+   * The second argument is the reception sequence number of the cell.
+   *
+   * \return `true` if a cell was popped, or
+   * \return `false` if the queue is empty.
+   */
+  template<typename ConsumeT>
+  bool
+  pop(ConsumeT && consume)
+  {
+    Cell * cell = nullptr;
+    uint64_t position = dequeue_position.load(std::memory_order_relaxed);
+    for (;;) {
+      cell = &cells[position % capacity];
+      const uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+      const int64_t difference = static_cast<int64_t>(sequence - (position + 1u));
+      if (0 == difference) {
+        if (dequeue_position.compare_exchange_weak(
+            position, position + 1u, std::memory_order_relaxed))
+        {
+          break;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = dequeue_position.load(std::memory_order_relaxed);
+      }
+    }
+    consume(*cell, position + 1u);
+    cell->sequence.store(position + capacity, std::memory_order_release);
+    return true;
+  }
+
+  /// Check whether no cell is ready to be popped.
+  bool
+  empty() const
+  {
+    const uint64_t position = dequeue_position.load(std::memory_order_acquire);
+    return cells[position % capacity].sequence.load(std::memory_order_acquire) != position + 1u;
+  }
+
+  // Positions are on their own cache lines, producers and consumers do not share them.
+  alignas(64) std::atomic<uint64_t> enqueue_position;
+  alignas(64) std::atomic<uint64_t> dequeue_position;
+  /// Maximum number of cells kept, set when the entry is taken.
+  std::atomic<uint64_t> depth;
+  Cell cells[capacity];
+};
+
+struct Segment
+{
+  /// segment_magic once the segment is initialized, written last.
+  std::atomic<uint64_t> magic;
+  /// Size of this struct, which tells apart incompatible layouts.
+  uint64_t size;
+  /// Robust process shared mutex guarding the tables below.
+  pthread_mutex_t mutex;
+  /// Set by the last process to detach, once it unlinked the segment.
+  bool is_unlinked;
+  /// Processes attached to the segment, 0 for free entries.
+  int32_t pids[max_processes];
+  NodeEntry nodes[max_nodes];
+  EndpointEntry endpoints[max_endpoints];
+  /// Incremented whenever nodes or endpoints are added or removed.
+  alignas(64) std::atomic<uint32_t> graph_generation;
+  /// Futex word incremented whenever any entity may have become ready.
+  alignas(64) std::atomic<uint32_t> notification_sequence;
+  /// Number of threads waiting on notification_sequence, of all processes.
+  std::atomic<uint32_t> waiter_count;
+  Queue queues[max_endpoints];
+};
+
+}  // namespace rmw_shm_cpp
+
+#endif  // SEGMENT_HPP_
@@ -0,0 +1,48 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TEST_COMMON_HPP_
+#define TEST_COMMON_HPP_
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+
+#include "rmw_native_common/testing/node_test.hpp"
+#include "rmw_native_common/testing/type_supports.hpp"
+
+namespace test_common
+{
+
+using rmw_native_common::testing::Message;
+using rmw_native_common::testing::init_message;
+using rmw_native_common::testing::fini_message;
+using rmw_native_common::testing::PlainMessage;
+using rmw_native_common::testing::AddTwoIntsRequest;
+using rmw_native_common::testing::AddTwoIntsResponse;
+using rmw_native_common::testing::get_message_type_support;
+using rmw_native_common::testing::get_plain_message_type_support;
+using rmw_native_common::testing::get_service_type_support;
+
+/// Fixture providing an initialized context and a node.
+/**
+ * Each test executable uses a domain of its own, so that tests running in
+ * parallel do not see each other.
+ */
+template<size_t DomainId>
+using ShmTest = rmw_native_common::testing::NodeTest<DomainId>;
+
+}  // namespace test_common
+
+#endif  // TEST_COMMON_HPP_
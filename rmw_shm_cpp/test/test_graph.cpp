@@ -0,0 +1,27 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "rmw_native_common/testing/graph_tests.hpp"
+
+namespace rmw_native_common
+{
+namespace testing
+{
+
+INSTANTIATE_TYPED_TEST_SUITE_P(Shm, TestGraph, DomainIdParam<104u>);
+
+}  // namespace testing
+}  // namespace rmw_native_common
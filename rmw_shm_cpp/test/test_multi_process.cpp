@@ -0,0 +1,222 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <gtest/gtest.h>
+
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include "rcutils/allocator.h"
+#include "rcutils/strdup.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/init.h"
+#include "rmw/init_options.h"
+#include "rmw/qos_profiles.h"
+#include "rmw/rmw.h"
+
+#include "./test_common.hpp"
+
+// Processes are forked before any context is initialized, as they would be started on their own.
+// Children report failures through their exit status, as they cannot use gtest assertions.
+
+namespace
+{
+
+constexpr size_t domain_id = 105u;
+
+struct Participant
+{
+  rmw_context_t context = rmw_get_zero_initialized_context();
+  rmw_node_t * node{nullptr};
+
+  bool
+  init(const char * node_name)
+  {
+    rmw_init_options_t options = rmw_get_zero_initialized_init_options();
+    if (RMW_RET_OK != rmw_init_options_init(&options, rcutils_get_default_allocator())) {
+      return false;
+    }
+    options.domain_id = domain_id;
+    options.enclave = rcutils_strdup("/", rcutils_get_default_allocator());
+    rmw_ret_t ret = rmw_init(&options, &context);
+    if (RMW_RET_OK != rmw_init_options_fini(&options) || RMW_RET_OK != ret) {
+      return false;
+    }
+    node = rmw_create_node(&context, node_name, "/test_ns");
+    return nullptr != node;
+  }
+
+  bool
+  fini()
+  {
+    return RMW_RET_OK == rmw_destroy_node(node) && RMW_RET_OK == rmw_shutdown(&context) &&
+           RMW_RET_OK == rmw_context_fini(&context);
+  }
+};
+
+// Publish a loaned plain message once a subscription is matched.
+int
+run_publisher()
+{
+  Participant participant;
+  if (!participant.init("publisher_node")) {
+    return 1;
+  }
+  rmw_publisher_options_t options = rmw_get_default_publisher_options();
+  rmw_publisher_t * publisher = rmw_create_publisher(
+    participant.node, test_common::get_plain_message_type_support(), "/chatter",
+    &rmw_qos_profile_default, &options);
+  if (nullptr == publisher) {
+    return 2;
+  }
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  size_t count = 0u;
+  while (0u == count) {
+    if (RMW_RET_OK != rmw_publisher_count_matched_subscriptions(publisher, &count) ||
+      std::chrono::steady_clock::now() > deadline)
+    {
+      return 3;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  void * loaned_message = nullptr;
+  if (RMW_RET_OK != rmw_borrow_loaned_message(
+      publisher, test_common::get_plain_message_type_support(), &loaned_message))
+  {
+    return 4;
+  }
+  auto message = static_cast<test_common::PlainMessage *>(loaned_message);
+  message->count = 42;
+  for (size_t i = 0u; i < 16u; ++i) {
+    message->values[i] = static_cast<double>(i);
+  }
+  if (RMW_RET_OK != rmw_publish_loaned_message(publisher, loaned_message, nullptr)) {
+    return 5;
+  }
+  if (RMW_RET_OK != rmw_destroy_publisher(participant.node, publisher) || !participant.fini()) {
+    return 6;
+  }
+  return 0;
+}
+
+int
+wait_for_exit_status(pid_t pid)
+{
+  int status = 0;
+  if (pid != waitpid(pid, &status, 0)) {
+    return -1;
+  }
+  return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+}  // namespace
+
+TEST(TestMultiProcess, loaned_message) {
+  const pid_t pid = fork();
+  ASSERT_NE(-1, pid);
+  if (0 == pid) {
+    _exit(run_publisher());
+  }
+
+  Participant participant;
+  ASSERT_TRUE(participant.init("subscription_node")) << rmw_get_error_string().str;
+  rmw_subscription_options_t options = rmw_get_default_subscription_options();
+  rmw_subscription_t * subscription = rmw_create_subscription(
+    participant.node, test_common::get_plain_message_type_support(), "/chatter",
+    &rmw_qos_profile_default, &options);
+  ASSERT_NE(nullptr, subscription) << rmw_get_error_string().str;
+  rmw_wait_set_t * wait_set = rmw_create_wait_set(&participant.context, 0u);
+  ASSERT_NE(nullptr, wait_set) << rmw_get_error_string().str;
+
+  // Notifications cross processes too.
+  void * subscription_handles[] = {subscription->data};
+  rmw_subscriptions_t subscriptions = {1u, subscription_handles};
+  rmw_time_t timeout = {10u, 0u};
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_wait(&subscriptions, nullptr, nullptr, nullptr, nullptr, wait_set, &timeout));
+  void * loaned_message = nullptr;
+  bool taken = false;
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_take_loaned_message(subscription, &loaned_message, &taken, nullptr)) <<
+    rmw_get_error_string().str;
+  ASSERT_TRUE(taken);
+  auto message = static_cast<const test_common::PlainMessage *>(loaned_message);
+  EXPECT_EQ(42, message->count);
+  for (size_t i = 0u; i < 16u; ++i) {
+    EXPECT_EQ(static_cast<double>(i), message->values[i]);
+  }
+  EXPECT_EQ(
+    RMW_RET_OK, rmw_return_loaned_message_from_subscription(subscription, loaned_message));
+  EXPECT_EQ(0, wait_for_exit_status(pid));
+
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_wait_set(wait_set));
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_subscription(participant.node, subscription));
+  EXPECT_TRUE(participant.fini());
+}
+
+TEST(TestMultiProcess, dead_process) {
+  int pipe_fds[2];
+  ASSERT_EQ(0, pipe(pipe_fds));
+  const pid_t pid = fork();
+  ASSERT_NE(-1, pid);
+  if (0 == pid) {
+    close(pipe_fds[0]);
+    Participant participant;
+    rmw_publisher_options_t options = rmw_get_default_publisher_options();
+    if (!participant.init("doomed_node") ||
+      nullptr == rmw_create_publisher(
+        participant.node, test_common::get_message_type_support(), "/doomed",
+        &rmw_qos_profile_default, &options))
+    {
+      _exit(1);
+    }
+    // Die without cleaning up anything, once the parent knows about the publisher.
+    const char ready = 1;
+    if (1 != write(pipe_fds[1], &ready, 1)) {
+      _exit(2);
+    }
+    while (true) {
+      pause();
+    }
+  }
+  close(pipe_fds[1]);
+  char ready = 0;
+  ASSERT_EQ(1, read(pipe_fds[0], &ready, 1));
+  close(pipe_fds[0]);
+
+  Participant participant;
+  ASSERT_TRUE(participant.init("survivor_node")) << rmw_get_error_string().str;
+  size_t count = 0u;
+  EXPECT_EQ(RMW_RET_OK, rmw_count_publishers(participant.node, "/doomed", &count));
+  EXPECT_EQ(1u, count);
+
+  ASSERT_EQ(0, kill(pid, SIGKILL));
+  int status = 0;
+  ASSERT_EQ(pid, waitpid(pid, &status, 0));
+  // Entries of dead processes are cleaned up by the next process registering a node.
+  rmw_node_t * node = rmw_create_node(&participant.context, "other_node", "/test_ns");
+  ASSERT_NE(nullptr, node) << rmw_get_error_string().str;
+  EXPECT_EQ(RMW_RET_OK, rmw_count_publishers(participant.node, "/doomed", &count));
+  EXPECT_EQ(0u, count);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_node(node));
+  EXPECT_TRUE(participant.fini());
+}
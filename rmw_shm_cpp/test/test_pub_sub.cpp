@@ -0,0 +1,423 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/message_sequence.h"
+#include "rmw/qos_profiles.h"
+#include "rmw/rmw.h"
+#include "rmw/serialized_message.h"
+#include "rmw/subscription_content_filter_options.h"
+
+#include "./test_common.hpp"
+
+using test_common::Message;
+using test_common::PlainMessage;
+
+class TestPubSub : public test_common::ShmTest<101u>
+{
+protected:
+  void
+  SetUp() override
+  {
+    NodeTest::SetUp();
+    ASSERT_TRUE(test_common::init_message(&message));
+    ASSERT_TRUE(test_common::init_message(&received));
+  }
+
+  void
+  TearDown() override
+  {
+    test_common::fini_message(&message);
+    test_common::fini_message(&received);
+    NodeTest::TearDown();
+  }
+
+  rmw_publisher_t *
+  create_publisher(
+    const rmw_qos_profile_t & qos = rmw_qos_profile_default,
+    const rosidl_message_type_support_t * type_support = test_common::get_message_type_support())
+  {
+    rmw_publisher_options_t options = rmw_get_default_publisher_options();
+    return rmw_create_publisher(node, type_support, "/chatter", &qos, &options);
+  }
+
+  rmw_subscription_t *
+  create_subscription(
+    const rmw_qos_profile_t & qos = rmw_qos_profile_default,
+    bool ignore_local_publications = false,
+    const rosidl_message_type_support_t * type_support = test_common::get_message_type_support())
+  {
+    rmw_subscription_options_t options = rmw_get_default_subscription_options();
+    options.ignore_local_publications = ignore_local_publications;
+    return rmw_create_subscription(node, type_support, "/chatter", &qos, &options);
+  }
+
+  Message message;
+  Message received;
+};
+
+TEST_F(TestPubSub, publish_take) {
+  rmw_publisher_t * publisher = create_publisher();
+  ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+  rmw_subscription_t * subscription = create_subscription();
+  ASSERT_NE(nullptr, subscription) << rmw_get_error_string().str;
+
+  size_t count = 0u;
+  EXPECT_EQ(RMW_RET_OK, rmw_publisher_count_matched_subscriptions(publisher, &count));
+  EXPECT_EQ(1u, count);
+  EXPECT_EQ(RMW_RET_OK, rmw_subscription_count_matched_publishers(subscription, &count));
+  EXPECT_EQ(1u, count);
+
+  bool taken = true;
+  EXPECT_EQ(RMW_RET_OK, rmw_take(subscription, &received, &taken, nullptr));
+  EXPECT_FALSE(taken);
+
+  message.count = 7;
+  ASSERT_TRUE(rosidl_runtime_c__String__assign(&message.text, "hello"));
+  for (int32_t i = 1; i <= 2; ++i) {
+    message.value = i;
+    ASSERT_EQ(RMW_RET_OK, rmw_publish(publisher, &message, nullptr)) <<
+      rmw_get_error_string().str;
+  }
+
+  rmw_gid_t gid;
+  ASSERT_EQ(RMW_RET_OK, rmw_get_gid_for_publisher(publisher, &gid));
+  for (int32_t i = 1; i <= 2; ++i) {
+    rmw_message_info_t message_info = rmw_get_zero_initialized_message_info();
+    ASSERT_EQ(
+      RMW_RET_OK, rmw_take_with_info(subscription, &received, &taken, &message_info, nullptr)) <<
+      rmw_get_error_string().str;
+    ASSERT_TRUE(taken);
+    EXPECT_EQ(7, received.count);
+    EXPECT_EQ(i, received.value);
+    EXPECT_EQ(std::string("hello"), received.text.data);
+    EXPECT_EQ(static_cast<uint64_t>(i), message_info.publication_sequence_number);
+    EXPECT_EQ(static_cast<uint64_t>(i), message_info.reception_sequence_number);
+    EXPECT_NE(0, message_info.source_timestamp);
+    EXPECT_FALSE(message_info.from_intra_process);
+    bool is_equal = false;
+    EXPECT_EQ(RMW_RET_OK, rmw_compare_gids_equal(&gid, &message_info.publisher_gid, &is_equal));
+    EXPECT_TRUE(is_equal);
+  }
+  EXPECT_EQ(RMW_RET_OK, rmw_take(subscription, &received, &taken, nullptr));
+  EXPECT_FALSE(taken);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_subscription(node, subscription));
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_publisher(node, publisher));
+}
+
+TEST_F(TestPubSub, keep_last) {
+  rmw_qos_profile_t qos = rmw_qos_profile_default;
+  qos.depth = 2u;
+  rmw_publisher_t * publisher = create_publisher();
+  ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+  rmw_subscription_t * subscription = create_subscription(qos);
+  ASSERT_NE(nullptr, subscription) << rmw_get_error_string().str;
+
+  rmw_qos_profile_t actual_qos;
+  EXPECT_EQ(RMW_RET_OK, rmw_subscription_get_actual_qos(subscription, &actual_qos));
+  EXPECT_EQ(2u, actual_qos.depth);
+  EXPECT_EQ(RMW_QOS_POLICY_RELIABILITY_RELIABLE, actual_qos.reliability);
+  EXPECT_EQ(RMW_QOS_POLICY_DURABILITY_VOLATILE, actual_qos.durability);
+
+  for (int32_t i = 1; i <= 3; ++i) {
+    message.count = i;
+    ASSERT_EQ(RMW_RET_OK, rmw_publish(publisher, &message, nullptr));
+  }
+  // The oldest message was dropped, and the reception sequence numbers show it.
+  for (int32_t i = 2; i <= 3; ++i) {
+    bool taken = false;
+    rmw_message_info_t message_info = rmw_get_zero_initialized_message_info();
+    ASSERT_EQ(
+      RMW_RET_OK, rmw_take_with_info(subscription, &received, &taken, &message_info, nullptr));
+    ASSERT_TRUE(taken);
+    EXPECT_EQ(i, received.count);
+    EXPECT_EQ(static_cast<uint64_t>(i), message_info.reception_sequence_number);
+  }
+
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_subscription(node, subscription));
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_publisher(node, publisher));
+}
+
+TEST_F(TestPubSub, ignore_local_publications) {
+  rmw_publisher_t * publisher = create_publisher();
+  ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+  rmw_subscription_t * subscription = create_subscription(rmw_qos_profile_default, true);
+  ASSERT_NE(nullptr, subscription) << rmw_get_error_string().str;
+
+  ASSERT_EQ(RMW_RET_OK, rmw_publish(publisher, &message, nullptr));
+  bool taken = true;
+  EXPECT_EQ(RMW_RET_OK, rmw_take(subscription, &received, &taken, nullptr));
+  EXPECT_FALSE(taken);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_subscription(node, subscription));
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_publisher(node, publisher));
+}
+
+TEST_F(TestPubSub, take_sequence) {
+  rmw_publisher_t * publisher = create_publisher();
+  ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+  rmw_subscription_t * subscription = create_subscription();
+  ASSERT_NE(nullptr, subscription) << rmw_get_error_string().str;
+
+  constexpr size_t capacity = 4u;
+  Message messages[capacity];
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rmw_message_sequence_t message_sequence = rmw_get_zero_initialized_message_sequence();
+  ASSERT_EQ(RMW_RET_OK, rmw_message_sequence_init(&message_sequence, capacity, &allocator));
+  rmw_message_info_sequence_t message_info_sequence =
+    rmw_get_zero_initialized_message_info_sequence();
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_message_info_sequence_init(&message_info_sequence, capacity, &allocator));
+  for (size_t i = 0u; i < capacity; ++i) {
+    ASSERT_TRUE(test_common::init_message(&messages[i]));
+    message_sequence.data[i] = &messages[i];
+  }
+
+  for (int32_t i = 1; i <= 3; ++i) {
+    message.count = i;
+    ASSERT_EQ(RMW_RET_OK, rmw_publish(publisher, &message, nullptr));
+  }
+  size_t taken = 0u;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_take_sequence(
+      subscription, capacity + 1u, &message_sequence, &message_info_sequence, &taken, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_take_sequence(
+      subscription, capacity, &message_sequence, &message_info_sequence, &taken, nullptr));
+  EXPECT_EQ(3u, taken);
+  EXPECT_EQ(3u, message_sequence.size);
+  EXPECT_EQ(3u, message_info_sequence.size);
+  for (size_t i = 0u; i < taken; ++i) {
+    EXPECT_EQ(static_cast<int32_t>(i + 1u), messages[i].count);
+    EXPECT_EQ(i + 1u, message_info_sequence.data[i].publication_sequence_number);
+  }
+
+  for (size_t i = 0u; i < capacity; ++i) {
+    test_common::fini_message(&messages[i]);
+  }
+  EXPECT_EQ(RMW_RET_OK, rmw_message_info_sequence_fini(&message_info_sequence));
+  EXPECT_EQ(RMW_RET_OK, rmw_message_sequence_fini(&message_sequence));
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_subscription(node, subscription));
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_publisher(node, publisher));
+}
+
+TEST_F(TestPubSub, serialized_messages) {
+  rmw_publisher_t * publisher = create_publisher();
+  ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+  rmw_subscription_t * subscription = create_subscription();
+  ASSERT_NE(nullptr, subscription) << rmw_get_error_string().str;
+
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rmw_serialized_message_t serialized_message = rmw_get_zero_initialized_serialized_message();
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_init(&serialized_message, 0u, &allocator));
+  message.count = 11;
+  ASSERT_TRUE(rosidl_runtime_c__String__assign(&message.text, "serialized"));
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_serialize(&message, test_common::get_message_type_support(), &serialized_message)) <<
+    rmw_get_error_string().str;
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_publish_serialized_message(publisher, &serialized_message, nullptr));
+
+  // Taking a serialized message grows the buffer as needed.
+  rmw_serialized_message_t taken_message = rmw_get_zero_initialized_serialized_message();
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_init(&taken_message, 0u, &allocator));
+  bool taken = false;
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_take_serialized_message(subscription, &taken_message, &taken, nullptr)) <<
+    rmw_get_error_string().str;
+  ASSERT_TRUE(taken);
+  ASSERT_EQ(serialized_message.buffer_length, taken_message.buffer_length);
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_deserialize(&taken_message, test_common::get_message_type_support(), &received));
+  EXPECT_EQ(11, received.count);
+  EXPECT_EQ(std::string("serialized"), received.text.data);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_fini(&taken_message));
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_fini(&serialized_message));
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_subscription(node, subscription));
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_publisher(node, publisher));
+}
+
+TEST_F(TestPubSub, unsupported_features) {
+  rmw_subscription_options_t options = rmw_get_default_subscription_options();
+  rmw_subscription_content_filter_options_t content_filter_options =
+    rmw_get_zero_initialized_content_filter_options();
+  options.content_filter_options = &content_filter_options;
+  EXPECT_EQ(
+    nullptr,
+    rmw_create_subscription(
+      node, test_common::get_message_type_support(), "/chatter", &rmw_qos_profile_default,
+      &options));
+  rmw_reset_error();
+
+  // Messages with strings or sequences cannot be loaned.
+  rmw_publisher_t * publisher = create_publisher();
+  ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+  EXPECT_FALSE(publisher->can_loan_messages);
+  void * loaned_message = nullptr;
+  EXPECT_EQ(
+    RMW_RET_UNSUPPORTED,
+    rmw_borrow_loaned_message(
+      publisher, test_common::get_message_type_support(), &loaned_message));
+  rmw_reset_error();
+  rmw_subscription_t * subscription = create_subscription();
+  ASSERT_NE(nullptr, subscription) << rmw_get_error_string().str;
+  EXPECT_FALSE(subscription->can_loan_messages);
+  bool taken = false;
+  EXPECT_EQ(
+    RMW_RET_UNSUPPORTED,
+    rmw_take_loaned_message(subscription, &loaned_message, &taken, nullptr));
+  rmw_reset_error();
+
+  EXPECT_EQ(
+    RMW_RET_UNSUPPORTED,
+    rmw_subscription_set_on_new_message_callback(subscription, nullptr, nullptr));
+  rmw_reset_error();
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_subscription(node, subscription));
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_publisher(node, publisher));
+}
+
+TEST_F(TestPubSub, loaned_messages) {
+  const rosidl_message_type_support_t * type_support =
+    test_common::get_plain_message_type_support();
+  rmw_publisher_t * publisher = create_publisher(rmw_qos_profile_default, type_support);
+  ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+  EXPECT_TRUE(publisher->can_loan_messages);
+  rmw_subscription_t * subscription =
+    create_subscription(rmw_qos_profile_default, false, type_support);
+  ASSERT_NE(nullptr, subscription) << rmw_get_error_string().str;
+  EXPECT_TRUE(subscription->can_loan_messages);
+
+  void * loaned_message = nullptr;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_borrow_loaned_message(
+      publisher, test_common::get_message_type_support(), &loaned_message));
+  rmw_reset_error();
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_borrow_loaned_message(publisher, type_support, &loaned_message)) <<
+    rmw_get_error_string().str;
+  ASSERT_NE(nullptr, loaned_message);
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_borrow_loaned_message(publisher, type_support, &loaned_message));
+  rmw_reset_error();
+  auto plain_message = static_cast<PlainMessage *>(loaned_message);
+  plain_message->count = 42;
+  plain_message->values[15] = 1.5;
+  ASSERT_EQ(RMW_RET_OK, rmw_publish_loaned_message(publisher, loaned_message, nullptr)) <<
+    rmw_get_error_string().str;
+
+  // The subscription gets the very memory the publisher wrote to.
+  void * taken_message = nullptr;
+  bool taken = false;
+  rmw_message_info_t message_info = rmw_get_zero_initialized_message_info();
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_take_loaned_message_with_info(
+      subscription, &taken_message, &taken, &message_info, nullptr)) <<
+    rmw_get_error_string().str;
+  ASSERT_TRUE(taken);
+  EXPECT_EQ(loaned_message, taken_message);
+  EXPECT_EQ(42, static_cast<PlainMessage *>(taken_message)->count);
+  EXPECT_EQ(1.5, static_cast<PlainMessage *>(taken_message)->values[15]);
+  EXPECT_EQ(1u, message_info.publication_sequence_number);
+  EXPECT_EQ(
+    RMW_RET_OK, rmw_return_loaned_message_from_subscription(subscription, taken_message));
+  int64_t not_loaned = 0;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_return_loaned_message_from_subscription(subscription, &not_loaned));
+  rmw_reset_error();
+
+  // Loans that are not published are returned, and plain messages can still be copied.
+  loaned_message = nullptr;
+  ASSERT_EQ(RMW_RET_OK, rmw_borrow_loaned_message(publisher, type_support, &loaned_message));
+  EXPECT_EQ(
+    RMW_RET_OK, rmw_return_loaned_message_from_publisher(publisher, loaned_message));
+  PlainMessage message{};
+  message.count = 7;
+  ASSERT_EQ(RMW_RET_OK, rmw_publish(publisher, &message, nullptr));
+  PlainMessage received{};
+  ASSERT_EQ(RMW_RET_OK, rmw_take(subscription, &received, &taken, nullptr));
+  ASSERT_TRUE(taken);
+  EXPECT_EQ(7, received.count);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_subscription(node, subscription));
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_publisher(node, publisher));
+}
+
+TEST_F(TestPubSub, plain_serialized_messages) {
+  const rosidl_message_type_support_t * type_support =
+    test_common::get_plain_message_type_support();
+  rmw_publisher_t * publisher = create_publisher(rmw_qos_profile_default, type_support);
+  ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+  rmw_subscription_t * subscription =
+    create_subscription(rmw_qos_profile_default, false, type_support);
+  ASSERT_NE(nullptr, subscription) << rmw_get_error_string().str;
+
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rmw_serialized_message_t serialized_message = rmw_get_zero_initialized_serialized_message();
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_init(&serialized_message, 0u, &allocator));
+  PlainMessage message{};
+  message.count = 3;
+  message.values[0] = -2.5;
+  ASSERT_EQ(RMW_RET_OK, rmw_serialize(&message, type_support, &serialized_message));
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_publish_serialized_message(publisher, &serialized_message, nullptr)) <<
+    rmw_get_error_string().str;
+
+  // Stored as plain messages, taken back as serialized ones.
+  void * loaned_message = nullptr;
+  bool taken = false;
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_take_loaned_message(subscription, &loaned_message, &taken, nullptr));
+  ASSERT_TRUE(taken);
+  EXPECT_EQ(3, static_cast<PlainMessage *>(loaned_message)->count);
+  EXPECT_EQ(
+    RMW_RET_OK, rmw_return_loaned_message_from_subscription(subscription, loaned_message));
+
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_publish_serialized_message(publisher, &serialized_message, nullptr));
+  rmw_serialized_message_t taken_message = rmw_get_zero_initialized_serialized_message();
+  ASSERT_EQ(RMW_RET_OK, rmw_serialized_message_init(&taken_message, 0u, &allocator));
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_take_serialized_message(subscription, &taken_message, &taken, nullptr)) <<
+    rmw_get_error_string().str;
+  ASSERT_TRUE(taken);
+  ASSERT_EQ(serialized_message.buffer_length, taken_message.buffer_length);
+  PlainMessage received{};
+  ASSERT_EQ(RMW_RET_OK, rmw_deserialize(&taken_message, type_support, &received));
+  EXPECT_EQ(3, received.count);
+  EXPECT_EQ(-2.5, received.values[0]);
+
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_fini(&taken_message));
+  EXPECT_EQ(RMW_RET_OK, rmw_serialized_message_fini(&serialized_message));
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_subscription(node, subscription));
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_publisher(node, publisher));
+}